@@ -0,0 +1,782 @@
+// Copyright 2026 Aepelzen's Parasites contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Golden-output regression test of the DSP cores.
+//
+// Usage: regression [-u] [-t tolerance] [-e sample tolerance] [fingerprints file]
+//
+// Renders a deterministic stimulus through every feature mode and carrier
+// shape of the Warps modulator, through the sample rate converters, through
+// every shape of the carrier oscillator bank, and through every feature mode,
+// generator mode and range of the Tides generator. Each output channel is cut
+// into blocks, and each block is summarized by its RMS level and by its energy
+// in 8 octave bands, in dB. A few short runs of samples of each channel are
+// also kept as they are.
+//
+// The fingerprints are compared with the reference file (by default
+// regression/fingerprints.txt, relative to the parasites directory), and the
+// test fails if any level deviates by more than the tolerance (1 dB by
+// default), or if any of the kept samples differs by more than the sample
+// tolerance (0.01 of full scale by default). Renders which are bit-exact are
+// reported as such. With -u, the reference file is written instead: do so
+// when a change is meant to alter the sound.
+//
+// The references depend on the stmlib sources the cores are built with. They
+// are written by "make -f regression/makefile update" on a tree with the
+// stmlib submodule checked out.
+
+#include <getopt.h>
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "stmlib/utils/random.h"
+
+#include "tides/generator.h"
+#include "warps/dsp/doppler_bank.h"
+#include "warps/dsp/modulator.h"
+#include "warps/dsp/oscillator_bank.h"
+#include "warps/dsp/sample_rate_converter.h"
+
+#pragma GCC diagnostic ignored "-Wclass-memaccess"
+
+using namespace std;
+using namespace stmlib;
+
+const size_t kFingerprintBlockSize = 8192;
+const size_t kNumBands = 8;
+const float kFloorDb = -80.0f;
+// Runs of samples kept from each channel, evenly spread over the render.
+const size_t kNumProbeRuns = 8;
+const size_t kProbeRunSize = 8;
+
+struct BlockFingerprint {
+  float rms;
+  float bands[kNumBands];
+};
+
+struct Fingerprint {
+  uint32_t hash;
+  vector<BlockFingerprint> blocks;
+  vector<float> probes;
+};
+
+// Deterministic noise, independent from stmlib::Random.
+class Lcg {
+ public:
+  Lcg(uint32_t seed) : state_(seed) { }
+
+  inline float Next() {
+    state_ = state_ * 1664525L + 1013904223L;
+    return static_cast<float>(static_cast<int32_t>(state_)) / 2147483648.0f;
+  }
+
+ private:
+  uint32_t state_;
+};
+
+float ToDb(double energy) {
+  float db = energy > 0.0 ? 10.0f * log10(energy) : kFloorDb;
+  return max(db, kFloorDb);
+}
+
+void Fft(vector<complex<double> >* data) {
+  vector<complex<double> >& x = *data;
+  size_t n = x.size();
+  for (size_t i = 1, j = 0; i < n; ++i) {
+    size_t bit = n >> 1;
+    for (; j & bit; bit >>= 1) {
+      j ^= bit;
+    }
+    j ^= bit;
+    if (i < j) {
+      swap(x[i], x[j]);
+    }
+  }
+  for (size_t length = 2; length <= n; length <<= 1) {
+    complex<double> w_length = polar(1.0, -2.0 * M_PI / length);
+    for (size_t i = 0; i < n; i += length) {
+      complex<double> w(1.0);
+      for (size_t j = 0; j < length / 2; ++j) {
+        complex<double> u = x[i + j];
+        complex<double> v = x[i + j + length / 2] * w;
+        x[i + j] = u + v;
+        x[i + j + length / 2] = u - v;
+        w *= w_length;
+      }
+    }
+  }
+}
+
+// Signal levels are relative to full scale. Band k covers the octave below
+// Nyquist / 2^k, the last band everything below.
+BlockFingerprint ComputeBlockFingerprint(const float* samples) {
+  BlockFingerprint fingerprint;
+  vector<complex<double> > spectrum(kFingerprintBlockSize);
+  double energy = 0.0;
+  for (size_t i = 0; i < kFingerprintBlockSize; ++i) {
+    double s = samples[i];
+    energy += s * s;
+    double window = 0.5 - 0.5 * cos(2.0 * M_PI * i / kFingerprintBlockSize);
+    spectrum[i] = s * window;
+  }
+  fingerprint.rms = ToDb(energy / kFingerprintBlockSize);
+  Fft(&spectrum);
+
+  size_t high = kFingerprintBlockSize / 2;
+  for (size_t band = 0; band < kNumBands; ++band) {
+    size_t low = band == kNumBands - 1 ? 1 : high / 2;
+    double band_energy = 0.0;
+    for (size_t i = low; i < high; ++i) {
+      band_energy += norm(spectrum[i]);
+    }
+    // Hann window power gain is 3/8.
+    band_energy /= 0.375 * kFingerprintBlockSize * kFingerprintBlockSize / 2;
+    fingerprint.bands[band] = ToDb(band_energy);
+    high = low;
+  }
+  return fingerprint;
+}
+
+// Fingerprints of the channels of a render, one after the other.
+void ComputeFingerprint(
+    const vector<float>* channels,
+    size_t num_channels,
+    Fingerprint* fingerprint) {
+  fingerprint->hash = 2166136261u;
+  fingerprint->blocks.clear();
+  fingerprint->probes.clear();
+  for (size_t c = 0; c < num_channels; ++c) {
+    const vector<float>& samples = channels[c];
+    for (size_t i = 0; i < samples.size(); ++i) {
+      uint32_t bits;
+      memcpy(&bits, &samples[i], sizeof(bits));
+      fingerprint->hash = (fingerprint->hash ^ bits) * 16777619u;
+    }
+    for (size_t i = 0;
+         i + kFingerprintBlockSize <= samples.size();
+         i += kFingerprintBlockSize) {
+      fingerprint->blocks.push_back(ComputeBlockFingerprint(&samples[i]));
+    }
+    if (samples.size() < kNumProbeRuns * kProbeRunSize) {
+      continue;
+    }
+    for (size_t run = 0; run < kNumProbeRuns; ++run) {
+      size_t start = (2 * run + 1) * samples.size() / (2 * kNumProbeRuns);
+      start = min(start, samples.size() - kProbeRunSize);
+      fingerprint->probes.insert(
+          fingerprint->probes.end(),
+          samples.begin() + start,
+          samples.begin() + start + kProbeRunSize);
+    }
+  }
+}
+
+// Stereo test signal: a chord with a slow vibrato on the left channel, a
+// chirp gated on and off on the right channel, a bit of noise on both.
+void RenderStimulus(warps::ShortFrame* frames, size_t size, float sample_rate) {
+  Lcg noise(0x21);
+  double phase[3] = { 0.0, 0.0, 0.0 };
+  for (size_t i = 0; i < size; ++i) {
+    double t = i / sample_rate;
+    double vibrato = 1.0 + 0.01 * sin(2.0 * M_PI * 5.0 * t);
+    phase[0] += 110.0 * vibrato / sample_rate;
+    phase[1] += 164.8 * vibrato / sample_rate;
+    phase[2] += (100.0 + 4000.0 * t) / sample_rate;
+    float l = 0.3f * sin(2.0 * M_PI * phase[0]) +
+        0.2f * sin(2.0 * M_PI * phase[1]) + 0.01f * noise.Next();
+    float gate = fmod(t, 0.25) < 0.18 ? 1.0f : 0.0f;
+    float r = 0.5f * gate * sin(2.0 * M_PI * phase[2]) + 0.01f * noise.Next();
+    frames[i].l = static_cast<short>(l * 32767.0f);
+    frames[i].r = static_cast<short>(r * 32767.0f);
+  }
+}
+
+typedef void (*RenderFn)(int32_t variant, vector<float>* channels);
+
+struct Case {
+  string name;
+  RenderFn render;
+  int32_t variant;
+};
+
+const float kWarpsSampleRate = 96000.0f;
+const size_t kWarpsBlockSize = 60;
+const size_t kWarpsNumFrames = 48000;
+
+const char* kFeatureModeNames[] = {
+  "doppler", "fold", "chebyschev", "frequency_shifter", "bitcrusher",
+  "comparator", "vocoder", "delay", "meta"
+};
+
+const int32_t kLookaheadLimiterVariant = 0x100;
+const int32_t kDelaySyncVariant = 0x200;
+const int32_t kDelayTapsVariant = 0x400;
+const size_t kNumDelayTaps = 3;
+
+// variant = feature mode * 4 + carrier shape, plus kLookaheadLimiterVariant
+// for the look-ahead vocoder limiter, kDelaySyncVariant for a delay time
+// which jumps between three values in the middle of blocks, or
+// kDelayTapsVariant for three extra read heads, whose times jump halfway
+// through the render, of which the left channel of the first one and the
+// right channel of the last one are rendered instead of the output. The algorithm and timbre controls sweep their whole range
+// during the render.
+void RenderModulator(int32_t variant, vector<float>* channels) {
+  bool lookahead_limiter = variant & kLookaheadLimiterVariant;
+  bool delay_sync = variant & kDelaySyncVariant;
+  bool delay_taps = variant & kDelayTapsVariant;
+  variant &= ~(kLookaheadLimiterVariant | kDelaySyncVariant |
+               kDelayTapsVariant);
+  warps::FeatureMode mode = static_cast<warps::FeatureMode>(variant / 4);
+  int32_t carrier_shape = variant % 4;
+
+  vector<warps::ShortFrame> input(kWarpsNumFrames);
+  vector<warps::ShortFrame> output(kWarpsNumFrames);
+  RenderStimulus(&input[0], kWarpsNumFrames, kWarpsSampleRate);
+
+  warps::Modulator* modulator = new warps::Modulator;
+  memset(modulator, 0, sizeof(*modulator));
+  modulator->Init(kWarpsSampleRate);
+  modulator->set_feature_mode(mode);
+  modulator->set_lookahead_limiter(lookahead_limiter);
+  for (size_t i = 0; i < kWarpsNumFrames; i += kWarpsBlockSize) {
+    float x = static_cast<float>(i) / kWarpsNumFrames;
+    warps::Parameters* p = modulator->mutable_parameters();
+    p->carrier_shape = carrier_shape;
+    p->channel_drive[0] = 0.6f;
+    p->channel_drive[1] = 0.7f;
+    p->modulation_algorithm = x;
+    p->modulation_parameter = 0.5f + 0.4f * sinf(2.0f * M_PI * x);
+    p->raw_level[0] = 0.6f;
+    p->raw_level[1] = 0.7f;
+    p->raw_algorithm_pot = x;
+    p->raw_algorithm_cv = 0.0f;
+    p->raw_algorithm = x;
+    p->note = 36.0f + 24.0f * x;
+    if (delay_sync) {
+      const size_t kPeriod = 9000;
+      size_t beat = i / kPeriod;
+      size_t offset = beat * kPeriod + kPeriod - i;
+      if (offset < kWarpsBlockSize) {
+        ++beat;
+      } else {
+        offset = 0;
+      }
+      modulator->set_delay_time(1500.0f + 2500.0f * (beat % 3), offset);
+    }
+    if (delay_taps) {
+      warps::DelayTap taps[kNumDelayTaps];
+      for (size_t t = 0; t < kNumDelayTaps; ++t) {
+        taps[t].time = 2000.0f * (t + 1) + 500.0f * sinf(2.0f * M_PI * x * t);
+        taps[t].time += x < 0.5f ? 0.0f : 1000.0f;
+        taps[t].level = 1.0f - 0.2f * t;
+        taps[t].pan = sinf(2.0f * M_PI * x + t);
+      }
+      modulator->set_delay_taps(taps, kNumDelayTaps);
+    }
+    modulator->Process(&input[i], &output[i], kWarpsBlockSize);
+    if (delay_taps) {
+      const warps::ShortFrame* first = modulator->delay_tap_output(0);
+      const warps::ShortFrame* last = modulator->delay_tap_output(
+          kNumDelayTaps - 1);
+      for (size_t j = 0; j < kWarpsBlockSize; ++j) {
+        output[i + j].l = first[j].l;
+        output[i + j].r = last[j].r;
+      }
+    }
+  }
+  delete modulator;
+
+  for (size_t c = 0; c < 2; ++c) {
+    channels[c].resize(kWarpsNumFrames);
+  }
+  for (size_t i = 0; i < kWarpsNumFrames; ++i) {
+    channels[0][i] = output[i].l / 32768.0f;
+    channels[1][i] = output[i].r / 32768.0f;
+  }
+}
+
+// Round trip through the 6x converters used by the modulator.
+void RenderSampleRateConverter(int32_t variant, vector<float>* channels) {
+  warps::SampleRateConverter<warps::SRC_UP, 6, 48> src_up;
+  warps::SampleRateConverter<warps::SRC_DOWN, 6, 48> src_down;
+  src_up.Init();
+  src_down.Init();
+
+  vector<warps::ShortFrame> input(kWarpsNumFrames);
+  RenderStimulus(&input[0], kWarpsNumFrames, kWarpsSampleRate);
+  channels[0].resize(kWarpsNumFrames);
+  for (size_t i = 0; i < kWarpsNumFrames; i += kWarpsBlockSize) {
+    float in[kWarpsBlockSize];
+    float oversampled[kWarpsBlockSize * 6];
+    for (size_t j = 0; j < kWarpsBlockSize; ++j) {
+      in[j] = input[i + j].r / 32768.0f;
+    }
+    src_up.Process(in, oversampled, kWarpsBlockSize);
+    src_down.Process(oversampled, &channels[0][i], kWarpsBlockSize * 6);
+  }
+}
+
+const char* kOscillatorShapeNames[] = {
+  "sine", "triangle", "saw", "pulse", "noise"
+};
+
+// variant = oscillator shape. Six voices, so that the last group of lanes is
+// partly used, at different pitches, with the stimulus as phase modulation.
+// The first and the last voice are fingerprinted.
+void RenderOscillatorBank(int32_t variant, vector<float>* channels) {
+  const size_t kNumVoices = 6;
+  warps::OscillatorShape shape = static_cast<warps::OscillatorShape>(variant);
+
+  vector<warps::ShortFrame> input(kWarpsNumFrames);
+  RenderStimulus(&input[0], kWarpsNumFrames, kWarpsSampleRate);
+
+  warps::OscillatorBank* bank = new warps::OscillatorBank;
+  bank->Init(kWarpsSampleRate);
+  Random::Seed(0x21);
+
+  for (size_t c = 0; c < 2; ++c) {
+    channels[c].resize(kWarpsNumFrames);
+  }
+  for (size_t i = 0; i < kWarpsNumFrames; i += kWarpsBlockSize) {
+    float x = static_cast<float>(i) / kWarpsNumFrames;
+    float note[kNumVoices];
+    float modulation[kNumVoices][kWarpsBlockSize];
+    float out[kNumVoices][kWarpsBlockSize];
+    float gain[kNumVoices];
+    float* modulation_ptr[kNumVoices];
+    float* out_ptr[kNumVoices];
+    for (size_t v = 0; v < kNumVoices; ++v) {
+      note[v] = 24.0f + 12.0f * v + 24.0f * x;
+      for (size_t j = 0; j < kWarpsBlockSize; ++j) {
+        modulation[v][j] = input[i + j].l / 32768.0f;
+      }
+      modulation_ptr[v] = modulation[v];
+      out_ptr[v] = out[v];
+    }
+    bank->Render(
+        shape, note, modulation_ptr, out_ptr, gain, kNumVoices,
+        kWarpsBlockSize);
+    for (size_t j = 0; j < kWarpsBlockSize; ++j) {
+      channels[0][i + j] = out[0][j] * gain[0];
+      channels[1][i + j] = out[kNumVoices - 1][j] * gain[kNumVoices - 1];
+    }
+  }
+  delete bank;
+}
+
+// variant = carrier shape, which selects the room. Six sources, so that the
+// last group of lanes is partly used, spread across the stereo field and
+// moving at different rates, with the stimulus delayed by a different number
+// of samples as input.
+void RenderDopplerBank(int32_t variant, vector<float>* channels) {
+  const size_t kNumSources = 6;
+
+  vector<warps::ShortFrame> input(kWarpsNumFrames);
+  RenderStimulus(&input[0], kWarpsNumFrames, kWarpsSampleRate);
+
+  warps::DopplerBank* bank = new warps::DopplerBank;
+  warps::DopplerBankArena* arena = new warps::DopplerBankArena;
+  bank->Init(kWarpsSampleRate, arena);
+
+  vector<warps::ShortFrame> output(kWarpsNumFrames);
+  for (size_t i = 0; i < kWarpsNumFrames; i += kWarpsBlockSize) {
+    float x = static_cast<float>(i) / kWarpsNumFrames;
+    warps::Parameters parameters[kNumSources];
+    warps::ShortFrame source_input[kNumSources][kWarpsBlockSize];
+    const warps::ShortFrame* input_ptr[kNumSources];
+    memset(parameters, 0, sizeof(parameters));
+    for (size_t s = 0; s < kNumSources; ++s) {
+      float position = x + static_cast<float>(s) / kNumSources;
+      warps::Parameters* p = &parameters[s];
+      p->carrier_shape = variant;
+      p->channel_drive[0] = 0.1f * s;
+      p->channel_drive[1] = 0.2f;
+      p->raw_algorithm = position - floorf(position);
+      p->modulation_parameter = 0.5f + 0.4f * sinf(2.0f * M_PI * position);
+      for (size_t j = 0; j < kWarpsBlockSize; ++j) {
+        size_t t = i + j >= 97 * s ? i + j - 97 * s : 0;
+        source_input[s][j] = input[t];
+      }
+      input_ptr[s] = source_input[s];
+    }
+    bank->Process(
+        parameters, input_ptr, &output[i], kNumSources, kWarpsBlockSize);
+  }
+  delete arena;
+  delete bank;
+
+  for (size_t c = 0; c < 2; ++c) {
+    channels[c].resize(kWarpsNumFrames);
+  }
+  for (size_t i = 0; i < kWarpsNumFrames; ++i) {
+    channels[0][i] = output[i].l / 32768.0f;
+    channels[1][i] = output[i].r / 32768.0f;
+  }
+}
+
+const uint32_t kTidesSampleRate = 48000;
+const size_t kTidesNumFrames = 48000;
+
+const char* kGeneratorFeatureNames[] = { "function", "harmonic", "random" };
+const char* kGeneratorModeNames[] = { "ad", "looping", "ar" };
+const char* kGeneratorRangeNames[] = { "high", "medium", "low" };
+
+// variant = (feature mode * 3 + generator mode) * 3 + range. Shape, slope and
+// smoothness sweep their range, the pitch rises by two octaves, and the
+// trigger input receives a gate every 1/8th of a second.
+void RenderGenerator(int32_t variant, vector<float>* channels) {
+  tides::Generator* generator = new tides::Generator;
+  memset(generator, 0, sizeof(*generator));
+  generator->Init();
+  generator->set_seed(0x21);
+  generator->feature_mode_ = static_cast<tides::Generator::FeatureMode>(
+      variant / 9);
+  generator->set_range(static_cast<tides::GeneratorRange>(variant % 3));
+  generator->set_mode(static_cast<tides::GeneratorMode>(variant / 3 % 3));
+  generator->set_sync(false);
+
+  for (size_t c = 0; c < 2; ++c) {
+    channels[c].resize(kTidesNumFrames);
+  }
+  const uint32_t kGatePeriod = kTidesSampleRate / 8;
+  for (size_t i = 0; i < kTidesNumFrames; ++i) {
+    if (generator->writable_block()) {
+      float x = static_cast<float>(i) / kTidesNumFrames;
+      int16_t pitch = (48 + 24 * x) * 128;
+      if (generator->feature_mode_ == tides::Generator::FEAT_MODE_HARMONIC) {
+        generator->set_pitch_high_range(pitch - (12 << 7), 0);
+      } else {
+        generator->set_pitch(pitch, 0);
+      }
+      generator->set_shape((2.0f * x - 1.0f) * 32767.0f);
+      generator->set_slope((1.0f - 2.0f * x) * 32767.0f);
+      generator->set_smoothness((-0.9f + 1.6f * x) * 32767.0f);
+      generator->set_pulse_width(0x7fff);
+      generator->FillBuffer();
+    }
+    uint32_t t = i % kGatePeriod;
+    uint8_t control = 0;
+    if (t < kGatePeriod / 2) {
+      control |= tides::CONTROL_GATE;
+    }
+    if (t == 0) {
+      control |= tides::CONTROL_GATE_RISING;
+    } else if (t == kGatePeriod / 2) {
+      control |= tides::CONTROL_GATE_FALLING;
+    }
+    tides::GeneratorSample s = generator->Process(control);
+    channels[0][i] = s.unipolar / 65536.0f;
+    channels[1][i] = s.bipolar / 32768.0f;
+  }
+  delete generator;
+}
+
+void ListCases(vector<Case>* cases) {
+  for (int32_t mode = 0; mode <= warps::FEATURE_MODE_META; ++mode) {
+    for (int32_t shape = 0; shape < 4; ++shape) {
+      Case c;
+      char name[64];
+      sprintf(name, "modulator/%s/shape%d", kFeatureModeNames[mode], shape);
+      c.name = name;
+      c.render = &RenderModulator;
+      c.variant = mode * 4 + shape;
+      cases->push_back(c);
+    }
+  }
+
+  for (int32_t shape = 0; shape < 4; ++shape) {
+    Case c;
+    char name[64];
+    sprintf(name, "modulator/vocoder/shape%d/lookahead", shape);
+    c.name = name;
+    c.render = &RenderModulator;
+    c.variant = (warps::FEATURE_MODE_VOCODER * 4 + shape) |
+        kLookaheadLimiterVariant;
+    cases->push_back(c);
+  }
+
+  for (int32_t shape = 0; shape < 4; ++shape) {
+    Case c;
+    char name[64];
+    sprintf(name, "modulator/delay/shape%d/sync", shape);
+    c.name = name;
+    c.render = &RenderModulator;
+    c.variant = (warps::FEATURE_MODE_DELAY * 4 + shape) | kDelaySyncVariant;
+    cases->push_back(c);
+  }
+
+  for (int32_t shape = 0; shape < 4; ++shape) {
+    Case c;
+    char name[64];
+    sprintf(name, "modulator/delay/shape%d/taps", shape);
+    c.name = name;
+    c.render = &RenderModulator;
+    c.variant = (warps::FEATURE_MODE_DELAY * 4 + shape) | kDelayTapsVariant;
+    cases->push_back(c);
+  }
+
+  Case src;
+  src.name = "src/96k_576k_96k";
+  src.render = &RenderSampleRateConverter;
+  src.variant = 0;
+  cases->push_back(src);
+
+  for (int32_t shape = 0; shape <= warps::OSCILLATOR_SHAPE_NOISE_LP; ++shape) {
+    Case c;
+    c.name = string("oscillator_bank/") + kOscillatorShapeNames[shape];
+    c.render = &RenderOscillatorBank;
+    c.variant = shape;
+    cases->push_back(c);
+  }
+
+  for (int32_t shape = 0; shape < 4; ++shape) {
+    Case c;
+    char name[64];
+    sprintf(name, "doppler_bank/shape%d", shape);
+    c.name = name;
+    c.render = &RenderDopplerBank;
+    c.variant = shape;
+    cases->push_back(c);
+  }
+
+  for (int32_t variant = 0; variant < 27; ++variant) {
+    Case c;
+    char name[64];
+    sprintf(name, "generator/%s/%s/%s",
+            kGeneratorFeatureNames[variant / 9],
+            kGeneratorModeNames[variant / 3 % 3],
+            kGeneratorRangeNames[variant % 3]);
+    c.name = name;
+    c.render = &RenderGenerator;
+    c.variant = variant;
+    cases->push_back(c);
+  }
+}
+
+// One line per case with the hash, the number of blocks and the number of kept
+// samples, followed by one line per block: RMS level, then band levels from
+// the highest octave down, and by one line per run of kept samples.
+bool WriteFingerprints(
+    const char* file_name,
+    const vector<Case>& cases,
+    const vector<Fingerprint>& fingerprints) {
+  FILE* fp = fopen(file_name, "w");
+  if (!fp) {
+    fprintf(stderr, "Could not open %s\n", file_name);
+    return false;
+  }
+  fprintf(fp, "# Generated by regression -u. Levels in dB.\n");
+  for (size_t i = 0; i < cases.size(); ++i) {
+    const Fingerprint& f = fingerprints[i];
+    fprintf(fp, "%s %08x %d %d\n",
+            cases[i].name.c_str(), f.hash,
+            static_cast<int>(f.blocks.size()),
+            static_cast<int>(f.probes.size()));
+    for (size_t j = 0; j < f.blocks.size(); ++j) {
+      fprintf(fp, "%.2f", f.blocks[j].rms);
+      for (size_t k = 0; k < kNumBands; ++k) {
+        fprintf(fp, " %.2f", f.blocks[j].bands[k]);
+      }
+      fprintf(fp, "\n");
+    }
+    for (size_t j = 0; j < f.probes.size(); ++j) {
+      fprintf(fp, "%.6f%s", f.probes[j],
+              (j + 1) % kProbeRunSize == 0 ? "\n" : " ");
+    }
+  }
+  fclose(fp);
+  return true;
+}
+
+bool ReadFingerprints(const char* file_name, map<string, Fingerprint>* out) {
+  FILE* fp = fopen(file_name, "r");
+  if (!fp) {
+    fprintf(stderr,
+            "Could not open %s. Create the references with -u first.\n",
+            file_name);
+    return false;
+  }
+  char line[512];
+  bool success = true;
+  while (success && fgets(line, sizeof(line), fp)) {
+    if (line[0] == '#') {
+      continue;
+    }
+    char name[128];
+    unsigned int hash;
+    int num_blocks;
+    int num_probes;
+    if (sscanf(line, "%127s %x %d %d",
+               name, &hash, &num_blocks, &num_probes) != 4) {
+      success = false;
+      break;
+    }
+    Fingerprint& f = (*out)[name];
+    f.hash = hash;
+    f.blocks.resize(num_blocks);
+    f.probes.resize(num_probes);
+    for (int i = 0; i < num_blocks; ++i) {
+      BlockFingerprint& b = f.blocks[i];
+      if (!fgets(line, sizeof(line), fp) ||
+          sscanf(line, "%f %f %f %f %f %f %f %f %f",
+                 &b.rms, &b.bands[0], &b.bands[1], &b.bands[2],
+                 &b.bands[3], &b.bands[4], &b.bands[5], &b.bands[6],
+                 &b.bands[7]) != 1 + static_cast<int>(kNumBands)) {
+        success = false;
+        break;
+      }
+    }
+    for (int i = 0; success && i < num_probes; ++i) {
+      if (fscanf(fp, "%f", &f.probes[i]) != 1) {
+        success = false;
+      }
+    }
+    // Rest of the last line of kept samples.
+    if (success && num_probes && !fgets(line, sizeof(line), fp)) {
+      success = false;
+    }
+  }
+  fclose(fp);
+  if (!success) {
+    fprintf(stderr, "%s is corrupted\n", file_name);
+  }
+  return success;
+}
+
+// Largest deviation between two fingerprints, in dB.
+float Deviation(const Fingerprint& a, const Fingerprint& b) {
+  if (a.blocks.size() != b.blocks.size()) {
+    return HUGE_VALF;
+  }
+  float deviation = 0.0f;
+  for (size_t i = 0; i < a.blocks.size(); ++i) {
+    deviation = max(deviation, fabsf(a.blocks[i].rms - b.blocks[i].rms));
+    for (size_t k = 0; k < kNumBands; ++k) {
+      deviation = max(
+          deviation,
+          fabsf(a.blocks[i].bands[k] - b.blocks[i].bands[k]));
+    }
+  }
+  return deviation;
+}
+
+// Largest difference between the kept samples of two fingerprints.
+float SampleError(const Fingerprint& a, const Fingerprint& b) {
+  if (a.probes.size() != b.probes.size()) {
+    return HUGE_VALF;
+  }
+  float error = 0.0f;
+  for (size_t i = 0; i < a.probes.size(); ++i) {
+    error = max(error, fabsf(a.probes[i] - b.probes[i]));
+  }
+  return error;
+}
+
+int main(int argc, char** argv) {
+  bool update = false;
+  float tolerance = 1.0f;
+  float sample_tolerance = 0.01f;
+  int option;
+  while ((option = getopt(argc, argv, "ut:e:")) != -1) {
+    switch (option) {
+      case 'u':
+        update = true;
+        break;
+      case 't':
+        tolerance = atof(optarg);
+        break;
+      case 'e':
+        sample_tolerance = atof(optarg);
+        break;
+      default:
+        fprintf(stderr,
+                "Usage: regression [-u] [-t tolerance] [-e sample tolerance] "
+                "[fingerprints file]\n");
+        return 1;
+    }
+  }
+  const char* file_name = optind < argc
+      ? argv[optind]
+      : "regression/fingerprints.txt";
+
+  vector<Case> cases;
+  ListCases(&cases);
+  vector<Fingerprint> fingerprints(cases.size());
+  for (size_t i = 0; i < cases.size(); ++i) {
+    // Some modes draw from the shared stmlib generator.
+    Random::Seed(0x21);
+    vector<float> channels[2];
+    cases[i].render(cases[i].variant, channels);
+    ComputeFingerprint(channels, 2, &fingerprints[i]);
+  }
+
+  if (update) {
+    if (!WriteFingerprints(file_name, cases, fingerprints)) {
+      return 1;
+    }
+    printf("Wrote %d fingerprints to %s\n",
+           static_cast<int>(cases.size()), file_name);
+    return 0;
+  }
+
+  map<string, Fingerprint> reference;
+  if (!ReadFingerprints(file_name, &reference)) {
+    return 1;
+  }
+  size_t num_failures = 0;
+  for (size_t i = 0; i < cases.size(); ++i) {
+    map<string, Fingerprint>::const_iterator r = reference.find(cases[i].name);
+    if (r == reference.end()) {
+      printf("MISSING  %s\n", cases[i].name.c_str());
+      ++num_failures;
+      continue;
+    }
+    const Fingerprint& f = fingerprints[i];
+    if (f.hash == r->second.hash) {
+      printf("EXACT    %s\n", cases[i].name.c_str());
+      continue;
+    }
+    float deviation = Deviation(f, r->second);
+    float error = SampleError(f, r->second);
+    bool pass = deviation <= tolerance && error <= sample_tolerance;
+    printf("%s %s (%.2f dB, %.4f)\n",
+           pass ? "PASS    " : "FAIL    ",
+           cases[i].name.c_str(),
+           deviation,
+           error);
+    num_failures += pass ? 0 : 1;
+  }
+  printf("%d/%d cases passed\n",
+         static_cast<int>(cases.size() - num_failures),
+         static_cast<int>(cases.size()));
+  return num_failures ? 1 : 0;
+}
@@ -0,0 +1,714 @@
+// Copyright 2026 Aepelzen's Parasites contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Offline renderer: runs the DSP of Wasp, Tapeworm or Cycles on WAV files, as
+// fast as possible, one file per thread.
+//
+// Usage: render [options] wasp|tapeworm|cycles [input.wav ...]
+//
+//   -a file         parameter automation file (see below)
+//   -p name=value   sets a parameter for the whole render
+//   -o directory    output directory (default: current directory)
+//   -j threads      number of worker threads (default: number of cores)
+//   -d seconds      duration, for cycles rendered without input file
+//   -s seed         seed of the random generators of cycles
+//
+// Inputs are 16-bit PCM files. For wasp and tapeworm, the left channel is
+// patched into the carrier input and the right channel into the modulator
+// input; a mono file is patched into both. For cycles, the first channel is
+// the trigger input and the second channel, if any, the clock input. Full
+// scale corresponds to +/-16V, as in the modules' codec emulation.
+//
+// Each input.wav is rendered to input.<engine>.wav: main and aux outputs for
+// wasp and tapeworm, unipolar and bipolar outputs for cycles. Outputs are
+// rounded up to a whole number of seconds, the extra time rendering the tail
+// of the effect.
+//
+// The automation file lists breakpoints, one per line:
+//
+//   # seconds  parameter  value
+//   0          algorithm  0.0
+//   8          algorithm  8.0
+//   4          shape      2
+//
+// Continuous parameters are linearly interpolated between breakpoints,
+// switches jump to the new value. Values are those of the panel controls:
+//
+//   wasp      algorithm (0..8), timbre, level1, level2, shape (0..3),
+//             mode (feature mode, 0..8)
+//   tapeworm  algorithm (0..8), timbre, level1, level2, shape (0..3)
+//   cycles    frequency (-48..48), shape, slope, smoothness (-1..1),
+//             fm (-12..12), quantize (0..7), mode (0..2), range (0..2),
+//             feature (0..2), pll (0/1)
+//
+// Parameters are mapped to the DSP as in src/Warps.cpp, src/Tapeworm.cpp and
+// src/Tides.cpp, once per block of the module, so that renders match the
+// plugin with its CV inputs unpatched.
+
+#include <getopt.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "stmlib/test/wav_writer.h"
+
+#include "tides/cv_scaler.h"
+#include "tides/generator.h"
+#include "warps/dsp/modulator.h"
+#include "warps/resources.h"
+
+#pragma GCC diagnostic ignored "-Wclass-memaccess"
+
+using namespace std;
+using namespace stmlib;
+
+// Size of the blocks processed by the Wasp and Tapeworm modules.
+const size_t kWarpsBlockSize = 60;
+
+enum Engine {
+  ENGINE_WASP,
+  ENGINE_TAPEWORM,
+  ENGINE_CYCLES
+};
+
+const char* kEngineNames[] = { "wasp", "tapeworm", "cycles" };
+
+struct ParameterInfo {
+  Engine engine;
+  const char* name;
+  float default_value;
+  bool is_switch;
+};
+
+const ParameterInfo kParameters[] = {
+  { ENGINE_WASP, "algorithm", 0.0f, false },
+  { ENGINE_WASP, "timbre", 0.5f, false },
+  { ENGINE_WASP, "level1", 1.0f, false },
+  { ENGINE_WASP, "level2", 1.0f, false },
+  { ENGINE_WASP, "shape", 0.0f, true },
+  { ENGINE_WASP, "mode", 8.0f, true },
+  { ENGINE_TAPEWORM, "algorithm", 0.0f, false },
+  { ENGINE_TAPEWORM, "timbre", 0.5f, false },
+  { ENGINE_TAPEWORM, "level1", 1.0f, false },
+  { ENGINE_TAPEWORM, "level2", 1.0f, false },
+  { ENGINE_TAPEWORM, "shape", 0.0f, true },
+  { ENGINE_CYCLES, "frequency", 0.0f, false },
+  { ENGINE_CYCLES, "shape", 0.0f, false },
+  { ENGINE_CYCLES, "slope", 0.0f, false },
+  { ENGINE_CYCLES, "smoothness", 0.0f, false },
+  { ENGINE_CYCLES, "fm", 0.0f, false },
+  { ENGINE_CYCLES, "quantize", 0.0f, true },
+  { ENGINE_CYCLES, "mode", 1.0f, true },
+  { ENGINE_CYCLES, "range", 1.0f, true },
+  { ENGINE_CYCLES, "feature", 0.0f, true },
+  { ENGINE_CYCLES, "pll", 0.0f, true },
+};
+
+const size_t kNumParameters = sizeof(kParameters) / sizeof(kParameters[0]);
+
+const ParameterInfo* FindParameter(Engine engine, const string& name) {
+  for (size_t i = 0; i < kNumParameters; ++i) {
+    if (kParameters[i].engine == engine && name == kParameters[i].name) {
+      return &kParameters[i];
+    }
+  }
+  return NULL;
+}
+
+// Breakpoints of one parameter.
+class Envelope {
+ public:
+  Envelope() : is_switch_(false) { }
+
+  void Init(float value, bool is_switch) {
+    points_.clear();
+    points_.push_back(make_pair(0.0f, value));
+    is_switch_ = is_switch;
+  }
+
+  void Add(float time, float value) {
+    // A breakpoint at 0 replaces the default value.
+    if (points_.size() == 1 && points_[0].first == 0.0f && time == 0.0f) {
+      points_.clear();
+    }
+    points_.push_back(make_pair(time, value));
+    stable_sort(points_.begin(), points_.end(), CompareTime);
+  }
+
+  float value(float time) const {
+    vector<pair<float, float> >::const_iterator next = upper_bound(
+        points_.begin(), points_.end(), make_pair(time, 0.0f), CompareTime);
+    if (next == points_.begin()) {
+      return next->second;
+    } else if (next == points_.end()) {
+      return points_.back().second;
+    }
+    vector<pair<float, float> >::const_iterator previous = next - 1;
+    if (is_switch_) {
+      return previous->second;
+    }
+    float t = (time - previous->first) / (next->first - previous->first);
+    return previous->second + (next->second - previous->second) * t;
+  }
+
+ private:
+  static bool CompareTime(
+      const pair<float, float>& a,
+      const pair<float, float>& b) {
+    return a.first < b.first;
+  }
+
+  vector<pair<float, float> > points_;
+  bool is_switch_;
+};
+
+class Automation {
+ public:
+  void Init(Engine engine) {
+    engine_ = engine;
+    for (size_t i = 0; i < kNumParameters; ++i) {
+      if (kParameters[i].engine == engine) {
+        envelopes_[kParameters[i].name].Init(
+            kParameters[i].default_value,
+            kParameters[i].is_switch);
+      }
+    }
+  }
+
+  bool Set(const string& name, float value) {
+    const ParameterInfo* info = FindParameter(engine_, name);
+    if (!info) {
+      fprintf(stderr, "Unknown %s parameter: %s\n",
+              kEngineNames[engine_], name.c_str());
+      return false;
+    }
+    envelopes_[name].Init(value, info->is_switch);
+    return true;
+  }
+
+  bool Load(const char* file_name) {
+    FILE* fp = fopen(file_name, "r");
+    if (!fp) {
+      fprintf(stderr, "Could not open %s\n", file_name);
+      return false;
+    }
+    char line[256];
+    int32_t line_number = 0;
+    bool success = true;
+    while (fgets(line, sizeof(line), fp)) {
+      ++line_number;
+      char* comment = strchr(line, '#');
+      if (comment) {
+        *comment = '\0';
+      }
+      float time, value;
+      char name[64];
+      int32_t num_fields = sscanf(line, "%f %63s %f", &time, name, &value);
+      if (num_fields <= 0) {
+        continue;
+      }
+      if (num_fields != 3 || !FindParameter(engine_, name)) {
+        fprintf(stderr, "%s:%d: invalid breakpoint\n", file_name, line_number);
+        success = false;
+        break;
+      }
+      envelopes_[name].Add(time, value);
+    }
+    fclose(fp);
+    return success;
+  }
+
+  inline float value(const char* name, float time) const {
+    return envelopes_.find(name)->second.value(time);
+  }
+
+ private:
+  Engine engine_;
+  map<string, Envelope> envelopes_;
+};
+
+struct Audio {
+  size_t sample_rate;
+  size_t num_channels;
+  vector<short> samples;
+
+  inline size_t num_frames() const {
+    return num_channels ? samples.size() / num_channels : 0;
+  }
+};
+
+bool ReadWav(const char* file_name, Audio* audio) {
+  FILE* fp = fopen(file_name, "rb");
+  if (!fp) {
+    fprintf(stderr, "Could not open %s\n", file_name);
+    return false;
+  }
+  char riff[12];
+  bool success = fread(riff, 1, 12, fp) == 12 &&
+      !memcmp(riff, "RIFF", 4) && !memcmp(riff + 8, "WAVE", 4);
+  bool has_format = false;
+  while (success) {
+    char id[4];
+    uint32_t size;
+    if (fread(id, 1, 4, fp) != 4 || fread(&size, 4, 1, fp) != 1) {
+      success = false;
+      break;
+    }
+    if (!memcmp(id, "fmt ", 4) && size >= 16) {
+      uint16_t format, num_channels, bits_per_sample;
+      uint32_t sample_rate, byte_rate;
+      uint16_t block_align;
+      success = fread(&format, 2, 1, fp) == 1 &&
+          fread(&num_channels, 2, 1, fp) == 1 &&
+          fread(&sample_rate, 4, 1, fp) == 1 &&
+          fread(&byte_rate, 4, 1, fp) == 1 &&
+          fread(&block_align, 2, 1, fp) == 1 &&
+          fread(&bits_per_sample, 2, 1, fp) == 1 &&
+          format == 1 && bits_per_sample == 16 &&
+          (num_channels == 1 || num_channels == 2);
+      audio->sample_rate = sample_rate;
+      audio->num_channels = num_channels;
+      has_format = true;
+      fseek(fp, size - 16 + (size & 1), SEEK_CUR);
+    } else if (!memcmp(id, "data", 4) && has_format) {
+      audio->samples.resize(size / 2);
+      size_t num_read = fread(
+          &audio->samples[0], 2, audio->samples.size(), fp);
+      audio->samples.resize(num_read - num_read % audio->num_channels);
+      break;
+    } else {
+      fseek(fp, size + (size & 1), SEEK_CUR);
+    }
+  }
+  fclose(fp);
+  if (!success) {
+    fprintf(stderr, "%s is not a 16-bit mono or stereo PCM file\n", file_name);
+  }
+  return success;
+}
+
+// Converts the input to stereo frames, padded with silence to a whole number
+// of seconds and of blocks. Returns the duration in seconds.
+size_t MakeStereoInput(
+    const Audio& audio,
+    size_t block_size,
+    vector<warps::ShortFrame>* input) {
+  size_t num_frames = audio.num_frames();
+  size_t duration = (num_frames + audio.sample_rate - 1) / audio.sample_rate;
+  if (!duration) {
+    duration = 1;
+  }
+  size_t padded_size = duration * audio.sample_rate;
+  padded_size += block_size - 1;
+  padded_size -= padded_size % block_size;
+  warps::ShortFrame silence = { 0, 0 };
+  input->assign(padded_size, silence);
+  for (size_t i = 0; i < num_frames; ++i) {
+    if (audio.num_channels == 2) {
+      (*input)[i].l = audio.samples[2 * i];
+      (*input)[i].r = audio.samples[2 * i + 1];
+    } else {
+      (*input)[i].l = (*input)[i].r = audio.samples[i];
+    }
+  }
+  return duration;
+}
+
+struct Job {
+  string input_file_name;
+  string output_file_name;
+};
+
+struct Settings {
+  Engine engine;
+  Automation automation;
+  float duration;
+  uint32_t seed;
+};
+
+bool WriteWav(
+    const string& file_name,
+    size_t sample_rate,
+    size_t duration,
+    warps::ShortFrame* frames) {
+  WavWriter wav_writer(2, sample_rate, duration);
+  if (!wav_writer.Open(file_name.c_str())) {
+    fprintf(stderr, "Could not open %s\n", file_name.c_str());
+    return false;
+  }
+  wav_writer.WriteFrames(
+      reinterpret_cast<short*>(frames),
+      duration * sample_rate);
+  return true;
+}
+
+bool RenderWarps(const Job& job, const Settings& settings) {
+  Audio audio;
+  if (!ReadWav(job.input_file_name.c_str(), &audio)) {
+    return false;
+  }
+  vector<warps::ShortFrame> input;
+  size_t duration = MakeStereoInput(audio, kWarpsBlockSize, &input);
+  vector<warps::ShortFrame> output(input.size());
+
+  warps::Modulator* modulator = new warps::Modulator;
+  memset(modulator, 0, sizeof(*modulator));
+  modulator->Init(96000.0f);
+  if (settings.engine == ENGINE_TAPEWORM) {
+    modulator->set_feature_mode(warps::FEATURE_MODE_DELAY);
+  }
+
+  const Automation& a = settings.automation;
+  float note_offset = log2f(96000.0f / audio.sample_rate) * 12.0f;
+  for (size_t i = 0; i < input.size(); i += kWarpsBlockSize) {
+    float t = static_cast<float>(i) / audio.sample_rate;
+    float algorithm = a.value("algorithm", t) / 8.0f;
+    CONSTRAIN(algorithm, 0.0f, 1.0f);
+    float timbre = a.value("timbre", t);
+    CONSTRAIN(timbre, 0.0f, 1.0f);
+    float level[2] = { a.value("level1", t), a.value("level2", t) };
+    CONSTRAIN(level[0], 0.0f, 1.0f);
+    CONSTRAIN(level[1], 0.0f, 1.0f);
+
+    warps::Parameters* p = modulator->mutable_parameters();
+    p->carrier_shape = static_cast<int32_t>(a.value("shape", t)) & 3;
+    p->modulation_algorithm = algorithm;
+    p->raw_level[0] = level[0];
+    p->raw_level[1] = level[1];
+    p->raw_algorithm = algorithm;
+    p->modulation_parameter = timbre;
+    if (settings.engine == ENGINE_WASP) {
+      int32_t mode = static_cast<int32_t>(a.value("mode", t));
+      CONSTRAIN(mode, 0, warps::FEATURE_MODE_META);
+      modulator->set_feature_mode(static_cast<warps::FeatureMode>(mode));
+      p->channel_drive[0] = level[0];
+      p->channel_drive[1] = level[1];
+      p->raw_algorithm_pot = Interpolate(warps::lut_pot_curve, algorithm, 512.0f);
+      p->raw_algorithm_cv = 0.0f;
+      p->note = 60.0f * level[0] + 12.0f * 2.0f + 12.0f + note_offset;
+    }
+    modulator->Process(&input[i], &output[i], kWarpsBlockSize);
+  }
+  delete modulator;
+
+  return WriteWav(job.output_file_name, audio.sample_rate, duration, &output[0]);
+}
+
+// Time elapsed since the input crossed the 0.7V threshold between the previous
+// and the current sample, in 1/256th of a sample. See src/Tides.cpp.
+uint8_t CrossingDelay(float previous, float current) {
+  if (current == previous) {
+    return 0;
+  }
+  float elapsed = (current - 0.7f) / (current - previous) * 256.0f;
+  CONSTRAIN(elapsed, 0.0f, 255.0f);
+  return static_cast<uint8_t>(elapsed);
+}
+
+bool RenderCycles(const Job& job, const Settings& settings) {
+  Audio audio;
+  if (!job.input_file_name.empty()) {
+    if (!ReadWav(job.input_file_name.c_str(), &audio)) {
+      return false;
+    }
+  } else {
+    audio.sample_rate = 48000;
+    audio.num_channels = 1;
+    audio.samples.resize(settings.duration * audio.sample_rate);
+  }
+  vector<warps::ShortFrame> input;
+  size_t duration = MakeStereoInput(audio, tides::kBlockSize, &input);
+  vector<warps::ShortFrame> output(input.size());
+  bool clock_patched = audio.num_channels == 2;
+
+  tides::Generator* generator = new tides::Generator;
+  memset(generator, 0, sizeof(*generator));
+  generator->Init();
+  generator->set_seed(settings.seed);
+  generator->set_sync(false);
+  // As in Tides::onReset. Init leaves the looping generator stopped, and
+  // set_mode starts it.
+  generator->set_range(tides::GENERATOR_RANGE_MEDIUM);
+  generator->set_mode(tides::GENERATOR_MODE_LOOPING);
+
+  const Automation& a = settings.automation;
+  const float kVoltsPerUnit = 16.0f / 32768.0f;
+  float pitch_offset = log2f(48000.0f / audio.sample_rate) * 12.0f * 0x80;
+  uint8_t last_gate = 0;
+  float last_trig = 0.0f;
+  float last_clock = 0.0f;
+  bool pll = false;
+  for (size_t i = 0; i < input.size(); ++i) {
+    if (generator->writable_block()) {
+      float t = static_cast<float>(i) / audio.sample_rate;
+      int32_t feature = static_cast<int32_t>(a.value("feature", t));
+      CONSTRAIN(feature, 0, 2);
+      generator->feature_mode_ = static_cast<tides::Generator::FeatureMode>(
+          feature);
+      int32_t mode = static_cast<int32_t>(a.value("mode", t));
+      CONSTRAIN(mode, 0, 2);
+      if (mode != generator->mode()) {
+        generator->set_mode(static_cast<tides::GeneratorMode>(mode));
+      }
+      int32_t range = static_cast<int32_t>(a.value("range", t));
+      CONSTRAIN(range, 0, 2);
+      if (range != generator->range()) {
+        generator->set_range(static_cast<tides::GeneratorRange>(range));
+      }
+
+      float frequency = a.value("frequency", t);
+      CONSTRAIN(frequency, -60.0f, 60.0f);
+      frequency += 60.0f;
+      if (feature == tides::Generator::FEAT_MODE_HARMONIC) {
+        frequency -= 12.0f;
+      }
+      int16_t pitch = static_cast<int16_t>(frequency * 0x80);
+      int32_t quantize = static_cast<int32_t>(a.value("quantize", t));
+      CONSTRAIN(quantize, 0, 7);
+      if (quantize) {
+        uint16_t semi = pitch >> 7;
+        uint16_t octaves = semi / 12;
+        semi -= octaves * 12;
+        pitch = octaves * tides::kOctave +
+            tides::quantize_lut[quantize - 1][semi];
+      }
+      pitch += pitch_offset;
+      if (feature == tides::Generator::FEAT_MODE_HARMONIC) {
+        generator->set_pitch_high_range(pitch, 0);
+      } else {
+        generator->set_pitch(pitch, 0);
+      }
+      if (feature == tides::Generator::FEAT_MODE_RANDOM) {
+        float pulse_width = 1.0f - a.value("fm", t) / 12.0f;
+        CONSTRAIN(pulse_width, 0.0f, 2.0f);
+        generator->set_pulse_width(pulse_width * 0x7fff);
+      }
+
+      float shape = a.value("shape", t);
+      float slope = a.value("slope", t);
+      float smoothness = a.value("smoothness", t);
+      CONSTRAIN(shape, -1.0f, 1.0f);
+      CONSTRAIN(slope, -1.0f, 1.0f);
+      CONSTRAIN(smoothness, -1.0f, 1.0f);
+      generator->set_shape(shape * 0x7fff);
+      generator->set_slope(slope * 0x7fff);
+      generator->set_smoothness(smoothness * 0x7fff);
+
+      pll = a.value("pll", t) != 0.0f;
+      generator->set_sync(clock_patched);
+      generator->set_pll(pll);
+      generator->FillBuffer();
+    }
+
+    float trig = input[i].l * kVoltsPerUnit;
+    float clock = clock_patched ? input[i].r * kVoltsPerUnit : 0.0f;
+    uint8_t gate = 0;
+    if (trig >= 0.7f) {
+      gate |= tides::CONTROL_GATE;
+    }
+    if (clock >= 0.7f) {
+      gate |= tides::CONTROL_CLOCK;
+    }
+    tides::GeneratorEdgeDelay edge_delay = { 0, 0 };
+    if (!(last_gate & tides::CONTROL_CLOCK) && (gate & tides::CONTROL_CLOCK)) {
+      if (pll) {
+        gate |= tides::CONTROL_CLOCK_RISING;
+        edge_delay.clock = CrossingDelay(last_clock, clock);
+      } else {
+        gate |= tides::CONTROL_GATE_RISING;
+        edge_delay.gate = CrossingDelay(last_clock, clock);
+      }
+    }
+    if (!(last_gate & tides::CONTROL_GATE) && (gate & tides::CONTROL_GATE)) {
+      gate |= tides::CONTROL_GATE_RISING;
+      edge_delay.gate = CrossingDelay(last_trig, trig);
+    }
+    if ((last_gate & tides::CONTROL_GATE) && !(gate & tides::CONTROL_GATE)) {
+      gate |= tides::CONTROL_GATE_FALLING;
+      edge_delay.gate = CrossingDelay(last_trig, trig);
+    }
+    last_gate = gate;
+    last_clock = clock;
+    last_trig = trig;
+
+    tides::GeneratorModulation modulation = { 0, 0, 0 };
+    tides::GeneratorSample s = generator->Process(gate, modulation, edge_delay);
+    output[i].l = s.unipolar >> 1;
+    output[i].r = Clip16(-s.bipolar);
+  }
+  delete generator;
+
+  return WriteWav(job.output_file_name, audio.sample_rate, duration, &output[0]);
+}
+
+void RunJobs(
+    const vector<Job>& jobs,
+    const Settings& settings,
+    size_t num_threads,
+    atomic<size_t>* num_failures) {
+  atomic<size_t> next_job(0);
+  vector<thread> workers;
+  for (size_t i = 0; i < num_threads; ++i) {
+    workers.push_back(thread([&]() {
+      size_t j;
+      while ((j = next_job++) < jobs.size()) {
+        bool success = settings.engine == ENGINE_CYCLES
+            ? RenderCycles(jobs[j], settings)
+            : RenderWarps(jobs[j], settings);
+        if (success) {
+          printf("%s\n", jobs[j].output_file_name.c_str());
+        } else {
+          ++*num_failures;
+        }
+      }
+    }));
+  }
+  for (size_t i = 0; i < workers.size(); ++i) {
+    workers[i].join();
+  }
+}
+
+string OutputFileName(
+    const string& directory,
+    const string& input_file_name,
+    Engine engine) {
+  string base = input_file_name;
+  size_t slash = base.find_last_of("/\\");
+  if (slash != string::npos) {
+    base = base.substr(slash + 1);
+  }
+  size_t dot = base.rfind('.');
+  if (dot != string::npos) {
+    base = base.substr(0, dot);
+  }
+  return directory + "/" + base + "." + kEngineNames[engine] + ".wav";
+}
+
+void Usage() {
+  fprintf(stderr,
+          "Usage: render [-a automation] [-p name=value] [-o directory] "
+          "[-j threads] [-d seconds] [-s seed] "
+          "wasp|tapeworm|cycles [input.wav ...]\n");
+}
+
+int main(int argc, char** argv) {
+  const char* automation_file_name = NULL;
+  vector<string> overrides;
+  string directory = ".";
+  size_t num_threads = thread::hardware_concurrency();
+  Settings settings;
+  settings.duration = 10.0f;
+  settings.seed = 0x21;
+
+  int option;
+  while ((option = getopt(argc, argv, "a:p:o:j:d:s:")) != -1) {
+    switch (option) {
+      case 'a':
+        automation_file_name = optarg;
+        break;
+      case 'p':
+        overrides.push_back(optarg);
+        break;
+      case 'o':
+        directory = optarg;
+        break;
+      case 'j':
+        num_threads = atoi(optarg);
+        break;
+      case 'd':
+        settings.duration = atof(optarg);
+        break;
+      case 's':
+        settings.seed = strtoul(optarg, NULL, 0);
+        break;
+      default:
+        Usage();
+        return 1;
+    }
+  }
+  if (optind >= argc) {
+    Usage();
+    return 1;
+  }
+
+  string engine_name = argv[optind++];
+  size_t engine = 0;
+  while (engine < 3 && engine_name != kEngineNames[engine]) {
+    ++engine;
+  }
+  if (engine == 3) {
+    Usage();
+    return 1;
+  }
+  settings.engine = static_cast<Engine>(engine);
+  settings.automation.Init(settings.engine);
+  for (size_t i = 0; i < overrides.size(); ++i) {
+    size_t equal = overrides[i].find('=');
+    if (equal == string::npos ||
+        !settings.automation.Set(
+            overrides[i].substr(0, equal),
+            atof(overrides[i].c_str() + equal + 1))) {
+      Usage();
+      return 1;
+    }
+  }
+  if (automation_file_name &&
+      !settings.automation.Load(automation_file_name)) {
+    return 1;
+  }
+
+  vector<Job> jobs;
+  for (int i = optind; i < argc; ++i) {
+    Job job;
+    job.input_file_name = argv[i];
+    job.output_file_name = OutputFileName(
+        directory, job.input_file_name, settings.engine);
+    jobs.push_back(job);
+  }
+  if (jobs.empty()) {
+    if (settings.engine != ENGINE_CYCLES) {
+      Usage();
+      return 1;
+    }
+    Job job;
+    job.output_file_name = directory + "/cycles.wav";
+    jobs.push_back(job);
+  }
+
+  if (num_threads < 1) {
+    num_threads = 1;
+  }
+  num_threads = min(num_threads, jobs.size());
+  atomic<size_t> num_failures(0);
+  RunJobs(jobs, settings, num_threads, &num_failures);
+  return num_failures ? 1 : 0;
+}
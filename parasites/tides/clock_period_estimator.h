@@ -0,0 +1,191 @@
+// Copyright 2026 Aepelzen's Parasites contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Estimates the period of an external clock from the intervals between its
+// edges.
+//
+// A median over the last three intervals rejects isolated glitches (missed or
+// doubled edges). The median then drives a scalar Kalman filter, whose
+// measurement noise is estimated on the fly from the innovations, so that the
+// estimate settles quickly on a clean clock and averages more on a jittery
+// one. Two consecutive intervals which agree with each other but not with the
+// estimate are a tempo change: the filter restarts from them.
+
+#ifndef TIDES_CLOCK_PERIOD_ESTIMATOR_H_
+#define TIDES_CLOCK_PERIOD_ESTIMATOR_H_
+
+#include "stmlib/stmlib.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace tides {
+
+// Intervals are expressed in samples, with 8 bits of fractional part.
+const uint32_t kMaxClockInterval = 8 * 48000 << 8;
+
+// Relative deviation above which an interval is considered an outlier.
+const float kTempoChangeThreshold = 0.2f;
+
+// Relative drift of the clock period allowed between two edges.
+const float kClockDrift = 0.002f;
+
+class ClockPeriodEstimator {
+ public:
+  ClockPeriodEstimator() { }
+  ~ClockPeriodEstimator() { }
+
+  void Init() {
+    num_intervals_ = 0;
+    num_updates_ = 0;
+    num_outliers_ = 0;
+    period_ = 0.0f;
+    variance_ = 0.0f;
+    noise_ = 0.0f;
+    outlier_ = 0.0f;
+  }
+
+  void Process(uint32_t interval) {
+    if (!interval) {
+      return;
+    }
+    if (interval >= kMaxClockInterval) {
+      // The clock has stopped: wait for two new edges.
+      Init();
+      return;
+    }
+
+    float z = static_cast<float>(interval);
+    if (!num_updates_) {
+      Restart(z);
+      return;
+    }
+
+    if (fabsf(z - period_) > kTempoChangeThreshold * period_) {
+      if (num_outliers_ &&
+          fabsf(z - outlier_) < kTempoChangeThreshold * outlier_) {
+        Restart(z);
+        Push(outlier_);
+        Push(z);
+        period_ = 0.5f * (z + outlier_);
+        return;
+      }
+      ++num_outliers_;
+      outlier_ = z;
+    } else {
+      num_outliers_ = 0;
+    }
+    Push(z);
+
+    float innovation = Median() - period_;
+    float drift = period_ * kClockDrift;
+    variance_ += drift * drift;
+    float gain = variance_ / (variance_ + noise_);
+    period_ += gain * innovation;
+    variance_ *= 1.0f - gain;
+
+    // Track the measurement noise, with a floor at a 1/256th of a sample to
+    // keep the filter responsive when the clock is perfectly regular.
+    noise_ += 0.125f * (innovation * innovation - noise_);
+    if (noise_ < 1.0f) {
+      noise_ = 1.0f;
+    }
+    if (num_updates_ < kSettlingUpdates) {
+      ++num_updates_;
+    }
+  }
+
+  inline bool locked() const { return num_updates_ != 0; }
+
+  // Estimated period, in samples with 8 bits of fractional part.
+  inline uint32_t period() const {
+    return static_cast<uint32_t>(period_ + 0.5f);
+  }
+
+  // 0 when unlocked, 65535 when locked on a clock with no measurable jitter.
+  // The relative jitter is penalized 20 times, so that the quality drops to 0
+  // when the jitter reaches 5% of the period.
+  uint16_t lock_quality() const {
+    if (!num_updates_) {
+      return 0;
+    }
+    float jitter = sqrtf(noise_) / period_;
+    float quality = 1.0f - 20.0f * jitter;
+    if (quality < 0.0f) {
+      quality = 0.0f;
+    }
+    quality *= static_cast<float>(num_updates_) / kSettlingUpdates;
+    return static_cast<uint16_t>(quality * 65535.0f);
+  }
+
+ private:
+  static const int32_t kHistorySize = 3;
+  static const int32_t kSettlingUpdates = 4;
+
+  void Restart(float interval) {
+    num_intervals_ = 0;
+    num_outliers_ = 0;
+    Push(interval);
+    period_ = interval;
+    // Trust the first interval to within 5%, and assume a 1% jitter until
+    // the following intervals tell otherwise.
+    variance_ = interval * interval * 0.0025f;
+    noise_ = interval * interval * 0.0001f;
+    num_updates_ = 1;
+  }
+
+  void Push(float interval) {
+    history_[num_intervals_ % kHistorySize] = interval;
+    ++num_intervals_;
+    if (num_intervals_ >= 2 * kHistorySize) {
+      num_intervals_ -= kHistorySize;
+    }
+  }
+
+  float Median() const {
+    if (num_intervals_ < kHistorySize) {
+      return history_[(num_intervals_ - 1) % kHistorySize];
+    }
+    float a = history_[0];
+    float b = history_[1];
+    float c = history_[2];
+    return std::max(std::min(a, b), std::min(std::max(a, b), c));
+  }
+
+  float history_[kHistorySize];
+  int32_t num_intervals_;
+  int32_t num_updates_;
+  int32_t num_outliers_;
+
+  float period_;
+  float variance_;
+  float noise_;
+  float outlier_;
+
+  DISALLOW_COPY_AND_ASSIGN(ClockPeriodEstimator);
+};
+
+}  // namespace tides
+
+#endif  // TIDES_CLOCK_PERIOD_ESTIMATOR_H_
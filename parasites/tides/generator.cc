@@ -31,9 +31,11 @@
 #include <algorithm>
 
 #include "stmlib/utils/dsp.h"
-#include "stmlib/utils/random.h"
 
 #include "tides/resources.h"
+#ifdef WAVETABLE_HACK
+#include "tides/wavetable/resources.h"
+#endif  // WAVETABLE_HACK
 
 // #define CORE_ONLY
 
@@ -44,6 +46,7 @@ using namespace stmlib;
 const int16_t kOctave = 12 * 128;
 const uint16_t kSlopeBits = 12;
 const uint32_t kSyncCounterMaxTime = 8 * 48000;
+const uint32_t kDefaultSeed = 0x21;
 
 const int32_t kDownsampleCoefficient[4] = { 17162, 19069, 17162, 12140 };
 
@@ -77,7 +80,10 @@ void Generator::Init() {
   set_pitch(60 << 7, 0);
   output_buffer_.Init();
   input_buffer_.Init();
+  modulation_buffer_.Init();
+  edge_delay_buffer_.Init();
   pattern_predictor_.Init();
+  clock_period_estimator_.Init();
   for (uint16_t i = 0; i < kBlockSize; ++i) {
     GeneratorSample s;
     s.flags = 0;
@@ -85,9 +91,17 @@ void Generator::Init() {
     s.bipolar = 0;
     output_buffer_.Overwrite(s);
     input_buffer_.Overwrite(0);
+    GeneratorModulation m = { 0, 0, 0 };
+    modulation_buffer_.Overwrite(m);
+    GeneratorEdgeDelay d = { 0, 0 };
+    edge_delay_buffer_.Overwrite(d);
   }
   
   antialiasing_ = true;
+  audio_rate_modulation_ = false;
+  control_shape_table_valid_ = false;
+  previous_control_shape_ = 0;
+  pll_ = false;
   shape_ = 0;
   slope_ = 0;
   smoothed_slope_ = 0;
@@ -108,6 +122,8 @@ void Generator::Init() {
   ClearFilterState();
   
   sync_counter_ = kSyncCounterMaxTime;
+  clock_counter_ = kSyncCounterMaxTime;
+  clock_edge_delay_ = 0;
   frequency_ratio_.p = 1;
   frequency_ratio_.q = 1;
   sync_ = false;
@@ -116,7 +132,7 @@ void Generator::Init() {
   local_osc_phase_increment_ = phase_increment_;
   target_phase_increment_ = phase_increment_;
 
-  RandomizeHarmonicDistribution();
+  set_seed(kDefaultSeed);
 }
 
 void Generator::ComputeFrequencyRatio(int16_t pitch) {
@@ -192,6 +208,52 @@ int16_t Generator::ComputePitch(int32_t phase_increment) {
   return pitch;
 }
 
+void Generator::TrackClock(
+    uint8_t control,
+    const GeneratorEdgeDelay& edge_delay) {
+  if (clock_counter_ <= kSyncCounterMaxTime) {
+    ++clock_counter_;
+  }
+  if (control & CONTROL_CLOCK_RISING) {
+    if (sync_ && pll_) {
+      clock_period_estimator_.Process(
+          (clock_counter_ << 8) + clock_edge_delay_ - edge_delay.clock);
+    }
+    clock_counter_ = 0;
+    clock_edge_delay_ = edge_delay.clock;
+  }
+}
+
+uint32_t Generator::ComputeSyncPhaseIncrement() const {
+  uint64_t period = static_cast<uint64_t>(
+      clock_period_estimator_.period()) * frequency_ratio_.q;
+  uint64_t increment = (static_cast<uint64_t>(frequency_ratio_.p) << 40) / period;
+  if (increment > 0x80000000) {
+    increment = 0x80000000;
+  }
+  return static_cast<uint32_t>(increment);
+}
+
+uint8_t Generator::ComputePhaseErrorShift() const {
+  // In PLL mode, the phase error is corrected within a couple of clock
+  // periods rather than with a fixed time constant of 8192 samples.
+  uint8_t shift = 13;
+  if (pll_ && clock_period_estimator_.locked()) {
+    uint32_t period = clock_period_estimator_.period() >> 7;
+    shift = 4;
+    while (shift < 13 && (1UL << shift) < period) {
+      ++shift;
+    }
+  }
+  return shift;
+}
+
+// Index of the second lut_cutoff entry interpolated at frequency. At the end
+// of the table the fraction is 0, and the last entry is read twice.
+static inline int32_t NextCutoffIndex(int32_t frequency) {
+  return std::min((frequency >> 7) + 1, LUT_CUTOFF_SIZE - 1);
+}
+
 int32_t Generator::ComputeCutoffFrequency(int16_t pitch, int16_t smoothness) {
   uint8_t shifts = clock_divider_;
   while (shifts > 1) {
@@ -211,9 +273,9 @@ int32_t Generator::ComputeCutoffFrequency(int16_t pitch, int16_t smoothness) {
     frequency = start + ((end - start) * (smoothness + 32768) >> 14);
   }
   frequency += 32768;
-  if (frequency < 0) {
-    frequency = 0;
-  }
+  // A high pitch, raised further by the clock divider, goes past the end of
+  // lut_cutoff.
+  CONSTRAIN(frequency, 0, (LUT_CUTOFF_SIZE - 1) << 7);
   return frequency;
 }
 
@@ -249,12 +311,26 @@ int32_t Generator::ComputeAntialiasAttenuation(
 }
 
 void Generator::FillBuffer() {
+    // The modulation buffer is drained even when audio-rate modulation is
+    // disabled, so that it stays aligned with the control buffer. A block
+    // without any modulation is rendered like an unmodulated one, so that
+    // unpatched modulation inputs leave the output bit-identical.
+    GeneratorModulation modulation[kBlockSize];
+    bool modulated = false;
+    for (uint16_t i = 0; i < kBlockSize; ++i) {
+      modulation[i] = modulation_buffer_.ImmediateRead();
+      modulated = modulated || modulation[i].fm || modulation[i].shape ||
+          modulation[i].slope;
+    }
+
     if (feature_mode_ == FEAT_MODE_FUNCTION) {
 #ifndef WAVETABLE_HACK
+      const GeneratorModulation* block_modulation =
+          audio_rate_modulation_ && modulated ? modulation : NULL;
       if (range_ == GENERATOR_RANGE_HIGH) {
-        FillBufferAudioRate();
+        FillBufferAudioRate(block_modulation);
       } else {
-        FillBufferControlRate();
+        FillBufferControlRate(block_modulation);
       }
 #else
       FillBufferWavetable();
@@ -304,7 +380,98 @@ void Generator::FillBuffer() {
 // 2. has a terrible behaviour in the audio range, because it causes audible FM
 // when the slope parameter is modulated by a LFO.
 
-void Generator::FillBufferAudioRate() {
+// Waveshaping parameters of the audio-rate renderer which only depend on the
+// slope setting. They are computed once per block, or whenever the slope
+// changes when it is modulated at audio rate.
+struct AudioRateSlope {
+  void Compute(int16_t slope_setting, int32_t phase_increment) {
+    // we split the slope button into two: original slope on the first
+    // half, compression on the second
+    int16_t compress = -slope_setting;
+    slope = slope_setting;
+    CONSTRAIN(slope, 0, 32767);
+    CONSTRAIN(compress, 0, 32767);
+
+    // adjust knob response for Slope
+    int32_t s = 32768 - slope;
+    slope = 32768 - ((s * s) >> 15);
+    CONSTRAIN(slope, 0, 32600); 	// that is a bit weird
+
+    gain = slope;
+    gain = (32768 - (gain * gain >> 15)) * 3 >> 1;
+    gain = 32768 * 1024 / gain;
+
+    phase_offset_a_bi = (slope - (slope >> 1)) << 16;
+    phase_offset_b_bi = (32768 - (slope >> 1)) << 16;
+    phase_offset_a_uni = 49152 << 16;
+    phase_offset_b_uni = (32768 + 49152 - slope) << 16;
+
+    // Clip the phase for compression
+    compress_index = compress << 1;
+    compress_index = 65535 - compress_index;
+    compress_index = (compress_index * compress_index) >> 16;
+    compress_index = 65535 - compress_index;
+    compress_index = compress_index * 29 / 30; // knob range
+    compress_index = 65535 - compress_index;
+
+    end_of_attack = (static_cast<uint32_t>(slope + 32768) << 16);
+
+    // Enforce that the EOA pulse is at least 1 sample wide.
+    if (end_of_attack >= abs(phase_increment)) {
+      end_of_attack -= phase_increment;
+    }
+    if (end_of_attack < abs(phase_increment)) {
+      end_of_attack = phase_increment;
+    }
+  }
+
+  inline uint32_t CompressPhase(uint32_t phase) const {
+    return (phase >> 16) > compress_index ? 0 :
+        phase / compress_index * UINT16_MAX;
+  }
+
+  int16_t slope;
+  int32_t gain;
+  uint32_t phase_offset_a_bi;
+  uint32_t phase_offset_b_bi;
+  uint32_t phase_offset_a_uni;
+  uint32_t phase_offset_b_uni;
+  uint32_t compress_index;
+  uint32_t end_of_attack;
+};
+
+// Renders the bipolar and unipolar ramps, before smoothing and folding.
+inline void RenderRamps(
+    uint32_t compressed_phase,
+    const AudioRateSlope& slope,
+    const int16_t* wave_1,
+    const int16_t* wave_2,
+    uint16_t xfade,
+    const int16_t* shape_1,
+    const int16_t* shape_2,
+    uint16_t shape_xfade,
+    int32_t* bipolar,
+    int32_t* unipolar) {
+  int32_t ramp_a, ramp_b, saw;
+  ramp_a = Crossfade1022(wave_1, wave_2, compressed_phase + slope.phase_offset_a_bi, xfade);
+  ramp_b = Crossfade1022(wave_1, wave_2, compressed_phase + slope.phase_offset_b_bi, xfade);
+  saw = (ramp_b - ramp_a) * slope.gain >> 10;
+  CLIP(saw);
+  
+  // Appy shape waveshaper.
+  *bipolar = Crossfade115(shape_1, shape_2, saw + 32768, shape_xfade);
+
+  ramp_a = Crossfade1022(wave_1, wave_2, compressed_phase + slope.phase_offset_a_uni, xfade);
+  ramp_b = Crossfade1022(wave_1, wave_2, compressed_phase + slope.phase_offset_b_uni, xfade);
+  saw = (ramp_b - ramp_a) * slope.gain >> 10;
+  CLIP(saw)
+  
+  // Appy shape waveshaper.
+  *unipolar = Crossfade115(shape_1, shape_2, (saw >> 1) + 32768 + 16384,
+                           shape_xfade);
+}
+
+void Generator::FillBufferAudioRate(const GeneratorModulation* modulation) {
   uint8_t size = kBlockSize;
   
   GeneratorSample sample = previous_sample_;
@@ -318,10 +485,22 @@ void Generator::FillBufferAudioRate() {
     local_osc_phase_increment_ = phase_increment_end;
     target_phase_increment_ = phase_increment_end;
   }
+  int16_t pitch = pitch_;
   if (pitch_ < 0) {
     pitch_ = 0;
   }
 
+  // With audio-rate FM, the anti-aliasing attenuation is computed for the
+  // highest pitch reached during the block.
+  int16_t peak_pitch = pitch_;
+  if (modulation && !sync_) {
+    for (uint8_t i = 0; i < kBlockSize; ++i) {
+      int32_t p = pitch + modulation[i].fm;
+      CONSTRAIN(p, peak_pitch, 32767);
+      peak_pitch = p;
+    }
+  }
+
 #ifndef CORE_ONLY
   // Load wavetable pointers for bandlimiting - they depend on pitch value.
   uint16_t xfade = pitch_ << 6;
@@ -334,36 +513,20 @@ void Generator::FillBufferAudioRate() {
   const int16_t* wave_1 = waveform_table[WAV_BANDLIMITED_PARABOLA_0 + index];
   const int16_t* wave_2 = waveform_table[WAV_BANDLIMITED_PARABOLA_0 + index + 1];
 
-  // we split the slope button into two: original slope on the first
-  // half, compression on the second
-  int16_t compress = -slope_;
-  int16_t slope = slope_;
-  CONSTRAIN(slope, 0, 32767);
-  CONSTRAIN(compress, 0, 32767);
-
-  // adjust knob response for Slope
-  int32_t s = 32768 - slope;
-  slope = 32768 - ((s * s) >> 15);
-  CONSTRAIN(slope, 0, 32600); 	// that is a bit weird
-
-  int32_t gain = slope;
-  gain = (32768 - (gain * gain >> 15)) * 3 >> 1;
-  gain = 32768 * 1024 / gain;
-  
-  uint32_t phase_offset_a_bi = (slope - (slope >> 1)) << 16;
-  uint32_t phase_offset_b_bi = (32768 - (slope >> 1)) << 16;
-  uint32_t phase_offset_a_uni = 49152 << 16;
-  uint32_t phase_offset_b_uni = (32768 + 49152 - slope) << 16;
+  int16_t slope_setting = slope_;
+  AudioRateSlope slope;
+  slope.Compute(slope_setting, phase_increment_);
   
   int32_t attenuation = 32767;
   if (antialiasing_) {
     attenuation = ComputeAntialiasAttenuation(
-          pitch_,
-	  slope,
+          peak_pitch,
+	  slope.slope,
           shape_,
           smoothness_);
   }
 
+  int16_t shape_setting = shape_;
   uint16_t shape = static_cast<uint16_t>((shape_ * attenuation >> 15) + 32768);
   uint16_t wave_index = WAV_INVERSE_TAN_AUDIO + (shape >> 14);
   const int16_t* shape_1 = waveform_table[wave_index];
@@ -372,7 +535,7 @@ void Generator::FillBufferAudioRate() {
 
   int32_t frequency = ComputeCutoffFrequency(pitch_, smoothness_);
   int32_t f_a = lut_cutoff[frequency >> 7] >> 16;
-  int32_t f_b = lut_cutoff[(frequency >> 7) + 1] >> 16;
+  int32_t f_b = lut_cutoff[NextCutoffIndex(frequency)] >> 16;
   int32_t f = f_a + ((f_b - f_a) * (frequency & 0x7f) >> 7);
   int32_t wf_gain = 2048;
   int32_t wf_balance = 0;
@@ -383,27 +546,24 @@ void Generator::FillBufferAudioRate() {
   }
 #endif  // CORE_ONLY  
   
-  uint32_t end_of_attack = (static_cast<uint32_t>(slope + 32768) << 16);
-  
   // Load state into registers - saves some memory load/store inside the
   // rendering loop.
   uint32_t phase = phase_;
   int32_t phase_increment = phase_increment_;
   int32_t phase_increment_increment = (phase_increment_end - phase_increment_) / size;
+  if (modulation && !sync_) {
+    // The increment is recomputed for every sample from the FM buffer.
+    phase_increment_increment = 0;
+  }
   bool wrap = wrap_;
   int32_t uni_lp_state_0 = uni_lp_state_[0];
   int32_t uni_lp_state_1 = uni_lp_state_[1];
   int32_t bi_lp_state_0 = bi_lp_state_[0];
   int32_t bi_lp_state_1 = bi_lp_state_[1];
+  int32_t bi_blep_delay = bi_blep_delay_;
+  int32_t uni_blep_delay = uni_blep_delay_;
+  uint8_t flags_delay = flags_delay_;
   
-  // Enforce that the EOA pulse is at least 1 sample wide.
-  if (end_of_attack >= abs(phase_increment)) {
-    end_of_attack -= phase_increment;
-  }
-  if (end_of_attack < abs(phase_increment)) {
-    end_of_attack = phase_increment;
-  }
-
   // cut out the output completely when smoothness is fully off.
   uint16_t final_gain_end = smoothness_ + 32768;
   CONSTRAIN(final_gain_end, 200, (UINT16_MAX >> 3) + 200);
@@ -411,16 +571,27 @@ void Generator::FillBufferAudioRate() {
   final_gain_end <<= 3;
 
   uint16_t final_gain_increment = (final_gain_end - final_gain_) / size;
+  uint8_t phase_error_shift = ComputePhaseErrorShift();
 
   while (size--) {
     ++sync_counter_;
     uint8_t control = input_buffer_.ImmediateRead();
+    GeneratorEdgeDelay edge_delay = edge_delay_buffer_.ImmediateRead();
+    TrackClock(control, edge_delay);
+
+    // State of the waveform before a reset, to band-limit the discontinuity.
+    bool reset = false;
+    uint32_t reset_phase = phase;
+    bool reset_running = running_;
 
     // When freeze is high, discard any start/reset command.
     if (!(control & CONTROL_FREEZE)) {
       if (control & CONTROL_GATE_RISING) {
-        phase = 0;
+        // The edge occurred a fraction of a sample before this one.
+        phase = static_cast<uint64_t>(abs(phase_increment)) *
+            edge_delay.gate >> 8;
         running_ = true;
+        reset = true;
       } else if (mode_ != GENERATOR_MODE_LOOPING && wrap) {
         phase = 0;
         running_ = false;
@@ -439,7 +610,12 @@ void Generator::FillBufferAudioRate() {
         ++sync_edges_counter_;
         if (sync_edges_counter_ >= frequency_ratio_.q) {
           sync_edges_counter_ = 0;
-          if (sync_counter_ < kSyncCounterMaxTime && sync_counter_) {
+          if (pll_ && clock_period_estimator_.locked()) {
+            target_phase_increment_ = ComputeSyncPhaseIncrement();
+            // The edge occurred a fraction of a sample before this one.
+            local_osc_phase_ = static_cast<uint64_t>(
+                target_phase_increment_) * edge_delay.clock >> 8;
+          } else if (sync_counter_ < kSyncCounterMaxTime && sync_counter_) {
             uint64_t increment = frequency_ratio_.p * static_cast<uint64_t>(
                 0xffffffff / sync_counter_);
             if (increment > 0x80000000) {
@@ -451,16 +627,65 @@ void Generator::FillBufferAudioRate() {
           sync_counter_ = 0;
         }
       }
-      // Fast tracking of the local oscillator to the external oscillator.
-      local_osc_phase_increment_ += static_cast<int32_t>(
-          target_phase_increment_ - local_osc_phase_increment_) >> 8;
+      if (pll_) {
+        // The period estimator already filters the jitter out.
+        local_osc_phase_increment_ = target_phase_increment_;
+      } else {
+        // Fast tracking of the local oscillator to the external oscillator.
+        local_osc_phase_increment_ += static_cast<int32_t>(
+            target_phase_increment_ - local_osc_phase_increment_) >> 8;
+      }
       local_osc_phase_ += local_osc_phase_increment_;
       
       // Slow phase realignment between the master oscillator and the local
       // oscillator.
       int32_t phase_error = local_osc_phase_ - phase;
-      phase_increment = local_osc_phase_increment_ + (phase_error >> 13);
+      phase_increment = local_osc_phase_increment_ +
+          (phase_error >> phase_error_shift);
     }
+
+#ifndef CORE_ONLY
+    if (modulation) {
+      if (!sync_) {
+        int32_t modulated_pitch = pitch + modulation->fm;
+        CONSTRAIN(modulated_pitch, -32768, 32767);
+        phase_increment = ComputePhaseIncrement(modulated_pitch);
+        if (modulated_pitch < 0) {
+          index = 0;
+          xfade = 0;
+        } else if (modulated_pitch >= (19 << 10)) {
+          index = 18;
+          xfade = 65535;
+        } else {
+          index = modulated_pitch >> 10;
+          xfade = modulated_pitch << 6;
+        }
+        wave_1 = waveform_table[WAV_BANDLIMITED_PARABOLA_0 + index];
+        wave_2 = waveform_table[WAV_BANDLIMITED_PARABOLA_0 + index + 1];
+      }
+
+      // Recompute the waveshaping parameters only when they have changed.
+      // The slope has the limits of set_slope, so that it is slope_ when it
+      // is not modulated.
+      int32_t modulated_slope = ConstrainSlope(slope_ + modulation->slope);
+      if (modulated_slope != slope_setting) {
+        slope_setting = modulated_slope;
+        slope.Compute(slope_setting, phase_increment);
+      }
+      int32_t modulated_shape = shape_ + modulation->shape;
+      CONSTRAIN(modulated_shape, -32768, 32767);
+      if (modulated_shape != shape_setting) {
+        shape_setting = modulated_shape;
+        shape = static_cast<uint16_t>(
+            (shape_setting * attenuation >> 15) + 32768);
+        wave_index = WAV_INVERSE_TAN_AUDIO + (shape >> 14);
+        shape_1 = waveform_table[wave_index];
+        shape_2 = waveform_table[wave_index + 1];
+        shape_xfade = shape << 2;
+      }
+      ++modulation;
+    }
+#endif  // CORE_ONLY
     
     if (control & CONTROL_FREEZE) {
       output_buffer_.Overwrite(sample);
@@ -477,31 +702,40 @@ void Generator::FillBufferAudioRate() {
 
 #ifndef CORE_ONLY
 
-    // Clip the phase for compression
-    uint32_t compress_index = compress << 1;
-    compress_index = 65535 - compress_index;
-    compress_index = (compress_index * compress_index) >> 16;
-    compress_index = 65535 - compress_index;
-    compress_index = compress_index * 29 / 30; // knob range
-    compress_index = 65535 - compress_index;
-    uint32_t compressed_phase =
-      (phase >> 16) > compress_index ? 0 :
-      phase / compress_index * UINT16_MAX;
+    uint32_t compressed_phase = slope.CompressPhase(phase);
 
-    // Bipolar version ---------------------------------------------------------
-    int32_t ramp_a, ramp_b, saw;
-    int32_t original, folded;
-    ramp_a = Crossfade1022(wave_1, wave_2, compressed_phase + phase_offset_a_bi, xfade);
-    ramp_b = Crossfade1022(wave_1, wave_2, compressed_phase + phase_offset_b_bi, xfade);
-    saw = (ramp_b - ramp_a) * gain >> 10;
-    CLIP(saw);
-    
-    // Appy shape waveshaper.
-    saw = Crossfade115(shape_1, shape_2, saw + 32768, shape_xfade);
+    int32_t bi_saw, uni_saw;
+    RenderRamps(compressed_phase, slope, wave_1, wave_2, xfade,
+                shape_1, shape_2, shape_xfade, &bi_saw, &uni_saw);
     if (!running_ && !sustained) {
-      saw = 0;
+      bi_saw = uni_saw = 0;
+    }
+
+    // Band-limit the reset with a polyBLEP. The correction spans the samples
+    // before and after the edge, so the ramps are delayed by one sample.
+    if (reset) {
+      int32_t bi_continued = 0;
+      int32_t uni_continued = 0;
+      if (reset_running) {
+        RenderRamps(slope.CompressPhase(reset_phase), slope,
+                    wave_1, wave_2, xfade, shape_1, shape_2, shape_xfade,
+                    &bi_continued, &uni_continued);
+      }
+      int64_t before = edge_delay.gate * edge_delay.gate;
+      int64_t after = (256 - edge_delay.gate) * (256 - edge_delay.gate);
+      int64_t bi_step = bi_saw - bi_continued;
+      int64_t uni_step = uni_saw - uni_continued;
+      bi_blep_delay += bi_step * before >> 17;
+      uni_blep_delay += uni_step * before >> 17;
+      bi_saw -= bi_step * after >> 17;
+      uni_saw -= uni_step * after >> 17;
     }
 
+    // Bipolar version ---------------------------------------------------------
+    int32_t saw, original, folded;
+    saw = bi_blep_delay;
+    bi_blep_delay = bi_saw;
+
     // Run through LPF.
     bi_lp_state_0 += f * (saw - bi_lp_state_0) >> 15;
     bi_lp_state_1 += f * (bi_lp_state_0 - bi_lp_state_1) >> 15;
@@ -513,17 +747,8 @@ void Generator::FillBufferAudioRate() {
     sample.bipolar = (sample.bipolar * final_gain_) >> 16;
 
     // Unipolar version --------------------------------------------------------
-    ramp_a = Crossfade1022(wave_1, wave_2, compressed_phase + phase_offset_a_uni, xfade);
-    ramp_b = Crossfade1022(wave_1, wave_2, compressed_phase + phase_offset_b_uni, xfade);
-    saw = (ramp_b - ramp_a) * gain >> 10;
-    CLIP(saw)
-    
-    // Appy shape waveshaper.
-    saw = Crossfade115(shape_1, shape_2, (saw >> 1) + 32768 + 16384,
-                       shape_xfade);
-    if (!running_ && !sustained) {
-      saw = 0;
-    }
+    saw = uni_blep_delay;
+    uni_blep_delay = uni_saw;
 
     // Run through LPF.
     uni_lp_state_0 += f * (saw - uni_lp_state_0) >> 15;
@@ -539,16 +764,22 @@ void Generator::FillBufferAudioRate() {
     sample.unipolar = phase >> 16;
 #endif  // CORE_ONLY
     
-    sample.flags = 0;
+    uint8_t flags = 0;
 
-    if (compressed_phase >= end_of_attack || !running_) {
-      sample.flags |= FLAG_END_OF_ATTACK;
+    if (compressed_phase >= slope.end_of_attack || !running_) {
+      flags |= FLAG_END_OF_ATTACK;
     }
 
     if (!(control & CONTROL_CLOCK) &&
 	sub_phase_ & 0x80000000) {
-      sample.flags |= FLAG_END_OF_RELEASE;
+      flags |= FLAG_END_OF_RELEASE;
     }
+#ifndef CORE_ONLY
+    sample.flags = flags_delay;
+    flags_delay = flags;
+#else
+    sample.flags = flags;
+#endif  // CORE_ONLY
     output_buffer_.Overwrite(sample);
     
     if (running_ && !sustained) {
@@ -565,6 +796,9 @@ void Generator::FillBufferAudioRate() {
   uni_lp_state_[1] = uni_lp_state_1;
   bi_lp_state_[0] = bi_lp_state_0;
   bi_lp_state_[1] = bi_lp_state_1;
+  bi_blep_delay_ = bi_blep_delay;
+  uni_blep_delay_ = uni_blep_delay;
+  flags_delay_ = flags_delay;
   
   previous_sample_ = sample;
   phase_ = phase;
@@ -572,7 +806,7 @@ void Generator::FillBufferAudioRate() {
   wrap_ = wrap;
 }
 
-void Generator::FillBufferControlRate() {
+void Generator::FillBufferControlRate(const GeneratorModulation* modulation) {
   uint8_t size = kBlockSize;
   
   if (sync_) {
@@ -593,9 +827,33 @@ void Generator::FillBufferControlRate() {
   const int16_t* shape_2 = waveform_table[wave_index + 1];
   uint16_t shape_xfade = shape << 3;
   
+  // Once the shape setting has not moved for a block, the crossfade between
+  // the two shape tables is baked into a single table, read with one lookup
+  // per sample. While the setting moves, the tables are crossfaded per sample
+  // rather than rebuilt for every block.
+  const int16_t* shape_table = NULL;
+  if (!modulation) {
+    if (!control_shape_table_valid_ || shape != control_shape_table_shape_) {
+      control_shape_table_valid_ = false;
+      if (shape == previous_control_shape_) {
+        for (uint16_t i = 0; i < WAV_REVERSED_CONTROL_SIZE; ++i) {
+          int32_t a = shape_1[i];
+          int32_t b = shape_2[i];
+          control_shape_table_[i] = a + ((b - a) * shape_xfade >> 16);
+        }
+        control_shape_table_shape_ = shape;
+        control_shape_table_valid_ = true;
+      }
+    }
+    if (control_shape_table_valid_) {
+      shape_table = control_shape_table_;
+    }
+  }
+  previous_control_shape_ = shape;
+
   int64_t frequency = ComputeCutoffFrequency(pitch_, smoothness_);
   int64_t f_a = lut_cutoff[frequency >> 7];
-  int64_t f_b = lut_cutoff[(frequency >> 7) + 1];
+  int64_t f_b = lut_cutoff[NextCutoffIndex(frequency)];
   int64_t f = f_a + ((f_b - f_a) * (frequency & 0x7f) >> 7);
   int32_t wf_gain = 2048;
   int32_t wf_balance = 0;
@@ -616,6 +874,7 @@ void Generator::FillBufferControlRate() {
   int64_t bi_lp_state_0 = bi_lp_state_[0];
   int64_t bi_lp_state_1 = bi_lp_state_[1];
   int32_t previous_smoothed_slope = 0x7fffffff;
+  int16_t shape_setting = shape_;
   uint32_t end_of_attack = 1UL << 31;
   uint32_t attack_factor = 1 << kSlopeBits;
   uint32_t decay_factor = 1 << kSlopeBits;
@@ -626,11 +885,41 @@ void Generator::FillBufferControlRate() {
     smoothed_slope += (slope_ - smoothed_slope) >> 4;
     
     uint8_t control = input_buffer_.ImmediateRead();
+    GeneratorEdgeDelay edge_delay = edge_delay_buffer_.ImmediateRead();
+    TrackClock(control, edge_delay);
+
+    // The modulation is applied on top of the smoothed knob value, so that it
+    // is not low-pass filtered away.
+    int32_t modulated_slope = smoothed_slope;
+    if (modulation) {
+      if (!sync_) {
+        int32_t modulated_pitch = pitch_ + modulation->fm;
+        CONSTRAIN(modulated_pitch, -32768, 32767);
+        phase_increment = ComputePhaseIncrement(modulated_pitch);
+      }
+      modulated_slope = ConstrainSlope(modulated_slope + modulation->slope);
+#ifndef CORE_ONLY
+      int32_t modulated_shape = shape_ + modulation->shape;
+      CONSTRAIN(modulated_shape, -32768, 32767);
+      if (modulated_shape != shape_setting) {
+        shape_setting = modulated_shape;
+        shape = static_cast<uint16_t>(shape_setting + 32768);
+        shape = (shape >> 2) * 3;
+        wave_index = WAV_REVERSED_CONTROL + (shape >> 13);
+        shape_1 = waveform_table[wave_index];
+        shape_2 = waveform_table[wave_index + 1];
+        shape_xfade = shape << 3;
+      }
+#endif  // CORE_ONLY
+      ++modulation;
+    }
 
     // When freeze is high, discard any start/reset command.
     if (!(control & CONTROL_FREEZE)) {
       if (control & CONTROL_GATE_RISING) {
-        phase = 0;
+        // The edge occurred a fraction of a sample before this one.
+        phase = static_cast<uint64_t>(phase_increment) *
+            edge_delay.gate >> 8;
         running_ = true;
       } else if (mode_ != GENERATOR_MODE_LOOPING && wrap) {
         running_ = false;
@@ -641,6 +930,8 @@ void Generator::FillBufferControlRate() {
     if ((control & CONTROL_CLOCK_RISING) && sync_ && sync_counter_) {
       if (sync_counter_ >= kSyncCounterMaxTime) {
         phase = 0;
+      } else if (pll_ && clock_period_estimator_.locked()) {
+        phase_increment = ComputeSyncPhaseIncrement();
       } else {
         uint32_t predicted_period = pattern_predictor_.Predict(sync_counter_);
         uint64_t increment = frequency_ratio_.p * static_cast<uint64_t>(
@@ -659,9 +950,9 @@ void Generator::FillBufferControlRate() {
     }
     
     // Recompute the waveshaping parameters only when the slope has changed.
-    if (smoothed_slope != previous_smoothed_slope) {
+    if (modulated_slope != previous_smoothed_slope) {
        uint32_t slope_offset = Interpolate88(
-            lut_slope_compression, smoothed_slope + 32768);
+            lut_slope_compression, modulated_slope + 32768);
       if (slope_offset <= 1) {
         decay_factor = 32768 << kSlopeBits;
         attack_factor = 1 << (kSlopeBits - 1);
@@ -669,7 +960,7 @@ void Generator::FillBufferControlRate() {
         decay_factor = (32768 << kSlopeBits) / slope_offset;
         attack_factor = (32768 << kSlopeBits) / (65536 - slope_offset);
       }
-      previous_smoothed_slope = smoothed_slope;
+      previous_smoothed_slope = modulated_slope;
       end_of_attack = slope_offset << 16;
     }
     
@@ -692,21 +983,23 @@ void Generator::FillBufferControlRate() {
 
 #ifndef CORE_ONLY  
     int32_t original, folded;
-    int32_t unipolar = Crossfade106(
-        shape_1,
-        shape_2,
-        skewed_phase >> 16, shape_xfade);
+    int32_t unipolar = shape_table
+        ? Interpolate106(shape_table, skewed_phase >> 16)
+        : Crossfade106(shape_1, shape_2, skewed_phase >> 16, shape_xfade);
     uni_lp_state_0 += f * ((unipolar << 16) - uni_lp_state_0) >> 31;
     uni_lp_state_1 += f * (uni_lp_state_0 - uni_lp_state_1) >> 31;
     
+    // The folder is bypassed when smoothness is not in its range.
     original = uni_lp_state_1 >> 15;
-    folded = Interpolate1022(wav_unipolar_fold, original * wf_gain) << 1;
-    sample.unipolar = original + ((folded - original) * wf_balance >> 15);
+    sample.unipolar = original;
+    if (wf_balance) {
+      folded = Interpolate1022(wav_unipolar_fold, original * wf_gain) << 1;
+      sample.unipolar = original + ((folded - original) * wf_balance >> 15);
+    }
     
-    int32_t bipolar = Crossfade106(
-        shape_1,
-        shape_2,
-        skewed_phase >> 15, shape_xfade);
+    int32_t bipolar = shape_table
+        ? Interpolate106(shape_table, skewed_phase >> 15)
+        : Crossfade106(shape_1, shape_2, skewed_phase >> 15, shape_xfade);
     if (skewed_phase >= (1UL << 31)) {
       bipolar = -bipolar;
     }
@@ -715,8 +1008,11 @@ void Generator::FillBufferControlRate() {
     bi_lp_state_1 += f * (bi_lp_state_0 - bi_lp_state_1) >> 31;
     
     original = bi_lp_state_1 >> 16;
-    folded = Interpolate1022(wav_bipolar_fold, original * wf_gain + (1UL << 31));
-    sample.bipolar = original + ((folded - original) * wf_balance >> 15);
+    sample.bipolar = original;
+    if (wf_balance) {
+      folded = Interpolate1022(wav_bipolar_fold, original * wf_gain + (1UL << 31));
+      sample.bipolar = original + ((folded - original) * wf_balance >> 15);
+    }
 
 #else    
     sample.bipolar = (skewed_phase >> 16) - 32768;
@@ -775,6 +1071,7 @@ void Generator::FillBufferControlRate() {
 }
 
 
+#ifdef WAVETABLE_HACK
 void Generator::FillBufferWavetable() {
   uint8_t size = kBlockSize;
   
@@ -805,7 +1102,7 @@ void Generator::FillBufferWavetable() {
   
   int32_t frequency = ComputeCutoffFrequency(pitch_, smoothness_);
   int32_t f_a = lut_cutoff[frequency >> 7] >> 16;
-  int32_t f_b = lut_cutoff[(frequency >> 7) + 1] >> 16;
+  int32_t f_b = lut_cutoff[NextCutoffIndex(frequency)] >> 16;
   int32_t f = f_a + ((f_b - f_a) * (frequency & 0x7f) >> 7);
   int32_t lp_state_0 = bi_lp_state_[0];
   int32_t lp_state_1 = bi_lp_state_[1];
@@ -814,6 +1111,7 @@ void Generator::FillBufferWavetable() {
   while (size--) {
     ++sync_counter_;
     uint8_t control = input_buffer_.ImmediateRead();
+    edge_delay_buffer_.ImmediateRead();
     
     // When freeze is high, discard any start/reset command.
     if (!(control & CONTROL_FREEZE)) {
@@ -931,6 +1229,7 @@ void Generator::FillBufferWavetable() {
   bi_lp_state_[0] = lp_state_0;
   bi_lp_state_[1] = lp_state_1;
 }
+#endif  // WAVETABLE_HACK
 
 uint16_t ComputePeak(uint16_t center, uint16_t width, uint16_t x) {
   uint16_t peak;
@@ -1013,14 +1312,18 @@ void Generator::FillBufferHarmonic() {
   }
 
   int32_t phase_increment_increment = (phase_increment_end - phase_increment_) / size;
+  uint8_t phase_error_shift = ComputePhaseErrorShift();
 
   while (size--) {
     sync_counter_++;
 
     uint8_t control = input_buffer_.ImmediateRead();
+    GeneratorEdgeDelay edge_delay = edge_delay_buffer_.ImmediateRead();
+    TrackClock(control, edge_delay);
 
     if (control & CONTROL_GATE_RISING) {
-      phase_ = 0;
+      phase_ = static_cast<uint64_t>(phase_increment_) *
+          edge_delay.gate >> 8;
       sub_phase_ = 0;
     }
 
@@ -1035,8 +1338,8 @@ void Generator::FillBufferHarmonic() {
 
     // clock input randomizes mode and range if not in PLL mode
     if (control & CONTROL_CLOCK_RISING && !sync_) {
-      mode_ = static_cast<GeneratorMode>(Random::GetWord() % 3);
-      range_ = static_cast<GeneratorRange>(Random::GetWord() % 3);
+      mode_ = static_cast<GeneratorMode>(random_.GetWord() % 3);
+      range_ = static_cast<GeneratorRange>(random_.GetWord() % 3);
     }
 
     if (sync_) {
@@ -1044,7 +1347,11 @@ void Generator::FillBufferHarmonic() {
         ++sync_edges_counter_;
         if (sync_edges_counter_ >= frequency_ratio_.q) {
           sync_edges_counter_ = 0;
-          if (sync_counter_ < kSyncCounterMaxTime && sync_counter_) {
+          if (pll_ && clock_period_estimator_.locked()) {
+            target_phase_increment_ = ComputeSyncPhaseIncrement();
+            local_osc_phase_ = static_cast<uint64_t>(
+                target_phase_increment_) * edge_delay.clock >> 8;
+          } else if (sync_counter_ < kSyncCounterMaxTime && sync_counter_) {
             uint64_t increment = frequency_ratio_.p * static_cast<uint64_t>(
                 0xffffffff / sync_counter_);
             if (increment > 0x80000000) {
@@ -1057,15 +1364,20 @@ void Generator::FillBufferHarmonic() {
         }
       }
 
-      // Fast tracking of the local oscillator to the external oscillator.
-      local_osc_phase_increment_ += static_cast<int32_t>(
-        target_phase_increment_ - local_osc_phase_increment_) >> 5;
+      if (pll_) {
+        local_osc_phase_increment_ = target_phase_increment_;
+      } else {
+        // Fast tracking of the local oscillator to the external oscillator.
+        local_osc_phase_increment_ += static_cast<int32_t>(
+          target_phase_increment_ - local_osc_phase_increment_) >> 5;
+      }
       local_osc_phase_ += local_osc_phase_increment_;
       
       // Slow phase realignment between the master oscillator and the local
       // oscillator.
       int32_t phase_error = local_osc_phase_ - phase_;
-      phase_increment_ = local_osc_phase_increment_ + (phase_error >> 13);
+      phase_increment_ = local_osc_phase_increment_ +
+          (phase_error >> phase_error_shift);
     }
 
     int32_t bipolar = 0;
@@ -1092,8 +1404,10 @@ void Generator::FillBufferHarmonic() {
       int32_t t = tn;
       if (gmode == GENERATOR_MODE_AR) { // power of two harmonics
         if (harm == kNumHarmonicsPowers) break;
+        // Harmonic 2^(harm + 1), read afresh to stop the error of the
+        // doubling recurrence from building up.
         if ((harm & 3) == 0)
-          tn = Interpolate1121(wav_sine1024, phase_ << harm);
+          tn = Interpolate1022(wav_sine1024, phase_ << (harm + 1));
         else
           tn = 2 * ((tn * tn) >> 15) - 32768;
       } else if (gmode == GENERATOR_MODE_AD) { // odd harmonics
@@ -1132,12 +1446,14 @@ void Generator::FillBufferHarmonic() {
 }
 
 void Generator::RandomizeHarmonicDistribution() {
+  uint32_t words[kNumHarmonics];
+  random_.Fill(words, kNumHarmonics);
   for(int i=0;i<kNumHarmonics;++i) {
     harm_permut_[i]=i;
   }
   for (int i = kNumHarmonics-1; i >= 0; --i) {
     //generate a random number [0, n-1]
-    int j = rand() % (i+1);
+    int j = words[i] % (i+1);
     //swap the last element with element at random index
     int temp = harm_permut_[i];
     harm_permut_[i] = harm_permut_[j];
@@ -1194,7 +1510,7 @@ inline void Generator::RandomizeDelay() {
   uint32_t delay_ratio = slope_ + 32768;
   delay_ratio = (delay_ratio * delay_ratio) >> 16; // square knob response
   uint32_t max_delay = (period * delay_ratio) >> 16;
-  delay_ = ((Random::GetWord() >> 16) * max_delay) >> 11;
+  delay_ = ((random_.GetWord() >> 16) * max_delay) >> 11;
   delayed_phase_increment_ = UINT32_MAX / (period + delay_);
 }
 
@@ -1203,7 +1519,7 @@ void Generator::RandomizeDivider() {
   if (skip_prob > UINT16_MAX - 256)
     divider_ = 1;
   else
-    divider_ = Random::GetGeometric(skip_prob) + 1;
+    divider_ = random_.GetGeometric(skip_prob) + 1;
 }
 
 void Generator::FillBufferRandom() {
@@ -1222,14 +1538,17 @@ void Generator::FillBufferRandom() {
     sync_counter_++;
 
     uint8_t control = input_buffer_.ImmediateRead();
+    GeneratorEdgeDelay edge_delay = edge_delay_buffer_.ImmediateRead();
+    TrackClock(control, edge_delay);
 
     // on trigger
     if (control & CONTROL_GATE_RISING) {
       uint16_t skip_prob = slope_ + 32768;
       // start divided osc. after coin toss
-      if ((Random::GetWord() >> 16) < skip_prob) {
+      if ((random_.GetWord() >> 16) < skip_prob) {
         running_ = true;
-        phase_ = 0;
+        phase_ = static_cast<uint64_t>(phase_increment_) *
+            edge_delay.gate >> 8;
         divided_phase_ = 0;
       }
 
@@ -1248,13 +1567,15 @@ void Generator::FillBufferRandom() {
     }
 
     if ((control & CONTROL_CLOCK_RISING) && !sync_) {
-      range_ = static_cast<GeneratorRange>(Random::GetWord() % 3);
+      range_ = static_cast<GeneratorRange>(random_.GetWord() % 3);
     }
 
     // on clock in sync mode
     if ((control & CONTROL_CLOCK_RISING) && sync_ && sync_counter_) {
       if (sync_counter_ >= kSyncCounterMaxTime) {
         phase_ = 0;
+      } else if (pll_ && clock_period_estimator_.locked()) {
+        phase_increment_ = ComputeSyncPhaseIncrement();
       } else {
         uint32_t predicted_period = pattern_predictor_.Predict(sync_counter_);
         uint64_t increment = frequency_ratio_.p * static_cast<uint64_t>(
@@ -1289,7 +1610,7 @@ void Generator::FillBufferRandom() {
       CONSTRAIN(a, 0, UINT16_MAX);
       int32_t b = pulse_width_ + (slope_ + 32768) / 2;
       CONSTRAIN(b, 0, UINT16_MAX);
-      uint32_t thresh = (Random::GetWord() >> 16) * (b-a) / INT16_MAX + a;
+      uint32_t thresh = (random_.GetWord() >> 16) * (b-a) / INT16_MAX + a;
       uint32_t min_thresh = delayed_phase_increment_ / 3000;
       uint32_t max_thresh = UINT16_MAX - (delayed_phase_increment_ / 3000);
       CONSTRAIN(thresh, min_thresh, max_thresh);
@@ -1298,7 +1619,7 @@ void Generator::FillBufferRandom() {
       // compute next value for ch. 1
       uint32_t step_max = 65536 - (smoothness_ + 32768);
       current_value_[0] = value_[0];
-      uint16_t rnd = ((Random::GetWord() >> 16) * step_max) >> 16;
+      uint16_t rnd = ((random_.GetWord() >> 16) * step_max) >> 16;
       rnd *= walk_direction_[0] ? 1 : -1;
       next_value_[0] = fold_add(next_value_[0], rnd);
       walk_direction_[0] = !walk_direction_[0];
@@ -1311,7 +1632,7 @@ void Generator::FillBufferRandom() {
       // compute next value for ch. 2
       uint32_t step_max = smoothness_ + 32768;
       current_value_[1] = value_[1];
-      uint16_t rnd = ((Random::GetWord() >> 16) * step_max) >> 16;
+      uint16_t rnd = ((random_.GetWord() >> 16) * step_max) >> 16;
       rnd *= walk_direction_[1] ? 1 : -1;
       next_value_[1] = fold_add(next_value_[1], rnd);
       walk_direction_[1] = !walk_direction_[1];
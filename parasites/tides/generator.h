@@ -34,7 +34,9 @@
 #include "stmlib/algorithms/pattern_predictor.h"
 #include "stmlib/utils/ring_buffer.h"
 
-// #define WAVETABLE_HACK
+#include "tides/clock_period_estimator.h"
+#include "tides/resources.h"
+#include "tides/xorshift.h"
 
 namespace tides {
 
@@ -70,6 +72,22 @@ struct GeneratorSample {
   uint8_t flags;
 };
 
+// Per-sample modulation, added to the block-rate values set with set_pitch(),
+// set_shape() and set_slope(). Only used by the function generator renderers,
+// and only when audio-rate modulation is enabled.
+struct GeneratorModulation {
+  int16_t fm;
+  int16_t shape;
+  int16_t slope;
+};
+
+// Sub-sample position of the edges flagged in the control byte, as the time
+// elapsed between the edge and the sample, in 1/256th of a sample.
+struct GeneratorEdgeDelay {
+  uint8_t clock;
+  uint8_t gate;
+};
+
 const uint16_t kBlockSize = 16;
 
 struct FrequencyRatio {
@@ -124,13 +142,7 @@ class Generator {
   }
 
   void set_slope(int16_t slope) {
-#ifndef WAVETABLE_HACK
-    if (range_ == GENERATOR_RANGE_HIGH &&
-        feature_mode_ != FEAT_MODE_HARMONIC) {
-      CONSTRAIN(slope, -32512, 32512);
-    }
-#endif  // WAVETABLE_HACK
-    slope_ = slope;
+    slope_ = ConstrainSlope(slope);
   }
 
   void set_smoothness(int16_t smoothness) {
@@ -148,6 +160,7 @@ class Generator {
   void set_sync(bool sync) {
     if (!sync_ && sync) {
       pattern_predictor_.Init();
+      clock_period_estimator_.Init();
     }
     sync_ = sync;
     sync_edges_counter_ = 0;
@@ -157,12 +170,57 @@ class Generator {
     pulse_width_ = pw;
   }
 
+  void set_audio_rate_modulation(bool audio_rate_modulation) {
+    audio_rate_modulation_ = audio_rate_modulation;
+  }
+
+  // Restarts the random sequence used by the "Two Drunks" random walk and by
+  // the harmonic distribution, so that renders can be reproduced.
+  void set_seed(uint32_t seed) {
+    seed_ = seed;
+    random_.Init(seed);
+    RandomizeHarmonicDistribution();
+  }
+
+  // In PLL mode, the period of the clock is estimated from the (sub-sample
+  // accurate) interval between consecutive edges rather than from the sample
+  // count since the last edge.
+  void set_pll(bool pll) {
+    if (!pll_ && pll) {
+      clock_period_estimator_.Init();
+    }
+    pll_ = pll;
+  }
+
   inline GeneratorMode mode() const { return mode_; }
   inline GeneratorRange range() const { return range_; }
   inline bool sync() const { return sync_; }
+  inline bool audio_rate_modulation() const { return audio_rate_modulation_; }
+  inline bool pll() const { return pll_; }
+  inline uint32_t seed() const { return seed_; }
+  inline uint16_t clock_lock_quality() const {
+    return sync_ && pll_ ? clock_period_estimator_.lock_quality() : 0;
+  }
   
   inline GeneratorSample Process(uint8_t control) {
+    GeneratorModulation modulation = { 0, 0, 0 };
+    return Process(control, modulation);
+  }
+
+  inline GeneratorSample Process(
+      uint8_t control,
+      const GeneratorModulation& modulation) {
+    GeneratorEdgeDelay edge_delay = { 0, 0 };
+    return Process(control, modulation, edge_delay);
+  }
+
+  inline GeneratorSample Process(
+      uint8_t control,
+      const GeneratorModulation& modulation,
+      const GeneratorEdgeDelay& edge_delay) {
     input_buffer_.Overwrite(control);
+    modulation_buffer_.Overwrite(modulation);
+    edge_delay_buffer_.Overwrite(edge_delay);
     return output_buffer_.ImmediateRead();
   }
   
@@ -194,11 +252,25 @@ class Generator {
   FeatureMode feature_mode_;
 
  private:
+  // Limits of the slope in the current range and feature mode.
+  int16_t ConstrainSlope(int32_t slope) const {
+#ifndef WAVETABLE_HACK
+    if (range_ == GENERATOR_RANGE_HIGH &&
+        feature_mode_ != FEAT_MODE_HARMONIC) {
+      CONSTRAIN(slope, -32512, 32512);
+    }
+#endif  // WAVETABLE_HACK
+    CONSTRAIN(slope, -32768, 32767);
+    return slope;
+  }
+
   // There are two versions of the rendering code, one optimized for audio, with
   // band-limiting.
-  void FillBufferAudioRate();
-  void FillBufferControlRate();
+  void FillBufferAudioRate(const GeneratorModulation* modulation);
+  void FillBufferControlRate(const GeneratorModulation* modulation);
+#ifdef WAVETABLE_HACK
   void FillBufferWavetable();
+#endif  // WAVETABLE_HACK
   template<GeneratorMode gmode> void FillBufferHarmonic();
   void FillBufferRandom();
   int32_t ComputeAntialiasAttenuation(
@@ -210,14 +282,21 @@ class Generator {
   inline void ClearFilterState() {
     uni_lp_state_[0] = uni_lp_state_[1] = 0;
     bi_lp_state_[0] = bi_lp_state_[1] = 0;
+    uni_blep_delay_ = bi_blep_delay_ = 0;
+    flags_delay_ = 0;
   }
 
   int32_t ComputePhaseIncrement(int16_t pitch);
   int16_t ComputePitch(int32_t phase_increment);
   int32_t ComputeCutoffFrequency(int16_t pitch, int16_t smoothness);
   void ComputeFrequencyRatio(int16_t pitch);
+  void TrackClock(uint8_t control, const GeneratorEdgeDelay& edge_delay);
+  uint32_t ComputeSyncPhaseIncrement() const;
+  uint8_t ComputePhaseErrorShift() const;
 
   stmlib::RingBuffer<uint8_t, kBlockSize * 2> input_buffer_;
+  stmlib::RingBuffer<GeneratorModulation, kBlockSize * 2> modulation_buffer_;
+  stmlib::RingBuffer<GeneratorEdgeDelay, kBlockSize * 2> edge_delay_buffer_;
   stmlib::RingBuffer<GeneratorSample, kBlockSize * 2> output_buffer_;
    
   GeneratorMode mode_;
@@ -233,6 +312,8 @@ class Generator {
   int32_t smoothed_slope_;
   int16_t smoothness_;
   bool antialiasing_;
+  bool audio_rate_modulation_;
+  bool pll_;
   uint16_t final_gain_;
   
   uint32_t phase_;
@@ -274,10 +355,30 @@ class Generator {
   uint32_t eor_counter_;
 
   stmlib::PatternPredictor<32, 8> pattern_predictor_;
+
+  Xorshift random_;
+  uint32_t seed_;
+
+  // Sub-sample clock period measurement for PLL mode.
+  ClockPeriodEstimator clock_period_estimator_;
+  uint32_t clock_counter_;
+  uint8_t clock_edge_delay_;
   
   int64_t uni_lp_state_[2];
   int64_t bi_lp_state_[2];
 
+  // Crossfade of the two shape tables used by the control-rate renderer.
+  int16_t control_shape_table_[WAV_REVERSED_CONTROL_SIZE];
+  uint16_t control_shape_table_shape_;
+  uint16_t previous_control_shape_;
+  bool control_shape_table_valid_;
+
+  // One sample delay of the audio-rate ramps, for the polyBLEP correction,
+  // and of the flags, which stay aligned with them.
+  int32_t uni_blep_delay_;
+  int32_t bi_blep_delay_;
+  uint8_t flags_delay_;
+
   bool running_;
   bool previous_freeze_;
   bool previous_clock_;
@@ -9791,11717 +9791,5 @@ const int16_t* waveform_table[] = {
   wav_unipolar_fold,
 };
 
-const int16_t wt_waves[] = {
-       0,    804,   1608,   2410,
-    3212,   4011,   4808,   5602,
-    6392,   7179,   7961,   8739,
-    9511,  10278,  11039,  11792,
-   12539,  13278,  14009,  14732,
-   15446,  16150,  16845,  17530,
-   18204,  18867,  19519,  20159,
-   20787,  21402,  22004,  22593,
-   23169,  23731,  24278,  24811,
-   25328,  25831,  26318,  26789,
-   27244,  27682,  28104,  28509,
-   28897,  29267,  29620,  29955,
-   30272,  30570,  30851,  31112,
-   31355,  31579,  31784,  31970,
-   32136,  32284,  32411,  32520,
-   32608,  32677,  32727,  32756,
-   32766,  32756,  32727,  32677,
-   32608,  32520,  32411,  32284,
-   32136,  31970,  31784,  31579,
-   31355,  31112,  30851,  30570,
-   30272,  29955,  29620,  29267,
-   28897,  28509,  28104,  27682,
-   27244,  26789,  26318,  25831,
-   25328,  24811,  24278,  23731,
-   23169,  22593,  22004,  21402,
-   20787,  20159,  19519,  18867,
-   18204,  17530,  16845,  16150,
-   15446,  14732,  14009,  13278,
-   12539,  11792,  11039,  10278,
-    9511,   8739,   7961,   7179,
-    6392,   5602,   4808,   4011,
-    3212,   2410,   1608,    804,
-       0,   -804,  -1608,  -2410,
-   -3212,  -4011,  -4808,  -5602,
-   -6392,  -7179,  -7961,  -8739,
-   -9511, -10278, -11039, -11792,
-  -12539, -13278, -14009, -14732,
-  -15446, -16150, -16845, -17530,
-  -18204, -18867, -19519, -20159,
-  -20787, -21402, -22004, -22593,
-  -23169, -23731, -24278, -24811,
-  -25328, -25831, -26318, -26789,
-  -27244, -27682, -28104, -28509,
-  -28897, -29267, -29620, -29955,
-  -30272, -30570, -30851, -31112,
-  -31355, -31579, -31784, -31970,
-  -32136, -32284, -32411, -32520,
-  -32608, -32677, -32727, -32756,
-  -32766, -32756, -32727, -32677,
-  -32608, -32520, -32411, -32284,
-  -32136, -31970, -31784, -31579,
-  -31355, -31112, -30851, -30570,
-  -30272, -29955, -29620, -29267,
-  -28897, -28509, -28104, -27682,
-  -27244, -26789, -26318, -25831,
-  -25328, -24811, -24278, -23731,
-  -23169, -22593, -22004, -21402,
-  -20787, -20159, -19519, -18867,
-  -18204, -17530, -16845, -16150,
-  -15446, -14732, -14009, -13278,
-  -12539, -11792, -11039, -10278,
-   -9511,  -8739,  -7961,  -7179,
-   -6392,  -5602,  -4808,  -4011,
-   -3212,  -2410,  -1608,   -804,
-       0,      0,   1608,   3212,
-    4808,   6392,   7961,   9511,
-   11039,  12539,  14009,  15446,
-   16845,  18204,  19519,  20787,
-   22004,  23169,  24278,  25328,
-   26318,  27244,  28104,  28897,
-   29620,  30272,  30851,  31355,
-   31784,  32136,  32411,  32608,
-   32727,  32766,  32727,  32608,
-   32411,  32136,  31784,  31355,
-   30851,  30272,  29620,  28897,
-   28104,  27244,  26318,  25328,
-   24278,  23169,  22004,  20787,
-   19519,  18204,  16845,  15446,
-   14009,  12539,  11039,   9511,
-    7961,   6392,   4808,   3212,
-    1608,      0,  -1608,  -3212,
-   -4808,  -6392,  -7961,  -9511,
-  -11039, -12539, -14009, -15446,
-  -16845, -18204, -19519, -20787,
-  -22004, -23169, -24278, -25328,
-  -26318, -27244, -28104, -28897,
-  -29620, -30272, -30851, -31355,
-  -31784, -32136, -32411, -32608,
-  -32727, -32766, -32727, -32608,
-  -32411, -32136, -31784, -31355,
-  -30851, -30272, -29620, -28897,
-  -28104, -27244, -26318, -25328,
-  -24278, -23169, -22004, -20787,
-  -19519, -18204, -16845, -15446,
-  -14009, -12539, -11039,  -9511,
-   -7961,  -6392,  -4808,  -3212,
-   -1608,      0,   1608,   3212,
-    4808,   6392,   7961,   9511,
-   11039,  12539,  14009,  15446,
-   16845,  18204,  19519,  20787,
-   22004,  23169,  24278,  25328,
-   26318,  27244,  28104,  28897,
-   29620,  30272,  30851,  31355,
-   31784,  32136,  32411,  32608,
-   32727,  32766,  32727,  32608,
-   32411,  32136,  31784,  31355,
-   30851,  30272,  29620,  28897,
-   28104,  27244,  26318,  25328,
-   24278,  23169,  22004,  20787,
-   19519,  18204,  16845,  15446,
-   14009,  12539,  11039,   9511,
-    7961,   6392,   4808,   3212,
-    1608,      0,  -1608,  -3212,
-   -4808,  -6392,  -7961,  -9511,
-  -11039, -12539, -14009, -15446,
-  -16845, -18204, -19519, -20787,
-  -22004, -23169, -24278, -25328,
-  -26318, -27244, -28104, -28897,
-  -29620, -30272, -30851, -31355,
-  -31784, -32136, -32411, -32608,
-  -32727, -32766, -32727, -32608,
-  -32411, -32136, -31784, -31355,
-  -30851, -30272, -29620, -28897,
-  -28104, -27244, -26318, -25328,
-  -24278, -23169, -22004, -20787,
-  -19519, -18204, -16845, -15446,
-  -14009, -12539, -11039,  -9511,
-   -7961,  -6392,  -4808,  -3212,
-   -1608,      0,      0,   2410,
-    4808,   7179,   9511,  11792,
-   14009,  16150,  18204,  20159,
-   22004,  23731,  25328,  26789,
-   28104,  29267,  30272,  31112,
-   31784,  32284,  32608,  32756,
-   32727,  32520,  32136,  31579,
-   30851,  29955,  28897,  27682,
-   26318,  24811,  23169,  21402,
-   19519,  17530,  15446,  13278,
-   11039,   8739,   6392,   4011,
-    1608,   -804,  -3212,  -5602,
-   -7961, -10278, -12539, -14732,
-  -16845, -18867, -20787, -22593,
-  -24278, -25831, -27244, -28509,
-  -29620, -30570, -31355, -31970,
-  -32411, -32677, -32766, -32677,
-  -32411, -31970, -31355, -30570,
-  -29620, -28509, -27244, -25831,
-  -24278, -22593, -20787, -18867,
-  -16845, -14732, -12539, -10278,
-   -7961,  -5602,  -3212,   -804,
-    1608,   4011,   6392,   8739,
-   11039,  13278,  15446,  17530,
-   19519,  21402,  23169,  24811,
-   26318,  27682,  28897,  29955,
-   30851,  31579,  32136,  32520,
-   32727,  32756,  32608,  32284,
-   31784,  31112,  30272,  29267,
-   28104,  26789,  25328,  23731,
-   22004,  20159,  18204,  16150,
-   14009,  11792,   9511,   7179,
-    4808,   2410,      0,  -2410,
-   -4808,  -7179,  -9511, -11792,
-  -14009, -16150, -18204, -20159,
-  -22004, -23731, -25328, -26789,
-  -28104, -29267, -30272, -31112,
-  -31784, -32284, -32608, -32756,
-  -32727, -32520, -32136, -31579,
-  -30851, -29955, -28897, -27682,
-  -26318, -24811, -23169, -21402,
-  -19519, -17530, -15446, -13278,
-  -11039,  -8739,  -6392,  -4011,
-   -1608,    804,   3212,   5602,
-    7961,  10278,  12539,  14732,
-   16845,  18867,  20787,  22593,
-   24278,  25831,  27244,  28509,
-   29620,  30570,  31355,  31970,
-   32411,  32677,  32766,  32677,
-   32411,  31970,  31355,  30570,
-   29620,  28509,  27244,  25831,
-   24278,  22593,  20787,  18867,
-   16845,  14732,  12539,  10278,
-    7961,   5602,   3212,    804,
-   -1608,  -4011,  -6392,  -8739,
-  -11039, -13278, -15446, -17530,
-  -19519, -21402, -23169, -24811,
-  -26318, -27682, -28897, -29955,
-  -30851, -31579, -32136, -32520,
-  -32727, -32756, -32608, -32284,
-  -31784, -31112, -30272, -29267,
-  -28104, -26789, -25328, -23731,
-  -22004, -20159, -18204, -16150,
-  -14009, -11792,  -9511,  -7179,
-   -4808,  -2410,      0,      0,
-    3212,   6392,   9511,  12539,
-   15446,  18204,  20787,  23169,
-   25328,  27244,  28897,  30272,
-   31355,  32136,  32608,  32766,
-   32608,  32136,  31355,  30272,
-   28897,  27244,  25328,  23169,
-   20787,  18204,  15446,  12539,
-    9511,   6392,   3212,      0,
-   -3212,  -6392,  -9511, -12539,
-  -15446, -18204, -20787, -23169,
-  -25328, -27244, -28897, -30272,
-  -31355, -32136, -32608, -32766,
-  -32608, -32136, -31355, -30272,
-  -28897, -27244, -25328, -23169,
-  -20787, -18204, -15446, -12539,
-   -9511,  -6392,  -3212,      0,
-    3212,   6392,   9511,  12539,
-   15446,  18204,  20787,  23169,
-   25328,  27244,  28897,  30272,
-   31355,  32136,  32608,  32766,
-   32608,  32136,  31355,  30272,
-   28897,  27244,  25328,  23169,
-   20787,  18204,  15446,  12539,
-    9511,   6392,   3212,      0,
-   -3212,  -6392,  -9511, -12539,
-  -15446, -18204, -20787, -23169,
-  -25328, -27244, -28897, -30272,
-  -31355, -32136, -32608, -32766,
-  -32608, -32136, -31355, -30272,
-  -28897, -27244, -25328, -23169,
-  -20787, -18204, -15446, -12539,
-   -9511,  -6392,  -3212,      0,
-    3212,   6392,   9511,  12539,
-   15446,  18204,  20787,  23169,
-   25328,  27244,  28897,  30272,
-   31355,  32136,  32608,  32766,
-   32608,  32136,  31355,  30272,
-   28897,  27244,  25328,  23169,
-   20787,  18204,  15446,  12539,
-    9511,   6392,   3212,      0,
-   -3212,  -6392,  -9511, -12539,
-  -15446, -18204, -20787, -23169,
-  -25328, -27244, -28897, -30272,
-  -31355, -32136, -32608, -32766,
-  -32608, -32136, -31355, -30272,
-  -28897, -27244, -25328, -23169,
-  -20787, -18204, -15446, -12539,
-   -9511,  -6392,  -3212,      0,
-    3212,   6392,   9511,  12539,
-   15446,  18204,  20787,  23169,
-   25328,  27244,  28897,  30272,
-   31355,  32136,  32608,  32766,
-   32608,  32136,  31355,  30272,
-   28897,  27244,  25328,  23169,
-   20787,  18204,  15446,  12539,
-    9511,   6392,   3212,      0,
-   -3212,  -6392,  -9511, -12539,
-  -15446, -18204, -20787, -23169,
-  -25328, -27244, -28897, -30272,
-  -31355, -32136, -32608, -32766,
-  -32608, -32136, -31355, -30272,
-  -28897, -27244, -25328, -23169,
-  -20787, -18204, -15446, -12539,
-   -9511,  -6392,  -3212,      0,
-       0,   4011,   7961,  11792,
-   15446,  18867,  22004,  24811,
-   27244,  29267,  30851,  31970,
-   32608,  32756,  32411,  31579,
-   30272,  28509,  26318,  23731,
-   20787,  17530,  14009,  10278,
-    6392,   2410,  -1608,  -5602,
-   -9511, -13278, -16845, -20159,
-  -23169, -25831, -28104, -29955,
-  -31355, -32284, -32727, -32677,
-  -32136, -31112, -29620, -27682,
-  -25328, -22593, -19519, -16150,
-  -12539,  -8739,  -4808,   -804,
-    3212,   7179,  11039,  14732,
-   18204,  21402,  24278,  26789,
-   28897,  30570,  31784,  32520,
-   32766,  32520,  31784,  30570,
-   28897,  26789,  24278,  21402,
-   18204,  14732,  11039,   7179,
-    3212,   -804,  -4808,  -8739,
-  -12539, -16150, -19519, -22593,
-  -25328, -27682, -29620, -31112,
-  -32136, -32677, -32727, -32284,
-  -31355, -29955, -28104, -25831,
-  -23169, -20159, -16845, -13278,
-   -9511,  -5602,  -1608,   2410,
-    6392,  10278,  14009,  17530,
-   20787,  23731,  26318,  28509,
-   30272,  31579,  32411,  32756,
-   32608,  31970,  30851,  29267,
-   27244,  24811,  22004,  18867,
-   15446,  11792,   7961,   4011,
-       0,  -4011,  -7961, -11792,
-  -15446, -18867, -22004, -24811,
-  -27244, -29267, -30851, -31970,
-  -32608, -32756, -32411, -31579,
-  -30272, -28509, -26318, -23731,
-  -20787, -17530, -14009, -10278,
-   -6392,  -2410,   1608,   5602,
-    9511,  13278,  16845,  20159,
-   23169,  25831,  28104,  29955,
-   31355,  32284,  32727,  32677,
-   32136,  31112,  29620,  27682,
-   25328,  22593,  19519,  16150,
-   12539,   8739,   4808,    804,
-   -3212,  -7179, -11039, -14732,
-  -18204, -21402, -24278, -26789,
-  -28897, -30570, -31784, -32520,
-  -32766, -32520, -31784, -30570,
-  -28897, -26789, -24278, -21402,
-  -18204, -14732, -11039,  -7179,
-   -3212,    804,   4808,   8739,
-   12539,  16150,  19519,  22593,
-   25328,  27682,  29620,  31112,
-   32136,  32677,  32727,  32284,
-   31355,  29955,  28104,  25831,
-   23169,  20159,  16845,  13278,
-    9511,   5602,   1608,  -2410,
-   -6392, -10278, -14009, -17530,
-  -20787, -23731, -26318, -28509,
-  -30272, -31579, -32411, -32756,
-  -32608, -31970, -30851, -29267,
-  -27244, -24811, -22004, -18867,
-  -15446, -11792,  -7961,  -4011,
-       0,      0,   4808,   9511,
-   14009,  18204,  22004,  25328,
-   28104,  30272,  31784,  32608,
-   32727,  32136,  30851,  28897,
-   26318,  23169,  19519,  15446,
-   11039,   6392,   1608,  -3212,
-   -7961, -12539, -16845, -20787,
-  -24278, -27244, -29620, -31355,
-  -32411, -32766, -32411, -31355,
-  -29620, -27244, -24278, -20787,
-  -16845, -12539,  -7961,  -3212,
-    1608,   6392,  11039,  15446,
-   19519,  23169,  26318,  28897,
-   30851,  32136,  32727,  32608,
-   31784,  30272,  28104,  25328,
-   22004,  18204,  14009,   9511,
-    4808,      0,  -4808,  -9511,
-  -14009, -18204, -22004, -25328,
-  -28104, -30272, -31784, -32608,
-  -32727, -32136, -30851, -28897,
-  -26318, -23169, -19519, -15446,
-  -11039,  -6392,  -1608,   3212,
-    7961,  12539,  16845,  20787,
-   24278,  27244,  29620,  31355,
-   32411,  32766,  32411,  31355,
-   29620,  27244,  24278,  20787,
-   16845,  12539,   7961,   3212,
-   -1608,  -6392, -11039, -15446,
-  -19519, -23169, -26318, -28897,
-  -30851, -32136, -32727, -32608,
-  -31784, -30272, -28104, -25328,
-  -22004, -18204, -14009,  -9511,
-   -4808,      0,   4808,   9511,
-   14009,  18204,  22004,  25328,
-   28104,  30272,  31784,  32608,
-   32727,  32136,  30851,  28897,
-   26318,  23169,  19519,  15446,
-   11039,   6392,   1608,  -3212,
-   -7961, -12539, -16845, -20787,
-  -24278, -27244, -29620, -31355,
-  -32411, -32766, -32411, -31355,
-  -29620, -27244, -24278, -20787,
-  -16845, -12539,  -7961,  -3212,
-    1608,   6392,  11039,  15446,
-   19519,  23169,  26318,  28897,
-   30851,  32136,  32727,  32608,
-   31784,  30272,  28104,  25328,
-   22004,  18204,  14009,   9511,
-    4808,      0,  -4808,  -9511,
-  -14009, -18204, -22004, -25328,
-  -28104, -30272, -31784, -32608,
-  -32727, -32136, -30851, -28897,
-  -26318, -23169, -19519, -15446,
-  -11039,  -6392,  -1608,   3212,
-    7961,  12539,  16845,  20787,
-   24278,  27244,  29620,  31355,
-   32411,  32766,  32411,  31355,
-   29620,  27244,  24278,  20787,
-   16845,  12539,   7961,   3212,
-   -1608,  -6392, -11039, -15446,
-  -19519, -23169, -26318, -28897,
-  -30851, -32136, -32727, -32608,
-  -31784, -30272, -28104, -25328,
-  -22004, -18204, -14009,  -9511,
-   -4808,      0,      0,   5602,
-   11039,  16150,  20787,  24811,
-   28104,  30570,  32136,  32756,
-   32411,  31112,  28897,  25831,
-   22004,  17530,  12539,   7179,
-    1608,  -4011,  -9511, -14732,
-  -19519, -23731, -27244, -29955,
-  -31784, -32677, -32608, -31579,
-  -29620, -26789, -23169, -18867,
-  -14009,  -8739,  -3212,   2410,
-    7961,  13278,  18204,  22593,
-   26318,  29267,  31355,  32520,
-   32727,  31970,  30272,  27682,
-   24278,  20159,  15446,  10278,
-    4808,   -804,  -6392, -11792,
-  -16845, -21402, -25328, -28509,
-  -30851, -32284, -32766, -32284,
-  -30851, -28509, -25328, -21402,
-  -16845, -11792,  -6392,   -804,
-    4808,  10278,  15446,  20159,
-   24278,  27682,  30272,  31970,
-   32727,  32520,  31355,  29267,
-   26318,  22593,  18204,  13278,
-    7961,   2410,  -3212,  -8739,
-  -14009, -18867, -23169, -26789,
-  -29620, -31579, -32608, -32677,
-  -31784, -29955, -27244, -23731,
-  -19519, -14732,  -9511,  -4011,
-    1608,   7179,  12539,  17530,
-   22004,  25831,  28897,  31112,
-   32411,  32756,  32136,  30570,
-   28104,  24811,  20787,  16150,
-   11039,   5602,      0,  -5602,
-  -11039, -16150, -20787, -24811,
-  -28104, -30570, -32136, -32756,
-  -32411, -31112, -28897, -25831,
-  -22004, -17530, -12539,  -7179,
-   -1608,   4011,   9511,  14732,
-   19519,  23731,  27244,  29955,
-   31784,  32677,  32608,  31579,
-   29620,  26789,  23169,  18867,
-   14009,   8739,   3212,  -2410,
-   -7961, -13278, -18204, -22593,
-  -26318, -29267, -31355, -32520,
-  -32727, -31970, -30272, -27682,
-  -24278, -20159, -15446, -10278,
-   -4808,    804,   6392,  11792,
-   16845,  21402,  25328,  28509,
-   30851,  32284,  32766,  32284,
-   30851,  28509,  25328,  21402,
-   16845,  11792,   6392,    804,
-   -4808, -10278, -15446, -20159,
-  -24278, -27682, -30272, -31970,
-  -32727, -32520, -31355, -29267,
-  -26318, -22593, -18204, -13278,
-   -7961,  -2410,   3212,   8739,
-   14009,  18867,  23169,  26789,
-   29620,  31579,  32608,  32677,
-   31784,  29955,  27244,  23731,
-   19519,  14732,   9511,   4011,
-   -1608,  -7179, -12539, -17530,
-  -22004, -25831, -28897, -31112,
-  -32411, -32756, -32136, -30570,
-  -28104, -24811, -20787, -16150,
-  -11039,  -5602,      0,      0,
-    6392,  12539,  18204,  23169,
-   27244,  30272,  32136,  32766,
-   32136,  30272,  27244,  23169,
-   18204,  12539,   6392,      0,
-   -6392, -12539, -18204, -23169,
-  -27244, -30272, -32136, -32766,
-  -32136, -30272, -27244, -23169,
-  -18204, -12539,  -6392,      0,
-    6392,  12539,  18204,  23169,
-   27244,  30272,  32136,  32766,
-   32136,  30272,  27244,  23169,
-   18204,  12539,   6392,      0,
-   -6392, -12539, -18204, -23169,
-  -27244, -30272, -32136, -32766,
-  -32136, -30272, -27244, -23169,
-  -18204, -12539,  -6392,      0,
-    6392,  12539,  18204,  23169,
-   27244,  30272,  32136,  32766,
-   32136,  30272,  27244,  23169,
-   18204,  12539,   6392,      0,
-   -6392, -12539, -18204, -23169,
-  -27244, -30272, -32136, -32766,
-  -32136, -30272, -27244, -23169,
-  -18204, -12539,  -6392,      0,
-    6392,  12539,  18204,  23169,
-   27244,  30272,  32136,  32766,
-   32136,  30272,  27244,  23169,
-   18204,  12539,   6392,      0,
-   -6392, -12539, -18204, -23169,
-  -27244, -30272, -32136, -32766,
-  -32136, -30272, -27244, -23169,
-  -18204, -12539,  -6392,      0,
-    6392,  12539,  18204,  23169,
-   27244,  30272,  32136,  32766,
-   32136,  30272,  27244,  23169,
-   18204,  12539,   6392,      0,
-   -6392, -12539, -18204, -23169,
-  -27244, -30272, -32136, -32766,
-  -32136, -30272, -27244, -23169,
-  -18204, -12539,  -6392,      0,
-    6392,  12539,  18204,  23169,
-   27244,  30272,  32136,  32766,
-   32136,  30272,  27244,  23169,
-   18204,  12539,   6392,      0,
-   -6392, -12539, -18204, -23169,
-  -27244, -30272, -32136, -32766,
-  -32136, -30272, -27244, -23169,
-  -18204, -12539,  -6392,      0,
-    6392,  12539,  18204,  23169,
-   27244,  30272,  32136,  32766,
-   32136,  30272,  27244,  23169,
-   18204,  12539,   6392,      0,
-   -6392, -12539, -18204, -23169,
-  -27244, -30272, -32136, -32766,
-  -32136, -30272, -27244, -23169,
-  -18204, -12539,  -6392,      0,
-    6392,  12539,  18204,  23169,
-   27244,  30272,  32136,  32766,
-   32136,  30272,  27244,  23169,
-   18204,  12539,   6392,      0,
-   -6392, -12539, -18204, -23169,
-  -27244, -30272, -32136, -32766,
-  -32136, -30272, -27244, -23169,
-  -18204, -12539,  -6392,      0,
-       0,   6392,  12539,  18204,
-   23169,  27244,  30272,  32136,
-   32766,  32136,  30272,  27244,
-   23169,  18204,  12539,   6392,
-       0,  -6392, -12539, -18204,
-  -23169, -27244, -30272, -32136,
-  -32766, -32136, -30272, -27244,
-  -23169, -18204, -12539,  -6392,
-       0,   6392,  12539,  18204,
-   23169,  27244,  30272,  32136,
-   32766,  32136,  30272,  27244,
-   23169,  18204,  12539,   6392,
-       0,  -6392, -12539, -18204,
-  -23169, -27244, -30272, -32136,
-  -32766, -32136, -30272, -27244,
-  -23169, -18204, -12539,  -6392,
-       0,   6392,  12539,  18204,
-   23169,  27244,  30272,  32136,
-   32766,  32136,  30272,  27244,
-   23169,  18204,  12539,   6392,
-       0,  -6392, -12539, -18204,
-  -23169, -27244, -30272, -32136,
-  -32766, -32136, -30272, -27244,
-  -23169, -18204, -12539,  -6392,
-       0,   6392,  12539,  18204,
-   23169,  27244,  30272,  32136,
-   32766,  32136,  30272,  27244,
-   23169,  18204,  12539,   6392,
-       0,  -6392, -12539, -18204,
-  -23169, -27244, -30272, -32136,
-  -32766, -32136, -30272, -27244,
-  -23169, -18204, -12539,  -6392,
-       0,   6392,  12539,  18204,
-   23169,  27244,  30272,  32136,
-   32766,  32136,  30272,  27244,
-   23169,  18204,  12539,   6392,
-       0,  -6392, -12539, -18204,
-  -23169, -27244, -30272, -32136,
-  -32766, -32136, -30272, -27244,
-  -23169, -18204, -12539,  -6392,
-       0,   6392,  12539,  18204,
-   23169,  27244,  30272,  32136,
-   32766,  32136,  30272,  27244,
-   23169,  18204,  12539,   6392,
-       0,  -6392, -12539, -18204,
-  -23169, -27244, -30272, -32136,
-  -32766, -32136, -30272, -27244,
-  -23169, -18204, -12539,  -6392,
-       0,   6392,  12539,  18204,
-   23169,  27244,  30272,  32136,
-   32766,  32136,  30272,  27244,
-   23169,  18204,  12539,   6392,
-       0,  -6392, -12539, -18204,
-  -23169, -27244, -30272, -32136,
-  -32766, -32136, -30272, -27244,
-  -23169, -18204, -12539,  -6392,
-       0,   6392,  12539,  18204,
-   23169,  27244,  30272,  32136,
-   32766,  32136,  30272,  27244,
-   23169,  18204,  12539,   6392,
-       0,  -6392, -12539, -18204,
-  -23169, -27244, -30272, -32136,
-  -32766, -32136, -30272, -27244,
-  -23169, -18204, -12539,  -6392,
-       0,      0,   7961,  15446,
-   22004,  27244,  30851,  32608,
-   32411,  30272,  26318,  20787,
-   14009,   6392,  -1608,  -9511,
-  -16845, -23169, -28104, -31355,
-  -32727, -32136, -29620, -25328,
-  -19519, -12539,  -4808,   3212,
-   11039,  18204,  24278,  28897,
-   31784,  32766,  31784,  28897,
-   24278,  18204,  11039,   3212,
-   -4808, -12539, -19519, -25328,
-  -29620, -32136, -32727, -31355,
-  -28104, -23169, -16845,  -9511,
-   -1608,   6392,  14009,  20787,
-   26318,  30272,  32411,  32608,
-   30851,  27244,  22004,  15446,
-    7961,      0,  -7961, -15446,
-  -22004, -27244, -30851, -32608,
-  -32411, -30272, -26318, -20787,
-  -14009,  -6392,   1608,   9511,
-   16845,  23169,  28104,  31355,
-   32727,  32136,  29620,  25328,
-   19519,  12539,   4808,  -3212,
-  -11039, -18204, -24278, -28897,
-  -31784, -32766, -31784, -28897,
-  -24278, -18204, -11039,  -3212,
-    4808,  12539,  19519,  25328,
-   29620,  32136,  32727,  31355,
-   28104,  23169,  16845,   9511,
-    1608,  -6392, -14009, -20787,
-  -26318, -30272, -32411, -32608,
-  -30851, -27244, -22004, -15446,
-   -7961,      0,   7961,  15446,
-   22004,  27244,  30851,  32608,
-   32411,  30272,  26318,  20787,
-   14009,   6392,  -1608,  -9511,
-  -16845, -23169, -28104, -31355,
-  -32727, -32136, -29620, -25328,
-  -19519, -12539,  -4808,   3212,
-   11039,  18204,  24278,  28897,
-   31784,  32766,  31784,  28897,
-   24278,  18204,  11039,   3212,
-   -4808, -12539, -19519, -25328,
-  -29620, -32136, -32727, -31355,
-  -28104, -23169, -16845,  -9511,
-   -1608,   6392,  14009,  20787,
-   26318,  30272,  32411,  32608,
-   30851,  27244,  22004,  15446,
-    7961,      0,  -7961, -15446,
-  -22004, -27244, -30851, -32608,
-  -32411, -30272, -26318, -20787,
-  -14009,  -6392,   1608,   9511,
-   16845,  23169,  28104,  31355,
-   32727,  32136,  29620,  25328,
-   19519,  12539,   4808,  -3212,
-  -11039, -18204, -24278, -28897,
-  -31784, -32766, -31784, -28897,
-  -24278, -18204, -11039,  -3212,
-    4808,  12539,  19519,  25328,
-   29620,  32136,  32727,  31355,
-   28104,  23169,  16845,   9511,
-    1608,  -6392, -14009, -20787,
-  -26318, -30272, -32411, -32608,
-  -30851, -27244, -22004, -15446,
-   -7961,      0,      0,   9511,
-   18204,  25328,  30272,  32608,
-   32136,  28897,  23169,  15446,
-    6392,  -3212, -12539, -20787,
-  -27244, -31355, -32766, -31355,
-  -27244, -20787, -12539,  -3212,
-    6392,  15446,  23169,  28897,
-   32136,  32608,  30272,  25328,
-   18204,   9511,      0,  -9511,
-  -18204, -25328, -30272, -32608,
-  -32136, -28897, -23169, -15446,
-   -6392,   3212,  12539,  20787,
-   27244,  31355,  32766,  31355,
-   27244,  20787,  12539,   3212,
-   -6392, -15446, -23169, -28897,
-  -32136, -32608, -30272, -25328,
-  -18204,  -9511,      0,   9511,
-   18204,  25328,  30272,  32608,
-   32136,  28897,  23169,  15446,
-    6392,  -3212, -12539, -20787,
-  -27244, -31355, -32766, -31355,
-  -27244, -20787, -12539,  -3212,
-    6392,  15446,  23169,  28897,
-   32136,  32608,  30272,  25328,
-   18204,   9511,      0,  -9511,
-  -18204, -25328, -30272, -32608,
-  -32136, -28897, -23169, -15446,
-   -6392,   3212,  12539,  20787,
-   27244,  31355,  32766,  31355,
-   27244,  20787,  12539,   3212,
-   -6392, -15446, -23169, -28897,
-  -32136, -32608, -30272, -25328,
-  -18204,  -9511,      0,   9511,
-   18204,  25328,  30272,  32608,
-   32136,  28897,  23169,  15446,
-    6392,  -3212, -12539, -20787,
-  -27244, -31355, -32766, -31355,
-  -27244, -20787, -12539,  -3212,
-    6392,  15446,  23169,  28897,
-   32136,  32608,  30272,  25328,
-   18204,   9511,      0,  -9511,
-  -18204, -25328, -30272, -32608,
-  -32136, -28897, -23169, -15446,
-   -6392,   3212,  12539,  20787,
-   27244,  31355,  32766,  31355,
-   27244,  20787,  12539,   3212,
-   -6392, -15446, -23169, -28897,
-  -32136, -32608, -30272, -25328,
-  -18204,  -9511,      0,   9511,
-   18204,  25328,  30272,  32608,
-   32136,  28897,  23169,  15446,
-    6392,  -3212, -12539, -20787,
-  -27244, -31355, -32766, -31355,
-  -27244, -20787, -12539,  -3212,
-    6392,  15446,  23169,  28897,
-   32136,  32608,  30272,  25328,
-   18204,   9511,      0,  -9511,
-  -18204, -25328, -30272, -32608,
-  -32136, -28897, -23169, -15446,
-   -6392,   3212,  12539,  20787,
-   27244,  31355,  32766,  31355,
-   27244,  20787,  12539,   3212,
-   -6392, -15446, -23169, -28897,
-  -32136, -32608, -30272, -25328,
-  -18204,  -9511,      0,      0,
-   11039,  20787,  28104,  32136,
-   32411,  28897,  22004,  12539,
-    1608,  -9511, -19519, -27244,
-  -31784, -32608, -29620, -23169,
-  -14009,  -3212,   7961,  18204,
-   26318,  31355,  32727,  30272,
-   24278,  15446,   4808,  -6392,
-  -16845, -25328, -30851, -32766,
-  -30851, -25328, -16845,  -6392,
-    4808,  15446,  24278,  30272,
-   32727,  31355,  26318,  18204,
-    7961,  -3212, -14009, -23169,
-  -29620, -32608, -31784, -27244,
-  -19519,  -9511,   1608,  12539,
-   22004,  28897,  32411,  32136,
-   28104,  20787,  11039,      0,
-  -11039, -20787, -28104, -32136,
-  -32411, -28897, -22004, -12539,
-   -1608,   9511,  19519,  27244,
-   31784,  32608,  29620,  23169,
-   14009,   3212,  -7961, -18204,
-  -26318, -31355, -32727, -30272,
-  -24278, -15446,  -4808,   6392,
-   16845,  25328,  30851,  32766,
-   30851,  25328,  16845,   6392,
-   -4808, -15446, -24278, -30272,
-  -32727, -31355, -26318, -18204,
-   -7961,   3212,  14009,  23169,
-   29620,  32608,  31784,  27244,
-   19519,   9511,  -1608, -12539,
-  -22004, -28897, -32411, -32136,
-  -28104, -20787, -11039,      0,
-   11039,  20787,  28104,  32136,
-   32411,  28897,  22004,  12539,
-    1608,  -9511, -19519, -27244,
-  -31784, -32608, -29620, -23169,
-  -14009,  -3212,   7961,  18204,
-   26318,  31355,  32727,  30272,
-   24278,  15446,   4808,  -6392,
-  -16845, -25328, -30851, -32766,
-  -30851, -25328, -16845,  -6392,
-    4808,  15446,  24278,  30272,
-   32727,  31355,  26318,  18204,
-    7961,  -3212, -14009, -23169,
-  -29620, -32608, -31784, -27244,
-  -19519,  -9511,   1608,  12539,
-   22004,  28897,  32411,  32136,
-   28104,  20787,  11039,      0,
-  -11039, -20787, -28104, -32136,
-  -32411, -28897, -22004, -12539,
-   -1608,   9511,  19519,  27244,
-   31784,  32608,  29620,  23169,
-   14009,   3212,  -7961, -18204,
-  -26318, -31355, -32727, -30272,
-  -24278, -15446,  -4808,   6392,
-   16845,  25328,  30851,  32766,
-   30851,  25328,  16845,   6392,
-   -4808, -15446, -24278, -30272,
-  -32727, -31355, -26318, -18204,
-   -7961,   3212,  14009,  23169,
-   29620,  32608,  31784,  27244,
-   19519,   9511,  -1608, -12539,
-  -22004, -28897, -32411, -32136,
-  -28104, -20787, -11039,      0,
-       0,  12539,  23169,  30272,
-   32766,  30272,  23169,  12539,
-       0, -12539, -23169, -30272,
-  -32766, -30272, -23169, -12539,
-       0,  12539,  23169,  30272,
-   32766,  30272,  23169,  12539,
-       0, -12539, -23169, -30272,
-  -32766, -30272, -23169, -12539,
-       0,  12539,  23169,  30272,
-   32766,  30272,  23169,  12539,
-       0, -12539, -23169, -30272,
-  -32766, -30272, -23169, -12539,
-       0,  12539,  23169,  30272,
-   32766,  30272,  23169,  12539,
-       0, -12539, -23169, -30272,
-  -32766, -30272, -23169, -12539,
-       0,  12539,  23169,  30272,
-   32766,  30272,  23169,  12539,
-       0, -12539, -23169, -30272,
-  -32766, -30272, -23169, -12539,
-       0,  12539,  23169,  30272,
-   32766,  30272,  23169,  12539,
-       0, -12539, -23169, -30272,
-  -32766, -30272, -23169, -12539,
-       0,  12539,  23169,  30272,
-   32766,  30272,  23169,  12539,
-       0, -12539, -23169, -30272,
-  -32766, -30272, -23169, -12539,
-       0,  12539,  23169,  30272,
-   32766,  30272,  23169,  12539,
-       0, -12539, -23169, -30272,
-  -32766, -30272, -23169, -12539,
-       0,  12539,  23169,  30272,
-   32766,  30272,  23169,  12539,
-       0, -12539, -23169, -30272,
-  -32766, -30272, -23169, -12539,
-       0,  12539,  23169,  30272,
-   32766,  30272,  23169,  12539,
-       0, -12539, -23169, -30272,
-  -32766, -30272, -23169, -12539,
-       0,  12539,  23169,  30272,
-   32766,  30272,  23169,  12539,
-       0, -12539, -23169, -30272,
-  -32766, -30272, -23169, -12539,
-       0,  12539,  23169,  30272,
-   32766,  30272,  23169,  12539,
-       0, -12539, -23169, -30272,
-  -32766, -30272, -23169, -12539,
-       0,  12539,  23169,  30272,
-   32766,  30272,  23169,  12539,
-       0, -12539, -23169, -30272,
-  -32766, -30272, -23169, -12539,
-       0,  12539,  23169,  30272,
-   32766,  30272,  23169,  12539,
-       0, -12539, -23169, -30272,
-  -32766, -30272, -23169, -12539,
-       0,  12539,  23169,  30272,
-   32766,  30272,  23169,  12539,
-       0, -12539, -23169, -30272,
-  -32766, -30272, -23169, -12539,
-       0,  12539,  23169,  30272,
-   32766,  30272,  23169,  12539,
-       0, -12539, -23169, -30272,
-  -32766, -30272, -23169, -12539,
-       0,      0,  14009,  25328,
-   31784,  32136,  26318,  15446,
-    1608, -12539, -24278, -31355,
-  -32411, -27244, -16845,  -3212,
-   11039,  23169,  30851,  32608,
-   28104,  18204,   4808,  -9511,
-  -22004, -30272, -32727, -28897,
-  -19519,  -6392,   7961,  20787,
-   29620,  32766,  29620,  20787,
-    7961,  -6392, -19519, -28897,
-  -32727, -30272, -22004,  -9511,
-    4808,  18204,  28104,  32608,
-   30851,  23169,  11039,  -3212,
-  -16845, -27244, -32411, -31355,
-  -24278, -12539,   1608,  15446,
-   26318,  32136,  31784,  25328,
-   14009,      0, -14009, -25328,
-  -31784, -32136, -26318, -15446,
-   -1608,  12539,  24278,  31355,
-   32411,  27244,  16845,   3212,
-  -11039, -23169, -30851, -32608,
-  -28104, -18204,  -4808,   9511,
-   22004,  30272,  32727,  28897,
-   19519,   6392,  -7961, -20787,
-  -29620, -32766, -29620, -20787,
-   -7961,   6392,  19519,  28897,
-   32727,  30272,  22004,   9511,
-   -4808, -18204, -28104, -32608,
-  -30851, -23169, -11039,   3212,
-   16845,  27244,  32411,  31355,
-   24278,  12539,  -1608, -15446,
-  -26318, -32136, -31784, -25328,
-  -14009,      0,  14009,  25328,
-   31784,  32136,  26318,  15446,
-    1608, -12539, -24278, -31355,
-  -32411, -27244, -16845,  -3212,
-   11039,  23169,  30851,  32608,
-   28104,  18204,   4808,  -9511,
-  -22004, -30272, -32727, -28897,
-  -19519,  -6392,   7961,  20787,
-   29620,  32766,  29620,  20787,
-    7961,  -6392, -19519, -28897,
-  -32727, -30272, -22004,  -9511,
-    4808,  18204,  28104,  32608,
-   30851,  23169,  11039,  -3212,
-  -16845, -27244, -32411, -31355,
-  -24278, -12539,   1608,  15446,
-   26318,  32136,  31784,  25328,
-   14009,      0, -14009, -25328,
-  -31784, -32136, -26318, -15446,
-   -1608,  12539,  24278,  31355,
-   32411,  27244,  16845,   3212,
-  -11039, -23169, -30851, -32608,
-  -28104, -18204,  -4808,   9511,
-   22004,  30272,  32727,  28897,
-   19519,   6392,  -7961, -20787,
-  -29620, -32766, -29620, -20787,
-   -7961,   6392,  19519,  28897,
-   32727,  30272,  22004,   9511,
-   -4808, -18204, -28104, -32608,
-  -30851, -23169, -11039,   3212,
-   16845,  27244,  32411,  31355,
-   24278,  12539,  -1608, -15446,
-  -26318, -32136, -31784, -25328,
-  -14009,      0,      0,  15446,
-   27244,  32608,  30272,  20787,
-    6392,  -9511, -23169, -31355,
-  -32136, -25328, -12539,   3212,
-   18204,  28897,  32766,  28897,
-   18204,   3212, -12539, -25328,
-  -32136, -31355, -23169,  -9511,
-    6392,  20787,  30272,  32608,
-   27244,  15446,      0, -15446,
-  -27244, -32608, -30272, -20787,
-   -6392,   9511,  23169,  31355,
-   32136,  25328,  12539,  -3212,
-  -18204, -28897, -32766, -28897,
-  -18204,  -3212,  12539,  25328,
-   32136,  31355,  23169,   9511,
-   -6392, -20787, -30272, -32608,
-  -27244, -15446,      0,  15446,
-   27244,  32608,  30272,  20787,
-    6392,  -9511, -23169, -31355,
-  -32136, -25328, -12539,   3212,
-   18204,  28897,  32766,  28897,
-   18204,   3212, -12539, -25328,
-  -32136, -31355, -23169,  -9511,
-    6392,  20787,  30272,  32608,
-   27244,  15446,      0, -15446,
-  -27244, -32608, -30272, -20787,
-   -6392,   9511,  23169,  31355,
-   32136,  25328,  12539,  -3212,
-  -18204, -28897, -32766, -28897,
-  -18204,  -3212,  12539,  25328,
-   32136,  31355,  23169,   9511,
-   -6392, -20787, -30272, -32608,
-  -27244, -15446,      0,  15446,
-   27244,  32608,  30272,  20787,
-    6392,  -9511, -23169, -31355,
-  -32136, -25328, -12539,   3212,
-   18204,  28897,  32766,  28897,
-   18204,   3212, -12539, -25328,
-  -32136, -31355, -23169,  -9511,
-    6392,  20787,  30272,  32608,
-   27244,  15446,      0, -15446,
-  -27244, -32608, -30272, -20787,
-   -6392,   9511,  23169,  31355,
-   32136,  25328,  12539,  -3212,
-  -18204, -28897, -32766, -28897,
-  -18204,  -3212,  12539,  25328,
-   32136,  31355,  23169,   9511,
-   -6392, -20787, -30272, -32608,
-  -27244, -15446,      0,  15446,
-   27244,  32608,  30272,  20787,
-    6392,  -9511, -23169, -31355,
-  -32136, -25328, -12539,   3212,
-   18204,  28897,  32766,  28897,
-   18204,   3212, -12539, -25328,
-  -32136, -31355, -23169,  -9511,
-    6392,  20787,  30272,  32608,
-   27244,  15446,      0, -15446,
-  -27244, -32608, -30272, -20787,
-   -6392,   9511,  23169,  31355,
-   32136,  25328,  12539,  -3212,
-  -18204, -28897, -32766, -28897,
-  -18204,  -3212,  12539,  25328,
-   32136,  31355,  23169,   9511,
-   -6392, -20787, -30272, -32608,
-  -27244, -15446,      0,      0,
-   16845,  28897,  32727,  27244,
-   14009,  -3212, -19519, -30272,
-  -32411, -25328, -11039,   6392,
-   22004,  31355,  31784,  23169,
-    7961,  -9511, -24278, -32136,
-  -30851, -20787,  -4808,  12539,
-   26318,  32608,  29620,  18204,
-    1608, -15446, -28104, -32766,
-  -28104, -15446,   1608,  18204,
-   29620,  32608,  26318,  12539,
-   -4808, -20787, -30851, -32136,
-  -24278,  -9511,   7961,  23169,
-   31784,  31355,  22004,   6392,
-  -11039, -25328, -32411, -30272,
-  -19519,  -3212,  14009,  27244,
-   32727,  28897,  16845,      0,
-  -16845, -28897, -32727, -27244,
-  -14009,   3212,  19519,  30272,
-   32411,  25328,  11039,  -6392,
-  -22004, -31355, -31784, -23169,
-   -7961,   9511,  24278,  32136,
-   30851,  20787,   4808, -12539,
-  -26318, -32608, -29620, -18204,
-   -1608,  15446,  28104,  32766,
-   28104,  15446,  -1608, -18204,
-  -29620, -32608, -26318, -12539,
-    4808,  20787,  30851,  32136,
-   24278,   9511,  -7961, -23169,
-  -31784, -31355, -22004,  -6392,
-   11039,  25328,  32411,  30272,
-   19519,   3212, -14009, -27244,
-  -32727, -28897, -16845,      0,
-   16845,  28897,  32727,  27244,
-   14009,  -3212, -19519, -30272,
-  -32411, -25328, -11039,   6392,
-   22004,  31355,  31784,  23169,
-    7961,  -9511, -24278, -32136,
-  -30851, -20787,  -4808,  12539,
-   26318,  32608,  29620,  18204,
-    1608, -15446, -28104, -32766,
-  -28104, -15446,   1608,  18204,
-   29620,  32608,  26318,  12539,
-   -4808, -20787, -30851, -32136,
-  -24278,  -9511,   7961,  23169,
-   31784,  31355,  22004,   6392,
-  -11039, -25328, -32411, -30272,
-  -19519,  -3212,  14009,  27244,
-   32727,  28897,  16845,      0,
-  -16845, -28897, -32727, -27244,
-  -14009,   3212,  19519,  30272,
-   32411,  25328,  11039,  -6392,
-  -22004, -31355, -31784, -23169,
-   -7961,   9511,  24278,  32136,
-   30851,  20787,   4808, -12539,
-  -26318, -32608, -29620, -18204,
-   -1608,  15446,  28104,  32766,
-   28104,  15446,  -1608, -18204,
-  -29620, -32608, -26318, -12539,
-    4808,  20787,  30851,  32136,
-   24278,   9511,  -7961, -23169,
-  -31784, -31355, -22004,  -6392,
-   11039,  25328,  32411,  30272,
-   19519,   3212, -14009, -27244,
-  -32727, -28897, -16845,      0,
-       0,   5372,  10592,  15516,
-   20009,  23951,  27242,  29807,
-   31594,  32579,  32766,  32185,
-   30892,  28963,  26496,  23602,
-   20401,  17020,  13585,  10218,
-    7032,   4126,   1582,   -536,
-   -2184,  -3343,  -4011,  -4209,
-   -3976,  -3367,  -2450,  -1300,
-       0,   1366,   2717,   3976,
-    5077,   5962,   6588,   6926,
-    6960,   6689,   6127,   5297,
-    4233,   2979,   1580,     88,
-   -1450,  -2985,  -4474,  -5882,
-   -7178,  -8342,  -9360, -10228,
-  -10947, -11527, -11980, -12322,
-  -12570, -12743, -12854, -12915,
-  -12935, -12915, -12854, -12743,
-  -12570, -12322, -11980, -11527,
-  -10947, -10228,  -9360,  -8342,
-   -7178,  -5882,  -4474,  -2985,
-   -1450,     88,   1580,   2979,
-    4233,   5297,   6127,   6689,
-    6960,   6926,   6588,   5962,
-    5077,   3976,   2717,   1366,
-       0,  -1300,  -2450,  -3367,
-   -3976,  -4209,  -4011,  -3343,
-   -2184,   -536,   1582,   4126,
-    7032,  10218,  13585,  17020,
-   20401,  23602,  26496,  28963,
-   30892,  32185,  32766,  32579,
-   31594,  29807,  27242,  23951,
-   20009,  15516,  10592,   5372,
-       0,  -5372, -10592, -15516,
-  -20009, -23951, -27242, -29807,
-  -31594, -32579, -32766, -32185,
-  -30892, -28963, -26496, -23602,
-  -20401, -17020, -13585, -10218,
-   -7032,  -4126,  -1582,    536,
-    2184,   3343,   4011,   4209,
-    3976,   3367,   2450,   1300,
-       0,  -1366,  -2717,  -3976,
-   -5077,  -5962,  -6588,  -6926,
-   -6960,  -6689,  -6127,  -5297,
-   -4233,  -2979,  -1580,    -88,
-    1450,   2985,   4474,   5882,
-    7178,   8342,   9360,  10228,
-   10947,  11527,  11980,  12322,
-   12570,  12743,  12854,  12915,
-   12935,  12915,  12854,  12743,
-   12570,  12322,  11980,  11527,
-   10947,  10228,   9360,   8342,
-    7178,   5882,   4474,   2985,
-    1450,    -88,  -1580,  -2979,
-   -4233,  -5297,  -6127,  -6689,
-   -6960,  -6926,  -6588,  -5962,
-   -5077,  -3976,  -2717,  -1366,
-       0,   1300,   2450,   3367,
-    3976,   4209,   4011,   3343,
-    2184,    536,  -1582,  -4126,
-   -7032, -10218, -13585, -17020,
-  -20401, -23602, -26496, -28963,
-  -30892, -32185, -32766, -32579,
-  -31594, -29807, -27242, -23951,
-  -20009, -15516, -10592,  -5372,
-       0,      0,   6754,  13211,
-   19089,  24138,  28151,  30976,
-   32522,  32766,  31747,  29569,
-   26387,  22402,  17847,  12972,
-    8029,   3262,  -1114,  -4915,
-   -8005, -10296, -11752, -12390,
-  -12273, -11506, -10225,  -8587,
-   -6760,  -4911,  -3193,  -1738,
-    -651,      0,    181,   -102,
-    -812,  -1879,  -3212,  -4701,
-   -6232,  -7688,  -8962,  -9961,
-  -10614, -10873, -10713, -10140,
-   -9178,  -7874,  -6291,  -4501,
-   -2582,   -610,   1342,   3213,
-    4950,   6518,   7890,   9057,
-   10017,  10777,  11349,  11745,
-   11977,  12053,  11977,  11745,
-   11349,  10777,  10017,   9057,
-    7890,   6518,   4950,   3213,
-    1342,   -610,  -2582,  -4501,
-   -6291,  -7874,  -9178, -10140,
-  -10713, -10873, -10614,  -9961,
-   -8962,  -7688,  -6232,  -4701,
-   -3212,  -1879,   -812,   -102,
-     181,      0,   -651,  -1738,
-   -3193,  -4911,  -6760,  -8587,
-  -10225, -11506, -12273, -12390,
-  -11752, -10296,  -8005,  -4915,
-   -1114,   3262,   8029,  12972,
-   17847,  22402,  26387,  29569,
-   31747,  32766,  32522,  30976,
-   28151,  24138,  19089,  13211,
-    6754,      0,  -6754, -13211,
-  -19089, -24138, -28151, -30976,
-  -32522, -32766, -31747, -29569,
-  -26387, -22402, -17847, -12972,
-   -8029,  -3262,   1114,   4915,
-    8005,  10296,  11752,  12390,
-   12273,  11506,  10225,   8587,
-    6760,   4911,   3193,   1738,
-     651,      0,   -181,    102,
-     812,   1879,   3212,   4701,
-    6232,   7688,   8962,   9961,
-   10614,  10873,  10713,  10140,
-    9178,   7874,   6291,   4501,
-    2582,    610,  -1342,  -3213,
-   -4950,  -6518,  -7890,  -9057,
-  -10017, -10777, -11349, -11745,
-  -11977, -12053, -11977, -11745,
-  -11349, -10777, -10017,  -9057,
-   -7890,  -6518,  -4950,  -3213,
-   -1342,    610,   2582,   4501,
-    6291,   7874,   9178,  10140,
-   10713,  10873,  10614,   9961,
-    8962,   7688,   6232,   4701,
-    3212,   1879,    812,    102,
-    -181,      0,    651,   1738,
-    3193,   4911,   6760,   8587,
-   10225,  11506,  12273,  12390,
-   11752,  10296,   8005,   4915,
-    1114,  -3262,  -8029, -12972,
-  -17847, -22402, -26387, -29569,
-  -31747, -32766, -32522, -30976,
-  -28151, -24138, -19089, -13211,
-   -6754,      0,      0,   8203,
-   15876,  22528,  27744,  31217,
-   32766,  32349,  30064,  26137,
-   20899,  14763,   8184,   1624,
-   -4481,  -9757, -13917, -16776,
-  -18264, -18423, -17392, -15396,
-  -12716,  -9662,  -6545,  -3648,
-   -1206,    616,   1730,   2128,
-    1877,   1109,      0,  -1248,
-   -2428,  -3351,  -3864,  -3862,
-   -3296,  -2179,   -581,   1382,
-    3559,   5778,   7864,   9654,
-   11012,  11836,  12070,  11700,
-   10757,   9307,   7446,   5288,
-    2953,    561,  -1780,  -3979,
-   -5965,  -7687,  -9112, -10224,
-  -11018, -11493, -11651, -11493,
-  -11018, -10224,  -9112,  -7687,
-   -5965,  -3979,  -1780,    561,
-    2953,   5288,   7446,   9307,
-   10757,  11700,  12070,  11836,
-   11012,   9654,   7864,   5778,
-    3559,   1382,   -581,  -2179,
-   -3296,  -3862,  -3864,  -3351,
-   -2428,  -1248,      0,   1109,
-    1877,   2128,   1730,    616,
-   -1206,  -3648,  -6545,  -9662,
-  -12716, -15396, -17392, -18423,
-  -18264, -16776, -13917,  -9757,
-   -4481,   1624,   8184,  14763,
-   20899,  26137,  30064,  32349,
-   32766,  31217,  27744,  22528,
-   15876,   8203,      0,  -8203,
-  -15876, -22528, -27744, -31217,
-  -32766, -32349, -30064, -26137,
-  -20899, -14763,  -8184,  -1624,
-    4481,   9757,  13917,  16776,
-   18264,  18423,  17392,  15396,
-   12716,   9662,   6545,   3648,
-    1206,   -616,  -1730,  -2128,
-   -1877,  -1109,      0,   1248,
-    2428,   3351,   3864,   3862,
-    3296,   2179,    581,  -1382,
-   -3559,  -5778,  -7864,  -9654,
-  -11012, -11836, -12070, -11700,
-  -10757,  -9307,  -7446,  -5288,
-   -2953,   -561,   1780,   3979,
-    5965,   7687,   9112,  10224,
-   11018,  11493,  11651,  11493,
-   11018,  10224,   9112,   7687,
-    5965,   3979,   1780,   -561,
-   -2953,  -5288,  -7446,  -9307,
-  -10757, -11700, -12070, -11836,
-  -11012,  -9654,  -7864,  -5778,
-   -3559,  -1382,    581,   2179,
-    3296,   3862,   3864,   3351,
-    2428,   1248,      0,  -1109,
-   -1877,  -2128,  -1730,   -616,
-    1206,   3648,   6545,   9662,
-   12716,  15396,  17392,  18423,
-   18264,  16776,  13917,   9757,
-    4481,  -1624,  -8184, -14763,
-  -20899, -26137, -30064, -32349,
-  -32766, -31217, -27744, -22528,
-  -15876,  -8203,      0,      0,
-    9684,  18498,  25657,  30544,
-   32766,  32193,  28962,  23460,
-   16277,   8137,   -176,  -7903,
-  -14385, -19124, -21830, -22432,
-  -21078, -18098, -13961,  -9208,
-   -4392,    -12,   3538,   6005,
-    7294,   7466,   6714,   5326,
-    3645,   2012,    725,      0,
-     -52,    565,   1737,   3266,
-    4894,   6344,   7361,   7738,
-    7349,   6163,   4242,   1740,
-   -1127,  -4097,  -6903,  -9292,
-  -11059, -12063, -12236, -11586,
-  -10186,  -8168,  -5698,  -2957,
-    -131,   2615,   5138,   7325,
-    9095,  10391,  11181,  11446,
-   11181,  10391,   9095,   7325,
-    5138,   2615,   -131,  -2957,
-   -5698,  -8168, -10186, -11586,
-  -12236, -12063, -11059,  -9292,
-   -6903,  -4097,  -1127,   1740,
-    4242,   6163,   7349,   7738,
-    7361,   6344,   4894,   3266,
-    1737,    565,    -52,      0,
-     725,   2012,   3645,   5326,
-    6714,   7466,   7294,   6005,
-    3538,    -12,  -4392,  -9208,
-  -13961, -18098, -21078, -22432,
-  -21830, -19124, -14385,  -7903,
-    -176,   8137,  16277,  23460,
-   28962,  32193,  32766,  30544,
-   25657,  18498,   9684,      0,
-   -9684, -18498, -25657, -30544,
-  -32766, -32193, -28962, -23460,
-  -16277,  -8137,    176,   7903,
-   14385,  19124,  21830,  22432,
-   21078,  18098,  13961,   9208,
-    4392,     12,  -3538,  -6005,
-   -7294,  -7466,  -6714,  -5326,
-   -3645,  -2012,   -725,      0,
-      52,   -565,  -1737,  -3266,
-   -4894,  -6344,  -7361,  -7738,
-   -7349,  -6163,  -4242,  -1740,
-    1127,   4097,   6903,   9292,
-   11059,  12063,  12236,  11586,
-   10186,   8168,   5698,   2957,
-     131,  -2615,  -5138,  -7325,
-   -9095, -10391, -11181, -11446,
-  -11181, -10391,  -9095,  -7325,
-   -5138,  -2615,    131,   2957,
-    5698,   8168,  10186,  11586,
-   12236,  12063,  11059,   9292,
-    6903,   4097,   1127,  -1740,
-   -4242,  -6163,  -7349,  -7738,
-   -7361,  -6344,  -4894,  -3266,
-   -1737,   -565,     52,      0,
-    -725,  -2012,  -3645,  -5326,
-   -6714,  -7466,  -7294,  -6005,
-   -3538,     12,   4392,   9208,
-   13961,  18098,  21078,  22432,
-   21830,  19124,  14385,   7903,
-     176,  -8137, -16277, -23460,
-  -28962, -32193, -32766, -30544,
-  -25657, -18498,  -9684,      0,
-       0,  11241,  21134,  28510,
-   32524,  32766,  29303,  22665,
-   13757,   3735,  -6155, -14746,
-  -21096, -24602, -25061, -22671,
-  -17979, -11781,  -4999,   1460,
-    6827,  10566,  12430,  12466,
-   10981,   8464,   5497,   2647,
-     378,  -1016,  -1444,  -1014,
-       0,   1226,   2265,   2771,
-    2512,   1410,   -444,  -2807,
-   -5329,  -7611,  -9269,  -9998,
-   -9620,  -8109,  -5597,  -2347,
-    1278,   4875,   8050,  10470,
-   11902,  12229,  11459,   9710,
-    7184,   4139,    852,  -2406,
-   -5395,  -7916,  -9818, -10999,
-  -11399, -10999,  -9818,  -7916,
-   -5395,  -2406,    852,   4139,
-    7184,   9710,  11459,  12229,
-   11902,  10470,   8050,   4875,
-    1278,  -2347,  -5597,  -8109,
-   -9620,  -9998,  -9269,  -7611,
-   -5329,  -2807,   -444,   1410,
-    2512,   2771,   2265,   1226,
-       0,  -1014,  -1444,  -1016,
-     378,   2647,   5497,   8464,
-   10981,  12466,  12430,  10566,
-    6827,   1460,  -4999, -11781,
-  -17979, -22671, -25061, -24602,
-  -21096, -14746,  -6155,   3735,
-   13757,  22665,  29303,  32766,
-   32524,  28510,  21134,  11241,
-       0, -11241, -21134, -28510,
-  -32524, -32766, -29303, -22665,
-  -13757,  -3735,   6155,  14746,
-   21096,  24602,  25061,  22671,
-   17979,  11781,   4999,  -1460,
-   -6827, -10566, -12430, -12466,
-  -10981,  -8464,  -5497,  -2647,
-    -378,   1016,   1444,   1014,
-       0,  -1226,  -2265,  -2771,
-   -2512,  -1410,    444,   2807,
-    5329,   7611,   9269,   9998,
-    9620,   8109,   5597,   2347,
-   -1278,  -4875,  -8050, -10470,
-  -11902, -12229, -11459,  -9710,
-   -7184,  -4139,   -852,   2406,
-    5395,   7916,   9818,  10999,
-   11399,  10999,   9818,   7916,
-    5395,   2406,   -852,  -4139,
-   -7184,  -9710, -11459, -12229,
-  -11902, -10470,  -8050,  -4875,
-   -1278,   2347,   5597,   8109,
-    9620,   9998,   9269,   7611,
-    5329,   2807,    444,  -1410,
-   -2512,  -2771,  -2265,  -1226,
-       0,   1014,   1444,   1016,
-    -378,  -2647,  -5497,  -8464,
-  -10981, -12466, -12430, -10566,
-   -6827,  -1460,   4999,  11781,
-   17979,  22671,  25061,  24602,
-   21096,  14746,   6155,  -3735,
-  -13757, -22665, -29303, -32766,
-  -32524, -28510, -21134, -11241,
-       0,      0,  12574,  23208,
-   30284,  32766,  30367,  23580,
-   13582,   2017,  -9283, -18611,
-  -24659, -26710, -24732, -19337,
-  -11638,  -3028,   5074,  11467,
-   15356,  16448,  14958,  11515,
-    7005,   2379,  -1533,  -4166,
-   -5301,  -5063,  -3856,  -2245,
-    -806,      0,    -67,   -988,
-   -2497,  -4155,  -5457,  -5950,
-   -5339,  -3560,   -796,   2553,
-    5944,   8792,  10585,  10976,
-    9843,   7310,   3721,   -423,
-   -4548,  -8102, -10635, -11856,
-  -11663, -10139,  -7523,  -4157,
-    -440,   3227,   6481,   9024,
-   10637,  11190,  10637,   9024,
-    6481,   3227,   -440,  -4157,
-   -7523, -10139, -11663, -11856,
-  -10635,  -8102,  -4548,   -423,
-    3721,   7310,   9843,  10976,
-   10585,   8792,   5944,   2553,
-    -796,  -3560,  -5339,  -5950,
-   -5457,  -4155,  -2497,   -988,
-     -67,      0,   -806,  -2245,
-   -3856,  -5063,  -5301,  -4166,
-   -1533,   2379,   7005,  11515,
-   14958,  16448,  15356,  11467,
-    5074,  -3028, -11638, -19337,
-  -24732, -26710, -24659, -18611,
-   -9283,   2017,  13582,  23580,
-   30367,  32766,  30284,  23208,
-   12574,      0, -12574, -23208,
-  -30284, -32766, -30367, -23580,
-  -13582,  -2017,   9283,  18611,
-   24659,  26710,  24732,  19337,
-   11638,   3028,  -5074, -11467,
-  -15356, -16448, -14958, -11515,
-   -7005,  -2379,   1533,   4166,
-    5301,   5063,   3856,   2245,
-     806,      0,     67,    988,
-    2497,   4155,   5457,   5950,
-    5339,   3560,    796,  -2553,
-   -5944,  -8792, -10585, -10976,
-   -9843,  -7310,  -3721,    423,
-    4548,   8102,  10635,  11856,
-   11663,  10139,   7523,   4157,
-     440,  -3227,  -6481,  -9024,
-  -10637, -11190, -10637,  -9024,
-   -6481,  -3227,    440,   4157,
-    7523,  10139,  11663,  11856,
-   10635,   8102,   4548,    423,
-   -3721,  -7310,  -9843, -10976,
-  -10585,  -8792,  -5944,  -2553,
-     796,   3560,   5339,   5950,
-    5457,   4155,   2497,    988,
-      67,      0,    806,   2245,
-    3856,   5063,   5301,   4166,
-    1533,  -2379,  -7005, -11515,
-  -14958, -16448, -15356, -11467,
-   -5074,   3028,  11638,  19337,
-   24732,  26710,  24659,  18611,
-    9283,  -2017, -13582, -23580,
-  -30367, -32766, -30284, -23208,
-  -12574,      0,      0,  14266,
-   25777,  32340,  32766,  27097,
-   16577,   3370,  -9904, -20716,
-  -27133, -28187, -24017, -15783,
-   -5364,   5074,  13539,  18618,
-   19709,  17080,  11725,   5073,
-   -1362,  -6328,  -9074,  -9463,
-   -7916,  -5241,  -2376,   -136,
-     990,    928,      0,  -1212,
-   -2056,  -2014,   -855,   1284,
-    3940,   6435,   8060,   8257,
-    6778,   3751,   -330,  -4711,
-   -8542, -11058, -11743, -10433,
-   -7342,  -3010,   1814,   6320,
-    9788,  11705,  11835,  10234,
-    7212,   3257,  -1048,  -5117,
-   -8431, -10588, -11335, -10588,
-   -8431,  -5117,  -1048,   3257,
-    7212,  10234,  11835,  11705,
-    9788,   6320,   1814,  -3010,
-   -7342, -10433, -11743, -11058,
-   -8542,  -4711,   -330,   3751,
-    6778,   8257,   8060,   6435,
-    3940,   1284,   -855,  -2014,
-   -2056,  -1212,      0,    928,
-     990,   -136,  -2376,  -5241,
-   -7916,  -9463,  -9074,  -6328,
-   -1362,   5073,  11725,  17080,
-   19709,  18618,  13539,   5074,
-   -5364, -15783, -24017, -28187,
-  -27133, -20716,  -9904,   3370,
-   16577,  27097,  32766,  32340,
-   25777,  14266,      0, -14266,
-  -25777, -32340, -32766, -27097,
-  -16577,  -3370,   9904,  20716,
-   27133,  28187,  24017,  15783,
-    5364,  -5074, -13539, -18618,
-  -19709, -17080, -11725,  -5073,
-    1362,   6328,   9074,   9463,
-    7916,   5241,   2376,    136,
-    -990,   -928,      0,   1212,
-    2056,   2014,    855,  -1284,
-   -3940,  -6435,  -8060,  -8257,
-   -6778,  -3751,    330,   4711,
-    8542,  11058,  11743,  10433,
-    7342,   3010,  -1814,  -6320,
-   -9788, -11705, -11835, -10234,
-   -7212,  -3257,   1048,   5117,
-    8431,  10588,  11335,  10588,
-    8431,   5117,   1048,  -3257,
-   -7212, -10234, -11835, -11705,
-   -9788,  -6320,  -1814,   3010,
-    7342,  10433,  11743,  11058,
-    8542,   4711,    330,  -3751,
-   -6778,  -8257,  -8060,  -6435,
-   -3940,  -1284,    855,   2014,
-    2056,   1212,      0,   -928,
-    -990,    136,   2376,   5241,
-    7916,   9463,   9074,   6328,
-    1362,  -5073, -11725, -17080,
-  -19709, -18618, -13539,  -5074,
-    5364,  15783,  24017,  28187,
-   27133,  20716,   9904,  -3370,
-  -16577, -27097, -32766, -32340,
-  -25777, -14266,      0,      0,
-   15506,  27348,  32766,  30580,
-   21457,   7714,  -7292, -20015,
-  -27597, -28538, -22998, -12674,
-    -295,  11114,  18996,  21856,
-   19546,  13175,   4717,  -3575,
-   -9776, -12740, -12305,  -9204,
-   -4745,   -370,   2777,   4133,
-    3804,   2428,    893,      0,
-     184,   1381,   3070,   4469,
-    4824,   3679,   1055,  -2521,
-   -6154,  -8832,  -9718,  -8401,
-   -5027,   -276,   4802,   9053,
-   11502,  11589,   9291,   5108,
-     -68,  -5170,  -9197, -11409,
-  -11463,  -9437,  -5779,  -1194,
-    3501,   7517,  10207,  11152,
-   10207,   7517,   3501,  -1194,
-   -5779,  -9437, -11463, -11409,
-   -9197,  -5170,    -68,   5108,
-    9291,  11589,  11502,   9053,
-    4802,   -276,  -5027,  -8401,
-   -9718,  -8832,  -6154,  -2521,
-    1055,   3679,   4824,   4469,
-    3070,   1381,    184,      0,
-     893,   2428,   3804,   4133,
-    2777,   -370,  -4745,  -9204,
-  -12305, -12740,  -9776,  -3575,
-    4717,  13175,  19546,  21856,
-   18996,  11114,   -295, -12674,
-  -22998, -28538, -27597, -20015,
-   -7292,   7714,  21457,  30580,
-   32766,  27348,  15506,      0,
-  -15506, -27348, -32766, -30580,
-  -21457,  -7714,   7292,  20015,
-   27597,  28538,  22998,  12674,
-     295, -11114, -18996, -21856,
-  -19546, -13175,  -4717,   3575,
-    9776,  12740,  12305,   9204,
-    4745,    370,  -2777,  -4133,
-   -3804,  -2428,   -893,      0,
-    -184,  -1381,  -3070,  -4469,
-   -4824,  -3679,  -1055,   2521,
-    6154,   8832,   9718,   8401,
-    5027,    276,  -4802,  -9053,
-  -11502, -11589,  -9291,  -5108,
-      68,   5170,   9197,  11409,
-   11463,   9437,   5779,   1194,
-   -3501,  -7517, -10207, -11152,
-  -10207,  -7517,  -3501,   1194,
-    5779,   9437,  11463,  11409,
-    9197,   5170,     68,  -5108,
-   -9291, -11589, -11502,  -9053,
-   -4802,    276,   5027,   8401,
-    9718,   8832,   6154,   2521,
-   -1055,  -3679,  -4824,  -4469,
-   -3070,  -1381,   -184,      0,
-    -893,  -2428,  -3804,  -4133,
-   -2777,    370,   4745,   9204,
-   12305,  12740,   9776,   3575,
-   -4717, -13175, -19546, -21856,
-  -18996, -11114,    295,  12674,
-   22998,  28538,  27597,  20015,
-    7292,  -7714, -21457, -30580,
-  -32766, -27348, -15506,      0,
-       0,   1370,   2738,   4101,
-    5456,   6802,   8135,   9454,
-   10756,  12038,  13298,  14535,
-   15746,  16929,  18081,  19201,
-   20287,  21337,  22349,  23322,
-   24253,  25143,  25988,  26787,
-   27541,  28246,  28903,  29510,
-   30067,  30573,  31027,  31429,
-   31779,  32075,  32319,  32510,
-   32648,  32733,  32766,  32747,
-   32677,  32556,  32384,  32164,
-   31896,  31580,  31218,  30812,
-   30362,  29870,  29337,  28765,
-   28156,  27511,  26833,  26122,
-   25382,  24613,  23818,  22999,
-   22158,  21297,  20418,  19523,
-   18615,  17696,  16768,  15834,
-   14894,  13952,  13010,  12070,
-   11134,  10204,   9282,   8371,
-    7472,   6587,   5718,   4867,
-    4035,   3225,   2438,   1676,
-     939,    230,   -450,  -1101,
-   -1720,  -2308,  -2862,  -3382,
-   -3868,  -4318,  -4733,  -5111,
-   -5452,  -5757,  -6024,  -6255,
-   -6448,  -6605,  -6725,  -6808,
-   -6856,  -6869,  -6847,  -6791,
-   -6703,  -6582,  -6431,  -6249,
-   -6039,  -5802,  -5538,  -5250,
-   -4938,  -4605,  -4252,  -3880,
-   -3492,  -3089,  -2672,  -2244,
-   -1807,  -1362,   -911,   -457,
-       0,    457,    911,   1362,
-    1807,   2244,   2672,   3089,
-    3492,   3880,   4252,   4605,
-    4938,   5250,   5538,   5802,
-    6039,   6249,   6431,   6582,
-    6703,   6791,   6847,   6869,
-    6856,   6808,   6725,   6605,
-    6448,   6255,   6024,   5757,
-    5452,   5111,   4733,   4318,
-    3868,   3382,   2862,   2308,
-    1720,   1101,    450,   -230,
-    -939,  -1676,  -2438,  -3225,
-   -4035,  -4867,  -5718,  -6587,
-   -7472,  -8371,  -9282, -10204,
-  -11134, -12070, -13010, -13952,
-  -14894, -15834, -16768, -17696,
-  -18615, -19523, -20418, -21297,
-  -22158, -22999, -23818, -24613,
-  -25382, -26122, -26833, -27511,
-  -28156, -28765, -29337, -29870,
-  -30362, -30812, -31218, -31580,
-  -31896, -32164, -32384, -32556,
-  -32677, -32747, -32766, -32733,
-  -32648, -32510, -32319, -32075,
-  -31779, -31429, -31027, -30573,
-  -30067, -29510, -28903, -28246,
-  -27541, -26787, -25988, -25143,
-  -24253, -23322, -22349, -21337,
-  -20287, -19201, -18081, -16929,
-  -15746, -14535, -13298, -12038,
-  -10756,  -9454,  -8135,  -6802,
-   -5456,  -4101,  -2738,  -1370,
-       0,      0,   3041,   6054,
-    9013,  11891,  14662,  17303,
-   19790,  22103,  24222,  26131,
-   27817,  29266,  30471,  31426,
-   32126,  32572,  32766,  32713,
-   32421,  31900,  31163,  30225,
-   29103,  27815,  26381,  24822,
-   23161,  21421,  19624,  17793,
-   15951,  14121,  12324,  10580,
-    8908,   7326,   5848,   4489,
-    3261,   2172,   1230,    441,
-    -194,   -674,  -1001,  -1178,
-   -1213,  -1112,   -885,   -543,
-    -100,    432,   1038,   1703,
-    2411,   3147,   3895,   4639,
-    5366,   6060,   6709,   7301,
-    7825,   8272,   8635,   8907,
-    9084,   9164,   9145,   9028,
-    8817,   8515,   8127,   7660,
-    7124,   6526,   5877,   5188,
-    4469,   3734,   2993,   2259,
-    1542,    855,    206,   -394,
-    -937,  -1415,  -1821,  -2151,
-   -2402,  -2570,  -2654,  -2657,
-   -2578,  -2423,  -2195,  -1899,
-   -1544,  -1137,   -686,   -201,
-     308,    831,   1358,   1878,
-    2382,   2859,   3300,   3698,
-    4043,   4329,   4551,   4704,
-    4784,   4790,   4720,   4576,
-    4359,   4073,   3721,   3309,
-    2843,   2332,   1783,   1205,
-     607,      0,   -607,  -1205,
-   -1783,  -2332,  -2843,  -3309,
-   -3721,  -4073,  -4359,  -4576,
-   -4720,  -4790,  -4784,  -4704,
-   -4551,  -4329,  -4043,  -3698,
-   -3300,  -2859,  -2382,  -1878,
-   -1358,   -831,   -308,    201,
-     686,   1137,   1544,   1899,
-    2195,   2423,   2578,   2657,
-    2654,   2570,   2402,   2151,
-    1821,   1415,    937,    394,
-    -206,   -855,  -1542,  -2259,
-   -2993,  -3734,  -4469,  -5188,
-   -5877,  -6526,  -7124,  -7660,
-   -8127,  -8515,  -8817,  -9028,
-   -9145,  -9164,  -9084,  -8907,
-   -8635,  -8272,  -7825,  -7301,
-   -6709,  -6060,  -5366,  -4639,
-   -3895,  -3147,  -2411,  -1703,
-   -1038,   -432,    100,    543,
-     885,   1112,   1213,   1178,
-    1001,    674,    194,   -441,
-   -1230,  -2172,  -3261,  -4489,
-   -5848,  -7326,  -8908, -10580,
-  -12324, -14121, -15951, -17793,
-  -19624, -21421, -23161, -24822,
-  -26381, -27815, -29103, -30225,
-  -31163, -31900, -32421, -32713,
-  -32766, -32572, -32126, -31426,
-  -30471, -29266, -27817, -26131,
-  -24222, -22103, -19790, -17303,
-  -14662, -11891,  -9013,  -6054,
-   -3041,      0,      0,   5244,
-   10346,  15170,  19590,  23493,
-   26785,  29395,  31273,  32396,
-   32766,  32410,  31377,  29739,
-   27586,  25019,  22151,  19100,
-   15983,  12915,  10001,   7335,
-    4994,   3039,   1511,    431,
-    -199,   -398,   -202,    340,
-    1165,   2201,   3372,   4601,
-    5812,   6935,   7909,   8683,
-    9218,   9492,   9495,   9233,
-    8723,   7996,   7093,   6062,
-    4954,   3826,   2731,   1720,
-     838,    121,   -403,   -719,
-    -819,   -711,   -409,     59,
-     662,   1360,   2110,   2868,
-    3589,   4235,   4769,   5163,
-    5397,   5458,   5345,   5064,
-    4632,   4071,   3411,   2687,
-    1935,   1194,    499,   -115,
-    -620,   -993,  -1219,  -1292,
-   -1210,   -984,   -631,   -172,
-     365,    946,   1540,   2111,
-    2629,   3063,   3390,   3593,
-    3658,   3584,   3372,   3035,
-    2589,   2058,   1469,    851,
-     238,   -342,   -857,  -1284,
-   -1602,  -1796,  -1858,  -1788,
-   -1591,  -1281,   -876,   -401,
-     118,    650,   1166,   1636,
-    2034,   2337,   2528,   2594,
-    2532,   2342,   2035,   1624,
-    1131,    580,      0,   -580,
-   -1131,  -1624,  -2035,  -2342,
-   -2532,  -2594,  -2528,  -2337,
-   -2034,  -1636,  -1166,   -650,
-    -118,    401,    876,   1281,
-    1591,   1788,   1858,   1796,
-    1602,   1284,    857,    342,
-    -238,   -851,  -1469,  -2058,
-   -2589,  -3035,  -3372,  -3584,
-   -3658,  -3593,  -3390,  -3063,
-   -2629,  -2111,  -1540,   -946,
-    -365,    172,    631,    984,
-    1210,   1292,   1219,    993,
-     620,    115,   -499,  -1194,
-   -1935,  -2687,  -3411,  -4071,
-   -4632,  -5064,  -5345,  -5458,
-   -5397,  -5163,  -4769,  -4235,
-   -3589,  -2868,  -2110,  -1360,
-    -662,    -59,    409,    711,
-     819,    719,    403,   -121,
-    -838,  -1720,  -2731,  -3826,
-   -4954,  -6062,  -7093,  -7996,
-   -8723,  -9233,  -9495,  -9492,
-   -9218,  -8683,  -7909,  -6935,
-   -5812,  -4601,  -3372,  -2201,
-   -1165,   -340,    202,    398,
-     199,   -431,  -1511,  -3039,
-   -4994,  -7335, -10001, -12915,
-  -15983, -19100, -22151, -25019,
-  -27586, -29739, -31377, -32410,
-  -32766, -32396, -31273, -29395,
-  -26785, -23493, -19590, -15170,
-  -10346,  -5244,      0,      0,
-    8000,  15500,  22039,  27240,
-   30831,  32673,  32766,  31241,
-   28350,  24433,  19892,  15146,
-   10596,   6593,   3405,   1201,
-      41,   -120,    579,   1927,
-    3666,   5524,   7241,   8599,
-    9439,   9675,   9300,   8378,
-    7033,   5434,   3767,   2218,
-     950,     81,   -319,   -242,
-     265,   1107,   2155,   3261,
-    4277,   5074,   5555,   5665,
-    5396,   4789,   3920,   2898,
-    1846,    885,    121,   -364,
-    -529,   -369,     79,    746,
-    1536,   2345,   3065,   3607,
-    3902,   3916,   3650,   3137,
-    2443,   1653,    861,    161,
-    -368,   -668,   -712,   -502,
-     -75,    508,   1169,   1821,
-    2380,   2774,   2954,   2898,
-    2614,   2136,   1523,    850,
-     199,   -355,   -746,   -932,
-    -895,   -646,   -222,    320,
-     909,   1467,   1923,   2218,
-    2316,   2202,   1890,   1418,
-     843,    236,   -332,   -791,
-   -1090,  -1193,  -1093,   -805,
-    -370,    155,    703,   1201,
-    1585,   1807,   1835,   1666,
-    1319,    834,    271,   -303,
-    -818,  -1213,  -1441,  -1476,
-   -1317,   -986,   -527,      0,
-     527,    986,   1317,   1476,
-    1441,   1213,    818,    303,
-    -271,   -834,  -1319,  -1666,
-   -1835,  -1807,  -1585,  -1201,
-    -703,   -155,    370,    805,
-    1093,   1193,   1090,    791,
-     332,   -236,   -843,  -1418,
-   -1890,  -2202,  -2316,  -2218,
-   -1923,  -1467,   -909,   -320,
-     222,    646,    895,    932,
-     746,    355,   -199,   -850,
-   -1523,  -2136,  -2614,  -2898,
-   -2954,  -2774,  -2380,  -1821,
-   -1169,   -508,     75,    502,
-     712,    668,    368,   -161,
-    -861,  -1653,  -2443,  -3137,
-   -3650,  -3916,  -3902,  -3607,
-   -3065,  -2345,  -1536,   -746,
-     -79,    369,    529,    364,
-    -121,   -885,  -1846,  -2898,
-   -3920,  -4789,  -5396,  -5665,
-   -5555,  -5074,  -4277,  -3261,
-   -2155,  -1107,   -265,    242,
-     319,    -81,   -950,  -2218,
-   -3767,  -5434,  -7033,  -8378,
-   -9300,  -9675,  -9439,  -8599,
-   -7241,  -5524,  -3666,  -1927,
-    -579,    120,    -41,  -1201,
-   -3405,  -6593, -10596, -15146,
-  -19892, -24433, -28350, -31241,
-  -32766, -32673, -30831, -27240,
-  -22039, -15500,  -8000,      0,
-       0,  11213,  21036,  28312,
-   32294,  32766,  30049,  24924,
-   18470,  11863,   6160,   2132,
-     145,    142,   1696,   4134,
-    6696,   8701,   9678,   9442,
-    8108,   6030,   3708,   1656,
-     287,   -171,    281,   1438,
-    2943,   4387,   5404,   5752,
-    5364,   4354,   2975,   1558,
-     424,   -188,   -174,    415,
-    1394,   2496,   3433,   3974,
-    3991,   3488,   2596,   1533,
-     552,   -124,   -351,   -101,
-     539,   1393,   2235,   2854,
-    3096,   2906,   2334,   1523,
-     668,    -27,   -405,   -389,
-       0,    652,   1394,   2036,
-    2419,   2446,   2115,   1507,
-     771,     84,   -392,   -550,
-    -362,    113,    749,   1383,
-    1853,   2043,   1906,   1475,
-     856,    199,   -337,   -629,
-    -612,   -298,    227,    828,
-    1351,   1664,   1690,   1420,
-     920,    312,   -257,   -652,
-    -781,   -618,   -210,    338,
-     884,   1292,   1457,   1337,
-     961,    418,   -160,   -634,
-    -890,   -870,   -585,   -108,
-     438,    914,   1200,   1222,
-     972,    510,    -54,   -584,
-    -951,  -1069,   -912,   -522,
-       0,    522,    912,   1069,
-     951,    584,     54,   -510,
-    -972,  -1222,  -1200,   -914,
-    -438,    108,    585,    870,
-     890,    634,    160,   -418,
-    -961,  -1337,  -1457,  -1292,
-    -884,   -338,    210,    618,
-     781,    652,    257,   -312,
-    -920,  -1420,  -1690,  -1664,
-   -1351,   -828,   -227,    298,
-     612,    629,    337,   -199,
-    -856,  -1475,  -1906,  -2043,
-   -1853,  -1383,   -749,   -113,
-     362,    550,    392,    -84,
-    -771,  -1507,  -2115,  -2446,
-   -2419,  -2036,  -1394,   -652,
-       0,    389,    405,     27,
-    -668,  -1523,  -2334,  -2906,
-   -3096,  -2854,  -2235,  -1393,
-    -539,    101,    351,    124,
-    -552,  -1533,  -2596,  -3488,
-   -3991,  -3974,  -3433,  -2496,
-   -1394,   -415,    174,    188,
-    -424,  -1558,  -2975,  -4354,
-   -5364,  -5752,  -5404,  -4387,
-   -2943,  -1438,   -281,    171,
-    -287,  -1656,  -3708,  -6030,
-   -8108,  -9442,  -9678,  -8701,
-   -6696,  -4134,  -1696,   -142,
-    -145,  -2132,  -6160, -11863,
-  -18470, -24924, -30049, -32766,
-  -32294, -28312, -21036, -11213,
-       0,      0,  14981,  26678,
-   32766,  32524,  26959,  18385,
-    9620,   3087,    119,    680,
-    3580,   7043,   9414,   9738,
-    8011,   5055,   2097,    235,
-      22,   1292,   3303,   5085,
-    5853,   5313,   3742,   1826,
-     348,   -143,    453,   1776,
-    3186,   4050,   4001,   3084,
-    1708,    456,   -169,     43,
-     940,   2086,   2958,   3178,
-    2659,   1639,    556,   -138,
-    -177,    417,   1350,   2195,
-    2579,   2339,   1585,    647,
-     -77,   -294,     64,    815,
-    1613,   2101,   2068,   1532,
-     727,      0,   -346,   -180,
-     407,   1142,   1695,   1823,
-    1471,    795,     85,   -356,
-    -350,     85,    745,   1334,
-    1589,   1399,    848,    174,
-    -334,   -465,   -172,    404,
-    1003,   1358,   1312,    885,
-     261,   -291,   -537,   -378,
-     105,    695,   1127,   1209,
-     904,    344,   -231,   -574,
-    -543,   -159,    403,    891,
-    1088,    905,    419,   -160,
-    -583,   -672,   -393,    125,
-     649,    947,    883,    483,
-     -82,   -569,   -770,   -601,
-    -143,    400,    785,    839,
-     534,      0,   -534,   -839,
-    -785,   -400,    143,    601,
-     770,    569,     82,   -483,
-    -883,   -947,   -649,   -125,
-     393,    672,    583,    160,
-    -419,   -905,  -1088,   -891,
-    -403,    159,    543,    574,
-     231,   -344,   -904,  -1209,
-   -1127,   -695,   -105,    378,
-     537,    291,   -261,   -885,
-   -1312,  -1358,  -1003,   -404,
-     172,    465,    334,   -174,
-    -848,  -1399,  -1589,  -1334,
-    -745,    -85,    350,    356,
-     -85,   -795,  -1471,  -1823,
-   -1695,  -1142,   -407,    180,
-     346,      0,   -727,  -1532,
-   -2068,  -2101,  -1613,   -815,
-     -64,    294,     77,   -647,
-   -1585,  -2339,  -2579,  -2195,
-   -1350,   -417,    177,    138,
-    -556,  -1639,  -2659,  -3178,
-   -2958,  -2086,   -940,    -43,
-     169,   -456,  -1708,  -3084,
-   -4001,  -4050,  -3186,  -1776,
-    -453,    143,   -348,  -1826,
-   -3742,  -5313,  -5853,  -5085,
-   -3303,  -1292,    -22,   -235,
-   -2097,  -5055,  -8011,  -9738,
-   -9414,  -7043,  -3580,   -680,
-    -119,  -3087,  -9620, -18385,
-  -26959, -32524, -32766, -26678,
-  -14981,      0,      0,  18782,
-   30875,  32766,  25595,  14213,
-    4438,    100,   1467,   5764,
-    9252,   9514,   6631,   2697,
-     198,    378,   2607,   5010,
-    5836,   4581,   2193,    294,
-      35,   1369,   3185,   4140,
-    3586,   1955,    385,   -100,
-     716,   2145,   3125,   2968,
-    1810,    472,   -144,    322,
-    1462,   2426,   2525,   1705,
-     552,   -140,     69,    975,
-    1898,   2175,   1616,    625,
-    -109,    -97,    609,   1477,
-    1879,   1532,    689,    -60,
-    -205,    325,   1126,   1616,
-    1447,    743,      0,   -269,
-     102,    826,   1376,   1358,
-     786,     66,   -302,    -75,
-     566,   1152,   1262,    818,
-     135,   -310,   -215,    336,
-     938,   1158,    837,    204,
-    -298,   -323,    133,    733,
-    1045,    844,    271,   -270,
-    -404,    -47,    536,    923,
-     836,    334,   -230,   -461,
-    -206,    346,    793,    813,
-     390,   -181,   -498,   -345,
-     162,    654,    776,    438,
-    -124,   -516,   -465,    -16,
-     506,    723,    476,    -63,
-    -517,   -568,   -187,    350,
-     654,    503,      0,   -503,
-    -654,   -350,    187,    568,
-     517,     63,   -476,   -723,
-    -506,     16,    465,    516,
-     124,   -438,   -776,   -654,
-    -162,    345,    498,    181,
-    -390,   -813,   -793,   -346,
-     206,    461,    230,   -334,
-    -836,   -923,   -536,     47,
-     404,    270,   -271,   -844,
-   -1045,   -733,   -133,    323,
-     298,   -204,   -837,  -1158,
-    -938,   -336,    215,    310,
-    -135,   -818,  -1262,  -1152,
-    -566,     75,    302,    -66,
-    -786,  -1358,  -1376,   -826,
-    -102,    269,      0,   -743,
-   -1447,  -1616,  -1126,   -325,
-     205,     60,   -689,  -1532,
-   -1879,  -1477,   -609,     97,
-     109,   -625,  -1616,  -2175,
-   -1898,   -975,    -69,    140,
-    -552,  -1705,  -2525,  -2426,
-   -1462,   -322,    144,   -472,
-   -1810,  -2968,  -3125,  -2145,
-    -716,    100,   -385,  -1955,
-   -3586,  -4140,  -3185,  -1369,
-     -35,   -294,  -2193,  -4581,
-   -5836,  -5010,  -2607,   -378,
-    -198,  -2697,  -6631,  -9514,
-   -9252,  -5764,  -1467,   -100,
-   -4438, -14213, -25595, -32766,
-  -30875, -18782,      0,      0,
-   22434,  32766,  27597,  13893,
-    2643,    233,   4695,   9207,
-    8858,   4445,    529,    457,
-    3369,   5671,   4918,   2056,
-      44,    667,   2868,   4115,
-    3110,    984,    -72,    854,
-    2567,   3160,   2030,    409,
-     -43,   1012,   2328,   2464,
-    1302,     87,     55,   1138,
-    2104,   1909,    781,    -81,
-     188,   1226,   1876,   1443,
-     402,   -148,    333,   1274,
-    1641,   1044,    129,   -143,
-     476,   1282,   1396,    701,
-     -58,    -88,    606,   1250,
-    1146,    410,   -174,      0,
-     713,   1180,    896,    168,
-    -230,    108,    793,   1076,
-     651,    -25,   -236,    224,
-     841,    942,    418,   -169,
-    -201,    338,    853,    784,
-     204,   -268,   -136,    441,
-     830,    608,     13,   -323,
-     -49,    525,    772,    423,
-    -150,   -337,     51,    584,
-     682,    234,   -280,   -316,
-     155,    614,    562,     51,
-    -375,   -264,    253,    612,
-     419,   -121,   -434,   -190,
-     340,    576,    259,   -275,
-    -457,    -99,    406,    506,
-      88,   -405,   -447,      0,
-     447,    405,    -88,   -506,
-    -406,     99,    457,    275,
-    -259,   -576,   -340,    190,
-     434,    121,   -419,   -612,
-    -253,    264,    375,    -51,
-    -562,   -614,   -155,    316,
-     280,   -234,   -682,   -584,
-     -51,    337,    150,   -423,
-    -772,   -525,     49,    323,
-     -13,   -608,   -830,   -441,
-     136,    268,   -204,   -784,
-    -853,   -338,    201,    169,
-    -418,   -942,   -841,   -224,
-     236,     25,   -651,  -1076,
-    -793,   -108,    230,   -168,
-    -896,  -1180,   -713,      0,
-     174,   -410,  -1146,  -1250,
-    -606,     88,     58,   -701,
-   -1396,  -1282,   -476,    143,
-    -129,  -1044,  -1641,  -1274,
-    -333,    148,   -402,  -1443,
-   -1876,  -1226,   -188,     81,
-    -781,  -1909,  -2104,  -1138,
-     -55,    -87,  -1302,  -2464,
-   -2328,  -1012,     43,   -409,
-   -2030,  -3160,  -2567,   -854,
-      72,   -984,  -3110,  -4115,
-   -2868,   -667,    -44,  -2056,
-   -4918,  -5671,  -3369,   -457,
-    -529,  -4445,  -8858,  -9207,
-   -4695,   -233,  -2643, -13893,
-  -27597, -32766, -22434,      0,
-       0,   2221,   4169,   5746,
-    7056,   8269,   9471,  10631,
-   11691,  12651,  13563,  14468,
-   15353,  16184,  16951,  17683,
-   18409,  19124,  19803,  20435,
-   21037,  21633,  22223,  22787,
-   23312,  23812,  24305,  24794,
-   25264,  25701,  26115,  26522,
-   26926,  27315,  27676,  28015,
-   28346,  28675,  28993,  29286,
-   29558,  29821,  30083,  30335,
-   30566,  30776,  30977,  31176,
-   31367,  31540,  31692,  31833,
-   31973,  32107,  32225,  32321,
-   32406,  32489,  32568,  32631,
-   32674,  32704,  32732,  32756,
-   32766,  32756,  32732,  32704,
-   32674,  32631,  32568,  32489,
-   32406,  32321,  32225,  32107,
-   31973,  31833,  31692,  31540,
-   31367,  31176,  30977,  30776,
-   30566,  30335,  30083,  29821,
-   29558,  29286,  28993,  28675,
-   28346,  28015,  27676,  27315,
-   26926,  26522,  26115,  25701,
-   25264,  24794,  24305,  23812,
-   23312,  22787,  22223,  21633,
-   21037,  20435,  19803,  19124,
-   18409,  17683,  16951,  16184,
-   15353,  14468,  13563,  12651,
-   11691,  10631,   9471,   8269,
-    7056,   5746,   4169,   2221,
-       0,  -2221,  -4169,  -5746,
-   -7056,  -8269,  -9471, -10631,
-  -11691, -12651, -13563, -14468,
-  -15353, -16184, -16951, -17683,
-  -18409, -19124, -19803, -20435,
-  -21037, -21633, -22223, -22787,
-  -23312, -23812, -24305, -24794,
-  -25264, -25701, -26115, -26522,
-  -26926, -27315, -27676, -28015,
-  -28346, -28675, -28993, -29286,
-  -29558, -29821, -30083, -30335,
-  -30566, -30776, -30977, -31176,
-  -31367, -31540, -31692, -31833,
-  -31973, -32107, -32225, -32321,
-  -32406, -32489, -32568, -32631,
-  -32674, -32704, -32732, -32756,
-  -32766, -32756, -32732, -32704,
-  -32674, -32631, -32568, -32489,
-  -32406, -32321, -32225, -32107,
-  -31973, -31833, -31692, -31540,
-  -31367, -31176, -30977, -30776,
-  -30566, -30335, -30083, -29821,
-  -29558, -29286, -28993, -28675,
-  -28346, -28015, -27676, -27315,
-  -26926, -26522, -26115, -25701,
-  -25264, -24794, -24305, -23812,
-  -23312, -22787, -22223, -21633,
-  -21037, -20435, -19803, -19124,
-  -18409, -17683, -16951, -16184,
-  -15353, -14468, -13563, -12651,
-  -11691, -10631,  -9471,  -8269,
-   -7056,  -5746,  -4169,  -2221,
-       0,      0,   5540,   9174,
-   12323,  14903,  17298,  19330,
-   21213,  22851,  24386,  25706,
-   26935,  27998,  28981,  29801,
-   30551,  31163,  31702,  32100,
-   32435,  32637,  32766,  32756,
-   32679,  32455,  32147,  31677,
-   31118,  30353,  29468,  28288,
-   26901,  24660,  22369,  20808,
-   19352,  18062,  16778,  15557,
-   14288,  13006,  11603,  10028,
-    7881,   6164,   4899,   3793,
-    2854,   2020,   1299,    658,
-     102,   -380,   -787,  -1129,
-   -1404,  -1608,  -1748,  -1817,
-   -1817,  -1724,  -1557,  -1256,
-    -833,     -2,    863,   1347,
-    1786,   2116,   2442,   2709,
-    2990,   3227,   3483,   3712,
-    3969,   4201,   4471,   4729,
-    5036,   5335,   5710,   6097,
-    6611,   7181,   8160,   9451,
-   10116,  10469,  10633,  10605,
-   10436,  10073,   9575,   8797,
-    7811,   6007,   4169,   3092,
-    2151,   1431,    761,    214,
-    -300,   -722,  -1129,  -1466,
-   -1784,  -2043,  -2295,  -2493,
-   -2675,  -2813,  -2944,  -3024,
-   -3091,  -3119,  -3137,  -3098,
-   -3048,  -2954,  -2842,  -2653,
-   -2458,  -2190,  -1874,  -1409,
-    -937,      0,    937,   1409,
-    1874,   2190,   2458,   2653,
-    2842,   2954,   3048,   3098,
-    3137,   3119,   3091,   3024,
-    2944,   2813,   2675,   2493,
-    2295,   2043,   1784,   1466,
-    1129,    722,    300,   -214,
-    -761,  -1431,  -2151,  -3092,
-   -4169,  -6007,  -7811,  -8797,
-   -9575, -10073, -10436, -10605,
-  -10633, -10469, -10116,  -9451,
-   -8160,  -7181,  -6611,  -6097,
-   -5710,  -5335,  -5036,  -4729,
-   -4471,  -4201,  -3969,  -3712,
-   -3483,  -3227,  -2990,  -2709,
-   -2442,  -2116,  -1786,  -1347,
-    -863,      2,    833,   1256,
-    1557,   1724,   1817,   1817,
-    1748,   1608,   1404,   1129,
-     787,    380,   -102,   -658,
-   -1299,  -2020,  -2854,  -3793,
-   -4899,  -6164,  -7881, -10028,
-  -11603, -13006, -14288, -15557,
-  -16778, -18062, -19352, -20808,
-  -22369, -24660, -26901, -28288,
-  -29468, -30353, -31118, -31677,
-  -32147, -32455, -32679, -32756,
-  -32766, -32637, -32435, -32100,
-  -31702, -31163, -30551, -29801,
-  -28981, -27998, -26935, -25706,
-  -24386, -22851, -21213, -19330,
-  -17298, -14903, -12323,  -9174,
-   -5540,      0,      0,   8456,
-   13476,  17775,  21023,  23920,
-   26164,  28156,  29653,  30936,
-   31795,  32453,  32715,  32766,
-   32408,  31804,  30709,  29264,
-   26861,  23704,  21122,  18231,
-   14890,  12333,   9950,   7569,
-    4687,   2464,    692,   -806,
-   -2193,  -3422,  -4939,  -6189,
-   -6682,  -6725,  -6117,  -4502,
-   -3423,  -2735,  -2093,  -1458,
-    -714,    372,   1191,   1724,
-    2169,   2534,   2856,   3187,
-    3525,   4211,   5012,   4858,
-    4239,   2484,    866,    -76,
-    -962,  -1685,  -2442,  -3128,
-   -3926,  -4732,  -6010,  -7193,
-   -7831,  -8258,  -8488,  -8535,
-   -8425,  -8065,  -7506,  -6187,
-   -4612,  -4085,  -3913,  -4595,
-   -5051,  -5031,  -4879,  -4535,
-   -4072,  -3367,  -2468,   -822,
-    1498,   2547,   3045,   3038,
-    2660,   1542,   -411,  -1676,
-   -2679,  -3637,  -4924,  -6130,
-   -6675,  -7044,  -7073,  -6946,
-   -6290,  -5185,  -4630,  -4462,
-   -4550,  -5375,  -5509,  -4837,
-   -3124,  -1765,  -1024,   -374,
-      88,    509,    817,   1098,
-    1294,   1466,   1564,   1639,
-    1641,   1615,   1506,   1358,
-    1086,    735,      0,   -735,
-   -1086,  -1358,  -1506,  -1615,
-   -1641,  -1639,  -1564,  -1466,
-   -1294,  -1098,   -817,   -509,
-     -88,    374,   1024,   1765,
-    3124,   4837,   5509,   5375,
-    4550,   4462,   4630,   5185,
-    6290,   6946,   7073,   7044,
-    6675,   6130,   4924,   3637,
-    2679,   1676,    411,  -1542,
-   -2660,  -3038,  -3045,  -2547,
-   -1498,    822,   2468,   3367,
-    4072,   4535,   4879,   5031,
-    5051,   4595,   3913,   4085,
-    4612,   6187,   7506,   8065,
-    8425,   8535,   8488,   8258,
-    7831,   7193,   6010,   4732,
-    3926,   3128,   2442,   1685,
-     962,     76,   -866,  -2484,
-   -4239,  -4858,  -5012,  -4211,
-   -3525,  -3187,  -2856,  -2534,
-   -2169,  -1724,  -1191,   -372,
-     714,   1458,   2093,   2735,
-    3423,   4502,   6117,   6725,
-    6682,   6189,   4939,   3422,
-    2193,    806,   -692,  -2464,
-   -4687,  -7569,  -9950, -12333,
-  -14890, -18231, -21122, -23704,
-  -26861, -29264, -30709, -31804,
-  -32408, -32766, -32715, -32453,
-  -31795, -30936, -29653, -28156,
-  -26164, -23920, -21023, -17775,
-  -13476,  -8456,      0,      0,
-    9956,  15621,  20381,  23809,
-   26788,  28912,  30704,  31806,
-   32611,  32766,  32610,  31723,
-   30428,  27835,  24503,  20930,
-   17371,  14123,  10594,   7924,
-    5202,   2447,    455,  -1108,
-   -2491,  -3904,  -4557,  -4158,
-   -2768,  -1855,  -1100,     -2,
-    1116,   1893,   2711,   3664,
-    5173,   5989,   6286,   6254,
-    5917,   5166,   3735,   2490,
-    1587,    544,   -484,  -2222,
-   -3779,  -4462,  -4553,  -4222,
-   -4355,  -4569,  -5312,  -5588,
-   -4373,  -3174,  -2607,  -2070,
-   -1673,  -1206,   -773,      7,
-     686,    927,    970,    827,
-     463,   -112,  -1377,  -2826,
-   -2838,  -2568,  -2885,  -3528,
-   -4723,  -5905,  -6725,  -8141,
-   -9235,  -9353,  -8877,  -7833,
-   -5491,  -1915,   -128,   1019,
-    1595,   1870,   1485,    507,
-       5,   -164,   -274,     10,
-     170,   -164,   -973,  -2575,
-   -3445,  -3530,  -3142,  -3097,
-   -3287,  -3655,  -4549,  -4930,
-   -4676,  -3700,  -3030,  -3352,
-   -3461,  -2016,   -824,   -209,
-     304,    653,    951,   1146,
-    1304,   1374,   1408,   1351,
-    1249,   1019,    706,      0,
-    -706,  -1019,  -1249,  -1351,
-   -1408,  -1374,  -1304,  -1146,
-    -951,   -653,   -304,    209,
-     824,   2016,   3461,   3352,
-    3030,   3700,   4676,   4930,
-    4549,   3655,   3287,   3097,
-    3142,   3530,   3445,   2575,
-     973,    164,   -170,    -10,
-     274,    164,     -5,   -507,
-   -1485,  -1870,  -1595,  -1019,
-     128,   1915,   5491,   7833,
-    8877,   9353,   9235,   8141,
-    6725,   5905,   4723,   3528,
-    2885,   2568,   2838,   2826,
-    1377,    112,   -463,   -827,
-    -970,   -927,   -686,     -7,
-     773,   1206,   1673,   2070,
-    2607,   3174,   4373,   5588,
-    5312,   4569,   4355,   4222,
-    4553,   4462,   3779,   2222,
-     484,   -544,  -1587,  -2490,
-   -3735,  -5166,  -5917,  -6254,
-   -6286,  -5989,  -5173,  -3664,
-   -2711,  -1893,  -1116,      2,
-    1100,   1855,   2768,   4158,
-    4557,   3904,   2491,   1108,
-    -455,  -2447,  -5202,  -7924,
-  -10594, -14123, -17371, -20930,
-  -24503, -27835, -30428, -31723,
-  -32610, -32766, -32611, -31806,
-  -30704, -28912, -26788, -23809,
-  -20381, -15621,  -9956,      0,
-       0,  12271,  18781,  24044,
-   27490,  30257,  31809,  32766,
-   32653,  31825,  29680,  25854,
-   20898,  16157,  11421,   7292,
-    3416,    204,  -2433,  -4654,
-   -5818,  -5923,  -5206,  -3943,
-   -2108,   -862,    570,   1650,
-    2690,   4042,   4404,   4154,
-    2973,   1462,    231,  -1718,
-   -3317,  -3688,  -4743,  -6329,
-   -7129,  -7360,  -7213,  -6334,
-   -5601,  -4898,  -3976,  -2361,
-   -2030,  -2040,  -1548,   -386,
-    1077,    564,   -988,  -2389,
-   -3381,  -3273,  -3793,  -5083,
-   -5406,  -5559,  -5268,  -4825,
-   -3593,  -2351,  -1557,   -879,
-    -172,    555,   1931,   2387,
-    1865,   2183,   2190,    921,
-      22,     51,   -215,   -757,
-   -2036,  -3547,  -4992,  -5052,
-   -4178,  -1492,   2767,   4716,
-    5680,   5765,   4789,   3948,
-    3135,   3491,   4195,   3926,
-    3008,   1772,   1140,    213,
-    -908,  -1391,   -628,    906,
-    1397,    643,    462,   1212,
-    1902,   2442,   3442,   3881,
-    3493,   2925,   3538,   3180,
-    2473,   2358,    947,    254,
-    -240,   -553,   -794,   -931,
-    -994,   -977,   -844,   -613,
-       0,    613,    844,    977,
-     994,    931,    794,    553,
-     240,   -254,   -947,  -2358,
-   -2473,  -3180,  -3538,  -2925,
-   -3493,  -3881,  -3442,  -2442,
-   -1902,  -1212,   -462,   -643,
-   -1397,   -906,    628,   1391,
-     908,   -213,  -1140,  -1772,
-   -3008,  -3926,  -4195,  -3491,
-   -3135,  -3948,  -4789,  -5765,
-   -5680,  -4716,  -2767,   1492,
-    4178,   5052,   4992,   3547,
-    2036,    757,    215,    -51,
-     -22,   -921,  -2190,  -2183,
-   -1865,  -2387,  -1931,   -555,
-     172,    879,   1557,   2351,
-    3593,   4825,   5268,   5559,
-    5406,   5083,   3793,   3273,
-    3381,   2389,    988,   -564,
-   -1077,    386,   1548,   2040,
-    2030,   2361,   3976,   4898,
-    5601,   6334,   7213,   7360,
-    7129,   6329,   4743,   3688,
-    3317,   1718,   -231,  -1462,
-   -2973,  -4154,  -4404,  -4042,
-   -2690,  -1650,   -570,    862,
-    2108,   3943,   5206,   5923,
-    5818,   4654,   2433,   -204,
-   -3416,  -7292, -11421, -16157,
-  -20898, -25854, -29680, -31825,
-  -32653, -32766, -31809, -30257,
-  -27490, -24044, -18781, -12271,
-       0,      0,  14366,  21477,
-   26975,  30120,  32291,  32766,
-   32189,  29681,  24770,  18374,
-   12441,   6763,   2065,  -2057,
-   -4977,  -7057,  -7253,  -5935,
-   -4390,  -2321,   -491,    924,
-    2196,   3233,   2987,   1547,
-    -180,  -2248,  -3378,  -5376,
-   -6731,  -7867,  -8601,  -7857,
-   -6964,  -6215,  -3605,  -2406,
-   -1761,   -368,    300,    313,
-    -199,   -852,  -1418,  -2762,
-   -2941,  -3617,  -4677,  -5346,
-   -3528,   -703,     80,     25,
-     969,   1855,   2907,   3106,
-    2819,   2299,   1342,   1063,
-     562,     57,   -561,   -427,
-    -298,    731,   1541,   2257,
-    2854,   2766,   4178,   5516,
-    4755,   3847,   2677,   1725,
-    2022,   1276,   -276,  -2483,
-   -4056,  -3879,  -1517,   2765,
-    4284,   4523,   3177,   1627,
-    1072,   1216,   1366,    614,
-    -822,  -1837,  -2956,  -2877,
-   -2515,  -3121,  -4325,  -3285,
-    -607,    437,     -8,   -186,
-      86,   -146,  -1038,     37,
-    -570,  -2094,  -2946,  -2600,
-   -2812,  -3038,  -2593,  -2500,
-   -1883,   -920,    -71,    250,
-     588,    694,    794,    706,
-     553,      0,   -553,   -706,
-    -794,   -694,   -588,   -250,
-      71,    920,   1883,   2500,
-    2593,   3038,   2812,   2600,
-    2946,   2094,    570,    -37,
-    1038,    146,    -86,    186,
-       8,   -437,    607,   3285,
-    4325,   3121,   2515,   2877,
-    2956,   1837,    822,   -614,
-   -1366,  -1216,  -1072,  -1627,
-   -3177,  -4523,  -4284,  -2765,
-    1517,   3879,   4056,   2483,
-     276,  -1276,  -2022,  -1725,
-   -2677,  -3847,  -4755,  -5516,
-   -4178,  -2766,  -2854,  -2257,
-   -1541,   -731,    298,    427,
-     561,    -57,   -562,  -1063,
-   -1342,  -2299,  -2819,  -3106,
-   -2907,  -1855,   -969,    -25,
-     -80,    703,   3528,   5346,
-    4677,   3617,   2941,   2762,
-    1418,    852,    199,   -313,
-    -300,    368,   1761,   2406,
-    3605,   6215,   6964,   7857,
-    8601,   7867,   6731,   5376,
-    3378,   2248,    180,  -1547,
-   -2987,  -3233,  -2196,   -924,
-     491,   2321,   4390,   5935,
-    7253,   7057,   4977,   2057,
-   -2065,  -6763, -12441, -18374,
-  -24770, -29681, -32189, -32766,
-  -32291, -30120, -26975, -21477,
-  -14366,      0,      0,  15443,
-   22783,  28303,  31117,  32766,
-   32290,  30250,  24755,  18019,
-   11402,   5697,    752,  -2885,
-   -5465,  -5904,  -4602,  -2651,
-    -520,   1255,   2970,   4005,
-    3944,   2613,    948,  -1260,
-   -3309,  -5183,  -6705,  -7053,
-   -6962,  -5872,  -4702,  -3433,
-   -2138,  -1085,   -840,    518,
-    -659,  -1838,  -2639,  -3785,
-   -4364,  -4899,  -4983,  -4058,
-   -3109,  -1970,   -634,      9,
-     -68,   1444,   3169,   1993,
-     339,     34,   -949,  -1529,
-   -1675,  -1789,  -1027,    -35,
-     859,   1468,   2605,   3481,
-    3752,   3528,   2731,   2087,
-    1773,   1408,   -162,   -178,
-     900,   1051,   1987,   1823,
-    1857,   2810,   3591,   3313,
-    1312,  -1357,  -2486,  -1058,
-    1934,   2638,   1584,   -558,
-   -1356,   -423,    464,   1129,
-     996,    301,    504,    370,
-    -624,  -1329,  -2348,  -3783,
-   -3300,  -1381,  -1466,  -2272,
-   -1194,   -475,   -264,   -830,
-     456,    136,   -317,  -1168,
-   -1754,  -2118,  -2599,  -2304,
-   -2441,  -2011,  -1667,   -586,
-      35,    414,    599,    720,
-     669,    534,      0,   -534,
-    -669,   -720,   -599,   -414,
-     -35,    586,   1667,   2011,
-    2441,   2304,   2599,   2118,
-    1754,   1168,    317,   -136,
-    -456,    830,    264,    475,
-    1194,   2272,   1466,   1381,
-    3300,   3783,   2348,   1329,
-     624,   -370,   -504,   -301,
-    -996,  -1129,   -464,    423,
-    1356,    558,  -1584,  -2638,
-   -1934,   1058,   2486,   1357,
-   -1312,  -3313,  -3591,  -2810,
-   -1857,  -1823,  -1987,  -1051,
-    -900,    178,    162,  -1408,
-   -1773,  -2087,  -2731,  -3528,
-   -3752,  -3481,  -2605,  -1468,
-    -859,     35,   1027,   1789,
-    1675,   1529,    949,    -34,
-    -339,  -1993,  -3169,  -1444,
-      68,     -9,    634,   1970,
-    3109,   4058,   4983,   4899,
-    4364,   3785,   2639,   1838,
-     659,   -518,    840,   1085,
-    2138,   3433,   4702,   5872,
-    6962,   7053,   6705,   5183,
-    3309,   1260,   -948,  -2613,
-   -3944,  -4005,  -2970,  -1255,
-     520,   2651,   4602,   5904,
-    5465,   2885,   -752,  -5697,
-  -11402, -18019, -24755, -30250,
-  -32290, -32766, -31117, -28303,
-  -22783, -15443,      0,      0,
-   17310,  24974,  30370,  32425,
-   32766,  29921,  23383,  14942,
-    7667,   1200,  -3398,  -6572,
-   -6687,  -4867,  -2347,    -33,
-    1972,   3232,   2950,   1133,
-   -1172,  -3783,  -5823,  -7285,
-   -8034,  -7275,  -5773,  -4256,
-   -2039,   -898,    190,    -14,
-    -758,  -1892,  -2920,  -4420,
-   -3815,  -3893,  -2820,  -1482,
-       7,   1207,   2483,   2962,
-    2373,   1666,    932,    -44,
-    -534,  -2096,   -681,   2241,
-    2202,   2533,   3822,   3574,
-    3885,   3057,   1933,   1486,
-     349,   -241,   -400,     -7,
-     562,    835,   1442,   2043,
-    2004,   1341,    533,   -548,
-    -878,  -1084,  -2224,  -1606,
-    -917,   -767,   -836,     60,
-     791,    -82,  -3070,  -4942,
-   -3398,    307,    888,   -863,
-   -2755,  -2053,   -661,    -31,
-    -408,   -190,    208,     68,
-    -648,  -1213,  -1311,   -661,
-   -1865,  -1277,   1832,   2363,
-    1724,   2389,   1809,   1960,
-     650,    771,    380,     -7,
-    -236,    312,    735,   1421,
-    2139,   2065,   2208,   1902,
-    1589,    598,    -60,   -381,
-    -557,   -581,   -484,      0,
-     484,    581,    557,    381,
-      60,   -598,  -1589,  -1902,
-   -2208,  -2065,  -2139,  -1421,
-    -735,   -312,    236,      7,
-    -380,   -771,   -650,  -1960,
-   -1809,  -2389,  -1724,  -2363,
-   -1832,   1277,   1865,    661,
-    1311,   1213,    648,    -68,
-    -208,    190,    408,     31,
-     661,   2053,   2755,    863,
-    -888,   -307,   3398,   4942,
-    3070,     82,   -791,    -60,
-     836,    767,    917,   1606,
-    2224,   1084,    878,    548,
-    -533,  -1341,  -2004,  -2043,
-   -1442,   -835,   -562,      7,
-     400,    241,   -349,  -1486,
-   -1933,  -3057,  -3885,  -3574,
-   -3822,  -2533,  -2202,  -2241,
-     681,   2096,    534,     44,
-    -932,  -1666,  -2373,  -2962,
-   -2483,  -1207,     -7,   1482,
-    2820,   3893,   3815,   4420,
-    2920,   1892,    758,     14,
-    -190,    898,   2039,   4256,
-    5773,   7275,   8034,   7285,
-    5823,   3783,   1172,  -1133,
-   -2950,  -3232,  -1972,     33,
-    2347,   4867,   6687,   6572,
-    3398,  -1200,  -7667, -14942,
-  -23383, -29921, -32766, -32425,
-  -30370, -24974, -17310,      0,
-       0,   3170,   5785,   7881,
-    9737,  11400,  12865,  14256,
-   15624,  16894,  18056,  19153,
-   20169,  21106,  22022,  22916,
-   23746,  24518,  25251,  25925,
-   26555,  27176,  27772,  28316,
-   28823,  29297,  29722,  30120,
-   30512,  30873,  31190,  31481,
-   31738,  31953,  32150,  32339,
-   32490,  32603,  32694,  32749,
-   32763,  32766,  32753,  32696,
-   32604,  32490,  32331,  32131,
-   31924,  31686,  31391,  31066,
-   30709,  30286,  29820,  29342,
-   28798,  28169,  27508,  26775,
-   25898,  24952,  23941,  22579,
-   20761,  18929,  17533,  16477,
-   15486,  14559,  13764,  13017,
-   12275,  11600,  10984,  10378,
-    9810,   9292,   8778,   8268,
-    7800,   7356,   6919,   6513,
-    6132,   5744,   5363,   5012,
-    4674,   4345,   4043,   3751,
-    3447,   3155,   2888,   2627,
-    2378,   2154,   1928,   1690,
-    1469,   1268,   1071,    893,
-     734,    562,    381,    224,
-      83,    -52,   -160,   -257,
-    -378,   -502,   -592,   -669,
-    -731,   -754,   -780,   -848,
-    -899,   -897,   -880,   -816,
-    -675,   -593,   -623,   -480,
-       0,    480,    623,    593,
-     675,    816,    880,    897,
-     899,    848,    780,    754,
-     731,    669,    592,    502,
-     378,    257,    160,     52,
-     -83,   -224,   -381,   -562,
-    -734,   -893,  -1071,  -1268,
-   -1469,  -1690,  -1928,  -2154,
-   -2378,  -2627,  -2888,  -3155,
-   -3447,  -3751,  -4043,  -4345,
-   -4674,  -5012,  -5363,  -5744,
-   -6132,  -6513,  -6919,  -7356,
-   -7800,  -8268,  -8778,  -9292,
-   -9810, -10378, -10984, -11600,
-  -12275, -13017, -13764, -14559,
-  -15486, -16477, -17533, -18929,
-  -20761, -22579, -23941, -24952,
-  -25898, -26775, -27508, -28169,
-  -28798, -29342, -29820, -30286,
-  -30709, -31066, -31391, -31686,
-  -31924, -32131, -32331, -32490,
-  -32604, -32696, -32753, -32766,
-  -32763, -32749, -32694, -32603,
-  -32490, -32339, -32150, -31953,
-  -31738, -31481, -31190, -30873,
-  -30512, -30120, -29722, -29297,
-  -28823, -28316, -27772, -27176,
-  -26555, -25925, -25251, -24518,
-  -23746, -22916, -22022, -21106,
-  -20169, -19153, -18056, -16894,
-  -15624, -14256, -12865, -11400,
-   -9737,  -7881,  -5785,  -3170,
-       0,      0,   4230,   7258,
-    9823,  11996,  13958,  15779,
-   17451,  18958,  20350,  21618,
-   22841,  23949,  24983,  25917,
-   26791,  27610,  28361,  29038,
-   29653,  30206,  30724,  31169,
-   31565,  31891,  32173,  32409,
-   32585,  32703,  32761,  32766,
-   32725,  32613,  32442,  32197,
-   31891,  31518,  31052,  30502,
-   29830,  29049,  28093,  26866,
-   25022,  23521,  22442,  21453,
-   20584,  19754,  18983,  18239,
-   17537,  16829,  16154,  15453,
-   14789,  14096,  13402,  12685,
-   11928,  11161,  10318,   9398,
-    8360,   6873,   5425,   4450,
-    3654,   2951,   2399,   1891,
-    1500,   1152,    879,    673,
-     532,    458,    450,    492,
-     634,    828,   1147,   1527,
-    2074,   2754,   3877,   5398,
-    6319,   7013,   7565,   8028,
-    8419,   8739,   9010,   9242,
-    9436,   9600,   9718,   9811,
-    9880,   9925,   9952,   9936,
-    9907,   9854,   9791,   9702,
-    9579,   9439,   9285,   9113,
-    8923,   8684,   8442,   8170,
-    7896,   7578,   7220,   6837,
-    6440,   6014,   5550,   4984,
-    4428,   3786,   3159,   2309,
-    1295,      0,  -1295,  -2309,
-   -3159,  -3786,  -4428,  -4984,
-   -5550,  -6014,  -6440,  -6837,
-   -7220,  -7578,  -7896,  -8170,
-   -8442,  -8684,  -8923,  -9113,
-   -9285,  -9439,  -9579,  -9702,
-   -9791,  -9854,  -9907,  -9936,
-   -9952,  -9925,  -9880,  -9811,
-   -9718,  -9600,  -9436,  -9242,
-   -9010,  -8739,  -8419,  -8028,
-   -7565,  -7013,  -6319,  -5398,
-   -3877,  -2754,  -2074,  -1527,
-   -1147,   -828,   -634,   -492,
-    -450,   -458,   -532,   -673,
-    -879,  -1152,  -1500,  -1891,
-   -2399,  -2951,  -3654,  -4450,
-   -5425,  -6873,  -8360,  -9398,
-  -10318, -11161, -11928, -12685,
-  -13402, -14096, -14789, -15453,
-  -16154, -16829, -17537, -18239,
-  -18983, -19754, -20584, -21453,
-  -22442, -23521, -25022, -26866,
-  -28093, -29049, -29830, -30502,
-  -31052, -31518, -31891, -32197,
-  -32442, -32613, -32725, -32766,
-  -32761, -32703, -32585, -32409,
-  -32173, -31891, -31565, -31169,
-  -30724, -30206, -29653, -29038,
-  -28361, -27610, -26791, -25917,
-  -24983, -23949, -22841, -21618,
-  -20350, -18958, -17451, -15779,
-  -13958, -11996,  -9823,  -7258,
-   -4230,      0,      0,   5139,
-    8598,  11570,  14026,  16326,
-   18307,  20133,  21738,  23260,
-   24594,  25831,  26920,  27946,
-   28830,  29638,  30328,  30962,
-   31471,  31913,  32247,  32524,
-   32678,  32766,  32737,  32644,
-   32409,  32096,  31625,  31057,
-   30252,  29282,  27675,  26021,
-   24887,  23821,  22870,  21910,
-   20974,  19990,  18983,  17860,
-   16569,  14786,  13358,  12305,
-   11371,  10577,   9859,   9227,
-    8646,   8136,   7673,   7262,
-    6889,   6569,   6288,   6049,
-    5847,   5693,   5585,   5522,
-    5521,   5588,   5837,   6112,
-    6224,   6332,   6397,   6470,
-    6521,   6595,   6652,   6730,
-    6799,   6901,   6996,   7123,
-    7252,   7430,   7612,   7857,
-    8125,   8509,   8949,   9736,
-   10805,  11346,  11628,  11748,
-   11723,  11586,  11294,  10892,
-   10287,   9522,   8143,   6731,
-    5890,   5142,   4549,   3990,
-    3528,   3083,   2695,   2320,
-    2002,   1686,   1406,   1134,
-     905,    674,    469,    273,
-     115,    -50,   -190,   -319,
-    -409,   -511,   -585,   -640,
-    -648,   -679,   -662,   -606,
-    -462,   -389,      0,    389,
-     462,    606,    662,    679,
-     648,    640,    585,    511,
-     409,    319,    190,     50,
-    -115,   -273,   -469,   -674,
-    -905,  -1134,  -1406,  -1686,
-   -2002,  -2320,  -2695,  -3083,
-   -3528,  -3990,  -4549,  -5142,
-   -5890,  -6731,  -8143,  -9522,
-  -10287, -10892, -11294, -11586,
-  -11723, -11748, -11628, -11346,
-  -10805,  -9736,  -8949,  -8509,
-   -8125,  -7857,  -7612,  -7430,
-   -7252,  -7123,  -6996,  -6901,
-   -6799,  -6730,  -6652,  -6595,
-   -6521,  -6470,  -6397,  -6332,
-   -6224,  -6112,  -5837,  -5588,
-   -5521,  -5522,  -5585,  -5693,
-   -5847,  -6049,  -6288,  -6569,
-   -6889,  -7262,  -7673,  -8136,
-   -8646,  -9227,  -9859, -10577,
-  -11371, -12305, -13358, -14786,
-  -16569, -17860, -18983, -19990,
-  -20974, -21910, -22870, -23821,
-  -24887, -26021, -27675, -29282,
-  -30252, -31057, -31625, -32096,
-  -32409, -32644, -32737, -32766,
-  -32678, -32524, -32247, -31913,
-  -31471, -30962, -30328, -29638,
-  -28830, -27946, -26920, -25831,
-  -24594, -23260, -21738, -20133,
-  -18307, -16326, -14026, -11570,
-   -8598,  -5139,      0,      0,
-    5974,   9842,  13176,  15911,
-   18417,  20517,  22472,  24152,
-   25693,  27010,  28231,  29244,
-   30161,  30908,  31558,  32034,
-   32426,  32647,  32766,  32713,
-   32549,  32179,  31663,  30884,
-   29786,  28003,  26594,  25404,
-   24260,  23041,  21753,  19974,
-   18220,  16985,  15861,  14885,
-   13951,  13082,  12221,  11376,
-   10480,   9479,   8103,   7077,
-    6456,   5995,   5750,   5633,
-    5754,   6037,   6863,   7971,
-    8516,   8925,   9205,   9450,
-    9623,   9787,   9910,  10035,
-   10132,  10257,  10374,  10623,
-   10837,  10879,  10848,  10752,
-   10597,  10383,  10106,   9771,
-    9347,   8845,   8197,   7372,
-    5968,   4804,   4166,   3646,
-    3346,   3126,   3101,   3180,
-    3639,   4384,   4722,   4874,
-    4935,   4904,   4825,   4652,
-    4432,   4080,   3636,   2708,
-    1819,   1505,   1352,   1470,
-    1749,   2473,   3655,   4327,
-    4750,   5061,   5289,   5451,
-    5558,   5628,   5653,   5639,
-    5600,   5525,   5414,   5279,
-    5116,   4908,   4680,   4419,
-    4109,   3761,   3386,   2927,
-    2413,   1833,   1087,      0,
-   -1087,  -1833,  -2413,  -2927,
-   -3386,  -3761,  -4109,  -4419,
-   -4680,  -4908,  -5116,  -5279,
-   -5414,  -5525,  -5600,  -5639,
-   -5653,  -5628,  -5558,  -5451,
-   -5289,  -5061,  -4750,  -4327,
-   -3655,  -2473,  -1749,  -1470,
-   -1352,  -1505,  -1819,  -2708,
-   -3636,  -4080,  -4432,  -4652,
-   -4825,  -4904,  -4935,  -4874,
-   -4722,  -4384,  -3639,  -3180,
-   -3101,  -3126,  -3346,  -3646,
-   -4166,  -4804,  -5968,  -7372,
-   -8197,  -8845,  -9347,  -9771,
-  -10106, -10383, -10597, -10752,
-  -10848, -10879, -10837, -10623,
-  -10374, -10257, -10132, -10035,
-   -9910,  -9787,  -9623,  -9450,
-   -9205,  -8925,  -8516,  -7971,
-   -6863,  -6037,  -5754,  -5633,
-   -5750,  -5995,  -6456,  -7077,
-   -8103,  -9479, -10480, -11376,
-  -12221, -13082, -13951, -14885,
-  -15861, -16985, -18220, -19974,
-  -21753, -23041, -24260, -25404,
-  -26594, -28003, -29786, -30884,
-  -31663, -32179, -32549, -32713,
-  -32766, -32647, -32426, -32034,
-  -31558, -30908, -30161, -29244,
-  -28231, -27010, -25693, -24152,
-  -22472, -20517, -18417, -15911,
-  -13176,  -9842,  -5974,      0,
-       0,   6764,  11016,  14691,
-   17644,  20303,  22514,  24540,
-   26217,  27750,  29003,  30114,
-   30991,  31728,  32240,  32618,
-   32766,  32757,  32512,  32044,
-   31290,  30031,  28207,  26846,
-   25454,  23951,  21905,  20301,
-   18952,  17731,  16474,  15238,
-   13589,  12032,  10984,  10113,
-    9413,   8838,   8372,   8023,
-    7766,   7635,   7625,   7864,
-    8041,   8188,   8343,   8567,
-    8825,   9217,   9690,  10599,
-   11698,  12242,  12600,  12796,
-   12892,  12882,  12783,  12597,
-   12306,  11931,  11402,  10744,
-    9634,   8488,   7763,   7097,
-    6542,   5997,   5509,   5007,
-    4537,   4027,   3516,   2913,
-    2214,   1038,    140,   -223,
-    -408,   -320,    -75,    482,
-    1259,   2782,   4949,   6150,
-    6969,   7536,   7937,   8188,
-    8303,   8290,   8117,   7784,
-    6983,   6138,   5780,   5498,
-    5418,   5396,   5736,   6374,
-    6471,   6177,   5562,   4278,
-    3319,   2709,   2195,   1771,
-    1399,   1079,    791,    537,
-     318,    113,    -50,   -203,
-    -325,   -424,   -495,   -551,
-    -545,   -553,   -448,   -343,
-       0,    343,    448,    553,
-     545,    551,    495,    424,
-     325,    203,     50,   -113,
-    -318,   -537,   -791,  -1079,
-   -1399,  -1771,  -2195,  -2709,
-   -3319,  -4278,  -5562,  -6177,
-   -6471,  -6374,  -5736,  -5396,
-   -5418,  -5498,  -5780,  -6138,
-   -6983,  -7784,  -8117,  -8290,
-   -8303,  -8188,  -7937,  -7536,
-   -6969,  -6150,  -4949,  -2782,
-   -1259,   -482,     75,    320,
-     408,    223,   -140,  -1038,
-   -2214,  -2913,  -3516,  -4027,
-   -4537,  -5007,  -5509,  -5997,
-   -6542,  -7097,  -7763,  -8488,
-   -9634, -10744, -11402, -11931,
-  -12306, -12597, -12783, -12882,
-  -12892, -12796, -12600, -12242,
-  -11698, -10599,  -9690,  -9217,
-   -8825,  -8567,  -8343,  -8188,
-   -8041,  -7864,  -7625,  -7635,
-   -7766,  -8023,  -8372,  -8838,
-   -9413, -10113, -10984, -12032,
-  -13589, -15238, -16474, -17731,
-  -18952, -20301, -21905, -23951,
-  -25454, -26846, -28207, -30031,
-  -31290, -32044, -32512, -32757,
-  -32766, -32618, -32240, -31728,
-  -30991, -30114, -29003, -27750,
-  -26217, -24540, -22514, -20303,
-  -17644, -14691, -11016,  -6764,
-       0,      0,   7512,  12118,
-   16099,  19213,  22007,  24278,
-   26318,  27964,  29422,  30542,
-   31498,  32136,  32611,  32766,
-   32736,  32340,  31687,  30373,
-   28538,  27024,  25255,  23128,
-   21513,  19972,  18393,  16387,
-   14851,  13615,  12554,  11532,
-   10589,   9351,   8280,   7791,
-    7608,   7861,   8765,   9326,
-    9633,   9902,  10152,  10439,
-   10862,  11176,  11377,  11544,
-   11691,  11825,  11997,  12188,
-   12675,  13263,  13166,  12743,
-   11574,  10476,   9801,   9149,
-    8589,   7992,   7428,   6766,
-    6081,   5012,   4003,   3415,
-    2975,   2682,   2510,   2448,
-    2547,   2779,   3495,   4376,
-    4572,   4526,   3867,   3390,
-    3301,   3319,   3504,   3789,
-    4278,   4927,   6181,   7974,
-    8783,   9168,   9184,   8926,
-    8165,   6838,   5929,   5150,
-    4366,   3265,   2207,   1681,
-    1285,   1146,   1122,   1492,
-    2201,   2484,   2473,   2267,
-    1531,   1258,   1514,   2445,
-    3143,   3444,   3683,   3795,
-    3878,   3880,   3861,   3779,
-    3672,   3514,   3321,   3083,
-    2797,   2457,   2057,   1557,
-     964,      0,   -964,  -1557,
-   -2057,  -2457,  -2797,  -3083,
-   -3321,  -3514,  -3672,  -3779,
-   -3861,  -3880,  -3878,  -3795,
-   -3683,  -3444,  -3143,  -2445,
-   -1514,  -1258,  -1531,  -2267,
-   -2473,  -2484,  -2201,  -1492,
-   -1122,  -1146,  -1285,  -1681,
-   -2207,  -3265,  -4366,  -5150,
-   -5929,  -6838,  -8165,  -8926,
-   -9184,  -9168,  -8783,  -7974,
-   -6181,  -4927,  -4278,  -3789,
-   -3504,  -3319,  -3301,  -3390,
-   -3867,  -4526,  -4572,  -4376,
-   -3495,  -2779,  -2547,  -2448,
-   -2510,  -2682,  -2975,  -3415,
-   -4003,  -5012,  -6081,  -6766,
-   -7428,  -7992,  -8589,  -9149,
-   -9801, -10476, -11574, -12743,
-  -13166, -13263, -12675, -12188,
-  -11997, -11825, -11691, -11544,
-  -11377, -11176, -10862, -10439,
-  -10152,  -9902,  -9633,  -9326,
-   -8765,  -7861,  -7608,  -7791,
-   -8280,  -9351, -10589, -11532,
-  -12554, -13615, -14851, -16387,
-  -18393, -19972, -21513, -23128,
-  -25255, -27024, -28538, -30373,
-  -31687, -32340, -32736, -32766,
-  -32611, -32136, -31498, -30542,
-  -29422, -27964, -26318, -24278,
-  -22007, -19213, -16099, -12118,
-   -7512,      0,      0,   8218,
-   13153,  17397,  20636,  23536,
-   25810,  27840,  29388,  30728,
-   31648,  32367,  32676,  32766,
-   32384,  31703,  30114,  28284,
-   26411,  24173,  22414,  20478,
-   18329,  16702,  15247,  13796,
-   12053,  10790,   9928,   9288,
-    8866,   8639,   8707,   8932,
-    9126,   9486,  10070,  11200,
-   11892,  12300,  12572,  12783,
-   12927,  13154,  13156,  12996,
-   12620,  12109,  11011,   9949,
-    9477,   9401,   9600,   9221,
-    8659,   7447,   6404,   5797,
-    5312,   4960,   4692,   4515,
-    4429,   4440,   4668,   4948,
-    5052,   5172,   5248,   5376,
-    5487,   5701,   5939,   6585,
-    7282,   7296,   6965,   6002,
-    5029,   4295,   3090,   2042,
-    1655,   1583,   1837,   2718,
-    4218,   4849,   5186,   5222,
-    5104,   4564,   3617,   3119,
-    2923,   2845,   3040,   3277,
-    3437,   3598,   3818,   4082,
-    4598,   5378,   5665,   5632,
-    5319,   4464,   3921,   3812,
-    4148,   4148,   3208,   2206,
-    1663,   1208,    864,    555,
-     312,     90,    -81,   -234,
-    -341,   -429,   -467,   -482,
-    -425,   -322,      0,    322,
-     425,    482,    467,    429,
-     341,    234,     81,    -90,
-    -312,   -555,   -864,  -1208,
-   -1663,  -2206,  -3208,  -4148,
-   -4148,  -3812,  -3921,  -4464,
-   -5319,  -5632,  -5665,  -5378,
-   -4598,  -4082,  -3818,  -3598,
-   -3437,  -3277,  -3040,  -2845,
-   -2923,  -3119,  -3617,  -4564,
-   -5104,  -5222,  -5186,  -4849,
-   -4218,  -2718,  -1837,  -1583,
-   -1655,  -2042,  -3090,  -4295,
-   -5029,  -6002,  -6965,  -7296,
-   -7282,  -6585,  -5939,  -5701,
-   -5487,  -5376,  -5248,  -5172,
-   -5052,  -4948,  -4668,  -4440,
-   -4429,  -4515,  -4692,  -4960,
-   -5312,  -5797,  -6404,  -7447,
-   -8659,  -9221,  -9600,  -9401,
-   -9477,  -9949, -11011, -12109,
-  -12620, -12996, -13156, -13154,
-  -12927, -12783, -12572, -12300,
-  -11892, -11200, -10070,  -9486,
-   -9126,  -8932,  -8707,  -8639,
-   -8866,  -9288,  -9928, -10790,
-  -12053, -13796, -15247, -16702,
-  -18329, -20478, -22414, -24173,
-  -26411, -28284, -30114, -31703,
-  -32384, -32766, -32676, -32367,
-  -31648, -30728, -29388, -27840,
-  -25810, -23536, -20636, -17397,
-  -13153,  -8218,      0,      0,
-    8899,  14141,  18614,  21959,
-   24925,  27174,  29148,  30555,
-   31720,  32366,  32766,  32605,
-   32137,  30743,  28823,  26637,
-   24413,  22313,  19960,  18164,
-   16272,  14271,  12830,  11648,
-   10552,   9316,   8660,   8730,
-    9464,   9876,  10186,  10629,
-   11103,  11457,  11877,  12433,
-   13417,  13911,  14037,  13935,
-   13619,  13008,  11905,  10950,
-   10260,   9479,   8728,   7493,
-    6406,   5927,   5926,   6239,
-    6130,   5919,   5277,   4939,
-    5604,   6254,   6500,   6715,
-    6839,   6985,   7101,   7370,
-    7578,   7571,   7455,   7238,
-    6891,   6419,   5514,   4501,
-    4466,   4624,   4320,   3763,
-    2731,   1747,   1092,     49,
-    -733,   -826,   -466,    313,
-    2097,   4823,   6163,   6993,
-    7385,   7532,   7180,   6369,
-    5894,   5627,   5382,   5304,
-    5146,   4774,   4116,   2988,
-    2356,   2309,   2640,   2643,
-    2426,   2044,   1222,    784,
-     824,   1390,   1729,   1349,
-    1101,   1871,   2478,   2708,
-    2869,   2915,   2926,   2859,
-    2764,   2597,   2401,   2126,
-    1812,   1381,    873,      0,
-    -873,  -1381,  -1812,  -2126,
-   -2401,  -2597,  -2764,  -2859,
-   -2926,  -2915,  -2869,  -2708,
-   -2478,  -1871,  -1101,  -1349,
-   -1729,  -1390,   -824,   -784,
-   -1222,  -2044,  -2426,  -2643,
-   -2640,  -2309,  -2356,  -2988,
-   -4116,  -4774,  -5146,  -5304,
-   -5382,  -5627,  -5894,  -6369,
-   -7180,  -7532,  -7385,  -6993,
-   -6163,  -4823,  -2097,   -313,
-     466,    826,    733,    -49,
-   -1092,  -1747,  -2731,  -3763,
-   -4320,  -4624,  -4466,  -4501,
-   -5514,  -6419,  -6891,  -7238,
-   -7455,  -7571,  -7578,  -7370,
-   -7101,  -6985,  -6839,  -6715,
-   -6500,  -6254,  -5604,  -4939,
-   -5277,  -5919,  -6130,  -6239,
-   -5926,  -5927,  -6406,  -7493,
-   -8728,  -9479, -10260, -10950,
-  -11905, -13008, -13619, -13935,
-  -14037, -13911, -13417, -12433,
-  -11877, -11457, -11103, -10629,
-  -10186,  -9876,  -9464,  -8730,
-   -8660,  -9316, -10552, -11648,
-  -12830, -14271, -16272, -18164,
-  -19960, -22313, -24413, -26637,
-  -28823, -30743, -32137, -32605,
-  -32766, -32366, -31720, -30555,
-  -29148, -27174, -24925, -21959,
-  -18614, -14141,  -8899,      0,
-       0,  10331,  19586,  26824,
-   31342,  32766,  31083,  26634,
-   20058,  12204,   4013,  -3599,
-   -9856, -14210, -16388, -16409,
-  -14548, -11278,  -7181,  -2853,
-    1186,   4556,   7066,   8715,
-    9666,  10197,  10626,  11241,
-   12235,  13656,  15399,  17214,
-   18751,  19625,  19490,  18113,
-   15429,  11577,   6893,   1885,
-   -2837,  -6645,  -8979,  -9444,
-   -7867,  -4339,    784,   6928,
-   13365,  19316,  24054,  27007,
-   27842,  26507,  23247,  18565,
-   13154,   7797,   3256,    164,
-   -1068,   -308,   2279,   6258,
-   10984,  15704,  19663,  22217,
-   22931,  21639,  18474,  13848,
-    8392,   2869,  -1937,  -5335,
-   -6819,  -6148,  -3369,   1180,
-    6931,  13156,  19075,  23962,
-   27241,  28558,  27822,  25205,
-   21103,  16076,  10752,   5742,
-    1552,  -1479,  -3213,  -3715,
-   -3217,  -2066,   -646,    693,
-    1702,   2274,   2460,   2453,
-    2539,   3038,   4228,   6272,
-    9170,  12730,  16574,  20180,
-   22955,  24315,  23789,  21101,
-   16233,   9458,   1325,  -7390,
-  -15772, -22878, -27860, -30077,
-  -29189, -25207, -18508,  -9791,
-       0,   9791,  18508,  25207,
-   29189,  30077,  27860,  22878,
-   15772,   7390,  -1325,  -9458,
-  -16233, -21101, -23789, -24315,
-  -22955, -20180, -16574, -12730,
-   -9170,  -6272,  -4228,  -3038,
-   -2539,  -2453,  -2460,  -2274,
-   -1702,   -693,    646,   2066,
-    3217,   3715,   3213,   1479,
-   -1552,  -5742, -10752, -16076,
-  -21103, -25205, -27822, -28558,
-  -27241, -23962, -19075, -13156,
-   -6931,  -1180,   3369,   6148,
-    6819,   5335,   1937,  -2869,
-   -8392, -13848, -18474, -21639,
-  -22931, -22217, -19663, -15704,
-  -10984,  -6258,  -2279,    308,
-    1068,   -164,  -3256,  -7797,
-  -13154, -18565, -23247, -26507,
-  -27842, -27007, -24054, -19316,
-  -13365,  -6928,   -784,   4339,
-    7867,   9444,   8979,   6645,
-    2837,  -1885,  -6893, -11577,
-  -15429, -18113, -19490, -19625,
-  -18751, -17214, -15399, -13656,
-  -12235, -11241, -10626, -10197,
-   -9666,  -8715,  -7066,  -4556,
-   -1186,   2853,   7181,  11278,
-   14548,  16409,  16388,  14210,
-    9856,   3599,  -4013, -12204,
-  -20058, -26634, -31083, -32766,
-  -31342, -26824, -19586, -10331,
-       0,      0,   9714,  18530,
-   25657,  30508,  32766,  32417,
-   29738,  25259,  19680,  13782,
-    8322,   3941,   1093,      1,
-     648,   2801,   6065,   9953,
-   13969,  17677,  20762,  23063,
-   24578,  25445,  25892,  26187,
-   26569,  27198,  28119,  29243,
-   30365,  31197,  31421,  30750,
-   28995,  26105,  22197,  17557,
-   12609,   7864,   3851,   1037,
-    -243,    158,   2167,   5496,
-    9668,  14083,  18096,  21109,
-   22648,  22441,  20448,  16876,
-   12147,   6842,   1614,  -2899,
-   -6168,  -7850,  -7831,  -6247,
-   -3459,      0,   3503,   6423,
-    8225,   8549,   7255,   4456,
-     491,  -4113,  -8723, -12689,
-  -15436, -16546, -15819, -13297,
-   -9263,  -4192,   1307,   6584,
-   11032,  14168,  15695,  15534,
-   13825,  10896,   7207,   3279,
-    -384,  -3363,  -5380,  -6323,
-   -6248,  -5353,  -3926,  -2292,
-    -742,    512,   1382,   1906,
-    2244,   2632,   3336,   4585,
-    6515,   9124,  12253,  15587,
-   18693,  21076,  22252,  21830,
-   19581,  15491,   9788,   2931,
-   -4433, -11541, -17606, -21921,
-  -23952, -23411, -20308, -14952,
-   -7921,      0,   7921,  14952,
-   20308,  23411,  23952,  21921,
-   17606,  11541,   4433,  -2931,
-   -9788, -15491, -19581, -21830,
-  -22252, -21076, -18693, -15587,
-  -12253,  -9124,  -6515,  -4585,
-   -3336,  -2632,  -2244,  -1906,
-   -1382,   -512,    742,   2292,
-    3926,   5353,   6248,   6323,
-    5380,   3363,    384,  -3279,
-   -7207, -10896, -13825, -15534,
-  -15695, -14168, -11032,  -6584,
-   -1307,   4192,   9263,  13297,
-   15819,  16546,  15436,  12689,
-    8723,   4113,   -491,  -4456,
-   -7255,  -8549,  -8225,  -6423,
-   -3503,      0,   3459,   6247,
-    7831,   7850,   6168,   2899,
-   -1614,  -6842, -12147, -16876,
-  -20448, -22441, -22648, -21109,
-  -18096, -14083,  -9668,  -5496,
-   -2167,   -158,    243,  -1037,
-   -3851,  -7864, -12609, -17557,
-  -22197, -26105, -28995, -30750,
-  -31421, -31197, -30365, -29243,
-  -28119, -27198, -26569, -26187,
-  -25892, -25445, -24578, -23063,
-  -20762, -17677, -13969,  -9953,
-   -6065,  -2801,   -648,     -1,
-   -1093,  -3941,  -8322, -13782,
-  -19680, -25259, -29738, -32417,
-  -32766, -30508, -25657, -18530,
-   -9714,      0,      0,   4908,
-    9288,  12691,  14814,  15550,
-   14997,  13448,  11342,   9197,
-    7534,   6791,   7263,   9048,
-   12041,  15940,  20300,  24595,
-   28298,  30963,  32294,  32183,
-   30735,  28244,  25156,  21992,
-   19276,  17454,  16822,  17486,
-   19343,  22098,  25310,  28457,
-   31018,  32552,  32766,  31559,
-   29037,  25502,  21401,  17261,
-   13609,  10894,   9417,   9284,
-   10398,  12464,  15044,  17618,
-   19666,  20750,  20575,  19043,
-   16260,  12527,   8291,   4079,
-     418,  -2247,  -3616,  -3583,
-   -2248,     92,   2995,   5940,
-    8405,   9945,  10265,   9262,
-    7039,   3893,    268,  -3315,
-   -6332,  -8341,  -9046,  -8345,
-   -6344,  -3341,    217,   3806,
-    6898,   9047,   9955,   9514,
-    7826,   5184,   2030,  -1117,
-   -3736,  -5385,  -5771,  -4792,
-   -2557,    637,   4342,   8034,
-   11185,  13350,  14230,  13719,
-   11920,   9127,   5784,   2412,
-    -465,  -2405,  -3112,  -2482,
-    -619,   2181,   5474,   8737,
-   11447,  13162,  13586,  12616,
-   10358,   7110,   3318,   -493,
-   -3797,  -6149,  -7248,  -6990,
-   -5475,  -2998,      0,   2998,
-    5475,   6990,   7248,   6149,
-    3797,    493,  -3318,  -7110,
-  -10358, -12616, -13586, -13162,
-  -11447,  -8737,  -5474,  -2181,
-     619,   2482,   3112,   2405,
-     465,  -2412,  -5784,  -9127,
-  -11920, -13719, -14230, -13350,
-  -11185,  -8034,  -4342,   -637,
-    2557,   4792,   5771,   5385,
-    3736,   1117,  -2030,  -5184,
-   -7826,  -9514,  -9955,  -9047,
-   -6898,  -3806,   -217,   3341,
-    6344,   8345,   9046,   8341,
-    6332,   3315,   -268,  -3893,
-   -7039,  -9262, -10265,  -9945,
-   -8405,  -5940,  -2995,    -92,
-    2248,   3583,   3616,   2247,
-    -418,  -4079,  -8291, -12527,
-  -16260, -19043, -20575, -20750,
-  -19666, -17618, -15044, -12464,
-  -10398,  -9284,  -9417, -10894,
-  -13609, -17261, -21401, -25502,
-  -29037, -31559, -32766, -32552,
-  -31018, -28457, -25310, -22098,
-  -19343, -17486, -16822, -17454,
-  -19276, -21992, -25156, -28244,
-  -30735, -32183, -32294, -30963,
-  -28298, -24595, -20300, -15940,
-  -12041,  -9048,  -7263,  -6791,
-   -7534,  -9197, -11342, -13448,
-  -14997, -15550, -14814, -12691,
-   -9288,  -4908,      0,      0,
-    3172,   6311,   9384,  12359,
-   15208,  17901,  20416,  22729,
-   24823,  26682,  28297,  29661,
-   30771,  31629,  32241,  32616,
-   32766,  32708,  32460,  32042,
-   31479,  30793,  30009,  29152,
-   28247,  27317,  26383,  25467,
-   24586,  23755,  22988,  22292,
-   21675,  21140,  20684,  20306,
-   19997,  19749,  19548,  19381,
-   19231,  19082,  18915,  18712,
-   18454,  18124,  17707,  17187,
-   16552,  15792,  14901,  13875,
-   12712,  11416,   9993,   8453,
-    6808,   5074,   3272,   1421,
-    -455,  -2331,  -4180,  -5975,
-   -7690,  -9299, -10775, -12095,
-  -13236, -14181, -14911, -15415,
-  -15682, -15708, -15490, -15032,
-  -14339, -13423, -12297, -10981,
-   -9494,  -7862,  -6111,  -4270,
-   -2367,   -435,   1497,   3397,
-    5236,   6985,   8619,  10113,
-   11446,  12602,  13565,  14325,
-   14877,  15217,  15348,  15274,
-   15005,  14553,  13935,  13169,
-   12275,  11276,  10197,   9061,
-    7894,   6721,   5565,   4448,
-    3392,   2414,   1531,    755,
-      95,   -442,   -853,  -1138,
-   -1303,  -1354,  -1300,  -1156,
-    -936,   -657,   -339,      0,
-     339,    657,    936,   1156,
-    1300,   1354,   1303,   1138,
-     853,    442,    -95,   -755,
-   -1531,  -2414,  -3392,  -4448,
-   -5565,  -6721,  -7894,  -9061,
-  -10197, -11276, -12275, -13169,
-  -13935, -14553, -15005, -15274,
-  -15348, -15217, -14877, -14325,
-  -13565, -12602, -11446, -10113,
-   -8619,  -6985,  -5236,  -3397,
-   -1497,    435,   2367,   4270,
-    6111,   7862,   9494,  10981,
-   12297,  13423,  14339,  15032,
-   15490,  15708,  15682,  15415,
-   14911,  14181,  13236,  12095,
-   10775,   9299,   7690,   5975,
-    4180,   2331,    455,  -1421,
-   -3272,  -5074,  -6808,  -8453,
-   -9993, -11416, -12712, -13875,
-  -14901, -15792, -16552, -17187,
-  -17707, -18124, -18454, -18712,
-  -18915, -19082, -19231, -19381,
-  -19548, -19749, -19997, -20306,
-  -20684, -21140, -21675, -22292,
-  -22988, -23755, -24586, -25467,
-  -26383, -27317, -28247, -29152,
-  -30009, -30793, -31479, -32042,
-  -32460, -32708, -32766, -32616,
-  -32241, -31629, -30771, -29661,
-  -28297, -26682, -24823, -22729,
-  -20416, -17901, -15208, -12359,
-   -9384,  -6311,  -3172,      0,
-       0,   3516,   6941,  10189,
-   13179,  15839,  18111,  19950,
-   21325,  22226,  22656,  22636,
-   22203,  21409,  20317,  19001,
-   17540,  16017,  14517,  13120,
-   11901,  10925,  10247,   9907,
-    9930,  10325,  11084,  12184,
-   13586,  15236,  17070,  19015,
-   20992,  22916,  24707,  26285,
-   27578,  28523,  29069,  29180,
-   28835,  28031,  26779,  25109,
-   23066,  20709,  18110,  15347,
-   12509,   9683,   6961,   4429,
-    2165,    240,  -1288,  -2375,
-   -2994,  -3133,  -2800,  -2015,
-    -819,    735,   2583,   4649,
-    6851,   9104,  11322,  13422,
-   15328,  16972,  18298,  19264,
-   19842,  20022,  19810,  19227,
-   18312,  17116,  15700,  14138,
-   12509,  10892,   9371,   8023,
-    6919,   6121,   5681,   5634,
-    5999,   6783,   7971,   9535,
-   11431,  13598,  15968,  18461,
-   20992,  23470,  25809,  27923,
-   29733,  31172,  32182,  32722,
-   32766,  32304,  31345,  29913,
-   28048,  25807,  23256,  20472,
-   17540,  14546,  11579,   8722,
-    6056,   3648,   1558,   -171,
-   -1510,  -2447,  -2986,  -3148,
-   -2969,  -2498,  -1798,   -939,
-       0,    939,   1798,   2498,
-    2969,   3148,   2986,   2447,
-    1510,    171,  -1558,  -3648,
-   -6056,  -8722, -11579, -14546,
-  -17540, -20472, -23256, -25807,
-  -28048, -29913, -31345, -32304,
-  -32766, -32722, -32182, -31172,
-  -29733, -27923, -25809, -23470,
-  -20992, -18461, -15968, -13598,
-  -11431,  -9535,  -7971,  -6783,
-   -5999,  -5634,  -5681,  -6121,
-   -6919,  -8023,  -9371, -10892,
-  -12509, -14138, -15700, -17116,
-  -18312, -19227, -19810, -20022,
-  -19842, -19264, -18298, -16972,
-  -15328, -13422, -11322,  -9104,
-   -6851,  -4649,  -2583,   -735,
-     819,   2015,   2800,   3133,
-    2994,   2375,   1288,   -240,
-   -2165,  -4429,  -6961,  -9683,
-  -12509, -15347, -18110, -20709,
-  -23066, -25109, -26779, -28031,
-  -28835, -29180, -29069, -28523,
-  -27578, -26285, -24707, -22916,
-  -20992, -19015, -17070, -15236,
-  -13586, -12184, -11084, -10325,
-   -9930,  -9907, -10247, -10925,
-  -11901, -13120, -14517, -16017,
-  -17540, -19001, -20317, -21409,
-  -22203, -22636, -22656, -22226,
-  -21325, -19950, -18111, -15839,
-  -13179, -10189,  -6941,  -3516,
-       0,      0,   4500,   8902,
-   13113,  17047,  20628,  23796,
-   26503,  28723,  30444,  31673,
-   32435,  32766,  32718,  32350,
-   31727,  30919,  29993,  29013,
-   28035,  27109,  26272,  25548,
-   24952,  24485,  24136,  23887,
-   23711,  23576,  23447,  23288,
-   23068,  22757,  22332,  21777,
-   21085,  20257,  19302,  18234,
-   17078,  15858,  14604,  13347,
-   12115,  10935,   9830,   8816,
-    7904,   7098,   6398,   5795,
-    5277,   4829,   4431,   4065,
-    3714,   3360,   2993,   2604,
-    2190,   1754,   1303,    850,
-     409,      0,   -359,   -647,
-    -849,   -950,   -939,   -812,
-    -571,   -220,    226,    752,
-    1336,   1955,   2582,   3194,
-    3767,   4283,   4725,   5085,
-    5359,   5550,   5667,   5723,
-    5738,   5731,   5725,   5742,
-    5800,   5913,   6090,   6333,
-    6636,   6984,   7357,   7726,
-    8057,   8312,   8453,   8441,
-    8241,   7825,   7171,   6268,
-    5118,   3733,   2141,    379,
-   -1502,  -3442,  -5374,  -7227,
-   -8927, -10405, -11595, -12440,
-  -12898, -12936, -12542, -11718,
-  -10485,  -8881,  -6959,  -4785,
-   -2437,      0,   2437,   4785,
-    6959,   8881,  10485,  11718,
-   12542,  12936,  12898,  12440,
-   11595,  10405,   8927,   7227,
-    5374,   3442,   1502,   -379,
-   -2141,  -3733,  -5118,  -6268,
-   -7171,  -7825,  -8241,  -8441,
-   -8453,  -8312,  -8057,  -7726,
-   -7357,  -6984,  -6636,  -6333,
-   -6090,  -5913,  -5800,  -5742,
-   -5725,  -5731,  -5738,  -5723,
-   -5667,  -5550,  -5359,  -5085,
-   -4725,  -4283,  -3767,  -3194,
-   -2582,  -1955,  -1336,   -752,
-    -226,    220,    571,    812,
-     939,    950,    849,    647,
-     359,      0,   -409,   -850,
-   -1303,  -1754,  -2190,  -2604,
-   -2993,  -3360,  -3714,  -4065,
-   -4431,  -4829,  -5277,  -5795,
-   -6398,  -7098,  -7904,  -8816,
-   -9830, -10935, -12115, -13347,
-  -14604, -15858, -17078, -18234,
-  -19302, -20257, -21085, -21777,
-  -22332, -22757, -23068, -23288,
-  -23447, -23576, -23711, -23887,
-  -24136, -24485, -24952, -25548,
-  -26272, -27109, -28035, -29013,
-  -29993, -30919, -31727, -32350,
-  -32718, -32766, -32435, -31673,
-  -30444, -28723, -26503, -23796,
-  -20628, -17047, -13113,  -8902,
-   -4500,      0,      0,   7240,
-   14078,  20149,  25169,  28953,
-   31433,  32655,  32766,  31988,
-   30585,  28828,  26965,  25189,
-   23625,  22325,  21275,  20409,
-   19632,  18846,  17973,  16970,
-   15844,  14646,  13466,  12416,
-   11607,  11128,  11030,  11309,
-   11908,  12717,  13593,  14374,
-   14910,  15080,  14817,  14113,
-   13025,  11667,  10190,   8761,
-    7537,   6637,   6125,   6000,
-    6189,   6564,   6960,   7195,
-    7108,   6580,   5559,   4071,
-    2219,    176,  -1840,  -3593,
-   -4864,  -5482,  -5346,  -4447,
-   -2868,   -778,   1592,   3977,
-    6111,   7761,   8759,   9022,
-    8558,   7465,   5915,   4125,
-    2330,    746,   -457,  -1175,
-   -1386,  -1144,   -570,    173,
-     901,   1446,   1677,   1520,
-     971,     91,  -1003,  -2156,
-   -3205,  -3999,  -4428,  -4437,
-   -4035,  -3293,  -2332,  -1305,
-    -375,    314,    650,    574,
-      82,   -775,  -1910,  -3212,
-   -4569,  -5893,  -7129,  -8274,
-   -9368, -10489, -11734, -13197,
-  -14942, -16983, -19267, -21667,
-  -23985, -25975, -27363, -27882,
-  -27308, -25491, -22383, -18051,
-  -12674,  -6537,      0,   6537,
-   12674,  18051,  22383,  25491,
-   27308,  27882,  27363,  25975,
-   23985,  21667,  19267,  16983,
-   14942,  13197,  11734,  10489,
-    9368,   8274,   7129,   5893,
-    4569,   3212,   1910,    775,
-     -82,   -574,   -650,   -314,
-     375,   1305,   2332,   3293,
-    4035,   4437,   4428,   3999,
-    3205,   2156,   1003,    -91,
-    -971,  -1520,  -1677,  -1446,
-    -901,   -173,    570,   1144,
-    1386,   1175,    457,   -746,
-   -2330,  -4125,  -5915,  -7465,
-   -8558,  -9022,  -8759,  -7761,
-   -6111,  -3977,  -1592,    778,
-    2868,   4447,   5346,   5482,
-    4864,   3593,   1840,   -176,
-   -2219,  -4071,  -5559,  -6580,
-   -7108,  -7195,  -6960,  -6564,
-   -6189,  -6000,  -6125,  -6637,
-   -7537,  -8761, -10190, -11667,
-  -13025, -14113, -14817, -15080,
-  -14910, -14374, -13593, -12717,
-  -11908, -11309, -11030, -11128,
-  -11607, -12416, -13466, -14646,
-  -15844, -16970, -17973, -18846,
-  -19632, -20409, -21275, -22325,
-  -23625, -25189, -26965, -28828,
-  -30585, -31988, -32766, -32655,
-  -31433, -28953, -25169, -20149,
-  -14078,  -7240,      0,      0,
-    7802,  15121,  21519,  26647,
-   30272,  32298,  32766,  31840,
-   29787,  26934,  23638,  20241,
-   17043,  14269,  12065,  10488,
-    9522,   9087,   9070,   9340,
-    9774,  10267,  10748,  11174,
-   11529,  11812,  12025,  12166,
-   12219,  12150,  11917,  11473,
-   10782,   9832,   8650,   7303,
-    5907,   4616,   3606,   3062,
-    3145,   3973,   5598,   7994,
-   11049,  14570,  18305,  21961,
-   25239,  27865,  29621,  30368,
-   30062,  28752,  26574,  23728,
-   20453,  16990,  13555,  10311,
-    7351,   4691,   2277,      0,
-   -2277,  -4691,  -7351, -10311,
-  -13555, -16990, -20453, -23728,
-  -26574, -28752, -30062, -30368,
-  -29621, -27865, -25239, -21961,
-  -18305, -14570, -11049,  -7994,
-   -5598,  -3973,  -3145,  -3062,
-   -3606,  -4616,  -5907,  -7303,
-   -8650,  -9832, -10782, -11473,
-  -11917, -12150, -12219, -12166,
-  -12025, -11812, -11529, -11174,
-  -10748, -10267,  -9774,  -9340,
-   -9070,  -9087,  -9522, -10488,
-  -12065, -14269, -17043, -20241,
-  -23638, -26934, -29787, -31840,
-  -32766, -32298, -30272, -26647,
-  -21519, -15121,  -7802,      0,
-    7802,  15121,  21519,  26647,
-   30272,  32298,  32766,  31840,
-   29787,  26934,  23638,  20241,
-   17043,  14269,  12065,  10488,
-    9522,   9087,   9070,   9340,
-    9774,  10267,  10748,  11174,
-   11529,  11812,  12025,  12166,
-   12219,  12150,  11917,  11473,
-   10782,   9832,   8650,   7303,
-    5907,   4616,   3606,   3062,
-    3145,   3973,   5598,   7994,
-   11049,  14570,  18305,  21961,
-   25239,  27865,  29621,  30368,
-   30062,  28752,  26574,  23728,
-   20453,  16990,  13555,  10311,
-    7351,   4691,   2277,      0,
-   -2277,  -4691,  -7351, -10311,
-  -13555, -16990, -20453, -23728,
-  -26574, -28752, -30062, -30368,
-  -29621, -27865, -25239, -21961,
-  -18305, -14570, -11049,  -7994,
-   -5598,  -3973,  -3145,  -3062,
-   -3606,  -4616,  -5907,  -7303,
-   -8650,  -9832, -10782, -11473,
-  -11917, -12150, -12219, -12166,
-  -12025, -11812, -11529, -11174,
-  -10748, -10267,  -9774,  -9340,
-   -9070,  -9087,  -9522, -10488,
-  -12065, -14269, -17043, -20241,
-  -23638, -26934, -29787, -31840,
-  -32766, -32298, -30272, -26647,
-  -21519, -15121,  -7802,      0,
-       0,   7655,  14867,  21224,
-   26374,  30047,  32077,  32409,
-   31101,  28321,  24329,  19459,
-   14093,   8631,   3465,  -1053,
-   -4631,  -7058,  -8216,  -8084,
-   -6736,  -4331,  -1096,   2694,
-    6736,  10732,  14401,  17509,
-   19877,  21399,  22039,  21832,
-   20879,  19328,  17361,  15177,
-   12971,  10915,   9149,   7764,
-    6802,   6250,   6048,   6098,
-    6275,   6440,   6460,   6218,
-    5628,   4646,   3271,   1550,
-    -429,  -2544,  -4647,  -6584,
-   -8204,  -9375, -10000, -10020,
-   -9426,  -8256,  -6597,  -4572,
-   -2333,    -48,   2116,   4006,
-    5496,   6499,   6974,   6928,
-    6414,   5528,   4397,   3165,
-    1984,    995,    313,     22,
-     162,    725,   1659,   2872,
-    4241,   5623,   6874,   7861,
-    8478,   8658,   8382,   7683,
-    6648,   5407,   4128,   3000,
-    2216,   1952,   2352,   3512,
-    5463,   8166,  11510,  15315,
-   19345,  23318,  26933,  29888,
-   31908,  32766,  32305,  30451,
-   27230,  22761,  17259,  11018,
-    4397,  -2209,  -8395, -13772,
-  -18002, -20817, -22044, -21617,
-  -19584, -16105, -11442,  -5939,
-       0,   5939,  11442,  16105,
-   19584,  21617,  22044,  20817,
-   18002,  13772,   8395,   2209,
-   -4397, -11018, -17259, -22761,
-  -27230, -30451, -32305, -32766,
-  -31908, -29888, -26933, -23318,
-  -19345, -15315, -11510,  -8166,
-   -5463,  -3512,  -2352,  -1952,
-   -2216,  -3000,  -4128,  -5407,
-   -6648,  -7683,  -8382,  -8658,
-   -8478,  -7861,  -6874,  -5623,
-   -4241,  -2872,  -1659,   -725,
-    -162,    -22,   -313,   -995,
-   -1984,  -3165,  -4397,  -5528,
-   -6414,  -6928,  -6974,  -6499,
-   -5496,  -4006,  -2116,     48,
-    2333,   4572,   6597,   8256,
-    9426,  10020,  10000,   9375,
-    8204,   6584,   4647,   2544,
-     429,  -1550,  -3271,  -4646,
-   -5628,  -6218,  -6460,  -6440,
-   -6275,  -6098,  -6048,  -6250,
-   -6802,  -7764,  -9149, -10915,
-  -12971, -15177, -17361, -19328,
-  -20879, -21832, -22039, -21399,
-  -19877, -17509, -14401, -10732,
-   -6736,  -2694,   1096,   4331,
-    6736,   8084,   8216,   7058,
-    4631,   1053,  -3465,  -8631,
-  -14093, -19459, -24329, -28321,
-  -31101, -32409, -32077, -30047,
-  -26374, -21224, -14867,  -7655,
-       0,      0,   8611,  16573,
-   23312,  28391,  31557,  32766,
-   32173,  30108,  27023,  23429,
-   19830,  16660,  14234,  12718,
-   12128,  12337,  13117,  14184,
-   15247,  16061,  16459,  16379,
-   15863,  15039,  14097,  13241,
-   12652,  12449,  12666,  13239,
-   14018,  14791,  15318,  15376,
-   14802,  13525,  11585,   9137,
-    6430,   3777,   1507,    -87,
-    -790,   -508,    714,   2694,
-    5132,   7648,   9840,  11336,
-   11855,  11245,   9513,   6825,
-    3487,    -95,  -3471,  -6211,
-   -7965,  -8515,  -7804,  -5947,
-   -3215,      0,   3245,   6065,
-    8069,   8984,   8694,   7255,
-    4882,   1924,  -1191,  -4018,
-   -6153,  -7293,  -7276,  -6099,
-   -3917,  -1016,   2227,   5405,
-    8136,  10114,  11151,  11198,
-   10346,   8801,   6856,   4833,
-    3040,   1723,   1032,   1003,
-    1560,   2538,   3709,   4832,
-    5690,   6131,   6089,   5595,
-    4768,   3786,   2854,   2159,
-    1830,   1910,   2335,   2941,
-    3483,   3673,   3227,   1920,
-    -372,  -3631,  -7688, -12223,
-  -16800, -20910, -24039, -25729,
-  -25647, -23633, -19726, -14174,
-   -7409,      0,   7409,  14174,
-   19726,  23633,  25647,  25729,
-   24039,  20910,  16800,  12223,
-    7688,   3631,    372,  -1920,
-   -3227,  -3673,  -3483,  -2941,
-   -2335,  -1910,  -1830,  -2159,
-   -2854,  -3786,  -4768,  -5595,
-   -6089,  -6131,  -5690,  -4832,
-   -3709,  -2538,  -1560,  -1003,
-   -1032,  -1723,  -3040,  -4833,
-   -6856,  -8801, -10346, -11198,
-  -11151, -10114,  -8136,  -5405,
-   -2227,   1016,   3917,   6099,
-    7276,   7293,   6153,   4018,
-    1191,  -1924,  -4882,  -7255,
-   -8694,  -8984,  -8069,  -6065,
-   -3245,      0,   3215,   5947,
-    7804,   8515,   7965,   6211,
-    3471,     95,  -3487,  -6825,
-   -9513, -11245, -11855, -11336,
-   -9840,  -7648,  -5132,  -2694,
-    -714,    508,    790,     87,
-   -1507,  -3777,  -6430,  -9137,
-  -11585, -13525, -14802, -15376,
-  -15318, -14791, -14018, -13239,
-  -12666, -12449, -12652, -13241,
-  -14097, -15039, -15863, -16379,
-  -16459, -16061, -15247, -14184,
-  -13117, -12337, -12128, -12718,
-  -14234, -16660, -19830, -23429,
-  -27023, -30108, -32173, -32766,
-  -31557, -28391, -23312, -16573,
-   -8611,      0,      0,   6396,
-   12198,  16892,  20113,  21694,
-   21681,  20330,  18060,  15395,
-   12885,  11031,  10216,  10650,
-   12352,  15148,  18707,  22592,
-   26328,  29475,  31688,  32766,
-   32673,  31540,  29629,  27296,
-   24920,  22848,  21337,  20517,
-   20372,  20751,  21395,  21990,
-   22221,  21830,  20667,  18718,
-   16112,  13111,  10061,   7347,
-    5323,   4259,   4286,   5373,
-    7323,   9795,  12352,  14524,
-   15879,  16090,  14990,  12600,
-    9138,   4990,    663,  -3288,
-   -6333,  -8048,  -8173,  -6655,
-   -3657,    462,   5191,   9943,
-   14127,  17234,  18903,  18970,
-   17488,  14713,  11071,   7085,
-    3312,    254,  -1705,  -2351,
-   -1665,    182,   2860,   5932,
-    8926,  11400,  13010,  13554,
-   12997,  11468,   9230,   6636,
-    4064,   1860,    279,   -552,
-    -650,   -169,    630,   1430,
-    1913,   1818,    993,   -581,
-   -2774,  -5332,  -7910, -10125,
-  -11628, -12151, -11567,  -9909,
-   -7378,  -4318,  -1168,   1599,
-    3549,   4352,   3838,   2027,
-    -866,  -4457,  -8241, -11662,
-  -14195, -15415, -15064, -13090,
-   -9656,  -5123,      0,   5123,
-    9656,  13090,  15064,  15415,
-   14195,  11662,   8241,   4457,
-     866,  -2027,  -3838,  -4352,
-   -3549,  -1599,   1168,   4318,
-    7378,   9909,  11567,  12151,
-   11628,  10125,   7910,   5332,
-    2774,    581,   -993,  -1818,
-   -1913,  -1430,   -630,    169,
-     650,    552,   -279,  -1860,
-   -4064,  -6636,  -9230, -11468,
-  -12997, -13554, -13010, -11400,
-   -8926,  -5932,  -2860,   -182,
-    1665,   2351,   1705,   -254,
-   -3312,  -7085, -11071, -14713,
-  -17488, -18970, -18903, -17234,
-  -14127,  -9943,  -5191,   -462,
-    3657,   6655,   8173,   8048,
-    6333,   3288,   -663,  -4990,
-   -9138, -12600, -14990, -16090,
-  -15879, -14524, -12352,  -9795,
-   -7323,  -5373,  -4286,  -4259,
-   -5323,  -7347, -10061, -13111,
-  -16112, -18718, -20667, -21830,
-  -22221, -21990, -21395, -20751,
-  -20372, -20517, -21337, -22848,
-  -24920, -27296, -29629, -31540,
-  -32673, -32766, -31688, -29475,
-  -26328, -22592, -18707, -15148,
-  -12352, -10650, -10216, -11031,
-  -12885, -15395, -18060, -20330,
-  -21681, -21694, -20113, -16892,
-  -12198,  -6396,      0,      0,
-    2433,   4851,   7242,   9591,
-   11885,  14111,  16257,  18310,
-   20260,  22096,  23808,  25388,
-   26829,  28123,  29265,  30250,
-   31076,  31739,  32239,  32576,
-   32751,  32766,  32625,  32333,
-   31894,  31315,  30604,  29768,
-   28817,  27760,  26607,  25368,
-   24055,  22679,  21252,  19784,
-   18288,  16775,  15257,  13745,
-   12248,  10779,   9346,   7959,
-    6627,   5357,   4156,   3031,
-    1988,   1030,    162,   -613,
-   -1293,  -1878,  -2367,  -2761,
-   -3062,  -3271,  -3392,  -3429,
-   -3387,  -3270,  -3084,  -2835,
-   -2529,  -2174,  -1777,  -1345,
-    -885,   -405,     88,    587,
-    1084,   1573,   2048,   2502,
-    2929,   3325,   3684,   4004,
-    4279,   4508,   4688,   4817,
-    4895,   4921,   4896,   4820,
-    4696,   4524,   4309,   4052,
-    3758,   3430,   3073,   2692,
-    2291,   1875,   1450,   1020,
-     590,    167,   -246,   -643,
-   -1021,  -1374,  -1698,  -1992,
-   -2250,  -2471,  -2652,  -2792,
-   -2889,  -2943,  -2954,  -2922,
-   -2849,  -2735,  -2582,  -2394,
-   -2172,  -1920,  -1642,  -1341,
-   -1022,   -689,   -347,      0,
-     347,    689,   1022,   1341,
-    1642,   1920,   2172,   2394,
-    2582,   2735,   2849,   2922,
-    2954,   2943,   2889,   2792,
-    2652,   2471,   2250,   1992,
-    1698,   1374,   1021,    643,
-     246,   -167,   -590,  -1020,
-   -1450,  -1875,  -2291,  -2692,
-   -3073,  -3430,  -3758,  -4052,
-   -4309,  -4524,  -4696,  -4820,
-   -4896,  -4921,  -4895,  -4817,
-   -4688,  -4508,  -4279,  -4004,
-   -3684,  -3325,  -2929,  -2502,
-   -2048,  -1573,  -1084,   -587,
-     -88,    405,    885,   1345,
-    1777,   2174,   2529,   2835,
-    3084,   3270,   3387,   3429,
-    3392,   3271,   3062,   2761,
-    2367,   1878,   1293,    613,
-    -162,  -1030,  -1988,  -3031,
-   -4156,  -5357,  -6627,  -7959,
-   -9346, -10779, -12248, -13745,
-  -15257, -16775, -18288, -19784,
-  -21252, -22679, -24055, -25368,
-  -26607, -27760, -28817, -29768,
-  -30604, -31315, -31894, -32333,
-  -32625, -32766, -32751, -32576,
-  -32239, -31739, -31076, -30250,
-  -29265, -28123, -26829, -25388,
-  -23808, -22096, -20260, -18310,
-  -16257, -14111, -11885,  -9591,
-   -7242,  -4851,  -2433,      0,
-       0,   4355,   8624,  12725,
-   16581,  20122,  23289,  26034,
-   28325,  30141,  31477,  32342,
-   32760,  32766,  32406,  31737,
-   30819,  29719,  28504,  27241,
-   25992,  24813,  23752,  22848,
-   22127,  21604,  21280,  21146,
-   21180,  21350,  21615,  21925,
-   22230,  22473,  22600,  22559,
-   22302,  21791,  20996,  19896,
-   18486,  16771,  14769,  12512,
-   10043,   7413,   4687,   1931,
-    -783,  -3380,  -5788,  -7938,
-   -9768, -11225, -12265, -12859,
-  -12991, -12657, -11871, -10658,
-   -9061,  -7130,  -4928,  -2526,
-       0,   2570,   5105,   7527,
-    9765,  11754,  13439,  14778,
-   15740,  16310,  16484,  16275,
-   15708,  14820,  13659,  12282,
-   10750,   9129,   7486,   5888,
-    4394,   3059,   1930,   1042,
-     419,     72,      0,    190,
-     615,   1239,   2016,   2893,
-    3814,   4718,   5545,   6237,
-    6744,   7020,   7030,   6749,
-    6166,   5282,   4109,   2674,
-    1016,   -816,  -2767,  -4770,
-   -6757,  -8660, -10407, -11933,
-  -13179, -14093, -14635, -14776,
-  -14501, -13809, -12713, -11240,
-   -9430,  -7336,  -5019,  -2548,
-       0,   2548,   5019,   7336,
-    9430,  11240,  12713,  13809,
-   14501,  14776,  14635,  14093,
-   13179,  11933,  10407,   8660,
-    6757,   4770,   2767,    816,
-   -1016,  -2674,  -4109,  -5282,
-   -6166,  -6749,  -7030,  -7020,
-   -6744,  -6237,  -5545,  -4718,
-   -3814,  -2893,  -2016,  -1239,
-    -615,   -190,      0,    -72,
-    -419,  -1042,  -1930,  -3059,
-   -4394,  -5888,  -7486,  -9129,
-  -10750, -12282, -13659, -14820,
-  -15708, -16275, -16484, -16310,
-  -15740, -14778, -13439, -11754,
-   -9765,  -7527,  -5105,  -2570,
-       0,   2526,   4928,   7130,
-    9061,  10658,  11871,  12657,
-   12991,  12859,  12265,  11225,
-    9768,   7938,   5788,   3380,
-     783,  -1931,  -4687,  -7413,
-  -10043, -12512, -14769, -16771,
-  -18486, -19896, -20996, -21791,
-  -22302, -22559, -22600, -22473,
-  -22230, -21925, -21615, -21350,
-  -21180, -21146, -21280, -21604,
-  -22127, -22848, -23752, -24813,
-  -25992, -27241, -28504, -29719,
-  -30819, -31737, -32406, -32766,
-  -32760, -32342, -31477, -30141,
-  -28325, -26034, -23289, -20122,
-  -16581, -12725,  -8624,  -4355,
-       0,      0,   8045,  15543,
-   22013,  27090,  30567,  32412,
-   32766,  31914,  30241,  28179,
-   26148,  24500,  23478,  23193,
-   23621,  24614,  25936,  27303,
-   28435,  29095,  29128,  28478,
-   27193,  25410,  23332,  21186,
-   19189,  17509,  16245,  15409,
-   14933,  14683,  14489,  14181,
-   13616,  12717,  11479,   9983,
-    8376,   6849,   5604,   4812,
-    4584,   4937,   5787,   6951,
-    8167,   9131,   9540,   9142,
-    7778,   5415,   2162,  -1735,
-   -5915,  -9948, -13384, -15816,
-  -16931, -16561, -14703, -11528,
-   -7363,  -2652,   2098,   6383,
-    9756,  11890,  12613,  11924,
-    9991,   7122,   3721,    234,
-   -2910,  -5358,  -6868,  -7334,
-   -6796,  -5419,  -3460,  -1227,
-     969,   2860,   4257,   5069,
-    5308,   5078,   4543,   3900,
-    3334,   2987,   2932,   3161,
-    3590,   4073,   4434,   4499,
-    4131,   3258,   1889,    119,
-   -1884,  -3907,  -5721,  -7128,
-   -7988,  -8255,  -7984,  -7329,
-   -6524,  -5850,  -5587,  -5968,
-   -7138,  -9117, -11792, -14914,
-  -18125, -21002, -23108, -24051,
-  -23540, -21430, -17746, -12687,
-   -6613,      0,   6613,  12687,
-   17746,  21430,  23540,  24051,
-   23108,  21002,  18125,  14914,
-   11792,   9117,   7138,   5968,
-    5587,   5850,   6524,   7329,
-    7984,   8255,   7988,   7128,
-    5721,   3907,   1884,   -119,
-   -1889,  -3258,  -4131,  -4499,
-   -4434,  -4073,  -3590,  -3161,
-   -2932,  -2987,  -3334,  -3900,
-   -4543,  -5078,  -5308,  -5069,
-   -4257,  -2860,   -969,   1227,
-    3460,   5419,   6796,   7334,
-    6868,   5358,   2910,   -234,
-   -3721,  -7122,  -9991, -11924,
-  -12613, -11890,  -9756,  -6383,
-   -2098,   2652,   7363,  11528,
-   14703,  16561,  16931,  15816,
-   13384,   9948,   5915,   1735,
-   -2162,  -5415,  -7778,  -9142,
-   -9540,  -9131,  -8167,  -6951,
-   -5787,  -4937,  -4584,  -4812,
-   -5604,  -6849,  -8376,  -9983,
-  -11479, -12717, -13616, -14181,
-  -14489, -14683, -14933, -15409,
-  -16245, -17509, -19189, -21186,
-  -23332, -25410, -27193, -28478,
-  -29128, -29095, -28435, -27303,
-  -25936, -24614, -23621, -23193,
-  -23478, -24500, -26148, -28179,
-  -30241, -31914, -32766, -32412,
-  -30567, -27090, -22013, -15543,
-   -8045,      0,      0,   5633,
-   11090,  16204,  20820,  24805,
-   28054,  30487,  32061,  32766,
-   32624,  31689,  30042,  27790,
-   25054,  21969,  18675,  15310,
-   12003,   8873,   6019,   3519,
-    1429,   -221,  -1424,  -2195,
-   -2571,  -2603,  -2355,  -1898,
-   -1306,   -651,      0,    590,
-    1075,   1422,   1617,   1655,
-    1549,   1321,   1003,    631,
-     245,   -115,   -414,   -623,
-    -721,   -697,   -550,   -289,
-      67,    492,    952,   1413,
-    1837,   2192,   2446,   2578,
-    2571,   2422,   2134,   1722,
-    1208,    623,      0,   -623,
-   -1208,  -1722,  -2134,  -2422,
-   -2571,  -2578,  -2446,  -2192,
-   -1837,  -1413,   -952,   -492,
-     -67,    289,    550,    697,
-     721,    623,    414,    115,
-    -245,   -631,  -1003,  -1321,
-   -1549,  -1655,  -1617,  -1422,
-   -1075,   -590,      0,    651,
-    1306,   1898,   2355,   2603,
-    2571,   2195,   1424,    221,
-   -1429,  -3519,  -6019,  -8873,
-  -12003, -15310, -18675, -21969,
-  -25054, -27790, -30042, -31689,
-  -32624, -32766, -32061, -30487,
-  -28054, -24805, -20820, -16204,
-  -11090,  -5633,      0,   5633,
-   11090,  16204,  20820,  24805,
-   28054,  30487,  32061,  32766,
-   32624,  31689,  30042,  27790,
-   25054,  21969,  18675,  15310,
-   12003,   8873,   6019,   3519,
-    1429,   -221,  -1424,  -2195,
-   -2571,  -2603,  -2355,  -1898,
-   -1306,   -651,      0,    590,
-    1075,   1422,   1617,   1655,
-    1549,   1321,   1003,    631,
-     245,   -115,   -414,   -623,
-    -721,   -697,   -550,   -289,
-      67,    492,    952,   1413,
-    1837,   2192,   2446,   2578,
-    2571,   2422,   2134,   1722,
-    1208,    623,      0,   -623,
-   -1208,  -1722,  -2134,  -2422,
-   -2571,  -2578,  -2446,  -2192,
-   -1837,  -1413,   -952,   -492,
-     -67,    289,    550,    697,
-     721,    623,    414,    115,
-    -245,   -631,  -1003,  -1321,
-   -1549,  -1655,  -1617,  -1422,
-   -1075,   -590,      0,    651,
-    1306,   1898,   2355,   2603,
-    2571,   2195,   1424,    221,
-   -1429,  -3519,  -6019,  -8873,
-  -12003, -15310, -18675, -21969,
-  -25054, -27790, -30042, -31689,
-  -32624, -32766, -32061, -30487,
-  -28054, -24805, -20820, -16204,
-  -11090,  -5633,      0,      0,
-    6202,  12174,  17697,  22572,
-   26628,  29733,  31794,  32766,
-   32649,  31491,  29381,  26444,
-   22839,  18745,  14355,   9865,
-    5465,   1333,  -2378,  -5543,
-   -8069,  -9900, -11017, -11436,
-  -11208, -10410,  -9142,  -7522,
-   -5675,  -3727,  -1799,      0,
-    1578,   2864,   3812,   4399,
-    4629,   4525,   4131,   3506,
-    2720,   1846,    958,    124,
-    -596,  -1157,  -1527,  -1693,
-   -1656,  -1436,  -1063,   -578,
-     -32,    526,   1045,   1479,
-    1791,   1956,   1961,   1804,
-    1500,   1074,    560,      0,
-    -560,  -1074,  -1500,  -1804,
-   -1961,  -1956,  -1791,  -1479,
-   -1045,   -526,     32,    578,
-    1063,   1436,   1656,   1693,
-    1527,   1157,    596,   -124,
-    -958,  -1846,  -2720,  -3506,
-   -4131,  -4525,  -4629,  -4399,
-   -3812,  -2864,  -1578,      0,
-    1799,   3727,   5675,   7522,
-    9142,  10410,  11208,  11436,
-   11017,   9900,   8069,   5543,
-    2378,  -1333,  -5465,  -9865,
-  -14355, -18745, -22839, -26444,
-  -29381, -31491, -32649, -32766,
-  -31794, -29733, -26628, -22572,
-  -17697, -12174,  -6202,      0,
-    6202,  12174,  17697,  22572,
-   26628,  29733,  31794,  32766,
-   32649,  31491,  29381,  26444,
-   22839,  18745,  14355,   9865,
-    5465,   1333,  -2378,  -5543,
-   -8069,  -9900, -11017, -11436,
-  -11208, -10410,  -9142,  -7522,
-   -5675,  -3727,  -1799,      0,
-    1578,   2864,   3812,   4399,
-    4629,   4525,   4131,   3506,
-    2720,   1846,    958,    124,
-    -596,  -1157,  -1527,  -1693,
-   -1656,  -1436,  -1063,   -578,
-     -32,    526,   1045,   1479,
-    1791,   1956,   1961,   1804,
-    1500,   1074,    560,      0,
-    -560,  -1074,  -1500,  -1804,
-   -1961,  -1956,  -1791,  -1479,
-   -1045,   -526,     32,    578,
-    1063,   1436,   1656,   1693,
-    1527,   1157,    596,   -124,
-    -958,  -1846,  -2720,  -3506,
-   -4131,  -4525,  -4629,  -4399,
-   -3812,  -2864,  -1578,      0,
-    1799,   3727,   5675,   7522,
-    9142,  10410,  11208,  11436,
-   11017,   9900,   8069,   5543,
-    2378,  -1333,  -5465,  -9865,
-  -14355, -18745, -22839, -26444,
-  -29381, -31491, -32649, -32766,
-  -31794, -29733, -26628, -22572,
-  -17697, -12174,  -6202,      0,
-       0,   2403,   4113,   5679,
-    7038,   8329,   9496,  10620,
-   11654,  12656,  13588,  14494,
-   15343,  16170,  16948,  17708,
-   18425,  19126,  19789,  20437,
-   21052,  21653,  22223,  22781,
-   23311,  23829,  24320,  24801,
-   25257,  25704,  26127,  26540,
-   26931,  27314,  27675,  28028,
-   28361,  28686,  28991,  29288,
-   29567,  29838,  30092,  30337,
-   30566,  30787,  30991,  31188,
-   31369,  31542,  31699,  31850,
-   31984,  32112,  32224,  32330,
-   32420,  32504,  32572,  32633,
-   32680,  32720,  32744,  32763,
-   32766,  32763,  32744,  32720,
-   32680,  32633,  32572,  32504,
-   32420,  32330,  32224,  32112,
-   31984,  31850,  31699,  31542,
-   31369,  31188,  30991,  30787,
-   30566,  30337,  30092,  29838,
-   29567,  29288,  28991,  28686,
-   28361,  28028,  27675,  27314,
-   26931,  26540,  26127,  25704,
-   25257,  24801,  24320,  23829,
-   23311,  22781,  22223,  21653,
-   21052,  20437,  19789,  19126,
-   18425,  17708,  16948,  16170,
-   15343,  14494,  13588,  12656,
-   11654,  10620,   9496,   8329,
-    7038,   5679,   4113,   2403,
-       0,  -2403,  -4113,  -5679,
-   -7038,  -8329,  -9496, -10620,
-  -11654, -12656, -13588, -14494,
-  -15343, -16170, -16948, -17708,
-  -18425, -19126, -19789, -20437,
-  -21052, -21653, -22223, -22781,
-  -23311, -23829, -24320, -24801,
-  -25257, -25704, -26127, -26540,
-  -26931, -27314, -27675, -28028,
-  -28361, -28686, -28991, -29288,
-  -29567, -29838, -30092, -30337,
-  -30566, -30787, -30991, -31188,
-  -31369, -31542, -31699, -31850,
-  -31984, -32112, -32224, -32330,
-  -32420, -32504, -32572, -32633,
-  -32680, -32720, -32744, -32763,
-  -32766, -32763, -32744, -32720,
-  -32680, -32633, -32572, -32504,
-  -32420, -32330, -32224, -32112,
-  -31984, -31850, -31699, -31542,
-  -31369, -31188, -30991, -30787,
-  -30566, -30337, -30092, -29838,
-  -29567, -29288, -28991, -28686,
-  -28361, -28028, -27675, -27314,
-  -26931, -26540, -26127, -25704,
-  -25257, -24801, -24320, -23829,
-  -23311, -22781, -22223, -21653,
-  -21052, -20437, -19789, -19126,
-  -18425, -17708, -16948, -16170,
-  -15343, -14494, -13588, -12656,
-  -11654, -10620,  -9496,  -8329,
-   -7038,  -5679,  -4113,  -2403,
-       0,      0,  19700,  16277,
-   19290,  18389,  19906,  19744,
-   20566,  20784,  21180,  21626,
-   21743,  22318,  22256,  22889,
-   22727,  23357,  23157,  23737,
-   23549,  24042,  23902,  24285,
-   24215,  24474,  24485,  24621,
-   24709,  24732,  24887,  24815,
-   25016,  24874,  25098,  24912,
-   25132,  24930,  25122,  24929,
-   25071,  24907,  24984,  24861,
-   24863,  24788,  24716,  24686,
-   24544,  24553,  24353,  24385,
-   24144,  24183,  23919,  23946,
-   23679,  23675,  23421,  23373,
-   23145,  23041,  22848,  22684,
-   22527,  22303,  22179,  21902,
-   21802,  21483,  21393,  21047,
-   20953,  20595,  20480,  20125,
-   19975,  19637,  19440,  19128,
-   18876,  18595,  18285,  18035,
-   17671,  17444,  17034,  16821,
-   16376,  16162,  15696,  15466,
-   14995,  14733,  14270,  13963,
-   13518,  13155,  12737,  12311,
-   11920,  11432,  11064,  10518,
-   10165,   9570,   9216,   8585,
-    8214,   7562,   7155,   6495,
-    6034,   5379,   4847,   4204,
-    3590,   2960,   2254,   1630,
-     829,    197,   -701,  -1369,
-   -2366,  -3113,  -4223,  -5128,
-   -6421,  -7821,  -9469, -10522,
-  -11649, -12564, -13472, -14348,
-  -15092, -15963, -16571, -17448,
-  -17945, -18824, -19240, -20104,
-  -20470, -21297, -21649, -22410,
-  -22785, -23450, -23882, -24424,
-  -24943, -25340, -25969, -26206,
-  -26955, -27030, -27900, -27823,
-  -28797, -28594, -29640, -29355,
-  -30421, -30119, -31125, -30908,
-  -31723, -31779, -32112, -32766,
-   -7692,    340,  -3184,  -1301,
-   -3296,  -2190,  -3633,  -2936,
-   -4008,  -3617,  -4387,  -4248,
-   -4762,  -4834,  -5132,  -5374,
-   -5500,  -5867,  -5866,  -6314,
-   -6231,  -6714,  -6592,  -7069,
-   -6948,  -7384,  -7295,  -7662,
-   -7627,  -7908,  -7940,  -8126,
-   -8228,  -8321,  -8487,  -8498,
-   -8713,  -8658,  -8902,  -8803,
-   -9053,  -8933,  -9166,  -9046,
-   -9241,  -9140,  -9280,  -9211,
-   -9285,  -9255,  -9257,  -9267,
-   -9200,  -9243,  -9114,  -9178,
-   -9000,  -9069,  -8858,  -8914,
-   -8686,  -8709,  -8479,  -8453,
-   -8233,  -8145,  -7943,  -7783,
-   -7600,  -7364,  -7195,  -6885,
-   -6719,  -6339,  -6160,  -5715,
-   -5502,  -5000,  -4726,  -4166,
-   -3799,  -3169,  -2665,  -1917,
-   -1175,      0,      0,  27884,
-   22731,  27270,  25411,  28096,
-   27037,  28963,  28242,  29739,
-   29195,  30409,  29969,  30978,
-   30603,  31455,  31121,  31847,
-   31540,  32162,  31873,  32405,
-   32128,  32583,  32314,  32700,
-   32435,  32760,  32496,  32766,
-   32502,  32721,  32455,  32627,
-   32359,  32487,  32216,  32303,
-   32028,  32076,  31796,  31807,
-   31523,  31498,  31209,  31151,
-   30856,  30765,  30465,  30342,
-   30036,  29883,  29571,  29388,
-   29070,  28858,  28533,  28292,
-   27962,  27692,  27355,  27057,
-   26714,  26388,  26039,  25685,
-   25330,  24948,  24586,  24176,
-   23808,  23369,  22995,  22528,
-   22148,  21651,  21265,  20739,
-   20347,  19791,  19393,  18805,
-   18401,  17782,  17372,  16720,
-   16305,  15618,  15198,  14475,
-   14051,  13290,  12861,  12061,
-   11628,  10785,  10349,   9462,
-    9023,   8087,   7648,   6659,
-    6220,   5173,   4736,   3625,
-    3193,   2010,   1587,    322,
-     -87,  -1448,  -1836,  -3310,
-   -3665,  -5278,  -5583,  -7373,
-   -7599,  -9624,  -9719, -12084,
-  -11943, -14858, -14226, -18243,
-  -16194, -24065,      0,  24065,
-   16194,  18243,  14226,  14858,
-   11943,  12084,   9719,   9624,
-    7599,   7373,   5583,   5278,
-    3665,   3310,   1836,   1448,
-      87,   -322,  -1587,  -2010,
-   -3193,  -3625,  -4736,  -5173,
-   -6220,  -6659,  -7648,  -8087,
-   -9023,  -9462, -10349, -10785,
-  -11628, -12061, -12861, -13290,
-  -14051, -14475, -15198, -15618,
-  -16305, -16720, -17372, -17782,
-  -18401, -18805, -19393, -19791,
-  -20347, -20739, -21265, -21651,
-  -22148, -22528, -22995, -23369,
-  -23808, -24176, -24586, -24948,
-  -25330, -25685, -26039, -26388,
-  -26714, -27057, -27355, -27692,
-  -27962, -28292, -28533, -28858,
-  -29070, -29388, -29571, -29883,
-  -30036, -30342, -30465, -30765,
-  -30856, -31151, -31209, -31498,
-  -31523, -31807, -31796, -32076,
-  -32028, -32303, -32216, -32487,
-  -32359, -32627, -32455, -32721,
-  -32502, -32766, -32496, -32760,
-  -32435, -32700, -32314, -32583,
-  -32128, -32405, -31873, -32162,
-  -31540, -31847, -31121, -31455,
-  -30603, -30978, -29969, -30409,
-  -29195, -29739, -28242, -28963,
-  -27037, -28096, -25411, -27270,
-  -22731, -27884,      0,      0,
-   19352,  15628,  18682,  17254,
-   19017,  18143,  19381,  18739,
-   19682,  19159,  19908,  19453,
-   20065,  19650,  20156,  19765,
-   20188,  19812,  20167,  19799,
-   20096,  19731,  19979,  19614,
-   19820,  19453,  19621,  19249,
-   19384,  19007,  19111,  18728,
-   18805,  18414,  18467,  18067,
-   18098,  17689,  17699,  17280,
-   17271,  16842,  16815,  16376,
-   16333,  15881,  15824,  15360,
-   15290,  14813,  14730,  14240,
-   14145,  13641,  13537,  13017,
-   12904,  12367,  12248,  11693,
-   11569,  10994,  10867,  10270,
-   10142,   9520,   9395,   8744,
-    8626,   7942,   7837,   7111,
-    7028,   6250,   6203,   5354,
-    5366,   4413,   4532,   3406,
-    3740,   2250,   3182,    336,
-    7210,  32766,  30949,  31458,
-   30177,  30240,  29223,  29080,
-   28187,  27923,  27096,  26749,
-   25961,  25551,  24783,  24322,
-   23565,  23059,  22305,  21758,
-   21001,  20416,  19651,  19029,
-   18252,  17592,  16798,  16099,
-   15285,  14544,  13704,  12918,
-   12047,  11210,  10299,   9403,
-    8442,   7471,   6443,   5373,
-    4244,   3016,   1698,      0,
-   -1698,  -3016,  -4244,  -5373,
-   -6443,  -7471,  -8442,  -9403,
-  -10299, -11210, -12047, -12918,
-  -13704, -14544, -15285, -16099,
-  -16798, -17592, -18252, -19029,
-  -19651, -20416, -21001, -21758,
-  -22305, -23059, -23565, -24322,
-  -24783, -25551, -25961, -26749,
-  -27096, -27923, -28187, -29080,
-  -29223, -30240, -30177, -31458,
-  -30949, -32766,  -7210,   -336,
-   -3182,  -2250,  -3740,  -3406,
-   -4532,  -4413,  -5366,  -5354,
-   -6203,  -6250,  -7028,  -7111,
-   -7837,  -7942,  -8626,  -8744,
-   -9395,  -9520, -10142, -10270,
-  -10867, -10994, -11569, -11693,
-  -12248, -12367, -12904, -13017,
-  -13537, -13641, -14145, -14240,
-  -14730, -14813, -15290, -15360,
-  -15824, -15881, -16333, -16376,
-  -16815, -16842, -17271, -17280,
-  -17699, -17689, -18098, -18067,
-  -18467, -18414, -18805, -18728,
-  -19111, -19007, -19384, -19249,
-  -19621, -19453, -19820, -19614,
-  -19979, -19731, -20096, -19799,
-  -20167, -19812, -20188, -19765,
-  -20156, -19650, -20065, -19453,
-  -19908, -19159, -19682, -18739,
-  -19381, -18143, -19017, -17254,
-  -18682, -15628, -19352,      0,
-       0,  17463,  13979,  16627,
-   15239,  16705,  15832,  16809,
-   16157,  16855,  16322,  16834,
-   16374,  16749,  16337,  16604,
-   16228,  16406,  16055,  16159,
-   15828,  15867,  15552,  15533,
-   15232,  15159,  14871,  14749,
-   14473,  14305,  14040,  13827,
-   13575,  13318,  13079,  12779,
-   12553,  12211,  12000,  11615,
-   11421,  10990,  10817,  10339,
-   10190,   9660,   9541,   8954,
-    8871,   8220,   8183,   7456,
-    7481,   6658,   6769,   5820,
-    6059,   4927,   5373,   3942,
-    4780,   2728,   4600,    262,
-   16516,  32766,  28410,  30257,
-   28164,  28956,  27463,  27840,
-   26624,  26772,  25716,  25715,
-   24763,  24652,  23773,  23578,
-   22752,  22486,  21701,  21376,
-   20623,  20244,  19518,  19090,
-   18386,  17911,  17226,  16707,
-   16038,  15476,  14821,  14217,
-   13575,  12928,  12298,  11607,
-   10989,  10253,   9646,   8863,
-    8268,   7433,   6851,   5962,
-    5395,   4444,   3894,   2874,
-    2347,   1247,    748,   -448,
-    -907,  -2223,  -2624,  -4097,
-   -4408,  -6103,  -6258,  -8309,
-   -8145, -10902,  -9832, -15041,
-       0,  15041,   9832,  10902,
-    8145,   8309,   6258,   6103,
-    4408,   4097,   2624,   2223,
-     907,    448,   -748,  -1247,
-   -2347,  -2874,  -3894,  -4444,
-   -5395,  -5962,  -6851,  -7433,
-   -8268,  -8863,  -9646, -10253,
-  -10989, -11607, -12298, -12928,
-  -13575, -14217, -14821, -15476,
-  -16038, -16707, -17226, -17911,
-  -18386, -19090, -19518, -20244,
-  -20623, -21376, -21701, -22486,
-  -22752, -23578, -23773, -24652,
-  -24763, -25715, -25716, -26772,
-  -26624, -27840, -27463, -28956,
-  -28164, -30257, -28410, -32766,
-  -16516,   -262,  -4600,  -2728,
-   -4780,  -3942,  -5373,  -4927,
-   -6059,  -5820,  -6769,  -6658,
-   -7481,  -7456,  -8183,  -8220,
-   -8871,  -8954,  -9541,  -9660,
-  -10190, -10339, -10817, -10990,
-  -11421, -11615, -12000, -12211,
-  -12553, -12779, -13079, -13318,
-  -13575, -13827, -14040, -14305,
-  -14473, -14749, -14871, -15159,
-  -15232, -15533, -15552, -15867,
-  -15828, -16159, -16055, -16406,
-  -16228, -16604, -16337, -16749,
-  -16374, -16834, -16322, -16855,
-  -16157, -16809, -15832, -16705,
-  -15239, -16627, -13979, -17463,
-       0,      0,  17611,  14019,
-   16661,  15175,  16636,  15654,
-   16636,  15864,  16579,  15911,
-   16454,  15844,  16264,  15686,
-   16014,  15454,  15711,  15159,
-   15359,  14807,  14961,  14406,
-   14522,  13959,  14044,  13470,
-   13530,  12943,  12982,  12379,
-   12402,  11780,  11793,  11148,
-   11155,  10484,  10491,   9789,
-    9802,   9062,   9090,   8305,
-    8358,   7515,   7609,   6690,
-    6848,   5824,   6086,   4903,
-    5345,   3891,   4690,   2661,
-    4419,    270,  19683,  32766,
-   28594,  30307,  28262,  28986,
-   27496,  27839,  26598,  26738,
-   25634,  25646,  24625,  24549,
-   23581,  23439,  22507,  22314,
-   21404,  21171,  20275,  20009,
-   19119,  18826,  17937,  17621,
-   16730,  16394,  15496,  15144,
-   14235,  13870,  12946,  12571,
-   11629,  11246,  10282,   9895,
-    8903,   8517,   7491,   7112,
-    6044,   5678,   4557,   4216,
-    3026,   2728,   1444,   1219,
-    -205,   -298,  -1952,  -1776,
-   -3899,  -2996,  -6682,  14736,
-   23912,  19961,  20814,  18579,
-   18584,  16767,  16415,  14750,
-   14172,  12542,  11771,  10079,
-    9065,   6999,   5586,   3913,
-    2894,   1428,    525,   -823,
-   -1659,  -2923,  -3710,  -4911,
-   -5659,  -6808,  -7524,  -8632,
-   -9317, -10390, -11048, -12093,
-  -12723, -13745, -14348, -15352,
-  -15927, -16918, -17463, -18445,
-  -18959, -19939, -20416, -21401,
-  -21836, -22836, -23216, -24248,
-  -24556, -25646, -25845, -27046,
-  -27058, -28499, -28104, -30035,
-   -6633,   -578,  -3269,  -2671,
-   -4118,  -4068,  -5182,  -5329,
-   -6285,  -6528,  -7390,  -7686,
-   -8484,  -8813,  -9563,  -9911,
-  -10624, -10984, -11667, -12032,
-  -12689, -13056, -13691, -14057,
-  -14671, -15035, -15631, -15990,
-  -16570, -16922, -17487, -17831,
-  -18382, -18717, -19254, -19579,
-  -20104, -20418, -20931, -21231,
-  -21735, -22020, -22515, -22783,
-  -23271, -23520, -24002, -24228,
-  -24707, -24907, -25388, -25555,
-  -26041, -26174, -26649, -26855,
-  -26298,  -1651,   1620,    371,
-     641,     62,     73,   -334,
-    -397,   -717,   -804,  -1065,
-   -1155,  -1366,  -1448,  -1613,
-   -1677,  -1797,  -1834,  -1905,
-   -1908,  -1923,  -1880,  -1827,
-   -1723,  -1578,  -1381,  -1092,
-    -720,      0,      0,  17927,
-   14201,  16843,  15267,  16704,
-   15642,  16590,  15741,  16418,
-   15675,  16176,  15491,  15869,
-   15215,  15501,  14863,  15077,
-   14446,  14604,  13972,  14085,
-   13447,  13523,  12875,  12923,
-   12260,  12285,  11604,  11614,
-   10911,  10912,  10181,  10179,
-    9416,   9420,   8616,   8637,
-    7781,   7832,   6909,   7012,
-    5994,   6185,   5026,   5372,
-    3972,   4632,   2719,   4231,
-     422,  10993,  32766,  29218,
-   30558,  28718,  29221,  27854,
-   28027,  26874,  26868,  25833,
-   25714,  24750,  24551,  23632,
-   23376,  22486,  22183,  21312,
-   20972,  20112,  19741,  18887,
-   18490,  17636,  17218,  16361,
-   15923,  15060,  14607,  13734,
-   13267,  12381,  11905,  11002,
-   10518,   9595,   9108,   8159,
-    7675,   6691,   6218,   5187,
-    4742,   3642,   3253,   2039,
-    1777,    322,    442,  -1932,
-    2202,  26465,  25641,  25189,
-   23989,  23396,  22285,  21583,
-   20514,  19734,  18680,  17837,
-   16782,  15883,  14813,  13859,
-   12764,  11752,  10620,   9544,
-    8360,   7204,   5941,   4677,
-    3280,   1825,      0,  -1825,
-   -3280,  -4677,  -5941,  -7204,
-   -8360,  -9544, -10620, -11752,
-  -12764, -13859, -14813, -15883,
-  -16782, -17837, -18680, -19734,
-  -20514, -21583, -22285, -23396,
-  -23989, -25189, -25641, -26465,
-   -2202,   1932,   -442,   -322,
-   -1777,  -2039,  -3253,  -3642,
-   -4742,  -5187,  -6218,  -6691,
-   -7675,  -8159,  -9108,  -9595,
-  -10518, -11002, -11905, -12381,
-  -13267, -13734, -14607, -15060,
-  -15923, -16361, -17218, -17636,
-  -18490, -18887, -19741, -20112,
-  -20972, -21312, -22183, -22486,
-  -23376, -23632, -24551, -24750,
-  -25714, -25833, -26868, -26874,
-  -28027, -27854, -29221, -28718,
-  -30558, -29218, -32766, -10993,
-    -422,  -4231,  -2719,  -4632,
-   -3972,  -5372,  -5026,  -6185,
-   -5994,  -7012,  -6909,  -7832,
-   -7781,  -8637,  -8616,  -9420,
-   -9416, -10179, -10181, -10912,
-  -10911, -11614, -11604, -12285,
-  -12260, -12923, -12875, -13523,
-  -13447, -14085, -13972, -14604,
-  -14446, -15077, -14863, -15501,
-  -15215, -15869, -15491, -16176,
-  -15675, -16418, -15741, -16590,
-  -15642, -16704, -15267, -16843,
-  -14201, -17927,      0,      0,
-   17250,  13290,  15491,  13685,
-   14658,  13403,  13851,  12851,
-   12984,  12139,  12047,  11313,
-   11042,  10400,   9975,   9416,
-    8849,   8375,   7666,   7287,
-    6427,   6163,   5127,   5018,
-    3755,   3880,   2273,   2820,
-     547,   2165,  -2459,  13764,
-   29981,  25331,  26913,  24582,
-   25062,  23366,  23392,  22006,
-   21765,  20573,  20144,  19093,
-   18513,  17577,  16865,  16031,
-   15194,  14462,  13499,  12874,
-   11772,  11274,  10007,   9674,
-    8188,   8097,   6276,   6613,
-    4133,   5547,    722,  16745,
-   32766,  27922,  29311,  26790,
-   27079,  25196,  25035,  23464,
-   23038,  21663,  21051,  19818,
-   19056,  17939,  17046,  16031,
-   15014,  14100,  12955,  12149,
-   10865,  10184,   8734,   8216,
-    6545,   6267,   4258,   4406,
-    1735,   2956,  -2063,  13764,
-   29586,  24540,  25725,  22996,
-   23077,  20979,  20601,  18808,
-   18158,  16552,  15706,  14231,
-   13224,  11852,  10700,   9416,
-    8124,   6923,   5485,   4369,
-    2768,   1750,    -48,   -939,
-   -2996,  -3696,  -6145,  -6491,
-   -9686,  -9085, -14794,      0,
-   14794,   9085,   9686,   6491,
-    6145,   3696,   2996,    939,
-      48,  -1750,  -2768,  -4369,
-   -5485,  -6923,  -8124,  -9416,
-  -10700, -11852, -13224, -14231,
-  -15706, -16552, -18158, -18808,
-  -20601, -20979, -23077, -22996,
-  -25725, -24540, -29586, -13764,
-    2063,  -2956,  -1735,  -4406,
-   -4258,  -6267,  -6545,  -8216,
-   -8734, -10184, -10865, -12149,
-  -12955, -14100, -15014, -16031,
-  -17046, -17939, -19056, -19818,
-  -21051, -21663, -23038, -23464,
-  -25035, -25196, -27079, -26790,
-  -29311, -27922, -32766, -16745,
-    -722,  -5547,  -4133,  -6613,
-   -6276,  -8097,  -8188,  -9674,
-  -10007, -11274, -11772, -12874,
-  -13499, -14462, -15194, -16031,
-  -16865, -17577, -18513, -19093,
-  -20144, -20573, -21765, -22006,
-  -23392, -23366, -25062, -24582,
-  -26913, -25331, -29981, -13764,
-    2459,  -2165,   -547,  -2820,
-   -2273,  -3880,  -3755,  -5018,
-   -5127,  -6163,  -6427,  -7287,
-   -7666,  -8375,  -8849,  -9416,
-   -9975, -10400, -11042, -11313,
-  -12047, -12139, -12984, -12851,
-  -13851, -13403, -14658, -13685,
-  -15491, -13290, -17250,      0,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766,  32766,  32766,
-   32766,  32766,  32766,  32766,
-   32766,  32766,  32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766,  32766,
-       0,   1608,   3212,   4808,
-    6392,   7961,   9511,  11039,
-   12539,  14009,  15446,  16845,
-   18204,  19519,  20787,  22004,
-   23169,  24278,  25328,  26318,
-   27244,  28104,  28897,  29620,
-   30272,  30851,  31355,  31784,
-   32136,  32411,  32608,  32727,
-   32766,  32727,  32608,  32411,
-   32136,  31784,  31355,  30851,
-   30272,  29620,  28897,  28104,
-   27244,  26318,  25328,  24278,
-   23169,  22004,  20787,  19519,
-   18204,  16845,  15446,  14009,
-   12539,  11039,   9511,   7961,
-    6392,   4808,   3212,   1608,
-       0,  -1608,  -3212,  -4808,
-   -6392,  -7961,  -9511, -11039,
-  -12539, -14009, -15446, -16845,
-  -18204, -19519, -20787, -22004,
-  -23169, -24278, -25328, -26318,
-  -27244, -28104, -28897, -29620,
-  -30272, -30851, -31355, -31784,
-  -32136, -32411, -32608, -32727,
-  -32766, -32727, -32608, -32411,
-  -32136, -31784, -31355, -30851,
-  -30272, -29620, -28897, -28104,
-  -27244, -26318, -25328, -24278,
-  -23169, -22004, -20787, -19519,
-  -18204, -16845, -15446, -14009,
-  -12539, -11039,  -9511,  -7961,
-   -6392,  -4808,  -3212,  -1608,
-       0,   1608,   3212,   4808,
-    6392,   7961,   9511,  11039,
-   12539,  14009,  15446,  16845,
-   18204,  19519,  20787,  22004,
-   23169,  24278,  25328,  26318,
-   27244,  28104,  28897,  29620,
-   30272,  30851,  31355,  31784,
-   32136,  32411,  32608,  32727,
-   32766,  32727,  32608,  32411,
-   32136,  31784,  31355,  30851,
-   30272,  29620,  28897,  28104,
-   27244,  26318,  25328,  24278,
-   23169,  22004,  20787,  19519,
-   18204,  16845,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,   2009,   4011,
-    5997,   7961,   9896,  11792,
-   13645,  15446,  17189,  18867,
-   20474,  22004,  23452,  24811,
-   26076,  27244,  28309,  29267,
-   30116,  30851,  31469,  31970,
-   32350,  32608,  32744,  32756,
-   32645,  32411,  32056,  31579,
-   30984,  30272,  29446,  28509,
-   27465,  26318,  25071,  23731,
-   22301,  20787,  19194,  17530,
-   15799,  14009,  12167,  10278,
-    8351,   6392,   4410,   2410,
-     402,  -1608,  -3612,  -5602,
-   -7571,  -9511, -11416, -13278,
-  -15090, -16845, -18537, -20159,
-  -21705, -23169, -24546, -25831,
-  -27018, -28104, -29084, -29955,
-  -30713, -31355, -31879, -32284,
-  -32566, -32727, -32764, -32677,
-  -32468, -32136, -31684, -31112,
-  -30423, -29620, -28705, -27682,
-  -26555, -25328, -24006, -22593,
-  -21096, -19519, -17868, -16150,
-  -14372, -12539, -10659,  -8739,
-   -6786,  -4808,  -2811,   -804,
-    1206,   3212,   5205,   7179,
-    9126,  11039,  12910,  14732,
-   16499,  18204,  19840,  21402,
-   22883,  24278,  25582,  26789,
-   27896,  28897,  29790,  30570,
-   31236,  31784,  32212,  32520,
-   32704,  32766,  32704,  32520,
-   32212,  31784,  31236,  30570,
-   29790,  28897,  27896,  26789,
-   25582,  24278,  22883,  21402,
-   19840,  18204,  16499,  14732,
-   12910,  11039,   9126,   7179,
-    5205,   3212,   1206,   -804,
-   -2811,  -4808,  -6786,  -8739,
-  -10659, -12539, -14372,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,   2410,
-    4808,   7179,   9511,  11792,
-   14009,  16150,  18204,  20159,
-   22004,  23731,  25328,  26789,
-   28104,  29267,  30272,  31112,
-   31784,  32284,  32608,  32756,
-   32727,  32520,  32136,  31579,
-   30851,  29955,  28897,  27682,
-   26318,  24811,  23169,  21402,
-   19519,  17530,  15446,  13278,
-   11039,   8739,   6392,   4011,
-    1608,   -804,  -3212,  -5602,
-   -7961, -10278, -12539, -14732,
-  -16845, -18867, -20787, -22593,
-  -24278, -25831, -27244, -28509,
-  -29620, -30570, -31355, -31970,
-  -32411, -32677, -32766, -32677,
-  -32411, -31970, -31355, -30570,
-  -29620, -28509, -27244, -25831,
-  -24278, -22593, -20787, -18867,
-  -16845, -14732, -12539, -10278,
-   -7961,  -5602,  -3212,   -804,
-    1608,   4011,   6392,   8739,
-   11039,  13278,  15446,  17530,
-   19519,  21402,  23169,  24811,
-   26318,  27682,  28897,  29955,
-   30851,  31579,  32136,  32520,
-   32727,  32756,  32608,  32284,
-   31784,  31112,  30272,  29267,
-   28104,  26789,  25328,  23731,
-   22004,  20159,  18204,  16150,
-   14009,  11792,   9511,   7179,
-    4808,   2410,      0,  -2410,
-   -4808,  -7179,  -9511, -11792,
-  -14009, -16150, -18204, -20159,
-  -22004, -23731, -25328, -26789,
-  -28104, -29267, -30272, -31112,
-  -31784, -32284,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-    3212,   6392,   9511,  12539,
-   15446,  18204,  20787,  23169,
-   25328,  27244,  28897,  30272,
-   31355,  32136,  32608,  32766,
-   32608,  32136,  31355,  30272,
-   28897,  27244,  25328,  23169,
-   20787,  18204,  15446,  12539,
-    9511,   6392,   3212,      0,
-   -3212,  -6392,  -9511, -12539,
-  -15446, -18204, -20787, -23169,
-  -25328, -27244, -28897, -30272,
-  -31355, -32136, -32608, -32766,
-  -32608, -32136, -31355, -30272,
-  -28897, -27244, -25328, -23169,
-  -20787, -18204, -15446, -12539,
-   -9511,  -6392,  -3212,      0,
-    3212,   6392,   9511,  12539,
-   15446,  18204,  20787,  23169,
-   25328,  27244,  28897,  30272,
-   31355,  32136,  32608,  32766,
-   32608,  32136,  31355,  30272,
-   28897,  27244,  25328,  23169,
-   20787,  18204,  15446,  12539,
-    9511,   6392,   3212,      0,
-   -3212,  -6392,  -9511, -12539,
-  -15446, -18204, -20787, -23169,
-  -25328, -27244, -28897, -30272,
-  -31355, -32136, -32608, -32766,
-  -32608, -32136, -31355, -30272,
-  -28897, -27244, -25328, -23169,
-  -20787, -18204, -15446, -12539,
-   -9511,  -6392,  -3212,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,   4011,   7961,  11792,
-   15446,  18867,  22004,  24811,
-   27244,  29267,  30851,  31970,
-   32608,  32756,  32411,  31579,
-   30272,  28509,  26318,  23731,
-   20787,  17530,  14009,  10278,
-    6392,   2410,  -1608,  -5602,
-   -9511, -13278, -16845, -20159,
-  -23169, -25831, -28104, -29955,
-  -31355, -32284, -32727, -32677,
-  -32136, -31112, -29620, -27682,
-  -25328, -22593, -19519, -16150,
-  -12539,  -8739,  -4808,   -804,
-    3212,   7179,  11039,  14732,
-   18204,  21402,  24278,  26789,
-   28897,  30570,  31784,  32520,
-   32766,  32520,  31784,  30570,
-   28897,  26789,  24278,  21402,
-   18204,  14732,  11039,   7179,
-    3212,   -804,  -4808,  -8739,
-  -12539, -16150, -19519, -22593,
-  -25328, -27682, -29620, -31112,
-  -32136, -32677, -32727, -32284,
-  -31355, -29955, -28104, -25831,
-  -23169, -20159, -16845, -13278,
-   -9511,  -5602,  -1608,   2410,
-    6392,  10278,  14009,  17530,
-   20787,  23731,  26318,  28509,
-   30272,  31579,  32411,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,   6392,  12539,
-   18204,  23169,  27244,  30272,
-   32136,  32766,  32136,  30272,
-   27244,  23169,  18204,  12539,
-    6392,      0,  -6392, -12539,
-  -18204, -23169, -27244, -30272,
-  -32136, -32766, -32136, -30272,
-  -27244, -23169, -18204, -12539,
-   -6392,      0,   6392,  12539,
-   18204,  23169,  27244,  30272,
-   32136,  32766,  32136,  30272,
-   27244,  23169,  18204,  12539,
-    6392,      0,  -6392, -12539,
-  -18204, -23169, -27244, -30272,
-  -32136, -32766, -32136, -30272,
-  -27244, -23169, -18204, -12539,
-   -6392,      0,   6392,  12539,
-   18204,  23169,  27244,  30272,
-   32136,  32766,  32136,  30272,
-   27244,  23169,  18204,  12539,
-    6392,      0,  -6392, -12539,
-  -18204, -23169, -27244, -30272,
-  -32136, -32766, -32136, -30272,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,  12539,
-   23169,  30272,  32766,  30272,
-   23169,  12539,      0, -12539,
-  -23169, -30272, -32766, -30272,
-  -23169, -12539,      0,  12539,
-   23169,  30272,  32766,  30272,
-   23169,  12539,      0, -12539,
-  -23169, -30272, -32766, -30272,
-  -23169, -12539,      0,  12539,
-   23169,  30272,  32766,  30272,
-   23169,  12539,      0, -12539,
-  -23169, -30272, -32766, -30272,
-  -23169, -12539,      0,  12539,
-   23169,  30272,  32766,  30272,
-   23169,  12539,      0, -12539,
-  -23169, -30272, -32766, -30272,
-  -23169, -12539,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-   23169,  32766,  23169,      0,
-  -23169, -32766, -23169,      0,
-   23169,  32766,  23169,      0,
-  -23169, -32766, -23169,      0,
-   23169,  32766,  23169,      0,
-  -23169, -32766, -23169,      0,
-   23169,  32766,  23169,      0,
-  -23169, -32766, -23169,      0,
-   23169,  32766,  23169,      0,
-  -23169, -32766, -23169,      0,
-   23169,  32766,  23169,      0,
-  -23169,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-    1089,   2334,   3576,   4814,
-    6044,   7266,   8478,   9678,
-   10863,  12033,  13186,  14320,
-   15432,  16523,  17589,  18630,
-   19644,  20629,  21584,  22508,
-   23399,  24256,  25077,  25863,
-   26610,  27319,  27988,  28616,
-   29203,  29747,  30249,  30706,
-   31119,  31486,  31809,  32085,
-   32315,  32498,  32634,  32724,
-   32766,  32761,  32710,  32611,
-   32466,  32275,  32037,  31754,
-   31426,  31053,  30637,  30177,
-   29675,  29131,  28546,  27921,
-   27258,  26556,  25818,  25045,
-   24236,  23395,  22522,  21618,
-   20684,  19724,  18736,  17724,
-   16688,  15631,  14553,  13456,
-   12342,  11213,  10070,   8914,
-    7748,   6573,   5391,   4203,
-    3011,   1817,    622,   -571,
-   -1763,  -2949,  -4131,  -5304,
-   -6469,  -7623,  -8766,  -9895,
-  -11009, -12106, -13186, -14247,
-  -15288, -16307, -17303, -18276,
-  -19223, -20145, -21039, -21905,
-  -22742, -23550, -24326, -25072,
-  -25785, -26465, -27112, -27726,
-  -28305, -28849, -29359, -29833,
-  -30272, -30675, -31042, -31373,
-  -31669, -31929, -32153, -32342,
-  -32496, -32615, -32699, -32749,
-  -32766, -32750, -32700, -32619,
-  -32507, -32364, -32192, -31990,
-  -31760, -31502, -31218, -30909,
-  -30574, -30217, -29836, -29435,
-  -29013, -28571, -28111, -27634,
-  -27142, -26634, -26113, -25580,
-  -25035, -24481, -23917, -23347,
-  -22769, -22187, -21601, -21012,
-  -20421, -19830, -19240, -18651,
-  -18066, -17485, -16909, -16339,
-  -15777, -15222, -14678, -14143,
-  -13620, -13108, -12610, -12126,
-  -11656, -11201, -10762, -10340,
-   -9936,  -9549,  -9181,  -8833,
-   -8503,  -8194,  -7905,  -7637,
-   -7390,  -7165,  -6961,  -6779,
-   -6619,  -6481,  -6365,  -6271,
-   -6199,  -6150,  -6122,  -6117,
-   -6133,  -6171,  -6230,  -6310,
-   -6411,  -6533,  -6674,  -6835,
-   -7015,  -7214,  -7431,  -7666,
-   -7918,  -8187,  -8472,  -8773,
-   -9088,  -9417,  -9760, -10116,
-  -10485, -10865, -11255, -11656,
-  -12066, -12485, -12912, -13347,
-  -13787, -14234, -14686, -15142,
-  -15602, -16065, -16530, -16997,
-  -17464, -17932, -18399, -18866,
-  -19330, -19793, -20252, -20708,
-  -21160, -21607, -22050, -22486,
-  -22917, -23341, -23758, -24167,
-  -24569, -24963, -25348, -25724,
-  -26092,    737,   2585,   4426,
-    6252,   8059,   9841,  11591,
-   13304,  14975,  16598,  18168,
-   19680,  21130,  22511,  23821,
-   25054,  26207,  27276,  28259,
-   29150,  29949,  30652,  31258,
-   31764,  32168,  32471,  32670,
-   32766,  32758,  32646,  32431,
-   32114,  31696,  31178,  30563,
-   29852,  29048,  28153,  27171,
-   26105,  24958,  23735,  22440,
-   21075,  19647,  18160,  16618,
-   15027,  13392,  11718,  10010,
-    8273,   6514,   4738,   2949,
-    1155,   -641,  -2431,  -4211,
-   -5976,  -7720,  -9438, -11124,
-  -12775, -14385, -15950, -17465,
-  -18927, -20331, -21673, -22950,
-  -24159, -25297, -26361, -27348,
-  -28257, -29086, -29832, -30496,
-  -31075, -31569, -31978, -32301,
-  -32539, -32692, -32762, -32748,
-  -32653, -32477, -32224, -31894,
-  -31491, -31016, -30474, -29865,
-  -29195, -28466, -27682, -26846,
-  -25963, -25036, -24069, -23067,
-  -22033, -20973, -19890, -18789,
-  -17674, -16550, -15420, -14290,
-  -13164, -12045, -10938,  -9848,
-   -8777,  -7730,  -6710,  -5721,
-   -4767,  -3850,  -2974,  -2141,
-   -1355,   -617,     70,    703,
-    1282,   1804,   2269,   2674,
-    3019,   3304,   3527,   3688,
-    3788,   3826,   3804,   3720,
-    3577,   3375,   3116,   2800,
-    2430,   2006,   1532,   1008,
-     438,   -177,   -835,  -1532,
-   -2266,  -3034,  -3834,  -4663,
-   -5518,  -6396,  -7293,  -8208,
-   -9137, -10077, -11025, -11978,
-  -12933, -13888, -14840, -15785,
-  -16723, -17649, -18561, -19458,
-  -20336, -21194, -22030, -22842,
-  -23628, -24387, -25117, -25817,
-  -26486, -27122, -27725, -28294,
-  -28829, -29329, -29794, -30223,
-  -30617, -30977, -31301, -31590,
-  -31846, -32068, -32258, -32416,
-  -32543, -32640, -32709, -32751,
-  -32766, -32757, -32724, -32669,
-  -32594, -32501, -32390, -32263,
-  -32122, -31969, -31805, -31632,
-  -31451, -31264, -31072, -30877,
-  -30680, -30484, -30288, -30094,
-  -29905, -29719, -29540, -29368,
-  -29203, -29047, -28900, -28764,
-  -28638, -28524, -28421, -28331,
-  -28253, -28188, -28135, -28096,
-  -28069, -28055, -28054, -28065,
-  -28088, -28123, -28170, -28227,
-  -28295, -28373, -28460, -28556,
-  -28659, -28771, -28889, -29013,
-  -29142, -29276, -29413, -29554,
-  -29697, -31304,    555,   3005,
-    5439,   7842,  10202,  12505,
-   14737,  16887,  18943,  20891,
-   22723,  24427,  25993,  27413,
-   28680,  29785,  30724,  31490,
-   32080,  32491,  32720,  32766,
-   32630,  32312,  31815,  31142,
-   30296,  29283,  28109,  26781,
-   25306,  23693,  21952,  20092,
-   18124,  16059,  13909,  11686,
-    9402,   7071,   4705,   2316,
-     -81,  -2473,  -4849,  -7195,
-   -9498, -11747, -13930, -16035,
-  -18052, -19971, -21782, -23477,
-  -25048, -26487, -27788, -28945,
-  -29955, -30813, -31517, -32065,
-  -32455, -32689, -32766, -32689,
-  -32461, -32086, -31567, -30910,
-  -30122, -29208, -28177, -27036,
-  -25795, -24462, -23046, -21559,
-  -20009, -18409, -16767, -15096,
-  -13406, -11708, -10013,  -8331,
-   -6673,  -5049,  -3469,  -1943,
-    -478,    915,   2230,   3458,
-    4593,   5628,   6559,   7381,
-    8089,   8679,   9151,   9501,
-    9728,   9833,   9815,   9676,
-    9417,   9041,   8552,   7952,
-    7247,   6441,   5540,   4550,
-    3476,   2327,   1108,   -173,
-   -1508,  -2889,  -4309,  -5759,
-   -7232,  -8720, -10214, -11707,
-  -13192, -14660, -16105, -17520,
-  -18899, -20235, -21522, -22755,
-  -23930, -25042, -26087, -27062,
-  -27964, -28790, -29539, -30210,
-  -30801, -31313, -31745, -32099,
-  -32376, -32577, -32705, -32762,
-  -32751, -32676, -32539, -32345,
-  -32098, -31802, -31461, -31082,
-  -30667, -30223, -29754, -29264,
-  -28760, -28245, -27725, -27203,
-  -26685, -26175, -25677, -25195,
-  -24732, -24292, -23877, -23491,
-  -23136, -22815, -22528, -22278,
-  -22065, -21892, -21757, -21662,
-  -21606, -21589, -21610, -21669,
-  -21764, -21894, -22058, -22253,
-  -22477, -22729, -23006, -23307,
-  -23627, -23966, -24320, -24687,
-  -25064, -25449, -25840, -26233,
-  -26627, -27019, -27407, -27790,
-  -28164, -28530, -28884, -29225,
-  -29553, -29866, -30163, -30444,
-  -30708, -30954, -31183, -31393,
-  -31586, -31762, -31920, -32062,
-  -32188, -32299, -32395, -32477,
-  -32546, -32604, -32651, -32688,
-  -32717, -32738, -32752, -32761,
-  -32765, -32766, -32764, -32759,
-  -32754, -32748, -32742, -32736,
-  -32731, -32727, -32725, -32724,
-  -32725, -32727, -32730, -32735,
-  -32740, -32746, -32752, -32757,
-  -32762, -32765, -32766,    370,
-    4021,   7621,  11128,  14495,
-   17682,  20648,  23356,  25773,
-   27868,  29615,  30993,  31984,
-   32578,  32766,  32548,  31926,
-   30909,  29510,  27749,  25646,
-   23230,  20530,  17582,  14422,
-   11089,   7626,   4075,    480,
-   -3116,  -6667, -10133, -13471,
-  -16641, -19608, -22336, -24795,
-  -26958, -28803, -30309, -31464,
-  -32258, -32685, -32746, -32445,
-  -31792, -30801, -29488, -27877,
-  -25993, -23864, -21522, -19001,
-  -16337, -13568, -10731,  -7866,
-   -5010,  -2203,    519,   3121,
-    5569,   7833,   9883,  11695,
-   13247,  14521,  15502,  16182,
-   16552,  16612,  16362,  15808,
-   14961,  13833,  12440,  10803,
-    8943,   6886,   4658,   2289,
-    -193,  -2756,  -5370,  -8002,
-  -10622, -13201, -15709, -18119,
-  -20406, -22546, -24519, -26307,
-  -27894, -29268, -30420, -31344,
-  -32037, -32498, -32732, -32745,
-  -32545, -32143, -31555, -30795,
-  -29881, -28833, -27672, -26419,
-  -25095, -23724, -22327, -20928,
-  -19546, -18204, -16919, -15710,
-  -14594, -13584, -12694, -11934,
-  -11312, -10835, -10507, -10329,
-  -10301, -10421, -10685, -11086,
-  -11617, -12268, -13028, -13886,
-  -14829, -15843, -16914, -18030,
-  -19174, -20333, -21494, -22643,
-  -23768, -24858, -25901, -26888,
-  -27813, -28666, -29443, -30141,
-  -30755, -31284, -31729, -32090,
-  -32370, -32572, -32700, -32760,
-  -32757, -32698, -32589, -32439,
-  -32254, -32042, -31811, -31567,
-  -31318, -31070, -30829, -30601,
-  -30390, -30201, -30036, -29900,
-  -29792, -29716, -29670, -29656,
-  -29672, -29716, -29788, -29884,
-  -30002, -30138, -30291, -30456,
-  -30629, -30809, -30992, -31173,
-  -31352, -31525, -31690, -31845,
-  -31989, -32120, -32239, -32343,
-  -32434, -32511, -32576, -32629,
-  -32671, -32703, -32726, -32743,
-  -32754, -32761, -32764, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-     320,   5172,   9912,  14434,
-   18640,  22436,  25737,  28473,
-   30582,  32018,  32751,  32766,
-   32063,  30658,  28585,  25890,
-   22634,  18889,  14739,  10275,
-    5596,    804,  -3997,  -8704,
-  -13214, -17434, -21275, -24657,
-  -27513, -29786, -31436, -32433,
-  -32766, -32436, -31462, -29873,
-  -27717, -25049, -21938, -18461,
-  -14705, -10758,  -6714,  -2669,
-    1286,   5058,   8564,  11724,
-   14471,  16744,  18496,  19691,
-   20308,  20337,  19783,  18662,
-   17003,  14849,  12250,   9266,
-    5966,   2423,  -1285,  -5079,
-   -8877, -12603, -16180, -19538,
-  -22614, -25351, -27702, -29631,
-  -31109, -32122, -32664, -32741,
-  -32369, -31574, -30392, -28864,
-  -27042, -24979, -22734, -20370,
-  -17949, -15533, -13181, -10951,
-   -8896,  -7062,  -5489,  -4210,
-   -3251,  -2629,  -2352,  -2421,
-   -2828,  -3558,  -4589,  -5892,
-   -7435,  -9180, -11084, -13105,
-  -15199, -17320, -19426, -21476,
-  -23430, -25256, -26923, -28406,
-  -29686, -30749, -31587, -32198,
-  -32584, -32755, -32723, -32505,
-  -32123, -31601, -30962, -30237,
-  -29450, -28632, -27808, -27004,
-  -26243, -25546, -24931, -24413,
-  -24002, -23706, -23530, -23474,
-  -23536, -23709, -23986, -24356,
-  -24807, -25326, -25896, -26504,
-  -27135, -27774, -28407, -29022,
-  -29608, -30155, -30655, -31104,
-  -31498, -31834, -32113, -32336,
-  -32507, -32630, -32710, -32753,
-  -32766, -32755, -32728, -32689,
-  -32645, -32601, -32562, -32529,
-  -32506, -32495, -32494, -32504,
-  -32524, -32552, -32586, -32622,
-  -32659, -32693, -32723, -32746,
-  -32761, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766,    187,   7402,  14255,
-   20407,  25554,  29445,  31889,
-   32766,  32036,  29738,  25986,
-   20970,  14937,   8184,   1044,
-   -6135, -13006, -19239, -24538,
-  -28657, -31410, -32681, -32428,
-  -30687, -27566, -23241, -17946,
-  -11961,  -5598,    817,   6960,
-   12522,  17229,  20851,  23217,
-   24219,  23818,  22045,  18998,
-   14838,   9776,   4063,  -2020,
-   -8181, -14131, -19595, -24330,
-  -28134, -30856, -32401, -32736,
-  -31890, -29947, -27046, -23370,
-  -19135, -14579,  -9951,  -5495,
-   -1443,   2004,   4679,   6456,
-    7262,   7071,   5909,   3849,
-    1006,  -2468,  -6398, -10590,
-  -14845, -18968, -22779, -26119,
-  -28859, -30907, -32208, -32748,
-  -32550, -31674, -30212, -28281,
-  -26017, -23563, -21069, -18678,
-  -16518, -14702, -13318, -12428,
-  -12064, -12229, -12901, -14031,
-  -15549, -17370, -19399, -21535,
-  -23677, -25733, -27617, -29262,
-  -30617, -31647, -32340, -32700,
-  -32750, -32527, -32078, -31461,
-  -30735, -29960, -29196, -28493,
-  -27895, -27435, -27134, -27002,
-  -27038, -27231, -27563, -28006,
-  -28531, -29107, -29701, -30285,
-  -30834, -31328, -31752, -32099,
-  -32366, -32557, -32680, -32745,
-  -32766, -32756, -32729, -32696,
-  -32666, -32647, -32640, -32647,
-  -32666, -32692, -32720, -32745,
-  -32762, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766,    203,   9767,
-   18489,  25609,  30510,  32766,
-   32185,  28822,  22975,  15155,
-    6045,  -3567, -12852, -21016,
-  -27372, -31394, -32766, -31407,
-  -27476, -21356, -13615,  -4960,
-    3832,  11981,  18773,  23620,
-   26113,  26052,  23464,  18592,
-   11877,   3908,  -4625, -13000,
-  -20520, -26580, -30715, -32638,
-  -32261, -29699, -25255, -19390,
-  -12676,  -5744,    771,   6290,
-   10333,  12566,  12820,  11103,
-    7596,   2627,  -3357,  -9838,
-  -16273, -22143, -26996, -30487,
-  -32403, -32677, -31388, -28749,
-  -25080, -20780, -16281, -12018,
-   -8381,  -5689,  -4160,  -3902,
-   -4905,  -7047, -10115, -13825,
-  -17852, -21863, -25544, -28630,
-  -30924, -32312, -32766, -32344,
-  -31176, -29449, -27387, -25226,
-  -23194, -21487, -20259, -19606,
-  -19565, -20111, -21171, -22629,
-  -24344, -26163, -27938, -29540,
-  -30868, -31858, -32481, -32749,
-  -32704, -32411, -31952, -31414,
-  -30878, -30415, -30075, -29889,
-  -29867, -29998, -30256, -30604,
-  -31001, -31406, -31785, -32110,
-  -32368, -32554, -32673, -32737,
-  -32763, -32765, -32760, -32756,
-  -32757, -32762, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766,    438,
-   14623,  26051,  32513,  32766,
-   26770,  15694,   1683, -12564,
-  -24321, -31368, -32416, -27350,
-  -17241,  -4123,   9405,  20701,
-   27583,  28750,  24023,  14356,
-    1641, -11685, -23113, -30553,
-  -32731, -29414, -21434, -10500,
-    1149,  11197,  17694,  19429,
-   16136,   8522,  -1900, -13130,
-  -23083, -29991, -32738, -31047,
-  -25503, -17408,  -8499,   -597,
-    4749,   6550,   4539,   -809,
-   -8402, -16777, -24395, -29947,
-  -32590, -32089, -28820, -23668,
-  -17825, -12535,  -8857,  -7468,
-   -8558, -11830, -16588, -21904,
-  -26815, -30511, -32482, -32592,
-  -31075, -28452, -25411, -22649,
-  -20740, -20033, -20602, -22266,
-  -24649, -27277, -29684, -31505,
-  -32534, -32748, -32289, -31407,
-  -30399, -29534, -29009, -28912,
-  -29224, -29840, -30611, -31379,
-  -32021, -32466, -32701, -32766,
-  -32726, -32650, -32594, -32584,
-  -32619, -32677, -32732, -32762,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-  -32766, -32766, -32766, -32766,
-       0,   2616,   5198,   7731,
-   10203,  12599,  14908,  17118,
-   19217,  21194,  23041,  24748,
-   26306,  27709,  28950,  30024,
-   30925,  31651,  32199,  32568,
-   32757,  32766,  32597,  32253,
-   31736,  31051,  30203,  29199,
-   28045,  26748,  25318,  23762,
-   22091,  20315,  18444,  16490,
-   14464,  12378,  10243,   8072,
-    5877,   3671,   1465,   -729,
-   -2898,  -5031,  -7117,  -9144,
-  -11102, -12981, -14771, -16463,
-  -18050, -19523, -20875, -22100,
-  -23193, -24149, -24964, -25635,
-  -26159, -26536, -26765, -26845,
-  -26779, -26567, -26213, -25720,
-  -25092, -24334, -23451, -22450,
-  -21338, -20121, -18808, -17407,
-  -15926, -14375, -12763, -11099,
-   -9394,  -7656,  -5897,  -4125,
-   -2351,   -585,   1163,   2885,
-    4571,   6212,   7800,   9326,
-   10782,  12163,  13459,  14667,
-   15779,  16792,  17700,  18500,
-   19188,  19764,  20223,  20566,
-   20792,  20902,  20896,  20775,
-   20542,  20201,  19753,  19203,
-   18555,  17815,  16987,  16078,
-   15094,  14041,  12926,  11756,
-   10538,   9281,   7991,   6676,
-    5344,   4003,   2660,   1324,
-       0,  -1303,  -2579,  -3820,
-   -5020,  -6174,  -7275,  -8318,
-   -9298, -10211, -11052, -11818,
-  -12506, -13113, -13638, -14077,
-  -14432, -14700, -14882, -14979,
-  -14990, -14919, -14766, -14534,
-  -14226, -13845, -13395, -12878,
-  -12300, -11665, -10978, -10244,
-   -9468,  -8654,  -7810,  -6939,
-   -6049,  -5143,  -4229,  -3311,
-   -2394,  -1485,   -589,    291,
-    1148,   1979,   2779,   3544,
-    4270,   4954,   5593,   6184,
-    6724,   7213,   7647,   8027,
-    8350,   8616,   8826,   8979,
-    9076,   9118,   9106,   9041,
-    8926,   8763,   8554,   8301,
-    8008,   7677,   7313,   6917,
-    6494,   6047,   5580,   5097,
-    4601,   4096,   3585,   3073,
-    2562,   2056,   1559,   1073,
-     602,    147,   -287,   -700,
-   -1088,  -1451,  -1785,  -2091,
-   -2367,  -2612,  -2825,  -3006,
-   -3156,  -3274,  -3361,  -3417,
-   -3444,  -3443,  -3414,  -3360,
-   -3283,  -3184,  -3065,  -2928,
-   -2776,  -2611,  -2435,  -2251,
-   -2062,  -1869,  -1675,  -1482,
-   -1294,  -1111,   -937,   -772,
-    -620,   -481,   -358,   -251,
-    -162,    -92,    -41,    -10,
-       0,      0,   3807,   7537,
-   11147,  14593,  17833,  20831,
-   23552,  25964,  28041,  29760,
-   31103,  32056,  32612,  32766,
-   32520,  31880,  30858,  29469,
-   27732,  25673,  23319,  20701,
-   17853,  14812,  11617,   8308,
-    4927,   1515,  -1885,  -5233,
-   -8487, -11610, -14563, -17313,
-  -19827, -22078, -24039, -25690,
-  -27013, -27995, -28627, -28905,
-  -28829, -28402, -27634, -26536,
-  -25126, -23423, -21452, -19238,
-  -16812, -14204, -11449,  -8582,
-   -5638,  -2655,    331,   3283,
-    6165,   8943,  11584,  14057,
-   16333,  18388,  20197,  21741,
-   23004,  23974,  24641,  25002,
-   25054,  24800,  24248,  23406,
-   22288,  20910,  19294,  17460,
-   15434,  13243,  10915,   8481,
-    5972,   3418,    852,  -1694,
-   -4190,  -6605,  -8911, -11082,
-  -13091, -14916, -16538, -17939,
-  -19103, -20020, -20682, -21084,
-  -21224, -21103, -20726, -20102,
-  -19240, -18156, -16864, -15383,
-  -13735, -11941, -10025,  -8013,
-   -5931,  -3805,  -1662,    472,
-    2570,   4607,   6559,   8403,
-   10118,  11685,  13086,  14307,
-   15336,  16161,  16777,  17179,
-   17365,  17336,  17096,  16650,
-   16009,  15182,  14183,  13026,
-   11729,  10310,   8789,   7186,
-    5521,   3817,   2096,    379,
-   -1313,  -2959,  -4540,  -6037,
-   -7434,  -8713,  -9863, -10871,
-  -11726, -12422, -12953, -13314,
-  -13505, -13527, -13383, -13077,
-  -12618, -12012, -11272, -10409,
-   -9436,  -8368,  -7220,  -6008,
-   -4749,  -3460,  -2157,   -857,
-     424,   1669,   2865,   3997,
-    5052,   6020,   6889,   7651,
-    8300,   8829,   9235,   9517,
-    9673,   9705,   9615,   9409,
-    9092,   8671,   8155,   7552,
-    6873,   6129,   5332,   4492,
-    3624,   2738,   1846,    962,
-      95,   -743,  -1543,  -2294,
-   -2989,  -3621,  -4182,  -4669,
-   -5078,  -5405,  -5650,  -5813,
-   -5893,  -5895,  -5820,  -5673,
-   -5459,  -5184,  -4855,  -4478,
-   -4061,  -3613,  -3140,  -2652,
-   -2155,  -1659,  -1169,   -695,
-    -241,    186,    581,    939,
-    1257,   1532,   1762,   1946,
-    2084,   2176,   2223,   2229,
-    2195,   2125,   2024,   1896,
-    1745,   1577,   1396,   1210,
-    1022,    838,    662,    500,
-     355,    232,    132,     59,
-      15,      0,      0,   5008,
-    9868,  14478,  18738,  22560,
-   25865,  28585,  30666,  32068,
-   32766,  32751,  32029,  30622,
-   28565,  25908,  22713,  19055,
-   15016,  10686,   6162,   1543,
-   -3070,  -7577, -11883, -15894,
-  -19529, -22710, -25373, -27465,
-  -28945, -29788, -29980, -29523,
-  -28433, -26739, -24482, -21718,
-  -18510, -14931, -11063,  -6992,
-   -2807,   1399,   5535,   9514,
-   13249,  16663,  19685,  22253,
-   24315,  25833,  26779,  27137,
-   26905,  26096,  24730,  22845,
-   20485,  17707,  14574,  11159,
-    7537,   3790,      0,  -3751,
-   -7382, -10815, -13979, -16808,
-  -19243, -21238, -22752, -23759,
-  -24242, -24196, -23628, -22557,
-  -21010, -19028, -16656, -13952,
-  -10978,  -7800,  -4491,  -1123,
-    2230,   5496,   8605,  11491,
-   14095,  16363,  18251,  19721,
-   20748,  21315,  21414,  21050,
-   20236,  18995,  17360,  15371,
-   13076,  10528,   7785,   4911,
-    1968,   -979,  -3864,  -6628,
-   -9211, -11561, -13628, -15373,
-  -16761, -17768, -18378, -18581,
-  -18381, -17787, -16817, -15498,
-  -13864, -11954,  -9815,  -7496,
-   -5051,  -2533,      0,   2494,
-    4895,   7153,   9220,  11055,
-   12622,  13891,  14838,  15450,
-   15717,  15640,  15227,  14492,
-   13456,  12148,  10600,   8850,
-    6940,   4915,   2820,    703,
-   -1391,  -3415,  -5327,  -7087,
-   -8661, -10016, -11128, -11978,
-  -12551, -12842, -12849, -12577,
-  -12039, -11252, -10238,  -9024,
-   -7642,  -6124,  -4507,  -2829,
-   -1128,    558,   2193,   3742,
-    5174,   6458,   7571,   8493,
-    9207,   9703,   9976,  10026,
-    9856,   9477,   8903,   8151,
-    7242,   6202,   5056,   3834,
-    2564,   1276,      0,  -1237,
-   -2409,  -3491,  -4461,  -5303,
-   -6001,  -6543,  -6924,  -7141,
-   -7193,  -7085,  -6826,  -6427,
-   -5902,  -5268,  -4543,  -3747,
-   -2902,  -2029,  -1149,   -282,
-     551,   1333,   2049,   2683,
-    3226,   3669,   4006,   4235,
-    4355,   4369,   4283,   4104,
-    3842,   3509,   3116,   2678,
-    2208,   1720,   1229,    748,
-     289,   -138,   -522,   -857,
-   -1136,  -1355,  -1514,  -1613,
-   -1653,  -1638,  -1575,  -1470,
-   -1332,  -1168,   -989,   -804,
-    -621,   -449,   -297,   -172,
-     -78,    -20,      0,      0,
-    7354,  14295,  20489,  25641,
-   29511,  31921,  32766,  32017,
-   29723,  26009,  21064,  15140,
-    8531,   1563,  -5423, -12089,
-  -18115, -23212, -27144, -29727,
-  -30849, -30468, -28615, -25392,
-  -20967, -15564,  -9455,  -2942,
-    3658,  10022,  15845,  20849,
-   24799,  27514,  28871,  28819,
-   27372,  24613,  20687,  15796,
-   10185,   4133,  -2063,  -8101,
-  -13690, -18563, -22492, -25295,
-  -26846, -27083, -26007, -23682,
-  -20233, -15839, -10722,  -5136,
-     643,   6333,  11659,  16367,
-   20235,  23084,  24787,  25273,
-   24530,  22609,  19613,  15699,
-   11067,   5949,    598,  -4725,
-   -9762, -14271, -18041, -20896,
-  -22708, -23402, -22956, -21403,
-  -18833, -15381, -11224,  -6572,
-   -1656,   3283,   8006,  12286,
-   15921,  18742,  20623,  21483,
-   21294,  20078,  17905,  14892,
-   11197,   7006,   2530,  -2013,
-   -6400, -10421, -13887, -16636,
-  -18544, -19531, -19560, -18642,
-  -16836, -14240, -10990,  -7254,
-   -3218,    917,   4950,   8687,
-   11951,  14590,  16486,  17558,
-   17765,  17110,  15637,  13431,
-   10609,   7316,   3720,      0,
-   -3663,  -7091, -10123, -12617,
-  -14462, -15578, -15922, -15492,
-  -14320, -12476, -10059,  -7198,
-   -4037,   -736,   2543,   5642,
-    8413,  10728,  12484,  13604,
-   14046,  13802,  12895,  11382,
-    9349,   6902,   4170,   1290,
-   -1595,  -4346,  -6831,  -8935,
-  -10565, -11650, -12150, -12052,
-  -11374, -10161,  -8485,  -6435,
-   -4121,  -1661,    823,   3210,
-    5385,   7249,   8717,   9729,
-   10246,  10255,   9768,   8823,
-    7475,   5802,   3894,   1849,
-    -229,  -2239,  -4084,  -5678,
-   -6953,  -7853,  -8348,  -8424,
-   -8091,  -7378,  -6330,  -5010,
-   -3492,  -1855,   -184,   1438,
-    2934,   4234,   5283,   6037,
-    6470,   6574,   6355,   5837,
-    5058,   4066,   2920,   1681,
-     416,   -811,  -1942,  -2925,
-   -3718,  -4290,  -4624,  -4716,
-   -4572,  -4214,  -3670,  -2978,
-   -2183,  -1330,   -467,    361,
-    1115,   1759,   2269,   2627,
-    2825,   2865,   2757,   2519,
-    2176,   1756,   1288,    806,
-     338,    -90,   -456,   -745,
-    -946,  -1057,  -1083,  -1033,
-    -921,   -766,   -588,   -407,
-    -243,   -113,    -29,      0,
-       0,   9710,  18511,  25654,
-   30539,  32766,  32163,  28805,
-   23003,  15273,   6295,  -3150,
-  -12248, -20221, -26394, -30252,
-  -31482, -30001, -25958, -19722,
-  -11847,  -3021,   5988,  14407,
-   21519,  26723,  29590,  29894,
-   27631,  23017,  16470,   8567,
-       0,  -8491, -16178, -22409,
-  -26661, -28589, -28046, -25104,
-  -20035, -13294,  -5476,   2739,
-   10642,  17558,  22904,  26235,
-   27284,  25984,  22468,  17059,
-   10240,   2610,  -5169, -12429,
-  -18551, -23021, -25473, -25717,
-  -23753, -19773, -14138,  -7349,
-       0,   7273,  13846,  19164,
-   22783,  24411,  23929,  21402,
-   17067,  11316,   4658,  -2327,
-   -9036, -14896, -19414, -22218,
-  -23087, -21967, -18978, -14396,
-   -8634,  -2199,   4350,  10450,
-   15583,  19319,  21356,  21539,
-   19875,  16528,  11806,   6131,
-       0,  -6054, -11514, -15920,
-  -18905, -20234, -19813, -17700,
-  -14099,  -9337,  -3839,   1916,
-    7429,  12233,  15924,  18201,
-   18889,  17950,  15487,  11733,
-    7028,   1787,  -3532,  -8471,
-  -12614, -15617, -17240, -17362,
-  -15997, -13283,  -9474,  -4912,
-       0,   4836,   9182,  12675,
-   15027,  16057,  15696,  13998,
-   11130,   7358,   3020,  -1504,
-   -5823,  -9570, -12434, -14184,
-  -14691, -13933, -11997,  -9070,
-   -5421,  -1376,   2713,   6493,
-    9646,  11916,  13123,  13185,
-   12119,  10038,   7142,   3694,
-       0,  -3617,  -6850,  -9430,
-  -11149, -11879, -11579, -10296,
-   -8162,  -5380,  -2201,   1093,
-    4217,   6907,   8943,  10168,
-   10494,   9916,   8507,   6408,
-    3815,    964,  -1894,  -4514,
-   -6678,  -8214,  -9006,  -9007,
-   -8241,  -6794,  -4810,  -2475,
-       0,   2399,   4518,   6185,
-    7271,   7702,   7462,   6594,
-    5194,   3401,   1382,   -681,
-   -2610,  -4244,  -5453,  -6151,
-   -6296,  -5900,  -5017,  -3745,
-   -2209,   -553,   1075,   2535,
-    3710,   4512,   4889,   4830,
-    4363,   3549,   2478,   1257,
-       0,  -1180,  -2186,  -2941,
-   -3393,  -3525,  -3345,  -2892,
-   -2226,  -1422,   -563,    270,
-    1004,   1581,   1963,   2134,
-    2099,   1883,   1527,   1082,
-     602,    141,   -256,   -557,
-    -742,   -810,   -772,   -653,
-    -485,   -304,   -146,    -38,
-       0,      0,  14454,  26030,
-   32535,  32766,  26727,  15623,
-    1620, -12582, -24262, -31208,
-  -32128, -26896, -16562,  -3145,
-   10764,  22498,  29832,  31400,
-   26949,  17382,   4571,  -9005,
-  -20744, -28415, -30587, -26891,
-  -18085,  -5897,   7312,  19007,
-   26965,  29696,  26725,  18671,
-    7119,  -5690, -17295, -25488,
-  -28733, -26456, -19141,  -8235,
-    4143,  15614,  23993,  27706,
-   26088,  19498,   9245,  -2677,
-  -13972, -22487, -26621, -25626,
-  -19744, -10147,   1294,  12374,
-   20977,  25485,  25077,  19881,
-   10940,      0, -10826, -19471,
-  -24305, -24444, -19912, -11624,
-   -1203,   9335,  17976,  23089,
-   23736,  19841,  12200,   2313,
-   -7905, -16499, -21844, -22956,
-  -19672, -12668,  -3326,   6542,
-   15046,  20577,  22113,  19408,
-   13030,   4242,  -5251, -13625,
-  -19295, -21211, -19055, -13288,
-   -5057,   4035,  12241,  18005,
-   20259,  18617,  13443,   5773,
-   -2898, -10901, -16715, -19262,
-  -18099, -13499,  -6387,   1845,
-    9610,  15432,  18228,  17507,
-   13457,   6900,   -878,  -8374,
-  -14162, -17163, -16846, -13322,
-   -7312,      0,   7199,  12912,
-   16075,  16123,  13097,   7624,
-     787,  -6088, -11689, -14970,
-  -15343, -12787,  -7838,  -1481,
-    5047,  10499,  13855,  14513,
-   12394,   7954,   2081,  -4079,
-   -9348, -12738, -13638, -11926,
-   -7976,  -2586,   3189,   8242,
-   11625,  12727,  11385,   7906,
-    2996,  -2379,  -7187, -10523,
-  -11785, -10778,  -7746,  -3310,
-    1653,   6187,   9438,  10818,
-   10111,   7499,   3528,  -1014,
-   -5248,  -8377,  -9835,  -9388,
-   -7171,  -3653,    462,   4375,
-    7347,   8842,   8616,   6764,
-    3684,      0,  -3571,  -6354,
-   -7844,  -7801,  -6282,  -3625,
-    -371,   2841,   5403,   6851,
-    6950,   5732,   3476,    650,
-   -2188,  -4500,  -5867,  -6069,
-   -5117,  -3241,   -836,   1616,
-    3650,   4899,   5164,   4443,
-    2922,    931,  -1127,  -2859,
-   -3955,  -4242,  -3715,  -2523,
-    -934,    724,   2132,   3040,
-    3310,   2940,   2048,    847,
-    -408,  -1473,  -2160,  -2375,
-   -2122,  -1500,   -670,    182,
-     886,   1323,   1442,   1269,
-     884,    406,    -46,   -375,
-    -532,   -520,   -386,   -205,
-     -57,      0,      0,  18707,
-   30987,  32766,  23530,   6466,
-  -12633, -27339, -32748, -27119,
-  -12431,   6311,  22783,  31471,
-   29523,  17680,      0, -17533,
-  -29035, -30694, -22036,  -6054,
-   11825,  25582,  30635,  25362,
-   11622,  -5899, -21289, -29399,
-  -27571, -16506,      0,  16360,
-   27083,  28622,  20542,   5642,
-  -11016, -23825, -28522, -23606,
-  -10814,   5487,  19795,  27327,
-   25619,  15333,      0, -15186,
-  -25131, -26550, -19048,  -5230,
-   10208,  22068,  26409,  21849,
-   10005,  -5075, -18301, -25254,
-  -23667, -14159,      0,  14012,
-   23179,  24477,  17554,   4817,
-   -9399, -20312, -24297, -20092,
-   -9197,   4663,  16807,  23182,
-   21715,  12985,      0, -12838,
-  -21227, -22405, -16060,  -4405,
-    8590,  18555,  22184,  18335,
-    8388,  -4251, -15313, -21110,
-  -19763, -11811,      0,  11664,
-   19275,  20333,  14566,   3993,
-   -7782, -16798, -20071, -16579,
-   -7580,   3838,  13819,  19038,
-   17811,  10637,      0, -10491,
-  -17323, -18261, -13072,  -3581,
-    6973,  15042,  17958,  14822,
-    6771,  -3426, -12325, -16966,
-  -15859,  -9464,      0,   9317,
-   15371,  16189,  11578,   3169,
-   -6165, -13285, -15846, -13065,
-   -5963,   3014,  10831,  14894,
-   13908,   8290,      0,  -8143,
-  -13420, -14117, -10084,  -2756,
-    5356,  11528,  13733,  11309,
-    5154,  -2602,  -9337, -12821,
-  -11956,  -7116,      0,   6969,
-   11468,  12044,   8590,   2344,
-   -4548,  -9772, -11620,  -9552,
-   -4346,   2190,   7843,  10749,
-   10004,   5942,      0,  -5796,
-   -9516,  -9972,  -7096,  -1932,
-    3739,   8015,   9507,   7795,
-    3537,  -1778,  -6349,  -8677,
-   -8052,  -4768,      0,   4622,
-    7564,   7900,   5602,   1520,
-   -2931,  -6258,  -7395,  -6039,
-   -2729,   1365,   4855,   6605,
-    6100,   3595,      0,  -3448,
-   -5612,  -5828,  -4108,  -1108,
-    2122,   4502,   5282,   4282,
-    1920,   -953,  -3361,  -4533,
-   -4148,  -2421,      0,   2274,
-    3660,   3756,   2614,    696,
-   -1314,  -2745,  -3169,  -2525,
-   -1112,    541,   1867,   2461,
-    2196,   1247,      0,  -1100,
-   -1708,  -1684,  -1120,   -283,
-     505,    988,   1056,    769,
-     303,   -129,   -373,   -389,
-    -244,    -73,      0,      0,
-   30632,  23353, -12589, -32766,
-  -12489,  22985,  29911,      0,
-  -29671, -22617,  12191,  31726,
-   12091, -22250, -28950,      0,
-   28710,  21882, -11793, -30686,
-  -11693,  21514,  27989,      0,
-  -27749, -21146,  11395,  29645,
-   11295, -20779, -27028,      0,
-   26788,  20411, -10997, -28605,
-  -10897,  20043,  26067,      0,
-  -25827, -19675,  10598,  27565,
-   10499, -19308, -25106,      0,
-   24866,  18940, -10200, -26525,
-  -10101,  18572,  24145,      0,
-  -23905, -18204,   9802,  25485,
-    9703, -17836, -23184,      0,
-   22944,  17469,  -9404, -24444,
-   -9305,  17101,  22223,      0,
-  -21983, -16733,   9006,  23404,
-    8907, -16365, -21262,      0,
-   21022,  15998,  -8608, -22364,
-   -8509,  15630,  20301,      0,
-  -20061, -15262,   8210,  21324,
-    8111, -14894, -19340,      0,
-   19100,  14527,  -7812, -20284,
-   -7712,  14159,  18379,      0,
-  -18139, -13791,   7414,  19244,
-    7314, -13423, -17418,      0,
-   17178,  13056,  -7016, -18203,
-   -6916,  12688,  16457,      0,
-  -16217, -12320,   6618,  17163,
-    6518, -11952, -15496,      0,
-   15256,  11585,  -6220, -16123,
-   -6120,  11217,  14535,      0,
-  -14295, -10849,   5822,  15083,
-    5722, -10481, -13574,      0,
-   13334,  10113,  -5424, -14043,
-   -5324,   9746,  12613,      0,
-  -12373,  -9378,   5026,  13002,
-    4926,  -9010, -11652,      0,
-   11412,   8642,  -4627, -11962,
-   -4528,   8275,  10691,      0,
-  -10451,  -7907,   4229,  10922,
-    4130,  -7539,  -9730,      0,
-    9490,   7171,  -3831,  -9882,
-   -3732,   6804,   8769,      0,
-   -8529,  -6436,   3433,   8842,
-    3334,  -6068,  -7808,      0,
-    7568,   5700,  -3035,  -7801,
-   -2936,   5333,   6847,      0,
-   -6607,  -4965,   2637,   6761,
-    2538,  -4597,  -5886,      0,
-    5646,   4229,  -2239,  -5721,
-   -2140,   3862,   4925,      0,
-   -4685,  -3494,   1841,   4681,
-    1742,  -3126,  -3964,      0,
-    3724,   2758,  -1443,  -3641,
-   -1343,   2390,   3003,      0,
-   -2763,  -2023,   1045,   2600,
-     945,  -1655,  -2042,      0,
-    1802,   1287,   -647,  -1560,
-    -547,    919,   1081,      0,
-    -841,   -552,    249,    520,
-     149,   -184,   -120,      0,
-   -9377,  -4839,   -429,   3819,
-    7870,  11693,  15260,  18546,
-   21527,  24184,  26500,  28464,
-   30064,  31295,  32155,  32644,
-   32766,  32529,  31943,  31022,
-   29781,  28240,  26420,  24344,
-   22036,  19524,  16835,  13998,
-   11042,   7998,   4896,   1765,
-   -1366,  -4467,  -7510, -10471,
-  -13322, -16042, -18608, -21002,
-  -23205, -25202, -26981, -28532,
-  -29846, -30919, -31746, -32328,
-  -32667, -32766, -32632, -32274,
-  -31702, -30927, -29965, -28830,
-  -27539, -26109, -24560, -22910,
-  -21179, -19386, -17553, -15698,
-  -13841, -12001, -10197,  -8445,
-   -6763,  -5164,  -3664,  -2274,
-   -1007,    130,   1128,   1980,
-    2682,   3231,   3626,   3867,
-    3956,   3896,   3693,   3352,
-    2881,   2289,   1585,    779,
-    -117,  -1091,  -2131,  -3224,
-   -4357,  -5517,  -6692,  -7868,
-   -9033, -10176, -11284, -12347,
-  -13355, -14299, -15171, -15963,
-  -16669, -17284, -17804, -18225,
-  -18546, -18766, -18886, -18905,
-  -18828, -18657, -18395, -18049,
-  -17623, -17124, -16559, -15936,
-  -15261, -14544, -13792, -13014,
-  -12219, -11415, -10609,  -9812,
-   -9029,  -8269,  -7538,  -6844,
-   -6191,  -5585,  -5031,  -4533,
-   -4094,  -3717,  -3404,  -3155,
-   -2971,  -2853,  -2799,  -2808,
-   -2877,  -3005,  -3187,  -3421,
-   -3702,  -4027,  -4389,  -4785,
-   -5209,  -5656,  -6121,  -6599,
-   -7084,  -7571,  -8056,  -8534,
-   -8999,  -9449,  -9879, -10286,
-  -10667, -11018, -11338, -11625,
-  -11877, -12093, -12273, -12416,
-  -12524, -12595, -12632, -12636,
-  -12608, -12550, -12465, -12354,
-  -12221, -12067, -11897, -11711,
-  -11515, -11309, -11098, -10883,
-  -10668, -10455, -10246, -10044,
-   -9851,  -9668,  -9497,  -9339,
-   -9196,  -9068,  -8955,  -8859,
-   -8779,  -8715,  -8667,  -8634,
-   -8616,  -8611,  -8620,  -8639,
-   -8669,  -8708,  -8755,  -8807,
-   -8864,  -8924,  -8986,  -9048,
-   -9110,  -9168,  -9224,  -9275,
-   -9321,  -9360,  -9393,  -9419,
-   -9437,  -9448,  -9450,  -9445,
-   -9433,  -9413,  -9387,  -9356,
-   -9319,  -9278,  -9233,  -9186,
-   -9137,  -9088,  -9039,  -8992,
-   -8947,  -8906,  -8870,  -8838,
-   -8813,  -8794,  -8782,  -8778,
-   -8782,  -8795,  -8816,  -8845,
-   -8884,  -8932,  -8990,  -9066,
-   -9377,  -7511,    855,   8744,
-   15865,  21962,  26826,  30301,
-   32293,  32766,  31749,  29331,
-   25654,  20910,  15328,   9167,
-    2702,  -3786, -10025, -15760,
-  -20764, -24850, -27872, -29739,
-  -30407, -29889, -28248, -25596,
-  -22085, -17900, -13256,  -8378,
-   -3499,   1151,   5361,   8939,
-   11729,  13608,  14499,  14367,
-   13224,  11125,   8167,   4481,
-     229,  -4405,  -9223, -14022,
-  -18604, -22781, -26386, -29278,
-  -31348, -32522, -32766, -32084,
-  -30519, -28148, -25080, -21450,
-  -17415, -13141,  -8804,  -4575,
-    -618,   2920,   5912,   8257,
-    9886,  10757,  10866,  10237,
-    8926,   7014,   4607,   1825,
-   -1196,  -4318,  -7402, -10314,
-  -12934, -15157, -16900, -18103,
-  -18731, -18776, -18255, -17209,
-  -15704, -13820, -11654,  -9312,
-   -6905,  -4544,  -2334,   -372,
-    1258,   2490,   3276,   3589,
-    3423,   2793,   1734,    297,
-   -1451,  -3431,  -5556,  -7736,
-   -9880, -11902, -13723, -15274,
-  -16499, -17358, -17827, -17900,
-  -17586, -16911, -15914, -14647,
-  -13170, -11552,  -9863,  -8174,
-   -6554,  -5065,  -3762,  -2689,
-   -1880,  -1355,  -1121,  -1173,
-   -1493,  -2054,  -2818,  -3740,
-   -4772,  -5860,  -6954,  -8004,
-   -8963,  -9792, -10459, -10941,
-  -11224, -11304, -11185, -10882,
-  -10416,  -9815,  -9113,  -8345,
-   -7549,  -6763,  -6023,  -5360,
-   -4802,  -4371,  -4081,  -3942,
-   -3953,  -4109,  -4399,  -4805,
-   -5305,  -5875,  -6488,  -7117,
-   -7734,  -8315,  -8837,  -9282,
-   -9636,  -9889, -10037, -10081,
-  -10025,  -9879,  -9656,  -9370,
-   -9040,  -8683,  -8317,  -7960,
-   -7628,  -7332,  -7084,  -6892,
-   -6758,  -6684,  -6668,  -6703,
-   -6783,  -6898,  -7038,  -7191,
-   -7346,  -7492,  -7622,  -7726,
-   -7800,  -7840,  -7845,  -7817,
-   -7758,  -7673,  -7570,  -7454,
-   -7335,  -7220,  -7116,  -7031,
-   -6968,  -6933,  -6927,  -6951,
-   -7003,  -7080,  -7177,  -7289,
-   -7408,  -7528,  -7642,  -7743,
-   -7825,  -7883,  -7915,  -7917,
-   -7892,  -7838,  -7761,  -7665,
-   -7554,  -7437,  -7320,  -7209,
-   -7113,  -7037,  -6986,  -6964,
-   -6972,  -7012,  -7082,  -7179,
-   -7298,  -7434,  -7579,  -7726,
-   -7867,  -7994,  -8100,  -8179,
-   -8225,  -8235,  -8206,  -8136,
-   -8018,  -7511,  -9045,    688,
-    9758,  17734,  24254,  29037,
-   31900,  32766,  31664,  28723,
-   24169,  18301,  11478,   4097,
-   -3434, -10713, -17372, -23093,
-  -27624, -30791, -32506, -32766,
-  -31651, -29316, -25978, -21899,
-  -17373, -12703,  -8184,  -4087,
-    -644,   1968,   3629,   4287,
-    3950,   2693,    640,  -2039,
-   -5144,  -8457, -11757, -14836,
-  -17506, -19617, -21057, -21765,
-  -21724, -20968, -19571, -17645,
-  -15328, -12773, -10143,  -7593,
-   -5264,  -3275,  -1716,   -643,
-     -75,      0,   -372,  -1120,
-   -2153,  -3367,  -4655,  -5917,
-   -7061,  -8014,  -8727,  -9176,
-   -9362,  -9312,  -9074,  -8714,
-   -8307,  -7934,  -7673,  -7592,
-   -7743,  -8158,  -8848,  -9795,
-  -10959, -12277, -13669, -15040,
-  -16291, -17322, -18042, -18374,
-  -18265, -17683, -16627, -15127,
-  -13241, -11052,  -8668,  -6211,
-   -3813,  -1606,    285,   1748,
-    2696,   3066,   2830,   1993,
-     592,  -1300,  -3583,  -6136,
-   -8818, -11484, -13987, -16190,
-  -17972, -19236, -19917, -19981,
-  -19429, -18299, -16659, -14609,
-  -12270,  -9777,  -7276,  -4910,
-   -2814,  -1104,    124,    804,
-     903,    422,   -608,  -2122,
-   -4028,  -6215,  -8555, -10915,
-  -13161, -15169, -16828, -18051,
-  -18774, -18966, -18622, -17770,
-  -16465, -14785, -12829, -10708,
-   -8539,  -6439,  -4520,  -2878,
-   -1594,   -724,   -301,   -334,
-    -803,  -1669,  -2870,  -4328,
-   -5956,  -7660,  -9345, -10924,
-  -12318, -13462, -14310, -14834,
-  -15024, -14893, -14468, -13792,
-  -12921, -11917, -10847,  -9776,
-   -8765,  -7869,  -7129,  -6575,
-   -6224,  -6079,  -6129,  -6352,
-   -6716,  -7185,  -7716,  -8267,
-   -8799,  -9275,  -9668,  -9957,
-  -10132, -10191, -10142, -10000,
-   -9786,  -9526,  -9247,  -8976,
-   -8738,  -8554,  -8439,  -8401,
-   -8441,  -8553,  -8727,  -8944,
-   -9184,  -9423,  -9640,  -9812,
-   -9923,  -9959,  -9913,  -9785,
-   -9582,  -9315,  -9002,  -8666,
-   -8331,  -8022,  -7763,  -7577,
-   -7479,  -7482,  -7590,  -7800,
-   -8103,  -8483,  -8918,  -9382,
-   -9847, -10283, -10663, -10961,
-  -11158, -11240, -11199, -11037,
-  -10761, -10389,  -9941,  -9444,
-   -8929,  -8428,  -7970,  -7585,
-   -7296,  -7121,  -7072,  -7153,
-   -7366,  -7718,  -9045, -12446,
-   -3592,   4783,  12412,  19060,
-   24536,  28697,  31452,  32766,
-   32659,  31204,  28523,  24778,
-   20166,  14909,   9243,   3409,
-   -2359,  -7839, -12837, -17188,
-  -20765, -23480, -25292, -26199,
-  -26242, -25501, -24086, -22136,
-  -19806, -17264, -14679, -12215,
-  -10022,  -8233,  -6952,  -6254,
-   -6183,  -6748,  -7925,  -9659,
-  -11866, -14440, -17255, -20177,
-  -23064, -25777, -28185, -30173,
-  -31643, -32523, -32766, -32355,
-  -31300, -29639, -27438, -24781,
-  -21774, -18532, -15181, -11845,
-   -8647,  -5699,  -3099,   -928,
-     756,   1917,   2543,   2646,
-    2260,   1441,    259,  -1200,
-   -2845,  -4578,  -6305,  -7936,
-   -9391, -10603, -11525, -12124,
-  -12388, -12328, -11969, -11355,
-  -10546,  -9611,  -8627,  -7675,
-   -6834,  -6179,  -5775,  -5676,
-   -5919,  -6526,  -7499,  -8823,
-  -10462, -12368, -14474, -16704,
-  -18974, -21195, -23277, -25135,
-  -26692, -27881, -28648, -28957,
-  -28791, -28148, -27048, -25529,
-  -23643, -21457, -19049, -16507,
-  -13919, -11375,  -8964,  -6763,
-   -4844,  -3263,  -2062,  -1266,
-    -883,   -905,  -1308,  -2052,
-   -3086,  -4347,  -5766,  -7272,
-   -8791, -10254, -11595, -12760,
-  -13704, -14394, -14812, -14952,
-  -14825, -14453, -13869, -13118,
-  -12251, -11323, -10394,  -9520,
-   -8756,  -8150,  -7741,  -7560,
-   -7625,  -7943,  -8509,  -9306,
-  -10305, -11470, -12754, -14108,
-  -15477, -16806, -18042, -19135,
-  -20043, -20731, -21171, -21348,
-  -21257, -20904, -20306, -19487,
-  -18482, -17330, -16079, -14774,
-  -13464, -12196, -11014,  -9955,
-   -9051,  -8326,  -7794,  -7461,
-   -7326,  -7378,  -7597,  -7959,
-   -8434,  -8990,  -9591, -10202,
-  -10790, -11326, -11784, -12144,
-  -12392, -12522, -12534, -12434,
-  -12237, -11959, -11624, -11257,
-  -10884, -10533, -10230,  -9999,
-   -9858,  -9824,  -9905, -10106,
-  -10424, -10853, -11377, -11979,
-  -12638, -13327, -14020, -14691,
-  -15312, -15860, -16313, -16655,
-  -16871, -16957, -16908, -16730,
-  -16431, -16025, -15529, -14965,
-  -14354, -13723, -13093, -12490,
-  -11934, -11443, -11032, -10712,
-  -10488, -10361, -10329, -10385,
-  -10517, -10711, -10953, -11223,
-  -11504, -11780, -12034, -12252,
-  -12423, -12539, -12593, -12446,
-  -11290,  -2300,   6165,  13815,
-   20398,  25708,  29592,  31956,
-   32766,  32047,  29881,  26406,
-   21803,  16293,  10126,   3570,
-   -3099,  -9607, -15696, -21126,
-  -25694, -29230, -31613, -32766,
-  -32662, -31324, -28821, -25265,
-  -20807, -15629,  -9934,  -3943,
-    2118,   8024,  13564,  18542,
-   22790,  26171,  28583,  29963,
-   30288,  29576,  27883,  25298,
-   21944,  17968,  13537,   8831,
-    4033,   -673,  -5111,  -9124,
-  -12570, -15335, -17335, -18515,
-  -18854, -18362, -17083, -15085,
-  -12468,  -9347,  -5857,  -2142,
-    1647,   5363,   8861,  12011,
-   14698,  16826,  18324,  19143,
-   19264,  18691,  17457,  15615,
-   13242,  10431,   7289,   3933,
-     485,  -2934,  -6207,  -9223,
-  -11887, -14118, -15853, -17050,
-  -17686, -17762, -17298, -16335,
-  -14929, -13155, -11095,  -8843,
-   -6497,  -4154,  -1912,    140,
-    1922,   3365,   4415,   5033,
-    5197,   4904,   4166,   3013,
-    1487,   -355,  -2448,  -4716,
-   -7081,  -9463, -11782, -13964,
-  -15941, -17653, -19053, -20105,
-  -20786, -21090, -21022, -20600,
-  -19857, -18834, -17583, -16163,
-  -14635, -13066, -11519, -10057,
-   -8737,  -7611,  -6719,  -6096,
-   -5762,  -5728,  -5993,  -6545,
-   -7363,  -8415,  -9660, -11055,
-  -12548, -14087, -15619, -17092,
-  -18456, -19670, -20694, -21500,
-  -22066, -22379, -22438, -22247,
-  -21822, -21186, -20368, -19405,
-  -18335, -17201, -16048, -14918,
-  -13852, -12889, -12061, -11396,
-  -10914, -10628, -10545, -10662,
-  -10970, -11453, -12089, -12851,
-  -13708, -14624, -15566, -16497,
-  -17382, -18189, -18889, -19458,
-  -19876, -20131, -20215, -20126,
-  -19871, -19460, -18910, -18241,
-  -17479, -16650, -15784, -14911,
-  -14060, -13259, -12532, -11902,
-  -11387, -11000, -10748, -10636,
-  -10660, -10814, -11086, -11461,
-  -11919, -12439, -12996, -13568,
-  -14129, -14657, -15130, -15529,
-  -15839, -16047, -16145, -16130,
-  -16003, -15767, -15431, -15008,
-  -14512, -13960, -13373, -12768,
-  -12167, -11588, -11050, -10568,
-  -10157,  -9826,  -9584,  -9432,
-   -9373,  -9403,  -9515,  -9701,
-   -9947, -10242, -10568, -10911,
-  -11255, -11584, -11883, -12140,
-  -12344, -12488, -12566, -12575,
-  -12517, -12394, -12211, -11969,
-  -11290,  -8649,   1634,  11126,
-   19325,  25820,  30312,  32637,
-   32766,  30809,  27003,  21691,
-   15302,   8317,   1240,  -5436,
-  -11262, -15858, -18939, -20330,
-  -19974, -17933, -14383,  -9597,
-   -3926,   2224,   8422,  14239,
-   19279,  23200,  25737,  26718,
-   26073,  23836,  20140,  15207,
-    9332,   2861,  -3831, -10367,
-  -16388, -21582, -25695, -28554,
-  -30067, -30236, -29146, -26961,
-  -23909, -20268, -16344, -12447,
-   -8878,  -5900,  -3730,  -2520,
-   -2351,  -3230,  -5088,  -7792,
-  -11152, -14935, -18883, -22732,
-  -26225, -29134, -31274, -32509,
-  -32766, -32036, -30373, -27886,
-  -24737, -21123, -17263, -13386,
-   -9713,  -6443,  -3742,  -1729,
-    -475,      2,   -260,  -1176,
-   -2620,  -4433,  -6437,  -8447,
-  -10285, -11789, -12829, -13309,
-  -13177, -12428, -11099,  -9270,
-   -7055,  -4592,  -2039,    445,
-    2705,   4603,   6028,   6899,
-    7174,   6850,   5962,   4580,
-    2805,    758,  -1425,  -3607,
-   -5653,  -7447,  -8892,  -9920,
-  -10497, -10621, -10323,  -9663,
-   -8727,  -7617,  -6448,  -5333,
-   -4383,  -3693,  -3336,  -3362,
-   -3792,  -4619,  -5804,  -7287,
-   -8985, -10800, -12628, -14363,
-  -15907, -17175, -18101, -18642,
-  -18782, -18528, -17917, -17003,
-  -15861, -14579, -13249, -11965,
-  -10811,  -9863,  -9175,  -8783,
-   -8700,  -8916,  -9396, -10091,
-  -10932, -11842, -12739, -13543,
-  -14179, -14588, -14722, -14556,
-  -14084, -13323, -12307, -11090,
-   -9736,  -8320,  -6921,  -5614,
-   -4470,  -3544,  -2882,  -2507,
-   -2425,  -2624,  -3072,  -3724,
-   -4520,  -5394,  -6278,  -7104,
-   -7811,  -8349,  -8681,  -8785,
-   -8659,  -8315,  -7782,  -7103,
-   -6332,  -5527,  -4751,  -4064,
-   -3519,  -3160,  -3020,  -3115,
-   -3445,  -3998,  -4743,  -5641,
-   -6641,  -7688,  -8722,  -9689,
-  -10537, -11226, -11724, -12014,
-  -12094, -11974, -11677, -11239,
-  -10702, -10113,  -9522,  -8978,
-   -8524,  -8194,  -8015,  -7999,
-   -8149,  -8454,  -8892,  -9433,
-  -10037, -10664, -11269, -11811,
-  -12253, -12564, -12724, -12722,
-  -12557, -12242, -11795, -11245,
-  -10626,  -9976,  -9333,  -8733,
-   -8209,  -7786,  -7482,  -7306,
-   -7256,  -7324,  -7492,  -7734,
-   -8022,  -8325,  -8609,  -8842,
-   -8987,  -8649,  -9756,   3864,
-   15870,  25143,  30898,  32766,
-   30824,  25566,  17824,   8651,
-    -816,  -9506, -16540, -21332,
-  -23640, -23581, -21582, -18306,
-  -14539, -11073,  -8587,  -7556,
-   -8186, -10397, -13841, -17963,
-  -22088, -25523, -27663, -28076,
-  -26572, -23221, -18353, -12504,
-   -6341,   -575,   4143,   7309,
-    8629,   8058,   5798,   2269,
-   -1960,  -6251,  -9990, -12675,
-  -13984, -13818, -12315,  -9822,
-   -6847,  -3981,  -1810,   -830,
-   -1370,  -3545,  -7230, -12075,
-  -17545, -22991, -27733, -31152,
-  -32766, -32300, -29722, -25245,
-  -19305, -12508,  -5551,    862,
-    6103,   9695,  11368,  11079,
-    9009,   5535,   1168,  -3515,
-   -7950, -11654, -14286, -15684,
-  -15871, -15042, -13526, -11730,
-  -10074,  -8929,  -8560,  -9092,
-  -10493, -12581, -15050, -17524,
-  -19604, -20936, -21255, -20428,
-  -18475, -15565, -11995,  -8153,
-   -4460,  -1321,    933,   2086,
-    2063,    935,  -1087,  -3694,
-   -6515,  -9171, -11330, -12746,
-  -13296, -12989, -11961, -10458,
-   -8790,  -7290,  -6264,  -5947,
-   -6464,  -7818,  -9884, -12426,
-  -15130, -17643, -19624, -20790,
-  -20951, -20038, -18111, -15354,
-  -12049,  -8543,  -5201,  -2362,
-    -298,    818,    927,     92,
-   -1518,  -3654,  -6024,  -8331,
-  -10310, -11767, -12595, -12785,
-  -12424, -11672, -10740,  -9850,
-   -9208,  -8968,  -9213,  -9940,
-  -11065, -12433, -13845, -15082,
-  -15941, -16263, -15955, -15009,
-  -13496, -11564,  -9417,  -7284,
-   -5397,  -3952,  -3093,  -2887,
-   -3322,  -4308,  -5691,  -7279,
-   -8862, -10247, -11278, -11860,
-  -11966, -11640, -10986, -10156,
-   -9319,  -8643,  -8267,  -8280,
-   -8712,  -9527, -10629, -11874,
-  -13096, -14120, -14797, -15015,
-  -14722, -13927, -12703, -11175,
-   -9505,  -7870,  -6440,  -5358,
-   -4721,  -4571,  -4890,  -5606,
-   -6606,  -7749,  -8889,  -9893,
-  -10656, -11119, -11266, -11131,
-  -10787, -10331,  -9874,  -9517,
-   -9341,  -9395,  -9685, -10180,
-  -10811, -11487, -12103, -12561,
-  -12782, -12714, -12347, -11706,
-  -10856,  -9886,  -8901,  -8008,
-   -7301,  -6848,  -6686,  -6815,
-   -7197,  -7770,  -8449,  -9143,
-   -9767, -10254, -10560, -10671,
-  -10604, -10402, -10125,  -9840,
-   -9612,  -9496,  -9756,  -8654,
-    6404,  19251,  28354,  32766,
-   32244,  27262,  18900,   8642,
-   -1878, -11145, -18001, -21810,
-  -22517, -20619, -17029, -12882,
-   -9307,  -7216,  -7138,  -9138,
-  -12817, -17403, -21914, -25348,
-  -26879, -26014, -22692, -17290,
-  -10563,  -3502,   2840,   7537,
-    9951,   9841,   7399,   3205,
-   -1881,  -6889, -10909, -13261,
-  -13619, -12061,  -9054,  -5364,
-   -1905,    428,    931,   -771,
-   -4648, -10257, -16812, -23310,
-  -28701, -32064, -32766, -30567,
-  -25668, -18676, -10509,  -2251,
-    5023,  10412,  13326,  13561,
-   11318,   7147,   1841,  -3708,
-   -8662, -12373, -14479, -14946,
-  -14045, -12286, -10301,  -8714,
-   -8022,  -8498, -10141, -12681,
-  -15635, -18400, -20371, -21057,
-  -20177, -17716, -13933,  -9321,
-   -4522,   -218,   2986,   4665,
-    4643,   3019,    146,  -3438,
-   -7104, -10245, -12383, -13246,
-  -12815, -11313,  -9166,  -6914,
-   -5113,  -4228,  -4546,  -6126,
-   -8782, -12115, -15582, -18592,
-  -20605, -21229, -20286, -17844,
-  -14204,  -9855,  -5386,  -1399,
-    1597,   3255,   3446,   2266,
-      12,  -2879,  -5910,  -8613,
-  -10622, -11734, -11931, -11371,
-  -10349,  -9229,  -8371,  -8059,
-   -8448,  -9532, -11144, -12995,
-  -14720, -15955, -16402, -15886,
-  -14391, -12070,  -9215,  -6213,
-   -3480,  -1394,   -227,   -108,
-    -998,  -2703,  -4914,  -7254,
-   -9354, -10905, -11719, -11748,
-  -11092,  -9973,  -8690,  -7563,
-   -6871,  -6801,  -7415,  -8639,
-  -10276, -12041, -13615, -14698,
-  -15068, -14612, -13355, -11450,
-   -9153,  -6781,  -4659,  -3069,
-   -2200,  -2127,  -2798,  -4053,
-   -5653,  -7322,  -8803,  -9893,
-  -10479, -10551, -10200,  -9588,
-   -8922,  -8404,  -8198,  -8391,
-   -8983,  -9885, -10935, -11930,
-  -12663, -12964, -12730, -11946,
-  -10688,  -9115,  -7438,  -5890,
-   -4680,  -3968,  -3832,  -4260,
-   -5156,  -6356,  -7660,  -8863,
-   -9795, -10344, -10474, -10226,
-   -9708,  -9068,  -8472,  -8065,
-   -7948,  -8162,  -8676,  -9398,
-  -10194, -10910, -11402, -11561,
-  -11337, -10741,  -9848,  -8782,
-   -7694,  -6735,  -6036,  -5679,
-   -5691,  -6041,  -6647,  -7394,
-   -8153,  -8809,  -9276,  -9510,
-   -9517,  -9346,  -9073,  -8790,
-   -8577,  -8491,  -8545,  -8654,
-  -13419,    104,  10628,  17923,
-   22843,  26181,  28470,  30050,
-   31136,  31869,  32343,  32622,
-   32752,  32766,  32689,  32538,
-   32328,  32069,  31769,  31436,
-   31074,  30687,  30279,  29852,
-   29408,  28948,  28473,  27984,
-   27480,  26960,  26425,  25871,
-   25296,  24696,  24066,  23398,
-   22682,  21900,  21030,  20033,
-   18848,  17373,  15432,  12762,
-    9169,   5079,   1430,  -1505,
-   -4066,  -6668,  -9593, -12740,
-  -15560, -17663, -19102, -20077,
-  -20752, -21232, -21585, -21851,
-  -22060, -22230, -22376, -22511,
-  -22645, -22789, -22954, -23152,
-  -23402, -23724, -24148, -24711,
-  -25457, -26425, -27606, -28907,
-  -30151, -31179, -31929, -32415,
-  -32680, -32766, -32698, -32485,
-  -32118, -31560, -30732, -29497,
-  -27687, -25366, -23120, -21441,
-  -20295, -19485, -18867, -18349,
-  -17873, -17389, -16848, -16189,
-  -15337, -14254, -13063, -12030,
-  -11290, -10804, -10490, -10288,
-  -10159, -10079, -10033, -10012,
-  -10010, -10023, -10047, -10080,
-  -10122, -10170, -10226, -10288,
-  -10358, -10435, -10521, -10618,
-  -10728, -10856, -11008, -11194,
-  -11430, -11741, -12173, -12803,
-  -13745, -15064, -16526, -17697,
-  -18454, -18906, -19167, -19306,
-  -19362, -19355, -19296, -19186,
-  -19024, -18802, -18507, -18125,
-  -17650, -17104, -16564, -16148,
-  -15936, -15881, -15863, -15818,
-  -15745, -15659, -15569, -15480,
-  -15394, -15310, -15229, -15149,
-  -15069, -14989, -14907, -14822,
-  -14731, -14632, -14521, -14392,
-  -14237, -14043, -13786, -13428,
-  -12904, -12142, -11186, -10297,
-   -9670,  -9274,  -9028,  -8873,
-   -8775,  -8713,  -8676,  -8656,
-   -8649,  -8651,  -8660,  -8674,
-   -8691,  -8711,  -8732,  -8754,
-   -8774,  -8791,  -8801,  -8802,
-   -8787,  -8745,  -8666,  -8555,
-   -8444,  -8375,  -8357,  -8377,
-   -8423,  -8489,  -8570,  -8664,
-   -8770,  -8889,  -9022,  -9174,
-   -9350,  -9558,  -9812, -10134,
-  -10562, -11148, -11919, -12778,
-  -13557, -14196, -14702, -15088,
-  -15371, -15576, -15721, -15822,
-  -15893, -15939, -15967, -15982,
-  -15985, -15980, -15967, -15948,
-  -15924, -15895, -15862, -15825,
-  -15785, -15740, -15693, -15642,
-  -15587, -15528, -15465, -15398,
-  -15324, -15239, -15123, -14922,
-  -13419,  -6800,  11212,  21398,
-   26634,  29472,  31082,  32001,
-   32501,  32727,  32766,  32669,
-   32470,  32189,  31839,  31427,
-   30954,  30413,  29792,  29060,
-   28160,  26961,  25145,  21835,
-   15776,  10227,   7318,   5558,
-    4157,   2755,   1058,  -1368,
-   -5216, -10497, -15199, -18841,
-  -22526, -26542, -29678, -31471,
-  -32369, -32742, -32766, -32496,
-  -31878, -30662, -28092, -23287,
-  -19282, -17389, -16413, -15806,
-  -15369, -15018, -14711, -14426,
-  -14145, -13856, -13543, -13186,
-  -12752, -12179, -11344,  -9985,
-   -7746,  -5110,  -3390,  -2688,
-   -2809,  -4145,  -7033,  -8471,
-   -7483,  -5526,  -4019,  -3160,
-   -2686,  -2418,  -2263,  -2176,
-   -2131,  -2113,  -2111,  -2120,
-   -2132,  -2143,  -2146,  -2129,
-   -2076,  -1951,  -1674,  -1029,
-     569,   3389,   5015,   4974,
-    3862,   2526,   1657,   1144,
-     792,    502,    220,    -93,
-    -484,  -1022,  -1837,  -3147,
-   -5020,  -6828,  -8043,  -8823,
-   -9415, -10018, -10893, -12602,
-  -15258, -16941, -17633, -17913,
-  -18008, -17999, -17921, -17783,
-  -17579, -17284, -16829, -16093,
-  -15075, -14204, -13660, -13304,
-  -13028, -12775, -12506, -12176,
-  -11707, -10912,  -9324,  -6997,
-   -5456,  -4511,  -3613,  -2443,
-   -1045,     58,    696,   1034,
-    1206,   1281,   1296,   1267,
-    1204,   1110,    985,    821,
-     602,    293,   -181,   -951,
-   -2094,  -3735,  -5661,  -6752,
-   -7257,  -7523,  -7682,  -7786,
-   -7859,  -7915,  -7961,  -8005,
-   -8051,  -8107,  -8179,  -8283,
-   -8444,  -8713,  -9180,  -9925,
-  -10724, -11196, -11289, -10984,
-  -10040,  -8767,  -8077,  -7751,
-   -7550,  -7374,  -7157,  -6855,
-   -6556,  -6374,  -6281,  -6233,
-   -6211,  -6203,  -6206,  -6217,
-   -6236,  -6265,  -6307,  -6370,
-   -6472,  -6653,  -7029,  -7844,
-   -8787,  -9224,  -9359,  -9352,
-   -9241,  -9008,  -8591,  -7987,
-   -7425,  -7072,  -6878,  -6772,
-   -6723,  -6722,  -6780,  -6891,
-   -6978,  -6999,  -6971,  -6895,
-   -6747,  -6435,  -5783,  -5094,
-   -4775,  -4649,  -4600,  -4588,
-   -4596,  -4616,  -4646,  -4682,
-   -4724,  -4772,  -4826,  -4888,
-   -4957,  -5039,  -5136,  -5259,
-   -5424,  -5661,  -6011,  -6453,
-   -6901,  -7406,  -7768,  -7838,
-   -7755,  -6800,  -4958,  17269,
-   26188,  29871,  31586,  32400,
-   32731,  32766,  32598,  32270,
-   31790,  31130,  30191,  28660,
-   25278,  16637,  10620,   8202,
-    6502,   4629,   1743,  -3947,
-  -12732, -21579, -28476, -31535,
-  -32651, -32766, -31907, -28679,
-  -21087, -17427, -16163, -15512,
-  -15065, -14695, -14346, -13983,
-  -13573, -13063, -12349, -11160,
-   -8709,  -4497,  -3828,  -6833,
-   -4582,  -1048,    672,   1422,
-    1784,   1970,   2067,   2122,
-    2166,   2232,   2380,   2755,
-    3880,   7880,  12417,  13369,
-   12969,  11401,   7773,   3838,
-    1733,    269,  -1510,  -4493,
-   -7535,  -9205, -10392, -12203,
-  -16875, -20392, -21375, -21657,
-  -21678, -21559, -21336, -21009,
-  -20543, -19834, -18591, -16014,
-  -12170,  -9477,  -6703,  -1606,
-    1408,   3115,   5231,   7245,
-    8176,   8531,   8634,   8603,
-    8478,   8270,   7957,   7470,
-    6568,   4235,    -74,  -2319,
-   -4272,  -7242,  -9472, -10453,
-  -10939, -11237, -11475, -11753,
-  -12243, -13246, -14177, -14008,
-  -11900,  -8869,  -7848,  -7447,
-   -7209,  -7016,  -6815,  -6554,
-   -6138,  -5305,  -3467,  -1445,
-    -614,   -493,  -1066,  -3403,
-   -5502,  -6020,  -6052,  -5771,
-   -5035,  -4198,  -3796,  -3629,
-   -3551,  -3507,  -3470,  -3406,
-   -3233,  -2591,   -643,   -339,
-   -1783,  -2725,  -3129,  -3343,
-   -3485,  -3601,  -3711,  -3833,
-   -3989,  -4222,  -4643,  -5511,
-   -7123,  -9617, -10668, -10960,
-  -11017, -10952, -10776, -10427,
-   -9676,  -8194,  -6962,  -6384,
-   -6044,  -5736,  -5265,  -4020,
-   -2153,  -1489,  -1249,  -1124,
-   -1024,   -876,   -577,   -251,
-    -144,   -177,   -297,   -515,
-    -909,  -1766,  -4020,  -6505,
-   -7460,  -7838,  -8013,  -8099,
-   -8139,  -8151,  -8144,  -8122,
-   -8085,  -8029,  -7944,  -7791,
-   -7406,  -6293,  -5597,  -5395,
-   -5261,  -5104,  -4842,  -4273,
-   -3341,  -2786,  -2580,  -2512,
-   -2516,  -2580,  -2748,  -3239,
-   -4394,  -4959,  -5131,  -5199,
-   -5227,  -5233,  -5220,  -5176,
-   -5067,  -4943,  -4917,  -4985,
-   -5203,  -5662,  -5690,  -5019,
-   -4787,  -4733,  -4720,  -4721,
-   -4727,  -4737,  -4749,  -4763,
-   -4782,  -4807,  -4844,  -4908,
-   -5053,  -5494,  -5995,  -6115,
-   -6081,  -5877,  -4958,  -4581,
-   20748,  28470,  31243,  32371,
-   32766,  32751,  32444,  31855,
-   30839,  28716,  21245,  11692,
-    8677,   6405,   2673,  -5928,
-  -14006, -22443, -30236, -32766,
-  -32573, -27670, -19020, -16867,
-  -16081, -15588, -15154, -14675,
-  -14033, -12932, -10222,  -4163,
-   -3848, -10147,  -9955,  -5529,
-     122,   2356,   3196,   3587,
-    3831,   4105,   4746,   7505,
-   14818,  15983,  13416,   7473,
-    4563,   3321,   2417,   1382,
-    -373,  -4467, -11310, -20343,
-  -23493, -24270, -24394, -24172,
-  -23597, -22332, -18882, -13491,
-  -10836,  -8140,  -1230,   1922,
-    2942,   3645,   4609,   6845,
-   10055,  11258,  11346,  10767,
-    8870,   2179,  -4183,  -8883,
-  -10533, -11172, -11469, -11608,
-  -11647, -11590, -11356, -10481,
-   -6385,  -4616,  -6270,  -6951,
-   -6794,  -5775,  -2561,    319,
-    1120,   1168,    462,  -3195,
-   -6518,  -7195,  -7371,  -7389,
-   -7318,  -7149,  -6777,  -5798,
-   -4109,  -3670,  -3542,  -2083,
-   -1947,  -1968,  -2017,  -2080,
-   -2157,  -2257,  -2401,  -2646,
-   -3219,  -5517,  -8978,  -9715,
-   -9774,  -9298,  -7796,  -6986,
-   -6688,  -6480,  -6229,  -5738,
-   -3954,   -563,    288,    508,
-     556,    518,    402,    171,
-    -332,  -1744,  -4407,  -6331,
-   -8866,  -9326,  -9427,  -9452,
-   -9438,  -9395,  -9321,  -9205,
-   -9015,  -8641,  -7505,  -4403,
-   -2973,  -1360,    697,   1381,
-    1480,   1211,    467,   -113,
-    -532,  -1398,  -4022,  -5112,
-   -5418,  -5574,  -5709,  -5903,
-   -6348,  -7692,  -9123,  -9406,
-   -8950,  -6767,  -5591,  -5118,
-   -4521,  -4110,  -3960,  -3900,
-   -3878,  -3882,  -3935,  -4195,
-   -5530,  -5332,  -4468,  -4205,
-   -4112,  -4073,  -4056,  -4052,
-   -4058,  -4091,  -4109,  -2959,
-   -1897,  -1743,  -1786,  -1970,
-   -2482,  -3756,  -4574,  -4875,
-   -5072,  -5379,  -6517,  -7717,
-   -7948,  -7978,  -7927,  -7792,
-   -7494,  -7187,  -6960,  -6647,
-   -5911,  -3986,  -2285,  -1860,
-   -1729,  -1691,  -1696,  -1727,
-   -1780,  -1856,  -1973,  -2192,
-   -2884,  -4088,  -4588,  -4981,
-   -5537,  -6369,  -6683,  -6757,
-   -6750,  -6689,  -6550,  -6101,
-   -5160,  -4890,  -4801,  -4750,
-   -4709,  -4663,  -4594,  -4453,
-   -4068,  -3666,  -3821,  -4581,
-   -3910,  22828,  29617,  31842,
-   32630,  32766,  32490,  31808,
-   30367,  25500,  13226,   9566,
-    7273,   3617,  -6408, -21957,
-  -30712, -32766, -31601, -21897,
-  -17039, -15964, -15434, -15016,
-  -14589, -14069, -13325, -11988,
-  -10518, -10162,  -2418,   2693,
-    4250,   4875,   5210,   5508,
-    6089,   8542,  17419,  19453,
-   19089,  17209,  11220,   5071,
-     877,  -6311, -11272, -19359,
-  -24583, -25542, -25716, -25578,
-  -25218, -24595, -23483, -20940,
-  -12172,    -56,   3480,   6550,
-   11754,  14057,  14618,  14584,
-   14070,  12226,   4906,   1940,
-     747,   -901,  -5433,  -9475,
-  -10776, -11545, -12794, -12004,
-   -8831,  -8423,  -8285,  -8172,
-   -8038,  -7850,  -7534,  -6792,
-   -5042,  -7528,  -7771,  -7459,
-   -6793,  -4945,  -2001,   -856,
-    -248,    866,   5913,   8244,
-    8273,   7284,   3803,    720,
-    -341,  -1035,  -2026,  -5544,
-  -11407, -14260, -15090, -15274,
-  -15200, -14932, -14370, -13002,
-   -8536,  -1171,    976,   1627,
-    1949,   2201,   2612,   3843,
-    5047,   4717,   1201,  -1448,
-   -2233,  -3228,  -5976,  -8208,
-   -8795,  -8906,  -8660,  -6997,
-   -3486,  -3129,  -4074,  -5003,
-   -5218,  -5216,  -5067,  -4573,
-   -3036,  -4645,  -5399,  -5443,
-   -5398,  -5319,  -5199,  -4989,
-   -4504,  -3122,   -196,   2236,
-    2457,   1924,   -148,  -1844,
-   -2387,  -2695,  -3065,  -4212,
-   -7245,  -7992,  -8245,  -8545,
-   -9260,  -9573,  -9392,  -8671,
-   -6308,  -2352,   -660,   -260,
-    -116,    -66,    -66,   -107,
-    -202,   -444,  -1655,  -3235,
-   -3505,  -4033,  -5631,  -6835,
-   -7136,  -7182,  -7058,  -6433,
-   -4170,  -3518,  -3376,  -3341,
-   -3367,  -3534,  -3895,  -3768,
-   -2772,  -3415,  -4335,  -4445,
-   -4458,  -4446,  -4421,  -4381,
-   -4307,  -4128,  -3321,  -1618,
-   -1230,  -1184,  -2224,  -3068,
-   -3326,  -3466,  -3620,  -4019,
-   -5622,  -6218,  -6324,  -6335,
-   -6305,  -6239,  -6123,  -5879,
-   -4922,  -3295,  -2084,  -1847,
-   -1781,  -1771,  -1789,  -1831,
-   -1904,  -2046,  -2528,  -3811,
-   -4183,  -4470,  -5153,  -5541,
-   -5616,  -5605,  -5535,  -5319,
-   -4361,  -3868,  -3770,  -3734,
-   -3713,  -3692,  -3652,  -3527,
-   -3127,  -3301,  -3900,  -3983,
-   -3910,  -4171,  23663,  30104,
-   32119,  32764,  32766,  32309,
-   31241,  28161,  15285,   9873,
-    7171,   2204, -10999, -20195,
-  -29535, -32766, -29513, -18850,
-  -16789, -16116, -15651, -15162,
-  -14482, -13169,  -8975,  -7059,
-  -10499,  -9080,  -3584,   2466,
-    4335,   5101,   5780,   7784,
-   17205,  19629,  18291,  11774,
-    5931,   4132,   2909,   1006,
-   -5508, -20489, -25083, -26217,
-  -26394, -26061, -25104, -22328,
-  -14638,  -5144,    903,   2178,
-    2768,   3323,   4437,   8141,
-   12356,  11761,   3941,    833,
-   -2630,  -7595,  -8956,  -9282,
-   -9229,  -8696,  -5573,    868,
-    1470,      9,  -4586,  -6830,
-   -6691,  -3671,  -1987,  -6839,
-  -10496, -11037, -11146, -11108,
-  -10960, -10652,  -9964,  -7694,
-    1109,   5495,   3684,   2842,
-    2651,   2513,   2285,   1717,
-   -1077,  -6246,  -7137,  -7373,
-   -7446,  -7408,  -6920,  -7877,
-   -8577,  -4515,  -1842,  -1463,
-   -1399,  -1434,  -1533,  -1720,
-   -2126,  -3571,  -9002, -12021,
-  -12986, -11269,  -8222,  -7122,
-   -6585,  -5946,  -3487,    526,
-    1251,   1508,   1737,   2383,
-    3969,   4208,   3324,  -1288,
-   -6143,  -8302,  -8947,  -9188,
-   -9273,  -9259,  -9102,  -8260,
-   -5274,  -5489,  -5515,  -5424,
-   -5239,  -4814,  -3438,  -1347,
-   -2427,  -5065,  -5362,  -5306,
-   -4979,  -3877,  -3164,  -2866,
-   -2321,    562,   1936,   1910,
-    1258,   -800,  -2336,  -2925,
-   -3450,  -4854,  -8837,  -9848,
-  -10065, -10095, -10039,  -9911,
-   -9680,  -9182,  -7175,  -3879,
-   -1583,   -652,    115,    779,
-     897,    804,    352,  -2011,
-   -3144,  -3397,  -3533,  -3664,
-   -3863,  -4341,  -5788,  -6748,
-   -5086,  -4782,  -4744,  -4741,
-   -4750,  -4771,  -4828,  -5024,
-   -6264,  -7743,  -7800,  -7387,
-   -6220,  -4667,  -4036,  -3742,
-   -3315,  -1500,   -746,   -632,
-    -633,   -686,   -788,   -982,
-   -1478,  -2483,  -4557,  -5908,
-   -6849,  -7109,  -7176,  -7164,
-   -7089,  -6880,  -5836,  -4693,
-   -4405,  -4062,  -3878,  -3785,
-   -3655,  -3282,  -2610,  -3507,
-   -3887,  -3940,  -3956,  -3967,
-   -3987,  -4063,  -4172,  -3832,
-   -2796,  -2654,  -2709,  -2906,
-   -3494,  -4061,  -4256,  -4412,
-   -5015,  -5520,  -5438,  -5279,
-   -5118,  -4171, -10436,  22165,
-   29636,  32008,  32766,  32748,
-   32150,  30710,  26153,   9940,
-    2899, -10235, -22328, -25013,
-  -25890, -26192, -25863, -19985,
-  -17048, -20558, -21142, -19398,
-   -9750,   -611,    487,  -1999,
-  -14619, -18300, -19124, -19472,
-  -19715, -20077, -21272, -27795,
-  -27462, -16556,  -8739,  -4415,
-   -2846,  -2171,  -1899,  -2026,
-   -3665, -12811,  -9211,  -3304,
-   -2217,  -1966,  -1913,  -1844,
-   -1331,   3336,  10083,   7403,
-     414,  -8331, -14979, -16812,
-  -17903, -19997, -29217, -32379,
-  -32766, -32563, -31939, -30427,
-  -24929, -19233, -13536,  -5026,
-   -2379,   1387,   6099,   7849,
-    8149,   7597,   5186,  -6674,
-  -13561, -14928, -15334, -15438,
-  -15380, -15145, -14474, -11064,
-   -4250,  -2846,   -448,   -734,
-   -3806,  -5174,  -6058,  -7564,
-  -14224, -17317, -18012, -18421,
-  -19094, -21835, -24122, -23972,
-  -21277, -15057, -13633, -12723,
-  -11191,  -7762,  -4963,  -3714,
-   -1891,  -4911,  -7142,  -7460,
-   -7558,  -7601,  -7610,  -7556,
-   -7283,  -5483,   -814,  -2027,
-   -3877,  -4775,  -6332,  -9500,
-  -11653, -13075, -17668, -20287,
-  -20607, -20325, -18651, -17103,
-  -16611, -16098, -14373,  -9683,
-   -8678,  -8347,  -8092,  -7689,
-   -6675,  -5666,  -6168,  -9475,
-  -11741, -12045, -12089, -12053,
-  -11962, -11789, -11400,  -9885,
-   -4822,  -3073,  -2798,  -2866,
-   -3153,  -3808,  -5473,  -8125,
-  -11916, -14566, -15302, -16410,
-  -17252, -17377, -17306, -17042,
-  -16011, -12562, -11700, -11416,
-  -11199, -10872,  -9895,  -8818,
-   -7640,  -8217,  -9616,  -9702,
-   -9692,  -9674,  -9657,  -9635,
-   -9607,  -9508,  -7229,  -6669,
-   -6603,  -6641,  -6740,  -6917,
-   -7257,  -8094, -11120, -13966,
-  -14136, -13935, -13925, -13903,
-  -13839, -13680, -13095, -10744,
-  -10103,  -9987, -10022, -10402,
-  -10713, -10752, -10785, -11553,
-  -11944, -11384, -11150, -11021,
-  -10910, -10746, -10274,  -9567,
-   -7644,  -7090,  -7011,  -7028,
-   -7091,  -7194,  -7360,  -7690,
-   -8928, -11045, -12420, -13009,
-  -13190, -13233, -13205, -13102,
-  -12768, -11318, -10812, -10657,
-  -10415, -10240, -10206, -10214,
-  -10289, -10828, -11637, -11353,
-  -10755, -10499, -10426, -10490,
-  -10513, -10373, -10436,  -5333,
-   22790,  29483,  31832,  32678,
-   32766,  32275,  30978,  27191,
-   11007,  -9066, -17031, -18674,
-  -19078, -18983, -18485, -17247,
-  -12516,    567,   7496,  21480,
-   24871,  25158,  24487,  22943,
-   19613,   8618,  -5114, -11001,
-  -19197, -30109, -32334, -32766,
-  -32384, -30448, -20514, -15778,
-  -14289, -12290,  -4160,   1761,
-    2603,   2221,   -691, -10332,
-  -12560, -13217, -13809, -15638,
-  -23372, -25446, -23990, -16884,
-   -6112,  -1682,    431,   1633,
-    2746,   5671,  12362,  12627,
-    5587,   1779,   1039,    705,
-     445,    126,   -569,  -3982,
-   -6676,    103,   1690,   1937,
-    1930,   1812,   1601,   1280,
-     908,    601,  -5174,  -8594,
-  -10470, -11358, -11800, -12005,
-  -12002, -11455,  -7218,  -8214,
-   -8974,  -9080,  -9100,  -9117,
-   -9181,  -9429, -10729, -16339,
-  -16164, -12940, -12203, -11871,
-  -11547, -11084, -10182,  -6931,
-    -656,   2001,   1708,    463,
-     484,    514,    385,   -253,
-   -4284,  -7173,  -7458,  -6989,
-   -4467,  -3288,  -2968,  -2644,
-   -1577,   3111,   4459,   4569,
-    4330,   3418,    931,     -4,
-    -807,  -3136,  -8096, -10363,
-  -12203, -13103, -13291, -12373,
-  -10657,  -9879,  -6836,  -4232,
-   -3833,  -3755,  -3789,  -3922,
-   -4289,  -5829,  -7557, -11359,
-  -12642, -12834, -12812, -12691,
-  -12477, -12110, -11275,  -8342,
-   -4037,  -2351,   -773,    270,
-     721,    864,    791,    345,
-   -2235,  -5556,  -6153,  -6301,
-   -6333,  -6308,  -6230,  -6046,
-   -5448,  -2574,   -868,     45,
-     182,    152,     44,   -146,
-    -502,  -1609,  -4570,  -5824,
-   -7647,  -9053,  -9628,  -9843,
-   -9863,  -9639,  -8165,  -6317,
-   -5969,  -5690,  -4993,  -4803,
-   -4805,  -4905,  -5282,  -7289,
-   -8221,  -8385,  -8457,  -8683,
-   -9119,  -9092,  -8880,  -8163,
-   -6006,  -5240,  -4545,  -3698,
-   -3112,  -2558,  -2201,  -2280,
-   -3232,  -4664,  -4896,  -4963,
-   -4992,  -5015,  -5072,  -5359,
-   -5268,  -3925,  -3199,  -3098,
-   -3094,  -3121,  -3169,  -3232,
-   -3286,  -3446,  -4859,  -5354,
-   -5723,  -6251,  -6699,  -6903,
-   -6963,  -6913,  -6470,  -5672,
-   -5547,  -5516,  -5506,  -5506,
-   -5516,  -5547,  -5658,  -6324,
-   -6576,  -6460,  -6310,  -5333,
-       0,  11679,  18132,  23016,
-   26729,  29423,  31203,  32176,
-   32466,  32218,  31595,  30770,
-   29913,  29175,  28673,  28474,
-   28591,  28986,  29579,  30272,
-   30962,  31561,  32003,  32251,
-   32300,  32172,  31912,  31583,
-   31253,  30984,  30827,  30811,
-   30939,  31192,  31529,  31899,
-   32248,  32530,  32709,  32766,
-   32702,  32536,  32297,  32029,
-   31773,  31569,  31447,  31419,
-   31483,  31620,  31800,  31985,
-   32139,  32228,  32232,  32142,
-   31963,  31712,  31417,  31110,
-   30825,  30589,  30422,  30328,
-   30300,  30319,  30359,  30388,
-   30376,  30301,  30147,  29912,
-   29604,  29243,  28853,  28465,
-   28105,  27796,  27548,  27364,
-   27231,  27129,  27033,  26912,
-   26743,  26507,  26194,  25805,
-   25354,  24860,  24349,  23850,
-   23387,  22978,  22630,  22341,
-   22094,  21866,  21630,  21358,
-   21024,  20615,  20123,  19555,
-   18925,  18258,  17582,  16927,
-   16318,  15771,  15290,  14866,
-   14479,  14099,  13692,  13224,
-   12668,  12007,  11232,  10349,
-    9374,   8329,   7246,   6152,
-    5072,   4015,   2961,   1828,
-       0,  -1828,  -2961,  -4015,
-   -5072,  -6152,  -7246,  -8329,
-   -9374, -10349, -11232, -12007,
-  -12668, -13224, -13692, -14099,
-  -14479, -14866, -15290, -15771,
-  -16318, -16927, -17582, -18258,
-  -18925, -19555, -20123, -20615,
-  -21024, -21358, -21630, -21866,
-  -22094, -22341, -22630, -22978,
-  -23387, -23850, -24349, -24860,
-  -25354, -25805, -26194, -26507,
-  -26743, -26912, -27033, -27129,
-  -27231, -27364, -27548, -27796,
-  -28105, -28465, -28853, -29243,
-  -29604, -29912, -30147, -30301,
-  -30376, -30388, -30359, -30319,
-  -30300, -30328, -30422, -30589,
-  -30825, -31110, -31417, -31712,
-  -31963, -32142, -32232, -32228,
-  -32139, -31985, -31800, -31620,
-  -31483, -31419, -31447, -31569,
-  -31773, -32029, -32297, -32536,
-  -32702, -32766, -32709, -32530,
-  -32248, -31899, -31529, -31192,
-  -30939, -30811, -30827, -30984,
-  -31253, -31583, -31912, -32172,
-  -32300, -32251, -32003, -31561,
-  -30962, -30272, -29579, -28986,
-  -28591, -28474, -28673, -29175,
-  -29913, -30770, -31595, -32218,
-  -32466, -32176, -31203, -29423,
-  -26729, -23016, -18132, -11679,
-       0,      0,   3063,   8415,
-   14556,  20523,  25589,  29287,
-   31427,  32081,  31520,  30138,
-   28361,  26579,  25097,  24115,
-   23732,  23957,  24724,  25902,
-   27317,  28769,  30063,  31039,
-   31595,  31705,  31416,  30838,
-   30113,  29393,  28816,  28482,
-   28448,  28721,  29262,  29993,
-   30808,  31589,  32226,  32634,
-   32766,  32620,  32239,  31699,
-   31096,  30529,  30082,  29814,
-   29754,  29893,  30193,  30589,
-   31000,  31343,  31544,  31553,
-   31351,  30950,  30395,  29749,
-   29086,  28477,  27980,  27628,
-   27432,  27375,  27416,  27498,
-   27558,  27534,  27376,  27058,
-   26576,  25952,  25230,  24465,
-   23715,  23032,  22454,  21997,
-   21660,  21419,  21236,  21063,
-   20848,  20548,  20133,  19591,
-   18930,  18178,  17374,  16565,
-   15795,  15099,  14500,  14001,
-   13593,  13250,  12939,  12620,
-   12258,  11823,  11300,  10691,
-   10009,   9284,   8550,   7840,
-    7185,   6605,   6107,   5688,
-    5332,   5019,   4721,   4414,
-    4075,   3692,   3264,   2800,
-    2320,   1848,   1409,   1023,
-     702,    451,    264,    131,
-      43,      0,    -43,   -131,
-    -264,   -451,   -702,  -1023,
-   -1409,  -1848,  -2320,  -2800,
-   -3264,  -3692,  -4075,  -4414,
-   -4721,  -5019,  -5332,  -5688,
-   -6107,  -6605,  -7185,  -7840,
-   -8550,  -9284, -10009, -10691,
-  -11300, -11823, -12258, -12620,
-  -12939, -13250, -13593, -14001,
-  -14500, -15099, -15795, -16565,
-  -17374, -18178, -18930, -19591,
-  -20133, -20548, -20848, -21063,
-  -21236, -21419, -21660, -21997,
-  -22454, -23032, -23715, -24465,
-  -25230, -25952, -26576, -27058,
-  -27376, -27534, -27558, -27498,
-  -27416, -27375, -27432, -27628,
-  -27980, -28477, -29086, -29749,
-  -30395, -30950, -31351, -31553,
-  -31544, -31343, -31000, -30589,
-  -30193, -29893, -29754, -29814,
-  -30082, -30529, -31096, -31699,
-  -32239, -32620, -32766, -32634,
-  -32226, -31589, -30808, -29993,
-  -29262, -28721, -28448, -28482,
-  -28816, -29393, -30113, -30838,
-  -31416, -31705, -31595, -31039,
-  -30063, -28769, -27317, -25902,
-  -24724, -23957, -23732, -24115,
-  -25097, -26579, -28361, -30138,
-  -31520, -32081, -31427, -29287,
-  -25589, -20523, -14556,  -8415,
-   -3063,      0,      0,    142,
-    1442,   5080,  11185,  18567,
-   25317,  29771,  31213,  29975,
-   27040,  23517,  20260,  17757,
-   16202,  15617,  15959,  17157,
-   19093,  21574,  24301,  26886,
-   28933,  30137,  30379,  29748,
-   28504,  26988,  25530,  24392,
-   23747,  23682,  24207,  25268,
-   26742,  28440,  30124,  31539,
-   32464,  32766,  32432,  31568,
-   30367,  29057,  27853,  26924,
-   26377,  26254,  26538,  27154,
-   27979,  28850,  29587,  30025,
-   30046,  29605,  28743,  27572,
-   26244,  24921,  23739,  22796,
-   22144,  21785,  21680,  21754,
-   21905,  22015,  21970,  21683,
-   21108,  20253,  19178,  17975,
-   16747,  15591,  14579,  13751,
-   13117,  12660,  12339,  12098,
-   11872,  11596,  11217,  10703,
-   10052,   9290,   8463,   7628,
-    6837,   6129,   5526,   5035,
-    4646,   4341,   4093,   3876,
-    3660,   3423,   3150,   2840,
-    2500,   2149,   1808,   1496,
-    1226,   1003,    827,    691,
-     587,    506,    440,    382,
-     328,    273,    217,    164,
-     115,     75,     44,     24,
-      11,      5,      2,      1,
-       0,      0,      0,      0,
-       0,     -1,     -2,     -5,
-     -11,    -24,    -44,    -75,
-    -115,   -164,   -217,   -273,
-    -328,   -382,   -440,   -506,
-    -587,   -691,   -827,  -1003,
-   -1226,  -1496,  -1808,  -2149,
-   -2500,  -2840,  -3150,  -3423,
-   -3660,  -3876,  -4093,  -4341,
-   -4646,  -5035,  -5526,  -6129,
-   -6837,  -7628,  -8463,  -9290,
-  -10052, -10703, -11217, -11596,
-  -11872, -12098, -12339, -12660,
-  -13117, -13751, -14579, -15591,
-  -16747, -17975, -19178, -20253,
-  -21108, -21683, -21970, -22015,
-  -21905, -21754, -21680, -21785,
-  -22144, -22796, -23739, -24921,
-  -26244, -27572, -28743, -29605,
-  -30046, -30025, -29587, -28850,
-  -27979, -27154, -26538, -26254,
-  -26377, -26924, -27853, -29057,
-  -30367, -31568, -32432, -32766,
-  -32464, -31539, -30124, -28440,
-  -26742, -25268, -24207, -23682,
-  -23747, -24392, -25530, -26988,
-  -28504, -29748, -30379, -30137,
-  -28933, -26886, -24301, -21574,
-  -19093, -17157, -15959, -15617,
-  -16202, -17757, -20260, -23517,
-  -27040, -29975, -31213, -29771,
-  -25317, -18567, -11185,  -5080,
-   -1442,   -142,      0,      0,
-       0,     25,    452,   2773,
-    8886,  18118,  26290,  29308,
-   26704,  21076,  15294,  10858,
-    8021,   6497,   5971,   6276,
-    7411,   9475,  12545,  16490,
-   20801,  24620,  27039,  27539,
-   26243,  23790,  20982,  18469,
-   16632,  15639,  15540,  16344,
-   18036,  20545,  23667,  27012,
-   30016,  32077,  32766,  32003,
-   30078,  27514,  24863,  22559,
-   20868,  19907,  19695,  20188,
-   21281,  22796,  24459,  25919,
-   26808,  26850,  25954,  24251,
-   22041,  19678,  17472,  15626,
-   14238,  13319,  12828,  12687,
-   12787,  12991,  13141,  13080,
-   12690,  11930,  10850,   9572,
-    8248,   7011,   5949,   5098,
-    4458,   4000,   3686,   3475,
-    3321,   3181,   3013,   2792,
-    2507,   2170,   1811,   1462,
-    1151,    895,    696,    549,
-     443,    368,    315,    275,
-     243,    213,    183,    151,
-     119,     89,     63,     42,
-      27,     17,     11,      7,
-       5,      3,      2,      2,
-       1,      1,      1,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-      -1,     -1,     -1,     -2,
-      -2,     -3,     -5,     -7,
-     -11,    -17,    -27,    -42,
-     -63,    -89,   -119,   -151,
-    -183,   -213,   -243,   -275,
-    -315,   -368,   -443,   -549,
-    -696,   -895,  -1151,  -1462,
-   -1811,  -2170,  -2507,  -2792,
-   -3013,  -3181,  -3321,  -3475,
-   -3686,  -4000,  -4458,  -5098,
-   -5949,  -7011,  -8248,  -9572,
-  -10850, -11930, -12690, -13080,
-  -13141, -12991, -12787, -12687,
-  -12828, -13319, -14238, -15626,
-  -17472, -19678, -22041, -24251,
-  -25954, -26850, -26808, -25919,
-  -24459, -22796, -21281, -20188,
-  -19695, -19907, -20868, -22559,
-  -24863, -27514, -30078, -32003,
-  -32766, -32077, -30016, -27012,
-  -23667, -20545, -18036, -16344,
-  -15540, -15639, -16632, -18469,
-  -20982, -23790, -26243, -27539,
-  -27039, -24620, -20801, -16490,
-  -12545,  -9475,  -7411,  -6276,
-   -5971,  -6497,  -8021, -10858,
-  -15294, -21076, -26704, -29308,
-  -26290, -18118,  -8886,  -2773,
-    -452,    -25,      0,      0,
-       0,      0,      0,      2,
-     113,   1635,   8400,  19758,
-   25360,  20480,  11890,   5691,
-    2591,   1292,    796,    656,
-     735,   1077,   1894,   3610,
-    6766,  11537,  16992,  21073,
-   21979,  19675,  15705,  11769,
-    8778,   6901,   5991,   5904,
-    6629,   8313,  11213,  15519,
-   21026,  26789,  31204,  32766,
-   31040,  26917,  21934,  17379,
-   13900,  11622,  10429,  10175,
-   10770,  12157,  14237,  16737,
-   19121,  20663,  20737,  19181,
-   16413,  13177,  10155,   7728,
-    5979,   4829,   4142,   3800,
-    3705,   3772,   3912,   4017,
-    3974,   3707,   3217,   2586,
-    1939,   1377,    948,    650,
-     456,    335,    261,    217,
-     189,    170,    154,    136,
-     114,     89,     64,     42,
-      26,     15,      8,      5,
-       3,      2,      1,      1,
-       1,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-      -1,     -1,     -1,     -2,
-      -3,     -5,     -8,    -15,
-     -26,    -42,    -64,    -89,
-    -114,   -136,   -154,   -170,
-    -189,   -217,   -261,   -335,
-    -456,   -650,   -948,  -1377,
-   -1939,  -2586,  -3217,  -3707,
-   -3974,  -4017,  -3912,  -3772,
-   -3705,  -3800,  -4142,  -4829,
-   -5979,  -7728, -10155, -13177,
-  -16413, -19181, -20737, -20663,
-  -19121, -16737, -14237, -12157,
-  -10770, -10175, -10429, -11622,
-  -13900, -17379, -21934, -26917,
-  -31040, -32766, -31204, -26789,
-  -21026, -15519, -11213,  -8313,
-   -6629,  -5904,  -5991,  -6901,
-   -8778, -11769, -15705, -19675,
-  -21979, -21073, -16992, -11537,
-   -6766,  -3610,  -1894,  -1077,
-    -735,   -656,   -796,  -1292,
-   -2591,  -5691, -11890, -20480,
-  -25360, -19758,  -8400,  -1635,
-    -113,     -2,      0,      0,
-       0,      0,      0,      0,
-       0,      0,     33,   1436,
-   10250,  18189,  11131,   3192,
-     587,     96,     19,      6,
-       4,      5,     13,     47,
-     206,    874,   2978,   7249,
-   11886,  13093,  10151,   6049,
-    3117,   1589,    914,    661,
-     639,    834,   1403,   2789,
-    5885,  11825,  20629,  29288,
-   32766,  28936,  20857,  13030,
-    7633,   4570,   3029,   2361,
-    2232,   2543,   3359,   4828,
-    7001,   9507,  11361,  11454,
-    9575,   6693,   4042,   2222,
-    1186,    658,    403,    283,
-     232,    219,    228,    248,
-     264,    257,    219,    158,
-      96,     50,     23,     10,
-       4,      2,      1,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-      -1,     -2,     -4,    -10,
-     -23,    -50,    -96,   -158,
-    -219,   -257,   -264,   -248,
-    -228,   -219,   -232,   -283,
-    -403,   -658,  -1186,  -2222,
-   -4042,  -6693,  -9575, -11454,
-  -11361,  -9507,  -7001,  -4828,
-   -3359,  -2543,  -2232,  -2361,
-   -3029,  -4570,  -7633, -13030,
-  -20857, -28936, -32766, -29288,
-  -20629, -11825,  -5885,  -2789,
-   -1403,   -834,   -639,   -661,
-    -914,  -1589,  -3117,  -6049,
-  -10151, -13093, -11886,  -7249,
-   -2978,   -874,   -206,    -47,
-     -13,     -5,     -4,     -6,
-     -19,    -96,   -587,  -3192,
-  -11131, -18189, -10250,  -1436,
-     -33,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      1,     30,    448,
-    3585,  14460,  29511,  32766,
-   22481,  11236,   4897,   2207,
-    1177,    805,    715,    783,
-     949,   1108,   1074,    756,
-     348,     98,     17,      2,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,     -2,    -17,    -98,
-    -348,   -756,  -1074,  -1108,
-    -949,   -783,   -715,   -805,
-   -1177,  -2207,  -4897, -11236,
-  -22481, -32766, -29511, -14460,
-   -3585,   -448,    -30,     -1,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       2,    203,   5003,  25765,
-   32766,  13789,   2803,    416,
-      67,     16,      7,      5,
-       6,     10,     14,     13,
-       6,      1,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,     -1,     -6,    -13,
-     -14,    -10,     -6,     -5,
-      -7,    -16,    -67,   -416,
-   -2803, -13789, -32766, -25765,
-   -5003,   -203,     -2,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-       0,      0,      0,      0,
-    5925,   7696,   9104,  10369,
-   11562,  12690,  13936,  15484,
-   17199,  18774,  20109,  21288,
-   22299,  23101,  23867,  24803,
-   25788,  26484,  26820,  27059,
-   27398,  27744,  27893,  27712,
-   27130,  26207,  25209,  24386,
-   23641,  22624,  21183,  19497,
-   17736,  15824,  13667,  11388,
-    9146,   6851,   4273,   1434,
-   -1321,  -3729,  -5925,  -8226,
-  -10715, -13264, -15857, -18571,
-  -21183, -23189, -24446, -25471,
-  -26820, -28410, -29814, -30933,
-  -31919, -32634, -32767, -32448,
-  -32188, -32147, -31961, -31381,
-  -30577, -29720, -28740, -27685,
-  -26820, -26141, -25251, -23944,
-  -22525, -21297, -20151, -18913,
-  -17694, -16570, -15320, -13811,
-  -12325, -11166, -10220,  -9249,
-   -8299,  -7500,  -6731,  -5863,
-   -5078,  -4599,  -4315,  -4005,
-   -3736,  -3688,  -3778,  -3793,
-   -3736,  -3740,  -3778,  -3753,
-   -3736,  -3854,  -4047,  -4184,
-   -4273,  -4346,  -4315,  -4150,
-   -4005,  -3945,  -3778,  -3376,
-   -2931,  -2655,  -2436,  -2070,
-   -1589,  -1104,   -557,     67,
-     557,    798,   1052,   1567,
-    2168,   2583,   2931,   3459,
-    4047,   4447,   4810,   5444,
-    6194,   6608,   6689,   6925,
-    7536,   8185,   8568,   8819,
-    9146,   9468,   9641,   9752,
-    9952,  10216,  10447,  10633,
-   10757,  10707,  10447,  10133,
-    9952,   9914,   9910,   9844,
-    9683,   9472,   9373,   9552,
-    9952,  10305,  10447,  10517,
-   10757,  11216,  11789,  12428,
-   13173,  13981,  14741,  15475,
-   16393,  17631,  19036,  20345,
-   21493,  22577,  23599,  24466,
-   25251,  26197,  27356,  28458,
-   29277,  29919,  30577,  31212,
-   31693,  32071,  32456,  32750,
-   32767,  32523,  32188,  31828,
-   31424,  30965,  30309,  29148,
-   27398,  25427,  23599,  21821,
-   19883,  17927,  16083,  13938,
-   11025,   7701,   4810,   2532,
-     289,  -2202,  -4583,  -6729,
-   -9104, -11898, -14515, -16430,
-  -17962, -19670, -21493, -23009,
-  -24135, -25063, -25788, -26230,
-  -26551, -26912, -27130, -26969,
-  -26551, -26098, -25519, -24635,
-  -23599, -22669, -21762, -20623,
-  -19304, -18067, -16930, -15676,
-  -14204, -12566, -10757,  -8804,
-   -6957,  -5481,  -4315,  -3170,
-   -1857,   -302,   1589,   3777,
-    5925,   8089,  11729,  14765,
-   17048,  18973,  21167,  23894,
-   26799,  29155,  30394,  30565,
-   30360,  30560,  31369,  32321,
-   32767,  32315,  30906,  28810,
-   26621,  24942,  23850,  22841,
-   21378,  19324,  16819,  14063,
-   11379,   9142,   7379,   5637,
-    3502,   1067,  -1318,  -3491,
-   -5419,  -7007,  -8324,  -9811,
-  -11819, -14030, -15765, -16833,
-  -17654, -18594, -19625, -20695,
-  -21976, -23509, -24959, -25962,
-  -26544, -27020, -27631, -28419,
-  -29312, -30180, -30927, -31579,
-  -32187, -32638, -32767, -32633,
-  -32465, -32287, -31886, -31228,
-  -30603, -30180, -29690, -28770,
-  -27432, -25967, -24554, -23153,
-  -21659, -19998, -18195, -16482,
-  -15129, -14030, -12692, -10864,
-   -8924,  -7359,  -6123,  -4895,
-   -3767,  -3145,  -3007,  -2789,
-   -2145,  -1390,   -997,  -1033,
-   -1305,  -1741,  -2308,  -2789,
-   -3001,  -3145,  -3627,  -4544,
-   -5564,  -6305,  -6704,  -7002,
-   -7518,  -8412,  -9535, -10513,
-  -11062, -11221, -11218, -11215,
-  -11295, -11572, -12093, -12620,
-  -12738, -12274, -11501, -10864,
-  -10577, -10519, -10437, -10162,
-   -9687,  -9114,  -8552,  -8055,
-   -7648,  -7359,  -7176,  -7002,
-   -6718,  -6305,  -5872,  -5598,
-   -5630,  -5954,  -6297,  -6300,
-   -5928,  -5603,  -5755,  -6300,
-   -6789,  -7007,  -7146,  -7353,
-   -7464,  -7359,  -7315,  -7704,
-   -8455,  -9114,  -9399,  -9460,
-   -9571,  -9816, -10141, -10513,
-  -10905, -11221, -11401, -11566,
-  -11946, -12625, -13413, -14024,
-  -14388, -14732, -15312, -16131,
-  -17010, -17892, -18886, -19993,
-  -20991, -21754, -22499, -23504,
-  -24668, -25616, -26203, -26664,
-  -27210, -27723, -27993, -28068,
-  -28181, -28425, -28671, -28770,
-  -28680, -28425, -28065, -27717,
-  -27492, -27371, -27230, -27015,
-  -26806, -26669, -26533, -26313,
-  -26077, -25967, -25977, -25962,
-  -25898, -25967, -26279, -26664,
-  -26893, -27020, -27281, -27717,
-  -28130, -28425, -28734, -29122,
-  -29409, -29478, -29533, -29824,
-  -30254, -30531, -30639, -30877,
-  -31398, -31936, -32118, -31930,
-  -31749, -31936, -32412, -32633,
-  -32026, -30531, -28660, -27015,
-  -25821, -24914, -23946, -22451,
-  -19970, -16487, -12690,  -9460,
-   -7042,  -4901,  -2386,    721,
-    4295,   8089,   9195,  13300,
-   16725,  18988,  20602,  22494,
-   24924,  27502,  29870,  31776,
-   32767,  32503,  31296,  29836,
-   28489,  27217,  25949,  24512,
-   22429,  19354,  15611,  11832,
-    8170,   4400,    640,  -2643,
-   -5375,  -8061, -11123, -14482,
-  -17851, -20992, -23599, -25374,
-  -26406, -27145, -27877, -28569,
-  -29258, -30146, -31085, -31419,
-  -30684, -29238, -27877, -26991,
-  -26406, -25883, -25382, -24812,
-  -23911, -22570, -21104, -19972,
-  -19277, -18697, -17896, -16844,
-  -15712, -14625, -13618, -12700,
-  -11791, -10705,  -9340,  -7845,
-   -6444,  -5186,  -3993,  -2861,
-   -1810,   -702,    640,   2149,
-    3536,   4588,   5274,   5616,
-    5675,   5631,   5630,   5585,
-    5318,   4838,   4204,   3250,
-    1754,   -173,  -2211,  -4270,
-   -6444,  -8586, -10410, -12029,
-  -13930, -16329, -18965, -21542,
-  -23911, -25775, -26807, -27246,
-  -27832, -28901, -30016, -30709,
-  -31041, -31129, -30729, -29720,
-  -28545, -27641, -26807, -25645,
-  -24268, -23029, -21817, -20208,
-  -18208, -16280, -14687, -13252,
-  -11791, -10354,  -8984,  -7579,
-   -6088,  -4615,  -3280,  -2112,
-   -1097,   -199,    640,   1425,
-    2110,   2749,   3491,   4318,
-    4962,   5236,   5274,   5299,
-    5318,   5206,   4917,   4477,
-    3892,   3200,   2422,   1409,
-     -28,  -1740,  -3280,  -4490,
-   -5731,  -7370,  -9340, -11421,
-  -13574, -15723, -17539, -18848,
-  -19990, -21378, -22886, -24099,
-  -24981, -25856, -26807, -27533,
-  -27832, -27870, -27877, -27885,
-  -27832, -27711, -27520, -27217,
-  -26763, -26145, -25382, -24580,
-  -23911, -23410, -22886, -22181,
-  -21416, -20820, -20391, -19910,
-  -19277, -18657, -18252, -18050,
-  -17851, -17524, -17183, -17047,
-  -17138, -17228, -17183, -17198,
-  -17495, -17942, -18252, -18471,
-  -18921, -19662, -20391, -20917,
-  -21416, -22088, -22886, -23719,
-  -24624, -25586, -26451, -27163,
-  -27832, -28471, -28946, -29334,
-  -29971, -30942, -31798, -32050,
-  -31753, -31412, -31442, -31885,
-  -32466, -32767, -32511, -31813,
-  -31041, -30432, -30016, -29847,
-  -29971, -30094, -29659, -28431,
-  -26763, -25194, -23956, -22866,
-  -21416, -19044, -15757, -12435,
-  -10009,  -8286,  -6132,  -2886,
-    1041,   5078,   9195,   5291,
-    5439,   5112,   5437,   6625,
-    8053,   9113,   9759,  10359,
-   11214,  12314,  13479,  14627,
-   15827,  17116,  18320,  19162,
-   19655,  20317,  21756,  23964,
-   26171,  27519,  27772,  27431,
-   27329,  28052,  29437,  30632,
-   30989,  30720,  30289,  29565,
-   28512,  28319,  30200,  32767,
-   32553,  28319,  23296,  21563,
-   23313,  25385,  25458,  23697,
-   21031,  18183,  16253,  15961,
-   15996,  14181,  10616,   7692,
-    6546,   5645,   3660,   1556,
-     542,   -222,  -2209,  -5112,
-   -7506,  -9025, -10467, -12314,
-  -14307, -15961, -16717, -16315,
-  -15776, -17028, -20513, -24051,
-  -25188, -23964, -22369, -21917,
-  -22845, -24764, -26666, -26985,
-  -25179, -22897, -22203, -22984,
-  -23458, -22897, -22220, -21917,
-  -21057, -18895, -16231, -14448,
-  -13958, -14094, -13943, -12847,
-  -10610,  -7692,  -5008,  -3244,
-   -2385,  -1823,   -763,   1290,
-    4078,   6712,   8505,   9559,
-   10375,  11247,  12367,  14094,
-   16524,  18983,  20494,  20763,
-   20404,  20317,  21061,  22630,
-   24477,  25918,  26680,  26898,
-   26590,  25652,  24532,  24230,
-   25157,  26452,  26849,  25831,
-   23734,  21384,  19995,  20496,
-   22131,  22451,  19790,  15427,
-   12258,  11514,  11771,  11159,
-    9431,   7512,   5897,   4224,
-    2114,   -222,  -2314,  -4045,
-   -5694,  -7425,  -9044, -10447,
-  -11948, -13827, -15837, -17649,
-  -19386, -21029, -21807, -21384,
-  -21343, -23697, -27586, -29386,
-  -27245, -23964, -23769, -27252,
-  -31214, -32767, -31737, -29386,
-  -26865, -25297, -25595, -27252,
-  -28378, -27698, -25866, -24318,
-  -23570, -23163, -22602, -21650,
-  -20136, -18095, -15955, -14181,
-  -12885, -11960, -11314, -10713,
-   -9738,  -8225,  -6540,  -5112,
-   -3945,  -2890,  -2082,  -1644,
-   -1137,     43,   1606,   2357,
-    1721,    844,   1450,   3690,
-    5811,   6179,   5045,   3957,
-    3905,   4578,   5114,   5024,
-    4521,   4311,   4854,   5558,
-    5223,   3778,   2860,   3690,
-    4959,   4311,   1808,    222,
-    1343,   3511,   3883,   2090,
-     321,    310,   1483,   2090,
-    1268,   -222,   -885,    -43,
-    1333,   1644,    667,    -43,
-     750,   2177,   2417,   1290,
-     570,   1644,   3799,   5291,
-    3993,   5339,   5830,   5741,
-    5577,   5666,   6147,   6902,
-    7479,   7435,   6781,   5870,
-    4944,   4053,   3295,   2832,
-    2725,   2922,   3295,   3611,
-    3676,   3649,   3929,   4584,
-    5261,   5792,   6464,   7391,
-    8113,   8226,   8048,   8186,
-    8746,   9397,   9950,  10461,
-   10965,  11439,  11851,  11990,
-   11599,  10960,  10900,  11779,
-   12866,  13267,  13119,  13290,
-   14134,  15182,  15971,  16578,
-   17303,  18270,  19457,  20835,
-   22373,  23945,  25161,  25410,
-   24591,  23859,  24844,  27591,
-   29979,  30078,  28647,  28249,
-   29979,  32187,  32767,  31752,
-   30929,  31361,  32133,  31659,
-   29662,  27459,  26428,  26627,
-   27127,  27328,  27379,  27409,
-   27127,  26482,  26112,  26559,
-   27444,  27980,  28013,  27848,
-   27127,  24614,  19457,  12398,
-    5577,   1148,   -190,     87,
-   -1076,  -6409, -16035, -26585,
-  -32767, -30750, -21106,  -8847,
-    -126,   1935,  -1141,  -5100,
-   -6147,  -2872,   3612,  10612,
-   15401,  16902,  16288,  15814,
-   16986,  19785,  23259,  26384,
-   28394,  28738,  27062,  23379,
-   18253,  12661,   7414,   2730,
-   -1393,  -4445,  -5577,  -4796,
-   -3612,  -4084,  -7162, -11950,
-  -16288, -17972, -16035, -11532,
-   -7098,  -5179,  -6211,  -8311,
-   -8682,  -5546,    760,   8130,
-   14134,  17489,  18506,  18448,
-   18570,  19445,  20724,  21483,
-   21106,  19932,  18823,  18122,
-   17303,  15623,  12802,   9121,
-    5261,   2086,    126,   -939,
-   -2027,  -3792,  -6211,  -8881,
-  -11217, -12375, -11599,  -9025,
-   -5830,  -3337,  -2092,  -1744,
-   -1393,      2,   2978,   6971,
-   10648,  13068,  14386,  15395,
-   16669,  18196,  19457,  19773,
-   18887,  17284,  15654,  14105,
-   12232,   9843,   7098,   4070,
-     824,  -2142,  -4310,  -6114,
-   -8682, -12231, -15401, -16614,
-  -15654, -13639, -11915, -11204,
-  -11217, -10762,  -8746,  -5453,
-   -2344,   -351,   1076,   2929,
-    5261,   7346,   8682,   9342,
-    9697,  10172,  10900,  11340,
-   10648,   8733,   6464,   4587,
-    3042,   1603,    443,   -449,
-   -1710,  -3736,  -5894,  -7260,
-   -7731,  -7769,  -7479,  -6671,
-   -5513,  -4400,  -3359,  -2206,
-   -1076,   -183,    760,   2214,
-    3993,  11636,  19174,  22048,
-   19199,  11636,   2690,  -3062,
-   -2253,   5205,  16195,  26336,
-   32216,  32767,  29435,  25111,
-   22251,  21436,  21337,  19905,
-   15881,   9799,   3882,    612,
-     839,   3062,   4569,   3368,
-    -651,  -5818,  -9723, -10718,
-   -9106,  -7043,  -7044, -10411,
-  -16718, -24192, -30328, -32767,
-  -30499, -24498, -16994, -10105,
-   -5203,  -3062,  -3836,  -6737,
-  -10223, -12861, -13912, -13168,
-  -10661,  -6737,  -2113,   2449,
-    6491,   9799,  12188,  13474,
-   13576,  12555,  10684,   8574,
-    7063,   6737,   7437,   8268,
-    8126,   6430,   3596,    918,
-    -182,    918,   3586,   6124,
-    6502,   3368,  -3020, -10718,
-  -17193, -20823, -21518, -20211,
-  -18104, -16230, -15145, -14699,
-  -14316, -13780, -13639, -14699,
-  -17198, -20517, -23472, -24804,
-  -23742, -20517, -16324, -12555,
-   -9975,  -8574,  -7905,  -7349,
-   -6311,  -4593,  -2644,  -1224,
-    -782,  -1224,  -2158,  -3062,
-   -3321,  -2449,   -457,   2143,
-    4716,   6737,   7737,   7349,
-    5612,   3062,    353,  -2143,
-   -4330,  -6124,  -7376,  -7962,
-   -7833,  -7043,  -5869,  -4899,
-   -4841,  -6124,  -8613, -11636,
-  -14303, -15924, -16337, -15924,
-  -15313, -15005, -15113, -15311,
-  -15014, -13780, -11671,  -9187,
-   -6741,  -4287,  -1621,    918,
-    2339,   1837,   -239,  -2449,
-   -3305,  -2143,    885,   5205,
-    9855,  13474,  14868,  13780,
-   10936,   7349,   3862,   1224,
-     -12,      0,    426,    612,
-     679,    918,    947,      0,
-   -2074,  -4593,  -6770,  -8268,
-   -9097,  -9493,  -9968, -11024,
-  -12601, -14086, -14940, -15005,
-  -14226, -12555, -10369,  -8574,
-   -8005,  -8880, -10897, -13474,
-  -15749, -16842, -16511, -15311,
-  -13859, -12249, -10451,  -8880,
-   -8110,  -8268,  -9104, -10411,
-  -11946, -13168, -13565, -13168,
-  -12352, -11330, -10234,  -9493,
-   -9526, -10105, -10578, -10718,
-  -10877, -11330, -12052, -13168,
-  -14954, -17149, -18822, -19292,
-  -18796, -18067, -17640, -17761,
-  -18498, -19598, -20607, -21436,
-  -22472, -23886, -25231, -26029,
-  -26329, -26336, -25942, -25111,
-  -24342, -24192, -24585, -25111,
-  -25688, -26336, -26509, -25417,
-  -22901, -19292, -14381,  -7349,
-    1876,  11636,  10149,  10506,
-    6253,  -1243,  -8535,  -9911,
-   -2504,   9604,  19199,  22818,
-   21727,  17990,  13068,   9584,
-   10632,  16195,  22411,  25470,
-   24938,  22811,  20951,  20375,
-   21727,  24918,  28542,  30629,
-   30193,  27692,  24162,  20493,
-   17639,  16886,  19199,  24143,
-   29609,  32767,  31461,  25357,
-   16471,   8627,   5478,   8148,
-   14428,  20247,  22119,  18931,
-   12384,   5936,   2558,   2793,
-    4794,   6101,   5186,   1856,
-   -2796,  -6690,  -7951,  -6405,
-   -3672,  -1785,  -2112,  -5181,
-  -10387, -15744, -19045, -19717,
-  -18853, -17419, -15542, -13724,
-  -13306, -15032, -18169, -21592,
-  -24692, -26729, -26636, -24475,
-  -22065, -21158, -21672, -22416,
-  -22649, -22197, -21089, -20078,
-  -20605, -23069, -25760, -26484,
-  -24692, -21285, -17293, -13835,
-  -12430, -13819, -16709, -18851,
-  -19145, -17934, -15833, -13409,
-  -11555, -10846, -10578,  -9493,
-   -7467,  -5654,  -5031,  -5608,
-   -6883,  -8173,  -8535,  -7298,
-   -4840,  -2230,    -68,   1724,
-    3042,   3307,   2266,    509,
-   -1044,  -1758,  -1236,    803,
-    4210,   8069,  11025,  12041,
-   10924,   8278,   5186,   2996,
-    3042,   5877,  10441,  14347,
-   15596,  14130,  11609,   9871,
-    9757,  10915,  12193,  12436,
-   11508,  10525,  10733,  12257,
-   14136,  15284,  15112,  13643,
-   11508,   9548,   8105,   7045,
-    6545,   7098,   8397,   9158,
-    8589,   7174,   5478,   3298,
-     706,  -1339,  -2404,  -3340,
-   -4548,  -4906,  -3864,  -3189,
-   -4840,  -8231, -11454, -14047,
-  -16518, -18279, -18461, -18005,
-  -18561, -19861, -20505, -20749,
-  -22065, -24392, -26344, -27732,
-  -29363, -30705, -30431, -29080,
-  -28488, -28785, -28679, -28454,
-  -29655, -31842, -32767, -32016,
-  -31407, -31521, -31015, -29706,
-  -29072, -29167, -28387, -26925,
-  -27028, -28968, -30139, -29115,
-  -27320, -25868, -24300, -23203,
-  -24108, -25723, -24592, -20967,
-  -19437, -21833, -24300, -23832,
-  -22649, -22908, -22256, -18931,
-  -16518, -18398, -21381, -20613,
-  -17686, -17731, -20797, -22447,
-  -21481, -20635, -20213, -17410,
-  -12430,  -9448, -10286, -12079,
-  -12430, -12327, -12622, -12149,
-  -10971, -11219, -12622, -11087,
-   -4256,   4550,  10149,  14763,
-   17793,  13977,   7115,   2761,
-    5130,  14549,  25952,  31623,
-   28007,  19407,  13519,  14192,
-   19754,  26551,  31558,  32767,
-   30213,  26837,  26070,  28194,
-   30553,  31123,  30239,  29052,
-   28183,  27980,  28457,  28766,
-   28040,  26837,  26551,  27337,
-   27672,  25980,  22006,  17049,
-   13613,  13977,  17743,  21336,
-   21201,  17121,  11497,   6476,
-    3239,   2832,   5199,   7619,
-    6516,   1404,  -4394,  -7240,
-   -6254,  -3168,   -802,  -1810,
-   -7063, -14313, -19439, -19814,
-  -16276, -12027, -10255, -12384,
-  -17244, -21743, -23362, -22386,
-  -21179, -21457, -22995, -24672,
-  -25635, -25458, -24260, -22957,
-  -22584, -23172, -23907, -24386,
-  -24943, -25743, -26318, -26101,
-  -24805, -22314, -19025, -16385,
-  -16152, -18599, -21827, -23243,
-  -21607, -17742, -13735, -11526,
-  -11712, -13170, -13867, -12384,
-   -9037,  -5740,  -4585,  -6097,
-   -8650,  -9740,  -7957,  -3811,
-     917,   4261,   4981,   3332,
-    1103,    260,   1328,   3332,
-    5127,   6262,   6835,   7333,
-    8500,  10548,  12536,  13334,
-   13097,  12834,  12695,  11905,
-   10572,  10262,  12238,  15906,
-   19325,  20550,  18616,  14477,
-   11237,  11977,  16501,  21050,
-   21971,  19121,  15425,  13906,
-   15470,  18550,  20280,  18764,
-   14862,  11405,  10422,  11620,
-   13434,  14549,  14205,  12191,
-    9202,   6547,   5021,   4476,
-    4514,   4833,   4793,   3618,
-    1379,   -882,  -2301,  -2953,
-   -3485,  -4597,  -6782,  -9812,
-  -12511, -13741, -13568, -12955,
-  -12724, -13455, -15719, -19242,
-  -22351, -23457, -22854, -22100,
-  -22116, -22886, -24269, -25815,
-  -26447, -25743, -24962, -25529,
-  -27213, -28887, -29997, -30101,
-  -28566, -26315, -25858, -27529,
-  -28118, -26029, -24973, -28387,
-  -32767, -32030, -27023, -24386,
-  -26293, -28030, -26716, -25529,
-  -26806, -27458, -25055, -22957,
-  -24731, -27744, -27228, -23529,
-  -20625, -20028, -20595, -22100,
-  -24444, -25172, -22405, -18956,
-  -19036, -21743, -22329, -19528,
-  -17158, -18028, -20300, -20957,
-  -19552, -17170, -14292, -11241,
-   -9048,  -8597,  -9824, -12098,
-  -14275, -14313, -10409,  -3239,
-    3706,   6547,   3900,  -1810,
-   -5411,  -2596,   6017,  14763,
-    -694,  -1763,  -2004,  -1786,
-   -1482,  -1042,   -427,     39,
-      94,    -75,   -164,   -165,
-    -168,    -44,    361,    933,
-    1408,   1609,   1413,    754,
-    -168,   -967,  -1478,  -1824,
-   -2008,  -1852,  -1478,  -1372,
-   -1745,  -2291,  -2793,  -3471,
-   -4374,  -4980,  -4896,  -4506,
-   -4374,  -4353,  -3844,  -2679,
-   -1220,    201,   1413,   2193,
-    2460,   2527,   2727,   2951,
-    2986,   3062,   3516,   4112,
-    4300,   4035,   3779,   3799,
-    4037,   4583,   5619,   6837,
-    7455,   6941,   5356,   3021,
-     357,  -1977,  -3319,  -3502,
-   -2797,  -1476,     98,   1139,
-     883,   -549,  -2267,  -3595,
-   -4374,  -4395,  -3319,  -1357,
-     620,   1916,   2464,   2422,
-    1934,   1418,   1413,   1925,
-    2460,   2780,   2990,   2865,
-    1934,    394,   -953,  -1940,
-   -3323,  -5483,  -7788,  -9642,
-  -11209, -12505, -12783, -11591,
-   -9632,  -7778,  -5947,  -3671,
-    -957,   2210,   6407,  11840,
-   17445,  21707,  23758,  23162,
-   19811,  15034,  11665,  11753,
-   15079,  20608,  27439,  32767,
-   31641,  22313,  10351,   3119,
-     357,  -5213, -16989, -28840,
-  -32767, -28378, -21458, -16108,
-  -12524, -10862, -12520, -17096,
-  -21462, -22950, -21458, -17961,
-  -13050,  -7612,  -3056,    108,
-    2723,   5457,   7985,  10033,
-   11924,  13547,  14031,  13048,
-   11398,   9776,   7985,   5885,
-    4037,   2740,   1413,   -313,
-   -1745,  -2126,  -1741,  -1310,
-    -957,   -549,   -427,   -955,
-   -1745,  -2026,  -1478,   -207,
-    1671,   3802,   5356,   5658,
-    4826,   3382,   1675,    137,
-    -431,    447,   2201,   3760,
-    4563,   4542,   3516,   1342,
-   -1482,  -4029,  -5685,  -6318,
-   -5952,  -4821,  -3581,  -2891,
-   -2797,  -2921,  -3056,  -3167,
-   -3060,  -2578,  -2004,  -1747,
-   -1745,  -1660,  -1478,  -1395,
-   -1220,   -479,    887,   2436,
-    3774,   4777,   5356,   5522,
-    5615,   5930,   6145,   5670,
-    4563,   3531,   2990,   2708,
-    2460,   2429,   2727,   3032,
-    2986,   2583,   1938,   1063,
-      94,   -579,   -690,   -370,
-      94,    546,    887,    995,
-     883,    718,    624,    640,
-     883,   1459,   2201,   2764,
-    2986,   2855,   2201,    885,
-    -694,   1994,   -175,  -1958,
-   -2977,  -3704,  -4245,  -4238,
-   -3710,  -3134,  -2746,  -2528,
-   -2623,  -3134,  -3773,  -4238,
-   -4596,  -4843,  -4675,  -4238,
-   -4383,  -5413,  -6287,  -5947,
-   -4767,  -3704,  -2744,  -1389,
-     -68,    284,   -249,   -819,
-   -1259,  -1994,  -2698,  -2528,
-   -1709,  -1424,  -1906,  -1958,
-    -697,   1424,   3694,   6019,
-    8202,   9402,   8968,   7158,
-    4643,   1994,    -70,   -819,
-    -262,    854,   2018,   3169,
-    3936,   3704,   2705,   2030,
-    2183,   2564,   2645,   2599,
-    2393,   1424,   -349,  -1958,
-   -2643,  -2564,  -1866,   -249,
-    1897,   3134,   2581,    890,
-   -1043,  -3134,  -5125,  -5947,
-   -5220,  -4273,  -4548,  -5947,
-   -7767,  -9972, -12304, -13356,
-  -12098,  -9402,  -6715,  -4238,
-   -1716,    284,   1604,   3739,
-    7920,  12821,  15946,  16276,
-   13929,   8832,   2136,  -2528,
-   -2007,   3134,  10629,  19695,
-   28799,  32767,  27792,  18556,
-   14089,  15671,  14928,   6019,
-   -6199, -13391, -13847, -11076,
-   -6742,   -284,   6999,  12287,
-   14118,  11682,   3875,  -7087,
-  -14338, -13961, -11717, -16205,
-  -26493, -32767, -29145, -19624,
-  -10560,  -3704,    986,   1460,
-   -3433, -10542, -15559, -17345,
-  -16778, -13961,  -9250,  -4808,
-   -2352,   -854,   1436,   4309,
-    6836,   9402,  12304,  13997,
-   13047,  10542,   8494,   7158,
-    5927,   5413,   6290,   7158,
-    6013,   3134,    421,  -1389,
-   -2723,  -3134,  -1682,    890,
-    2554,   2564,   1835,    890,
-    -668,  -2564,  -3548,  -3098,
-   -2076,  -1424,  -1369,  -1958,
-   -3161,  -4273,  -4297,  -3098,
-   -1390,    284,   1649,   2030,
-     721,  -1994,  -5054,  -7657,
-   -9324,  -9402,  -7607,  -4808,
-   -2251,   -284,   1258,   2030,
-    1775,   1424,   2074,   3169,
-    3198,   1994,    824,    320,
-     -28,   -284,    353,   2030,
-    3751,   4843,   5572,   6019,
-    5715,   4843,   4446,   4879,
-    5236,   4843,   4171,   3739,
-    3266,   2564,   2206,   2599,
-    3273,   3704,   4018,   4309,
-    4112,   3134,   1752,    320,
-   -1205,  -2564,  -3042,  -2528,
-   -1822,  -1424,   -953,   -249,
-      54,   -284,   -415,    320,
-    1360,   1994,   2490,   3169,
-    3285,   1994,  -2398,  -3669,
-   -4728,  -5395,  -5579,  -5224,
-   -4330,  -3026,  -1603,   -390,
-     440,    931,   1180,   1244,
-    1236,   1407,   1975,   2848,
-    3621,   3895,   3566,   2839,
-    2031,   1406,   1180,   1527,
-    2429,   3468,   3963,   3460,
-    2031,      3,  -2398,  -4869,
-   -6716,  -7213,  -6374,  -5017,
-   -3932,  -3265,  -2795,  -2458,
-   -2342,  -2402,  -2398,  -2042,
-   -1149,    194,   1577,   2592,
-    3224,   3687,   3963,   3885,
-    3621,   3612,   3963,   4396,
-    4814,   5390,   5951,   5881,
-    4814,   2925,    385,  -2817,
-   -6318,  -9282, -11146, -11894,
-  -11487,  -9830,  -7567,  -5965,
-   -5523,  -5433,  -4784,  -3411,
-   -1149,   2628,   7939,  13460,
-   17538,  19261,  18278,  14861,
-   10779,   8719,   9928,  13501,
-   18334,  23684,  27026,  24428,
-   15550,   5769,    -12,  -3905,
-  -11487, -22801, -31425, -32767,
-  -28983, -24497, -20689, -17182,
-  -15066, -15694, -17905, -18906,
-  -17054, -12313,  -5181,   3195,
-   10779,  15902,  18278,  18326,
-   16743,  15225,  15892,  19141,
-   23503,  27900,  31797,  32767,
-   27479,  16982,   7542,   3160,
-      43,  -7660, -18701, -25798,
-  -25007, -19558, -14327, -10878,
-   -9102,  -9784, -13134, -17063,
-  -19042, -18374, -15520, -10813,
-   -5125,   -322,   2373,   3573,
-    4417,   5173,   5951,   7478,
-    9984,  12295,  13109,  12409,
-   10779,   8234,   4758,   1183,
-   -1547,  -3415,  -4784,  -5443,
-   -5125,  -4384,  -3988,  -3867,
-   -3535,  -3144,  -3193,  -3530,
-   -3535,  -3065,  -2398,  -1453,
-      43,   1725,   2770,   2955,
-    2826,   2797,   2770,   2764,
-    3224,   4417,   5951,   7155,
-    7598,   7092,   5554,   3151,
-     440,  -1852,  -3193,  -3414,
-   -2740,  -1687,   -807,   -452,
-    -751,  -1649,  -2795,  -3574,
-   -3535,  -2823,  -2000,  -1453,
-   -1149,   -933,   -807,   -806,
-    -751,   -298,    782,   2370,
-    4019,   5268,   5951,   6180,
-    6007,   5282,   3963,   2430,
-    1236,    606,    385,    444,
-     838,   1481,   1975,   1989,
-    1633,   1214,    782,    209,
-    -354,   -477,    -12,    612,
-     838,    542,    -12,   -598,
-   -1149,  -1549,  -1603,  -1269,
-    -751,   -293,    -12,     12,
-    -354,  -1197,  -2398,   5823,
-    5227,   4102,   3082,   2451,
-    1896,   1292,   1142,   1889,
-    3249,   4664,   5931,   6947,
-    7247,   6350,   4365,   1889,
-    -451,  -2080,  -2559,  -2045,
-   -1315,   -956,   -864,   -920,
-   -1582,  -3204,  -5194,  -6541,
-   -6908,  -6576,  -5682,  -4293,
-   -3016,  -2642,  -3147,  -3731,
-   -3876,  -3766,  -3609,  -3169,
-   -2101,   -394,   1555,   3013,
-    3287,   2416,   1217,    203,
-   -1103,  -3204,  -5518,  -7103,
-   -8003,  -8824,  -9349,  -8789,
-   -7222,  -5452,  -3461,   -358,
-    3986,   8598,  12878,  17064,
-   20896,  23212,  23318,  21561,
-   18358,  14219,  10946,  10882,
-   14303,  19277,  24352,  28867,
-   30147,  24336,  12432,   1889,
-   -1783,  -2642,  -8893, -21154,
-  -31190, -32431, -26813, -20030,
-  -14741, -11073, -10041, -12724,
-  -17627, -21752, -23497, -22841,
-  -19962, -15569, -11536,  -9351,
-   -8520,  -7700,  -6475,  -4855,
-   -2295,   1292,   4589,   6385,
-    7172,   8036,   9088,  10320,
-   12753,  17029,  21689,  24371,
-   24021,  20963,  16115,  11444,
-    9689,  11971,  16835,  22685,
-   28844,  32767,  29784,  19312,
-    8423,   4102,   3467,  -2607,
-  -16272, -29058, -32767, -28461,
-  -22152, -16693, -11970,  -9351,
-  -10908, -15569, -19927, -22278,
-  -23085, -22314, -19220, -14410,
-   -9608,  -5452,  -1404,   2451,
-    5383,   7474,   9386,  10882,
-   11144,  10284,   9066,   7509,
-    5270,   2978,   1595,    765,
-    -564,  -2080,  -2322,   -920,
-     954,   2416,   3639,   4699,
-    5081,   4664,   4032,   3575,
-    3298,   3540,   4733,   6385,
-    7396,   7474,   7140,   6385,
-    4672,   2416,   1074,   1327,
-    2292,   2978,   3366,   3575,
-    3043,   1292,  -1247,  -3731,
-   -5628,  -6576,  -6247,  -4855,
-   -3247,  -2080,  -1355,   -920,
-    -818,   -956,  -1115,  -1483,
-   -2460,  -3766,  -4493,  -4293,
-   -3732,  -3204,  -2348,   -920,
-     617,   1854,   2986,   4137,
-    4912,   5226,   5778,   6947,
-    7873,   7474,   5895,   4137,
-    2669,   1292,     99,   -358,
-      51,    730,   1030,    765,
-     -62,  -1518,  -3487,  -5417,
-   -6572,  -6576,  -5745,  -4855,
-   -4452,  -4328,  -3822,  -2607,
-    -954,    730,   2269,   3575,
-    4545,   5226,   5717,   5823,
-    5272,   2714,     90,  -2257,
-   -4005,  -4694,  -4085,  -2619,
-   -1221,   -587,   -837,  -1771,
-   -3077,  -4225,  -4548,  -3737,
-   -2149,   -438,   1017,   2177,
-    2953,   3066,   2409,   1379,
-     633,    461,    553,    479,
-     169,   -243,   -837,  -1801,
-   -3077,  -4535,  -6404,  -8985,
-  -11891, -14145, -15218, -15433,
-  -15138, -14088, -11971,  -9048,
-   -5860,  -2668,    553,   3997,
-    8056,  12899,  17718,  21010,
-   21972,  21067,  19109,  16647,
-   14550,  14181,  16326,  20545,
-   25684,  29972,  30707,  25938,
-   17333,   9231,   3337,  -3526,
-  -14211, -25636, -31455, -29402,
-  -23025, -16654, -11971,  -9683,
-  -10963, -15570, -20785, -23823,
-  -23952, -21499, -16610, -10120,
-   -4005,    356,   3337,   5740,
-    7592,   9004,  10759,  13002,
-   14550,  14437,  13079,  11139,
-    8519,   5306,   2409,    227,
-   -2149,  -5402,  -8724, -11038,
-  -12355, -12957, -12435, -10654,
-   -8644,  -7367,  -6404,  -4778,
-   -2149,   1636,   7048,  13790,
-   20117,  24148,  25140,  23041,
-   18261,  12689,   9367,  10023,
-   14086,  20470,  27923,  32767,
-   29859,  18733,   6120,  -1379,
-   -5397, -12444, -23568, -32192,
-  -32767, -27146, -20785, -16386,
-  -13747, -12996, -14754, -18170,
-  -21169, -22330, -21249, -17875,
-  -12819,  -7655,  -3621,   -404,
-    2953,   6546,   9831,  12643,
-   15014,  16529,  16790,  16122,
-   15014,  13310,  10759,   7936,
-    5736,   4238,   2873,   1519,
-     633,    420,    553,    685,
-     633,    165,   -837,  -1979,
-   -2613,  -2494,  -1765,   -435,
-    1561,   3758,   5192,   5284,
-    4344,   3083,   1945,   1165,
-    1097,   2060,   3801,   5378,
-    5736,   4450,   1945,   -937,
-   -3541,  -5579,  -6868,  -7143,
-   -6324,  -4876,  -3621,  -3073,
-   -3077,  -3178,  -3157,  -3011,
-   -2613,  -1799,   -837,   -385,
-    -758,  -1552,  -2229,  -2718,
-   -3077,  -2913,  -1765,     45,
-    1561,   2254,   2409,   2370,
-    2025,   1296,    553,    109,
-    -294,  -1006,  -1765,  -1922,
-   -1221,     39,   1481,   2859,
-    3880,   4216,   3801,   2928,
-    2025,   1460,   1481,   2090,
-    2953,   3602,   3801,   3649,
-    3417,   3384,   3801,   4795,
-    6200,   7490,   7976,   7206,
-    5272,   2730,   4808,   5930,
-    5569,   3822,   1720,    469,
-     412,   1092,   2089,   3199,
-    3964,   3822,   2821,   1561,
-     337,  -1092,  -2808,  -4445,
-   -5790,  -7099,  -8565,  -9906,
-  -10733, -10922, -10477,  -9360,
-   -7634,  -5461,  -2831,    469,
-    4555,   9283,  14228,  18491,
-   20767,  20206,  17292,  13576,
-   10576,   9283,  10467,  14668,
-   21397,  28398,  32154,  29959,
-   22329,  13106,   5942,    469,
-   -6656, -16383, -24697, -26836,
-  -22713, -16383, -11290,  -8268,
-   -7469,  -9283, -12765, -15368,
-  -15334, -13106,  -9953,  -6630,
-   -3804,  -2184,  -1415,    -76,
-    2594,   6007,   9520,  13030,
-   15818,  16383,  14267,  10845,
-    7617,   4915,   2861,   2107,
-    2666,   3276,   2942,   2107,
-    1519,   1092,    720,   1015,
-    2196,   3276,   3332,   2653,
-    1880,   1092,    546,   1015,
-    2320,   2730,    961,  -2261,
-   -5595,  -8737, -11506, -12637,
-  -11084,  -7645,  -3936,   -622,
-    2155,   3822,   4378,   5384,
-    8303,  12560,  16469,  19037,
-   19643,  17475,  13178,   9753,
-    9820,  13106,  18276,  25044,
-   31652,  32767,  24702,  11937,
-    3134,      0,  -4678, -15914,
-  -28348, -32767, -27322, -18098,
-  -10817,  -6553,  -4805,  -6084,
-  -10177, -14745, -17260, -17006,
-  -14508, -10376,  -5393,   -622,
-    3323,   6553,   9246,  11391,
-   13167,  14745,  15655,  15214,
-   13664,  12014,  10681,   9207,
-    7454,   6007,   5022,   3746,
-    1783,      0,   -576,    -76,
-     727,   1638,   2819,   3746,
-    3409,   1638,   -495,  -1715,
-   -1490,      0,   2203,   4292,
-    5465,   5461,   4579,   3199,
-    1650,    546,    648,   2107,
-    4194,   6007,   7063,   7022,
-    5412,   2184,  -1738,  -4991,
-   -6777,  -7099,  -6328,  -4991,
-   -3792,  -3276,  -3426,  -3899,
-   -4569,  -5461,  -6302,  -6630,
-   -6390,  -6007,  -5777,  -5537,
-   -4954,  -3822,  -2019,    469,
-    3337,   6007,   8010,   9207,
-    9712,   9830,   9962,  10299,
-   10574,  10376,   9643,   8661,
-    7722,   7099,   7164,   8114,
-    9603,  10922,  11482,  10845,
-    8622,   4915,    795,  -2261,
-   -3527,  -3276,  -2016,    -76,
-    1995,   3276,   3088,   1561,
-    -516,  -2184,  -2674,  -1715,
-     326,   2730,   -938,  -1563,
-   -2859,  -5098,  -8059, -11199,
-  -13778, -15049, -14705, -13114,
-  -10929,  -8562,  -6160,  -3825,
-   -1435,   1573,   5707,  10617,
-   15180,  18422,  19949,  19530,
-   17078,  13417,  10455,   9950,
-   12331,  16814,  21848,  24918,
-   23250,  16387,   7606,    865,
-   -3808, -10011, -19452, -28691,
-  -32767, -30678, -25623, -20890,
-  -17575, -15864, -16129, -18018,
-  -19949, -20395, -18977, -16005,
-  -11879,  -7330,  -3311,   -106,
-    2837,   5852,   8556,  10639,
-   12331,  13689,  14252,  13897,
-   13281,  12900,  12353,  11057,
-    9008,   6337,   2859,  -1221,
-   -4758,  -6589,  -6634,  -5540,
-   -3808,  -1955,   -938,  -1512,
-   -3334,  -5325,  -6634,  -6754,
-   -5233,  -2141,   1435,   4096,
-    5210,   4876,   3334,   1145,
-    -485,   -506,    960,   2960,
-    4736,   5751,   5233,   2743,
-    -960,  -4570,  -7584, -10223,
-  -12353, -13585, -14230, -14986,
-  -15676, -15448, -14230, -12812,
-  -11404,  -9382,  -6634,  -3824,
-    -960,   2918,   8081,  13273,
-   17078,  19026,  19000,  17012,
-   14230,  12788,  13778,  16718,
-   21351,  27619,  32767,  31546,
-   22300,  10732,   3808,    905,
-   -4758, -15763, -26098, -28803,
-  -24221, -17985, -13755, -11461,
-  -10929, -13119, -17553, -21525,
-  -22797, -21342, -18028, -13352,
-   -8081,  -3562,   -463,   1874,
-    4261,   6709,   9030,  11320,
-   13281,  13962,  12828,  10430,
-    7584,   4623,   1910,    155,
-    -485,   -911,  -1887,  -2971,
-   -3334,  -3069,  -2837,  -2725,
-   -2384,  -1951,  -1887,  -2072,
-   -1910,  -1254,   -463,    370,
-    1413,   2332,   2384,   1397,
-     -11,  -1292,  -2362,  -3033,
-   -2859,  -1883,   -938,   -788,
-   -1435,  -2578,  -4261,  -6572,
-   -9030, -10709, -10907,  -9541,
-   -7131,  -4606,  -2837,  -2071,
-   -1910,  -1895,  -1887,  -1807,
-   -1435,   -718,     11,    398,
-     463,    445,    485,    705,
-    1413,   2935,   5233,   7729,
-    9483,   9645,   8081,   5603,
-    3311,   1664,    485,   -203,
-     -11,    998,   1910,   1861,
-     938,   -244,  -1413,  -2557,
-   -3334,  -3246,  -2362,  -1298,
-    -485,     96,    485,    574,
-     463,    532,    960,   1507,
-    1887,   2038,   1910,   1358,
-     463,   -377,   -938,   3682,
-    9249,  15541,  21265,  25214,
-   26261,  23616,  18042,  12295,
-    9214,   9620,  12908,  18754,
-   26246,  31690,  30268,  21446,
-   10711,   3699,   -303,  -6544,
-  -16966, -26982, -30878, -28076,
-  -22547, -17831, -14919, -14080,
-  -15940, -19985, -23865, -25384,
-  -24319, -21599, -17724, -13004,
-   -8521,  -5451,  -3604,  -1700,
-     913,   3699,   6047,   7988,
-    9631,  10697,  10987,  10680,
-    9897,   8544,   6817,   5297,
-    4212,   3161,   1919,    991,
-     929,   1546,   2213,   2606,
-    2736,   2622,   2415,   2606,
-    3629,   5314,   6989,   7988,
-    7857,   6390,   3848,    991,
-   -1370,  -2759,  -2911,  -1700,
-     490,   2622,   3636,   3144,
-    1390,  -1145,  -3848,  -6006,
-   -7112,  -7066,  -6028,  -4391,
-   -2896,  -2221,  -2246,  -2238,
-   -1917,  -1683,  -1615,  -1161,
-    -301,    -68,  -1148,  -2776,
-   -3936,  -4913,  -6573,  -8697,
-  -10238, -10834, -10867, -10312,
-   -8775,  -6527,  -4317,  -2238,
-     125,   2622,   4864,   7450,
-   11453,  16618,  21390,  24675,
-   26169,  25230,  21458,  16601,
-   13808,  14465,  17620,  22522,
-   28683,  32767,  29553,  18754,
-    7507,   2084,   -551,  -8159,
-  -21370, -31827, -32767, -26461,
-  -19305, -14063, -10241,  -8697,
-  -11353, -17293, -22718, -24846,
-  -23634, -19985, -14604,  -8697,
-   -3742,    -68,   3043,   5835,
-    7941,   9620,  11558,  13371,
-   13840,  12850,  11621,  10680,
-    9120,   6390,   3382,    991,
-   -1102,  -3298,  -4858,  -4929,
-   -4008,  -3298,  -3182,  -3315,
-   -3752,  -4913,  -6540,  -7621,
-   -7407,  -5989,  -3906,  -1700,
-     192,   1546,   2361,   2606,
-    2209,   1546,   1502,   2606,
-    4362,   5852,   6682,   6912,
-    6386,   4776,   2204,   -623,
-   -2862,  -3836,  -3181,  -1161,
-    1282,   3161,   4008,   3682,
-    2063,   -606,  -3429,  -5468,
-   -6459,  -6527,  -5622,  -3853,
-   -2041,  -1145,  -1249,  -1700,
-   -2054,  -2221,  -1889,   -623,
-    1443,   3699,   5763,   7450,
-    8201,   7467,   5718,   4220,
-    3652,   3699,   4044,   4759,
-    5490,   5314,   3917,   2067,
-     355,  -1683,  -4542,  -7621,
-   -9936, -11372, -12404, -13004,
-  -12681, -11372,  -9561,  -7621,
-   -5575,  -3298,   -421,   3682,
-    -223,    483,   1338,   2243,
-    3160,   4084,   4983,   5862,
-    6805,   7852,   8888,   9762,
-   10450,  11020,  11491,  11868,
-   12272,  12905,  13834,  14909,
-   15917,  16759,  17479,  18202,
-   19041,  19986,  20864,  21500,
-   21905,  22208,  22426,  22475,
-   22426,  22588,  23207,  24200,
-   25290,  26286,  27112,  27670,
-   27893,  27894,  27893,  27995,
-   28153,  28354,  28674,  29147,
-   29716,  30340,  31017,  31651,
-   32059,  32164,  32059,  31839,
-   31538,  31279,  31278,  31552,
-   31798,  31753,  31538,  31451,
-   31538,  31649,  31798,  32140,
-   32579,  32767,  32579,  32283,
-   32059,  31700,  31017,  30294,
-   29976,  30077,  30236,  30306,
-   30497,  30907,  31278,  31321,
-   31017,  30421,  29455,  28142,
-   26852,  26041,  25810,  25905,
-   26071,  26176,  26071,  25592,
-   24769,  23831,  22947,  22121,
-   21384,  20872,  20603,  20340,
-   19822,  19064,  18260,  17497,
-   16698,  15857,  15136,  14671,
-   14355,  13895,  13053,  11833,
-   10450,   9160,   8107,   7319,
-    6805,   6577,   6545,   6454,
-    6024,   5149,   3941,   2606,
-    1338,    290,   -484,  -1099,
-   -1785,  -2711,  -3868,  -5105,
-   -6211,  -6970,  -7253,  -7152,
-   -6992,  -7136,  -7773,  -8899,
-  -10377, -11946, -13241, -13995,
-  -14282, -14453, -14803, -15370,
-  -16104, -17092, -18447, -20006,
-  -21311, -21993, -22092, -21948,
-  -21832, -21799, -21832, -21990,
-  -22353, -22922, -23654, -24525,
-  -25477, -26361, -27039, -27550,
-  -28080, -28728, -29382, -29870,
-  -30163, -30342, -30423, -30352,
-  -30163, -30048, -30163, -30442,
-  -30684, -30807, -30944, -31256,
-  -31725, -32184, -32506, -32690,
-  -32766, -32712, -32506, -32219,
-  -31985, -31902, -31985, -32209,
-  -32506, -32745, -32767, -32495,
-  -31985, -31350, -30684, -30078,
-  -29642, -29430, -29382, -29388,
-  -29382, -29323, -29122, -28690,
-  -28080, -27483, -27039, -26689,
-  -26258, -25656, -24956, -24279,
-  -23654, -23023, -22353, -21733,
-  -21311, -21134, -21051, -20814,
-  -20270, -19440, -18447, -17406,
-  -16365, -15324, -14282, -13294,
-  -12460, -11793, -11158, -10409,
-   -9596,  -8892,  -8294,  -7548,
-   -6472,  -5225,  -4128,  -3287,
-   -2566,  -1872,  -1265,   -761,
-    -223,  -1367,    530,   2497,
-    4532,   6611,   8552,  10218,
-   11786,  13560,  15544,  17425,
-   19023,  20509,  22071,  23602,
-   24882,  25914,  26906,  27977,
-   29058,  30032,  30866,  31580,
-   32178,  32606,  32767,  32610,
-   32236,  31834,  31479,  31066,
-   30486,  29775,  28974,  27977,
-   26664,  25142,  23666,  22315,
-   20898,  19222,  17323,  15366,
-   13432,  11501,   9565,   7644,
-    5727,   3780,   1827,    -76,
-   -1962,  -3940,  -6029,  -8054,
-   -9830, -11404, -13011, -14746,
-  -16426, -17839, -19024, -20151,
-  -21198, -21957, -22381, -22725,
-  -23220, -23758, -24051, -24012,
-  -23797, -23501, -23005, -22210,
-  -21261, -20412, -19702, -18864,
-  -17629, -16037, -14400, -12945,
-  -11586, -10117,  -8535,  -7025,
-   -5646,  -4198,  -2486,   -591,
-    1266,   3008,   4705,   6358,
-    7858,   9185,  10455,  11762,
-   13074,  14332,  15532,  16653,
-   17625,  18450,  19228,  19998,
-   20639,  21024,  21199,  21285,
-   21267,  21024,  20550,  19998,
-   19487,  18965,  18301,  17425,
-   16347,  15104,  13737,  12277,
-   10748,   9185,   7640,   6100,
-    4424,   2493,    402,  -1620,
-   -3523,  -5485,  -7582,  -9599,
-  -11333, -12949, -14770, -16805,
-  -18745, -20412, -21950, -23497,
-  -24976, -26332, -27707, -29159,
-  -30426, -31222, -31640, -31990,
-  -32340, -32509, -32485, -32505,
-  -32672, -32767, -32546, -31990,
-  -31139, -29935, -28414, -26843,
-  -25477, -24273, -23035, -21695,
-  -20261, -18611, -16628, -14489,
-  -12549, -10890,  -9217,  -7282,
-   -5188,  -3168,  -1249,    695,
-    2673,   4552,   6272,   7902,
-    9482,  10986,  12468,  14079,
-   15827,  17421,  18536,  19226,
-   19886,  20767,  21679,  22315,
-   22695,  23083,  23495,  23602,
-   23204,  22568,  22092,  21800,
-   21404,  20767,  20019,  19226,
-   18225,  16906,  15442,  14079,
-   12822,  11501,  10023,   8417,
-    6687,   4809,   2852,    953,
-    -853,  -2654,  -4485,  -6253,
-   -7865,  -9345, -10768, -12172,
-  -13580, -15008, -16393, -17577,
-  -18459, -19126, -19753, -20408,
-  -21009, -21442, -21662, -21695,
-  -21606, -21442, -21162, -20666,
-  -19944, -19126, -18293, -17320,
-  -16035, -14493, -12921, -11400,
-   -9800,  -8058,  -6321,  -4709,
-   -3113,  -1367,   1109,    111,
-    -948,  -1636,  -1709,  -1276,
-    -692,   -342,   -428,   -920,
-   -1717,  -2784,  -4016,  -5064,
-   -5562,  -5573,  -5554,  -5785,
-   -6075,  -6153,  -6067,  -6022,
-   -6075,  -6269,  -6836,  -7954,
-   -9407, -10796, -11963, -12917,
-  -13509, -13596, -13501, -13838,
-  -14790, -15926, -16833, -17535,
-  -18123, -18425, -18371, -18364,
-  -18892, -19906, -20934, -21682,
-  -22224, -22704, -23241, -24102,
-  -25556, -27438, -29137, -30191,
-  -30683, -30960, -31188, -31346,
-  -31452, -31566, -31700, -31888,
-  -32221, -32619, -32726, -32311,
-  -31708, -31535, -31957, -32508,
-  -32734, -32705, -32726, -32767,
-  -32477, -31652, -30419, -29009,
-  -27607, -26449, -25805, -25705,
-  -25813, -25711, -25292, -24757,
-  -24275, -23753, -22985, -21963,
-  -20942, -20133, -19396, -18397,
-  -17097, -15924, -15295, -15133,
-  -15047, -14886, -14782, -14642,
-  -14021, -12715, -11194, -10135,
-   -9664,  -9357,  -8887,  -8293,
-   -7613,  -6645,  -5298,  -3920,
-   -2999,  -2632,  -2478,  -2198,
-   -1717,  -1103,   -428,    149,
-     332,    -85,   -940,  -1734,
-   -1974,  -1481,   -428,    817,
-    1870,   2438,   2391,   1829,
-    1101,    676,    853,   1545,
-    2383,   3042,   3416,   3521,
-    3408,   3262,   3416,   4054,
-    4946,   5652,   5980,   6091,
-    6228,   6554,   7261,   8504,
-   10073,  11361,  11875,  11701,
-   11355,  11324,  11875,  13064,
-   14687,  16298,  17515,  18289,
-   18788,  19153,  19565,  20338,
-   21608,  23006,  23923,  24084,
-   23658,  22953,  22385,  22625,
-   24171,  26615,  28793,  29938,
-   30323,  30585,  30844,  30886,
-   30836,  31074,  31613,  32045,
-   32117,  31938,  31613,  31104,
-   30579,  30501,  31100,  32007,
-   32630,  32767,  32638,  32441,
-   32117,  31566,  30844,  30081,
-   29298,  28430,  27511,  26728,
-   26222,  25890,  25461,  24779,
-   23915,  22960,  21872,  20650,
-   19557,  18939,  18796,  18710,
-   18276,  17463,  16489,  15525,
-   14687,  14139,  13926,  13696,
-   12893,  11356,   9568,   8149,
-    7253,   6650,   6236,   6124,
-    6228,   6112,   5467,   4503,
-    3665,   3099,   2647,   2219,
-    1870,   1553,   1109,    592,
-     332,    558,   1109,   1629,
-    1870,   1719,   1109,  -2410,
-   -1054,    483,   1907,   3607,
-    6034,   8857,  11364,  13289,
-   14646,  15138,  14519,  13289,
-   12200,  11212,   9769,   8056,
-    7118,   7549,   8860,  10411,
-   12237,  14614,  17380,  20093,
-   22410,  24035,  24755,  24803,
-   24716,  24558,  23787,  22187,
-   20385,  19063,  18182,  17476,
-   17196,  17754,  18980,  20355,
-   21729,  23250,  24799,  26112,
-   27269,  28483,  29495,  29775,
-   29283,  28483,  27638,  26635,
-   25512,  24558,  23847,  23233,
-   22929,  23511,  25128,  27159,
-   28925,  30315,  31493,  32392,
-   32767,  32409,  31102,  28729,
-   25666,  22726,  20445,  18785,
-   17741,  17754,  19123,  21402,
-   23849,  26128,  28091,  29252,
-   29134,  27960,  26370,  24542,
-   22218,  19586,  17422,  16168,
-   15423,  14614,  13763,  13289,
-   13384,  13829,  14245,  14336,
-   14095,  13829,  13795,  13813,
-   13577,  13306,  13566,  14336,
-   14797,  14353,  13366,  12504,
-   11772,  10689,   9145,   7532,
-    6155,   4932,   3672,   2299,
-     883,   -301,   -883,   -840,
-    -673,   -824,  -1106,  -1102,
-    -926,  -1086,  -1649,  -2149,
-   -2403,  -2917,  -4205,  -6074,
-   -7874,  -9198, -10055, -10523,
-  -10525,  -9983,  -9056,  -8167,
-   -7748,  -7889,  -8300,  -8691,
-   -9151,  -9983, -11237, -12616,
-  -13849, -14955, -16056, -17065,
-  -17657, -17572, -16944, -16280,
-  -15953, -15740, -15086, -13924,
-  -12898, -12600, -12953, -13663,
-  -14905, -17048, -19906, -22822,
-  -25427, -27777, -29800, -31195,
-  -31970, -32488, -32767, -32242,
-  -30530, -28039, -25523, -23345,
-  -21515, -20188, -19711, -20205,
-  -21385, -22805, -24179, -25438,
-  -26533, -27254, -27417, -27270,
-  -27411, -28039, -28602, -28579,
-  -28327, -28562, -29185, -29364,
-  -28794, -28039, -27437, -26485,
-  -24766, -22805, -21466, -20990,
-  -21174, -22020, -23570, -25438,
-  -27124, -28562, -29803, -30410,
-  -29797, -28039, -25767, -23345,
-  -20773, -18357, -16817, -16541,
-  -17213, -18357, -19818, -21513,
-  -23086, -24114, -24446, -24130,
-  -23161, -21497, -19217, -16541,
-  -13770, -11291,  -9520,  -8691,
-   -8694,  -9198,  -9926, -10784,
-  -11687, -12338, -12380, -11831,
-  -11127, -10506,  -9580,  -7906,
-   -5834,  -4226,  -3304,  -2410,
-    3606,   6038,   8484,  10488,
-   12198,  13979,  15644,  16627,
-   16780,  16415,  15644,  14245,
-   12198,   9826,   7338,   4718,
-    2174,    202,   -967,  -1583,
-   -1835,  -1509,   -394,   1324,
-    3319,   5453,   7624,   9608,
-   11339,  13095,  15071,  16993,
-   18499,  19713,  21085,  22770,
-   24513,  26067,  27386,  28428,
-   29096,  29401,  29391,  28897,
-   27664,  25776,  23663,  21571,
-   19358,  16966,  14784,  13227,
-   12198,  11351,  10775,  10986,
-   12198,  14000,  15930,  18023,
-   20504,  23202,  25668,  27756,
-   29669,  31403,  32542,  32767,
-   32246,  31303,  29964,  28124,
-   25945,  23755,  21658,  19584,
-   17640,  16056,  14784,  13515,
-   12198,  11198,  10775,  10721,
-   10766,  11052,  11920,  13370,
-   15062,  16769,  18508,  20270,
-   21936,  23500,  25095,  26679,
-   27950,  28758,  29391,  30216,
-   31101,  31493,  31109,  30319,
-   29669,  29162,  28245,  26519,
-   24227,  21891,  19653,  17238,
-   14489,  11650,   9056,   6831,
-    5038,   3902,   3615,   4068,
-    5038,   6546,   8770,  11635,
-   14776,  17926,  21085,  24229,
-   27091,  29346,  30823,  31440,
-   31101,  29799,  27673,  24846,
-   21363,  17348,  13066,   8687,
-    4179,   -400,  -4690,  -8325,
-  -11286, -13731, -15573, -16513,
-  -16441, -15565, -14141, -12302,
-  -10141,  -7767,  -5263,  -2734,
-    -403,   1523,   3042,   4237,
-    5038,   5296,   5047,   4466,
-    3606,   2428,   1037,   -382,
-   -1835,  -3412,  -4976,  -6316,
-   -7563,  -9047, -10704, -12128,
-  -13291, -14669, -16433, -18097,
-  -19306, -20422, -21874, -23388,
-  -24461, -25229, -26170, -27177,
-  -27611, -27240, -26457, -25570,
-  -24461, -23058, -21588, -20184,
-  -18733, -17273, -16146, -15545,
-  -15296, -15260, -15573, -16314,
-  -17301, -18430, -19869, -21681,
-  -23602, -25432, -27316, -29320,
-  -31048, -32065, -32471, -32682,
-  -32767, -32382, -31326, -29811,
-  -28184, -26601, -25025, -23367,
-  -21597, -19812, -18151, -16557,
-  -14723, -12427,  -9845,  -7386,
-   -5272,  -3442,  -1826,   -547,
-     169,    202,   -394,  -1487,
-   -2981,  -4790,  -6695,  -8348,
-   -9568, -10497, -11277, -11666,
-  -11286, -10169,  -8700,  -7029,
-   -4985,  -2629,   -394,   1553,
-    3606,   1937,   2655,   3017,
-    2368,   1387,   1375,   2466,
-    3062,   1387,  -2593,  -7167,
-  -10772, -13477, -16358, -19829,
-  -23116, -25313, -26358, -26711,
-  -26469, -25313, -23324, -21481,
-  -20980, -22010, -23391, -23683,
-  -22668, -21459, -21021, -20930,
-  -20037, -18156, -16413, -15700,
-  -15375, -14027, -11274,  -8268,
-   -6499,  -6595,  -8264, -10745,
-  -12992, -14027, -13875, -14049,
-  -16360, -20909, -25643, -28362,
-  -29000, -29442, -31027, -32767,
-  -32553, -29992, -27269, -26711,
-  -27860, -27790, -24501, -19279,
-  -15149, -13477, -12949, -11847,
-  -10326,  -9898, -11171, -12948,
-  -13698, -13477, -13927, -16251,
-  -19422, -20909, -19377, -16251,
-  -14135, -14027, -14800, -15150,
-  -14965, -14578, -13803, -12397,
-  -10575,  -8247,  -4527,    815,
-    5922,   8268,   7643,   6595,
-    7485,   9920,  11574,  10999,
-    9137,   8268,   9658,  12100,
-   12963,  11021,   7904,   6045,
-    5523,   4139,    669,  -3313,
-   -5575,  -6045,  -6439,  -7718,
-   -9168,  -9898, -10157, -10745,
-  -11667, -11825, -10094,  -6617,
-   -2889,   -264,   1570,   4118,
-    8013,  12122,  15044,  16780,
-   18223,  19554,  20087,  19532,
-   18459,  17352,  15886,  13477,
-   10151,   6617,   3625,   1365,
-    -606,  -2741,  -4706,  -5516,
-   -4756,  -3292,  -2227,  -1387,
-     497,   4139,   8869,  13477,
-   17179,  19554,  20263,  19532,
-   18607,  19003,  21005,  23111,
-   23367,  21481,  19440,  19532,
-   21635,  23132,  22036,  19532,
-   18378,  19003,  18594,  14578,
-    7998,   2488,    400,    815,
-    1128,   -264,  -2969,  -5516,
-   -6855,  -7146,  -7360,  -8268,
-   -9977, -12376, -15444, -18728,
-  -20956, -20909, -18606, -15150,
-  -11620,  -8797,  -7653,  -8819,
-  -11117, -11825,  -9504,  -6066,
-   -4991,  -7696, -12577, -17352,
-  -20936, -22560, -20365, -12397,
-     717,  14599,  23072,  22010,
-   12337,   -264,  -9278, -11847,
-   -9623,  -5494,   -541,   5219,
-   10426,  12672,  11439,   9348,
-    9805,  14049,  20756,  27515,
-   32011,  32767,  30111,  26414,
-   24392,  24784,  25970,  25863,
-   23804,  20655,  17601,  15128,
-   13006,  11021,   9497,   8797,
-    8320,   6617,   3073,   -836,
-   -2748,  -1916,     93,   1365,
-    1645,   1937, -10209,  -2528,
-    1899,    107,  -5587,  -9588,
-   -8371,  -3271,   1859,   4274,
-    3183,  -1025,  -6357,  -8746,
-   -4776,   3900,  10334,   8431,
-    -411,  -7793,  -6100,   4044,
-   13969,  14714,   5454,  -5212,
-   -7087,   1394,  11104,  11733,
-    3183,  -4495,  -3019,   4797,
-    9603,   7294,   2630,   1444,
-    3440,   4784,   4684,   5562,
-    7549,   6908,   1603,  -4128,
-   -3749,   3177,   9050,   6216,
-   -4006, -12054, -10209,   -723,
-    6779,   4995,  -4816, -14881,
-  -17359,  -9962,   1603,   6425,
-   -2465, -18998, -26900, -16205,
-    3440,  10751,  -3789, -25931,
-  -32767, -18317,    319,   3044,
-  -11196, -25639, -26387, -16529,
-   -8628,  -8400, -10979, -11505,
-  -12480, -17555, -22792, -20341,
-  -10426,  -3846,  -9439, -22162,
-  -27887, -19726,  -6100,  -1136,
-   -9142, -20873, -24589, -18368,
-  -10426,  -8835, -13290, -17362,
-  -16845, -13829, -12777, -14574,
-  -15818, -13550,  -9439,  -8376,
-  -12737, -18600, -18940, -11424,
-   -2208,   -143,  -6871, -14430,
-  -14021,  -5876,   1603,   2041,
-   -2208,  -4444,  -2248,    911,
-    1899,   2376,   5454,  10020,
-   11401,   7915,   4171,   6002,
-   13198,  19478,  19835,  15928,
-   13198,  14336,  17524,  20208,
-   21929,  22958,  22660,  20963,
-   19875,  21290,  23944,  24813,
-   23470,  22695,  24200,  26127,
-   26295,  25839,  27025,  28437,
-   25781,  18548,  13158,  16488,
-   26552,  32583,  26511,  13276,
-    6779,  14435,  28052,  32767,
-   23984,  11839,   8279,  13710,
-   19105,  18144,  12645,   7020,
-    2670,   -514,  -1221,   1263,
-    3954,   2445,  -3789, -10532,
-  -13507, -12546, -10979, -12154,
-  -16845, -23041, -27671, -29018,
-  -27887, -26491, -26387, -27640,
-  -29428, -30790, -31009, -30027,
-  -28658, -27984, -28441, -29648,
-  -30969, -31864, -31779, -30086,
-  -26347, -20792, -14831, -10939,
-  -11196, -15306, -20481, -23859,
-  -24806, -24447, -23562, -21945,
-  -19670, -17860, -17656, -18936,
-  -20440, -20917, -19967, -18106,
-  -16332, -15493, -15858, -17168,
-  -18900, -20218, -19967, -17554,
-  -14277, -13102, -15858, -20325,
-  -21211, -15501,  -6871,  -3223,
-   -8628, -18315, -23049, -18482,
-   -9142,  -3182,  -4559, -10659,
-  -15818, -15812, -10209,  -1467,
-  -10104,  -6211,   6508,  10173,
-   -1903, -14046,  -8448,  11068,
-   24007,  18190,   1511,  -9975,
-   -7850,   5206,  19923,  25172,
-   14599,  -5539, -17953,  -9975,
-   11561,  25354,  17839,  -1915,
-  -12107,  -1957,  17363,  25844,
-   15615,  -2853, -12824,  -6393,
-   10787,  25354,  26389,  13979,
-    -100,  -2629,   8200,  21590,
-   26136,  19981,   8424,  -3258,
-  -10515,  -7554,   7616,  25844,
-   31288,  17519,  -3175, -10422,
-    3597,  25354,  32767,  17337,
-   -6648, -16061,  -2344,  20247,
-   29931,  18638,  -2788, -17138,
-  -15526,  -2181,  10729,  13083,
-    5008,  -4196,  -6779,  -4602,
-   -3894,  -4868,  -2631,   2113,
-    1107,  -9121, -18977, -16243,
-   -2485,   7221,   1679, -13557,
-  -22566, -16061,   -289,   9949,
-    5716,  -8226, -18593, -16019,
-   -3183,   8116,   7787,  -3482,
-  -15295, -18300, -13514,  -9079,
-   -8593,  -7554,  -3260,  -1915,
-   -9630, -20539, -22600, -14004,
-   -4680,  -1062,    440,   2113,
-   -1421, -11360, -16810,  -9303,
-    2166,   2967,  -5199,  -8184,
-   -3085,  -1957,  -9212, -11766,
-    -398,  12370,   8915,  -6840,
-  -13954,  -3300,  11499,  13979,
-    4782,  -3300,  -3064,    770,
-     358,  -4868,  -7231,    323,
-   14247,  21548,  14236,    770,
-   -2509,   8564,  20828,  20695,
-    9909,    281,  -1795,    770,
-    3974,   7221,   9793,   9277,
-    5262,    281,  -4042,  -7512,
-   -7333,    281,  11439,  13979,
-    2114, -12479, -12871,    770,
-   10367,   3862,  -9228, -12437,
-   -5091,   -390,  -3966,  -6393,
-     170,   8116,   4698,  -9079,
-  -18379, -12927,    642,   6591,
-   -2843, -19643, -28222, -21392,
-   -8243,  -4196, -12827, -22064,
-  -21320, -16509, -20308, -31019,
-  -32767, -19195,  -5618,  -9303,
-  -24958, -31284, -20096,  -7064,
-   -9620, -23449, -29375, -19601,
-   -7198,  -7554, -18299, -24079,
-  -17590,  -7554,  -4785,  -8184,
-   -9675,  -7554,  -7073,  -9751,
-  -10647,  -7554,  -5222,  -7064,
-   -9198,  -7554,  -5324,  -7064,
-   -9742,  -7554,  -3486,  -7064,
-  -19295, -27926, -22155,  -7064,
-    1736,  -4196, -17855, -25422,
-  -20141,  -7554,    801,  -1915,
-  -12233, -20091, -17920,  -7064,
-    3362,   4310,  -4350, -12437,
-   -9839,    728,   5724,  -1467,
-     757,   2658,   4339,   5842,
-    7041,   7799,   8229,   8563,
-    8836,   8926,   8827,   8679,
-    8537,   8361,   8229,   8352,
-    8836,   9608,  10623,  11961,
-   13624,  15372,  16907,  18167,
-   19310,  20429,  21395,  22019,
-   22302,  22449,  22592,  22612,
-   22302,  21694,  21096,  20792,
-   20806,  21018,  21395,  22011,
-   22901,  24015,  25285,  26647,
-   27988,  29166,  30073,  30672,
-   30980,  31056,  30971,  30755,
-   30382,  29836,  29176,  28523,
-   27988,  27613,  27380,  27279,
-   27389,  27830,  28577,  29401,
-   30083,  30651,  31270,  31944,
-   32477,  32736,  32767,  32608,
-   32177,  31407,  30373,  29203,
-   27988,  26834,  25884,  25190,
-   24696,  24398,  24388,  24652,
-   24996,  25277,  25585,  26026,
-   26492,  26767,  26782,  26590,
-   26193,  25551,  24687,  23625,
-   22302,  20699,  19001,  17495,
-   16318,  15437,  14812,  14425,
-   14223,  14152,  14213,  14379,
-   14522,  14549,  14513,  14453,
-   14223,  13637,  12717,  11607,
-   10333,   8864,   7331,   5929,
-    4647,   3317,   1945,    746,
-    -140,   -746,  -1047,   -926,
-    -439,    109,    448,    490,
-     158,   -674,  -1945,  -3336,
-   -4628,  -5917,  -7331,  -8751,
-  -10015, -11196, -12418, -13520,
-  -14204, -14449, -14513, -14552,
-  -14503, -14346, -14213, -14190,
-  -14204, -14246, -14513, -15205,
-  -16299, -17607, -19001, -20467,
-  -21984, -23445, -24687, -25591,
-  -26174, -26551, -26782, -26779,
-  -26473, -25998, -25585, -25287,
-  -24977, -24622, -24388, -24414,
-  -24678, -25146, -25884, -26884,
-  -27969, -29009, -30073, -31201,
-  -32159, -32669, -32767, -32681,
-  -32458, -31970, -31270, -30611,
-  -30064, -29419, -28577, -27795,
-  -27371, -27294, -27380, -27580,
-  -27969, -28538, -29176, -29802,
-  -30363, -30770, -30971, -31021,
-  -30962, -30690, -30073, -29128,
-  -27969, -26668, -25285, -23971,
-  -22882, -22041, -21395, -20959,
-  -20787, -20855, -21096, -21489,
-  -21984, -22408, -22592, -22530,
-  -22284, -21821, -21096, -20212,
-  -19291, -18249, -16907, -15286,
-  -13606, -12030, -10623,  -9509,
-   -8818,  -8462,  -8229,  -8097,
-   -8219,  -8559,  -8827,  -8867,
-   -8818,  -8771,  -8528,  -7847,
-   -6723,  -5251,  -3441,  -1354,
-     757,    812,   4224,   7263,
-    9800,  11788,  13263,  14365,
-   15249,  15985,  16622,  17271,
-   18026,  18890,  19883,  21145,
-   22786,  24701,  26667,  28570,
-   30353,  31803,  32622,  32767,
-   32521,  32126,  31509,  30507,
-   29213,  27929,  26853,  25987,
-   25339,  25024,  25087,  25341,
-   25490,  25347,  24874,  24050,
-   22812,  21150,  19158,  16948,
-   14575,  12111,   9719,   7586,
-    5802,   4363,   3250,   2421,
-    1760,   1134,    498,   -161,
-    -963,  -2093,  -3593,  -5326,
-   -7185,  -9195, -11339, -13397,
-  -15089, -16297, -17032, -17271,
-  -16985, -16297, -15462, -14688,
-  -14076, -13715, -13702, -14043,
-  -14621, -15329, -16126, -16948,
-  -17618, -17911, -17689, -16948,
-  -15791, -14360, -12782, -11137,
-   -9484,  -7904,  -6491,  -5326,
-   -4480,  -4030,  -4015,  -4358,
-   -4869,  -5321,  -5516,  -5326,
-   -4712,  -3707,  -2377,   -807,
-     855,   2426,   3803,   5003,
-    6006,   6623,   6620,   5972,
-    4905,   3717,   2626,   1775,
-    1267,   1134,   1329,   1775,
-    2389,   3071,   3740,   4358,
-    4846,   5008,   4636,   3712,
-    2396,    812,   -976,  -2744,
-   -4071,  -4675,  -4673,  -4358,
-   -3835,  -3061,  -2160,  -1452,
-   -1134,  -1124,  -1314,  -1775,
-   -2610,  -3707,  -4791,  -5649,
-   -6181,  -6290,  -5884,  -5003,
-   -3807,  -2416,   -856,    807,
-    2392,   3717,   4703,   5326,
-    5537,   5331,   4856,   4358,
-    4041,   4040,   4457,   5326,
-    6535,   7914,   9424,  11137,
-   12987,  14693,  16009,  16948,
-   17615,  17921,  17679,  16948,
-   16081,  15339,  14682,  14043,
-   13629,  13725,  14294,  15011,
-   15668,  16307,  16924,  17271,
-   17077,  16307,  15065,  13397,
-   11368,   9205,   7169,   5326,
-    3616,   2103,    951,    161,
-    -477,  -1124,  -1771,  -2421,
-   -3229,  -4353,  -5812,  -7586,
-   -9699, -12100, -14585, -16948,
-  -19139, -21140, -22821, -24050,
-  -24856, -25336, -25497, -25341,
-  -25073, -25014, -25335, -25987,
-  -26868, -27919, -29060, -30184,
-  -31226, -32116, -32688, -32767,
-  -32329, -31470, -30221, -28570,
-  -26645, -24691, -22851, -21145,
-  -19658, -18557, -17841, -17271,
-  -16645, -15974, -15276, -14365,
-  -13006, -11132,  -8788,  -5972,
-   -2701,    812,    585,   2988,
-    5279,   7387,   9191,  10679,
-   11929,  12989,  13885,  14687,
-   15450,  16119,  16623,  17014,
-   17406,  17817,  18188,  18537,
-   18970,  19531,  20144,  20738,
-   21318,  21906,  22491,  23071,
-   23665,  24264,  24838,  25401,
-   26012,  26653,  27185,  27478,
-   27576,  27685,  27968,  28384,
-   28750,  28965,  29141,  29459,
-   29923,  30368,  30706,  31045,
-   31488,  31946,  32271,  32478,
-   32662,  32767,  32662,  32416,
-   32271,  32291,  32271,  32077,
-   31879,  31858,  31879,  31721,
-   31488,  31521,  31879,  32218,
-   32271,  32191,  32271,  32504,
-   32662,  32669,  32662,  32699,
-   32662,  32484,  32271,  32100,
-   31879,  31521,  31097,  30707,
-   30315,  29884,  29532,  29347,
-   29141,  28654,  27968,  27438,
-   27185,  26923,  26403,  25760,
-   25229,  24744,  24056,  23118,
-   22100,  21109,  20144,  19266,
-   18579,  18025,  17406,  16644,
-   15841,  15068,  14276,  13456,
-   12712,  12098,  11538,  10954,
-   10365,   9789,   9191,   8579,
-    8017,   7482,   6844,   6069,
-    5279,   4534,   3714,   2741,
-    1759,    937,    194,   -692,
-   -1761,  -2820,  -3717,  -4498,
-   -5282,  -6091,  -6846,  -7479,
-   -8020,  -8573,  -9193,  -9816,
-  -10367, -10908, -11540, -12193,
-  -12714, -13183, -13888, -14885,
-  -15843, -16495, -17017, -17721,
-  -18582, -19382, -20146, -21070,
-  -22102, -22981, -23667, -24394,
-  -25232, -25949, -26405, -26762,
-  -27188, -27619, -27970, -28322,
-  -28752, -29180, -29535, -29894,
-  -30317, -30733, -31099, -31486,
-  -31882, -32148, -32273, -32431,
-  -32664, -32767, -32664, -32590,
-  -32664, -32623, -32273, -31909,
-  -31882, -32009, -31882, -31567,
-  -31491, -31718, -31882, -31846,
-  -31882, -32110, -32273, -32243,
-  -32273, -32508, -32664, -32509,
-  -32273, -32247, -32273, -32010,
-  -31491, -31027, -30708, -30362,
-  -29926, -29511, -29144, -28747,
-  -28361, -28112, -27970, -27795,
-  -27579, -27407, -27188, -26716,
-  -26014, -25348, -24841, -24323,
-  -23667, -23009, -22493, -22000,
-  -21320, -20488, -19755, -19282,
-  -18973, -18634, -18191, -17745,
-  -17408, -17109, -16626, -15874,
-  -15061, -14427, -13888, -13112,
-  -11932, -10463,  -8802,  -6841,
-   -4499,  -1940,    585,   1552,
-    8079,  14004,  19128,  23322,
-   26578,  29035,  30866,  32133,
-   32767,  32664,  31807,  30319,
-   28436,  26444,  24593,  23062,
-   21951,  21260,  20855,  20471,
-   19853,  18928,  17842,  16842,
-   16135,  15818,  15858,  16065,
-   16136,  15818,  15057,  13992,
-   12817,  11671,  10605,   9586,
-    8560,   7525,   6547,   5698,
-    5034,   4674,   4798,   5439,
-    6320,   7006,   7231,   6994,
-    6386,   5451,   4241,   2848,
-    1296,   -508,  -2635,  -4926,
-   -7020,  -8542,  -9301,  -9332,
-   -8826,  -8024,  -7164,  -6481,
-   -6117,  -5951,  -5589,  -4667,
-   -3197,  -1545,    -81,   1033,
-    1763,   2082,   2083,   2070,
-    2387,   3119,   4010,   4662,
-    4805,   4415,   3671,   2848,
-    2236,   2082,   2497,   3366,
-    4379,   5192,   5578,   5439,
-    4768,   3637,   2178,    515,
-   -1224,  -2841,  -4103,  -4926,
-   -5417,  -5692,  -5764,  -5704,
-   -5729,  -5951,  -6146,  -5963,
-   -5314,  -4396,  -3432,  -2594,
-   -2090,  -2063,  -2356,  -2594,
-   -2511,  -2063,  -1277,   -261,
-     650,   1046,    822,    256,
-    -327,   -768,   -946,   -780,
-    -426,   -249,   -429,   -780,
-   -1023,  -1027,   -713,     -2,
-     972,   1823,   2258,   2329,
-    2233,   2082,   2025,   2329,
-    3119,   4156,   5073,   5698,
-    6005,   5970,   5686,   5439,
-    5419,   5451,   5229,   4662,
-    3802,   2601,   1008,   -780,
-   -2453,  -3877,  -5022,  -5704,
-   -5718,  -5173,  -4414,  -3630,
-   -2860,  -2322,  -2393,  -3112,
-   -4030,  -4655,  -4847,  -4667,
-   -4137,  -3359,  -2658,  -2335,
-   -2336,  -2322,  -2008,  -1298,
-    -181,   1305,   2957,   4403,
-    5324,   5711,   5878,   6217,
-    6898,   7784,   8588,   9068,
-    9035,   8302,   6781,   4662,
-    2369,    268,  -1535,  -3112,
-   -4507,  -5692,  -6625,  -7259,
-   -7497,  -7247,  -6558,  -5704,
-   -5067,  -4914,  -5266,  -5963,
-   -6832,  -7765,  -8692,  -9591,
-  -10537, -11652, -12949, -14256,
-  -15341, -16058, -16370, -16329,
-  -16125, -16058, -16375, -17107,
-  -18105, -19168, -20096, -20735,
-  -21116, -21501, -22196, -23327,
-  -24848, -26684, -28701, -30583,
-  -31951, -32645, -32767, -32398,
-  -31397, -29535, -26686, -22809,
-  -17864, -11912,  -5269,   1552,
-    3623,  10829,  15675,  17326,
-   16339,  14384,  13333,  14161,
-   16339,  18092,  17348,  12795,
-    4627,  -5143, -13102, -15781,
-  -11434,  -1012,  12329,  24559,
-   32067,  32767,  27053,  17927,
-    9646,   5602,   6975,  12733,
-   20355,  26739,  29395,  27558,
-   22363,  15836,   9652,   4530,
-     277,  -3841,  -8418, -13169,
-  -16789, -17655, -14776,  -8325,
-     277,   8717,  14671,  16951,
-   16004,  13368,  10656,   8807,
-    7639,   5751,   1286,  -6556,
-  -16454, -25399, -30169, -28681,
-  -20804,  -8705,   3628,  12061,
-   14331,  11018,   4967,   -145,
-   -1395,   2078,   8648,  15099,
-   18347,  16818,  10990,   3231,
-   -3069,  -5142,  -2394,   3393,
-    9312,  12780,  12329,   7957,
-    1281,  -4995,  -8418,  -7951,
-   -4073,   1941,   8648,  14701,
-   19016,  20900,  20025,  16364,
-   10316,   2887,  -4402,  -9916,
-  -12438, -11662,  -8418,  -4343,
-   -1061,    611,    951,   1071,
-    2285,   5258,   9317,  12527,
-   12658,   8427,    282,  -9500,
-  -17458, -20388, -17118,  -9389,
-   -1061,   3784,   2624,  -4491,
-  -14781, -23661, -26822, -22453,
-  -12104,    290,  10321,  14882,
-   13327,   7743,   1955,   -466,
-    1950,   8012,  14671,  18525,
-   17343,  11088,   1955,  -6720,
-  -12104, -13073, -10425,  -6170,
-   -2399,   -295,    282,    480,
-    1615,   4296,   7979,  11197,
-   12324,  10357,   5301,  -1921,
-   -9761, -16434, -20464, -21183,
-  -18796, -14020,  -7748,  -1075,
-    4627,   7957,   7979,   4639,
-   -1061,  -7191, -11429, -12032,
-   -8757,  -3105,   2290,   4796,
-    2954,  -2770, -10091, -15920,
-  -17792, -14959,  -8752,  -2131,
-    1615,    618,  -4402, -10439,
-  -13777, -11730,  -3733,   8342,
-   20689,  29058,  30734,  25777,
-   16674,   6815,  -1056,  -5750,
-   -7753,  -8661, -10091, -12633,
-  -15450, -16741, -14776,  -8965,
-    -392,   8565,  15340,  18314,
-   17343,  13556,   8648,   3988,
-     -57,  -4116,  -9087, -15245,
-  -21808, -27094, -29165, -26802,
-  -20470, -12542,  -6410,  -4926,
-   -9092, -17528, -26822, -32767,
-  -32182, -24440, -11764,   1794,
-   11989,  15913,  12998,   5114,
-   -4407, -12335, -16783, -17616,
-  -16119, -14219, -13437, -14011,
-  -14781, -13991, -10425,  -4122,
-    3623,   3306,   9758,  14045,
-   15692,  15189,  13744,  12895,
-   13721,  15955,  17902,  17495,
-   13626,   6756,  -1283,  -7803,
-  -10027,  -6276,   2928,  14811,
-   25577,  32055,  32767,  28228,
-   20739,  13656,  10061,  11362,
-   16708,  23622,  29279,  31677,
-   30261,  25922,  20380,  15195,
-   11010,   7522,   4063,    245,
-   -3659,  -6659,  -7365,  -4737,
-    1097,   8672,  15875,  20945,
-   23067,  22472,  20248,  17878,
-   16388,  15572,  14036,  10212,
-    3586,  -4743, -12398, -16620,
-  -15414,  -8576,   1905,  12512,
-   19741,  21705,  18876,  13662,
-    9180,   7906,  10680,  16345,
-   22173,  25155,  23635,  18261,
-   11540,   6372,   4676,   6762,
-   11399,  16339,  19224,  18645,
-   14749,   9056,   3710,    629,
-     821,   4073,   9213,  14811,
-   19736,  23238,  24784,  24011,
-   20837,  15572,   9031,   2545,
-   -2385,  -4743,  -4408,  -2054,
-    1199,   4073,   5567,   5612,
-    5274,   5989,   8385,  11745,
-   14384,  14422,  10637,   3312,
-   -5428, -12409, -14997, -12403,
-   -6033,   1006,   5071,   3695,
-   -2946, -12026, -19580, -22369,
-  -19026, -10493,    117,   8678,
-   12146,  10206,   5146,    245,
-   -1876,   -143,   4685,  10212,
-   13392,  12122,   6418,  -1670,
-   -9239, -13942, -14894, -12786,
-   -9320,  -6276,  -4662,  -4353,
-   -4367,  -3593,  -1527,   1395,
-    3988,   4839,   2971,  -1670,
-   -8176, -15092, -20969, -24669,
-  -25528, -23525, -19321, -13936,
-   -8367,  -3593,   -765,   -904,
-   -4139,  -9343, -14621, -18153,
-  -18760, -16242, -11632,  -7037,
-   -4785,  -6276, -11243, -17770,
-  -23041, -24675, -22038, -16620,
-  -11153,  -8193,  -9033, -13170,
-  -18309, -21225, -19396, -12403,
-   -2105,   8289,  15451,  17111,
-   13045,   5223,  -3314, -10103,
-  -14160, -15859, -16441, -17386,
-  -19471, -21992, -23113, -21219,
-  -16016,  -8576,   -794,   5229,
-    7949,   7139,   3922,   -137,
-   -4002,  -7426, -10762, -14703,
-  -19759, -25442, -30037, -31569,
-  -29152, -23525, -16681, -11253,
-   -9716, -13176, -20388, -28119,
-  -32767, -31958, -25275, -14320,
-   -2362,   6756,  10315,   7912,
-    1315,  -6659, -13332, -17003,
-  -17450, -15859, -14007, -13170,
-  -13472, -13942, -13082,  -9720,
-   -3825,   3306,   2318,   7825,
-   11627,  13101,  12888,  12204,
-   12049,  12897,  14579,  16175,
-   16277,  13857,   9083,   3408,
-   -1057,  -2353,    627,   7595,
-   16700,  25107,  30223,  30875,
-   27693,  22611,  17962,  15674,
-   16700,  20673,  25995,  30559,
-   32767,  32169,  29377,  25539,
-   21774,  18713,  16271,  13892,
-   11204,   8486,   6546,   6264,
-    8244,  12549,  18385,  24136,
-   28116,  29564,  28955,  27423,
-   26002,  25183,  24727,  23685,
-   20928,  16051,   9929,   4412,
-    1479,   2441,   7392,  14951,
-   22619,  27872,  29377,  27498,
-   23888,  20676,  19653,  21543,
-   25579,  29767,  31914,  30815,
-   26847,  21702,  17539,  16017,
-   17546,  21092,  24727,  26646,
-   26002,  23050,  18807,  14665,
-   12049,  11899,  14157,  17841,
-   21774,  25195,  27686,  28808,
-   28116,  25505,  21344,  16295,
-   11204,   7084,   4855,   4846,
-    6553,   8899,  10774,  11514,
-   11204,  10630,  10774,  12100,
-   14163,  15752,  15425,  12261,
-    6553,    -57,  -5291,  -7352,
-   -5707,  -1314,   3587,   6259,
-    4862,   -400,  -7405, -13332,
-  -15854, -13832,  -7828,   -241,
-    5707,   7843,   6123,   2159,
-   -1902,  -4081,  -3177,    387,
-    4439,   6369,   4855,    340,
-   -5707, -11526, -15438, -16468,
-  -15009, -12605, -10788, -10147,
-  -10358, -10680, -10365,  -9022,
-   -6976,  -5219,  -4868,  -6585,
-  -10358, -15524, -20935, -25389,
-  -28116, -28872, -27700, -24845,
-  -20928, -16913, -13747, -12116,
-  -12472, -14911, -18821, -22864,
-  -25579, -26075, -24317, -21110,
-  -17968, -16596, -17975, -21745,
-  -26424, -30173, -31505, -29856,
-  -26002, -21898, -19666, -20364,
-  -23465, -27216, -29391, -28171,
-  -23042, -15265,  -7405,  -2133,
-   -1056,  -4163,  -9942, -16149,
-  -20928, -23626, -24740, -25248,
-  -26002, -27372, -28968, -29633,
-  -28116, -24068, -18398, -12662,
-   -8244,  -5988,  -6137,  -8229,
-  -11204, -14005, -16284, -18502,
-  -21351, -25037, -28968, -31953,
-  -32767, -30795, -26431, -21063,
-  -16700, -15252, -17552, -22656,
-  -28116, -31215, -30236, -24988,
-  -16700,  -7679,   -640,   2402,
-    1057,  -3456,  -9096, -13837,
-  -16277, -16179, -14593, -13078,
-  -12472, -12427, -12056, -10662,
-   -7821,  -3345,   2318,   1341,
-    4453,   6712,   7856,   8239,
-    8494,   9012,   9846,  10922,
-   11989,  12461,  11717,   9772,
-    7473,   5946,   5975,   7856,
-   11417,  15910,  20098,  22802,
-   23494,  22425,  20417,  18587,
-   17963,  18976,  21247,  23952,
-   26321,  27790,  28004,  27018,
-   25425,  23958,  22900,  22036,
-   21111,  20126,  19220,  18587,
-   18604,  19742,  22098,  25102,
-   27851,  29707,  30517,  30467,
-   29917,  29323,  29021,  28934,
-   28569,  27407,  25343,  22802,
-   20542,  19359,  19825,  22036,
-   25440,  28940,  31351,  32000,
-   31049,  29323,  27846,  27401,
-   28271,  30090,  31934,  32767,
-   32056,  30090,  27726,  25868,
-   25086,  25491,  26748,  28168,
-   28951,  28557,  26970,  24718,
-   22598,  21275,  21006,  21653,
-   22883,  24341,  25686,  26635,
-   26999,  26641,  25393,  23186,
-   20313,  17443,  15237,  13988,
-   13643,  13994,  14670,  15137,
-   15003,  14377,  13772,  13605,
-   13898,  14377,  14598,  13988,
-   12088,   9012,   5578,   2874,
-    1665,   2113,   3751,   5556,
-    6297,   5179,   2326,  -1341,
-   -4588,  -6317,  -5922,  -3640,
-    -595,   1730,   2293,    958,
-   -1545,  -4018,  -5367,  -5173,
-   -3886,  -2485,  -1942,  -2874,
-   -5319,  -8616, -11661, -13605,
-  -14362, -14365, -14017, -13605,
-  -13503, -13982, -14761, -15137,
-  -14746, -13982, -13575, -13988,
-  -15307, -17431, -20087, -22802,
-  -25085, -26629, -27294, -27018,
-  -25907, -24329, -22776, -21653,
-  -21225, -21647, -22899, -24718,
-  -26653, -28162, -28740, -28168,
-  -26797, -25479, -25051, -25868,
-  -27738, -30078, -32038, -32767,
-  -31936, -30078, -28260, -27401,
-  -27841, -29311, -31047, -32000,
-  -31332, -28928, -25472, -22036,
-  -19633, -18964, -20201, -22802,
-  -25673, -27778, -28746, -28934,
-  -28983, -29311, -29914, -30467,
-  -30524, -29695, -27816, -25102,
-  -22156, -19730, -18371, -18203,
-  -18952, -20114, -21205, -22036,
-  -22826, -23946, -25476, -27018,
-  -27947, -27778, -26364, -23952,
-  -21192, -18964, -18010, -18587,
-  -20350, -22413, -23570, -22802,
-  -19874, -15515, -10987,  -7473,
-   -5726,  -5934,  -7615,  -9772,
-  -11416, -12066, -11789, -10922,
-   -9869,  -9000,  -8428,  -7856,
-   -6760,  -4784,  -1954,   1341,
-    2831,    561,  -1752,  -3865,
-   -5528,  -6726,  -7686,  -8595,
-   -9304,  -9471,  -9034,  -8341,
-   -7686,  -6925,  -5798,  -4462,
-   -3371,  -2708,  -2292,  -2023,
-   -2022,  -2278,  -2562,  -2837,
-   -3371,  -4220,  -4989,  -5358,
-   -5528,  -5803,  -6067,  -6045,
-   -5798,  -5506,  -4989,  -3948,
-   -2562,  -1286,   -134,   1304,
-    3101,   4786,   6067,   7216,
-    8495,   9669,  10382,  10649,
-   10652,  10341,   9573,   8444,
-    7146,   5670,   3910,   1926,
-    -134,  -2213,  -4180,  -5710,
-   -6607,  -7088,  -7416,  -7393,
-   -6607,  -5099,  -3371,  -1699,
-     134,   2340,   4719,   6957,
-    9034,  11093,  13079,  14763,
-   16046,  17052,  17934,  18704,
-   19282,  19630,  19822,  19972,
-   20091,  20061,  19822,  19503,
-   19282,  19155,  19012,  18900,
-   19012,  19392,  19822,  20112,
-   20361,  20797,  21440,  22027,
-   22249,  22006,  21440,  20725,
-   19822,  18486,  16585,  14319,
-   12001,   9678,   7146,   4336,
-    1483,  -1168,  -3640,  -6084,
-   -8495, -10694, -12540, -14030,
-  -15237, -16195, -16855, -17148,
-  -17125, -16985, -16855, -16605,
-  -16046, -15293, -14697, -14397,
-  -14158, -13770, -13349, -13115,
-  -13079, -13148, -13349, -13733,
-  -14158, -14405, -14428, -14283,
-  -13888, -13056, -11731, -10010,
-   -7955,  -5555,  -2831,    152,
-    3371,   6754,  10113,  13287,
-   16316,  19261,  21979,  24289,
-   26294,  28239,  30070,  31445,
-   32227,  32622,  32767,  32495,
-   31688,  30540,  29261,  27735,
-   25755,  23396,  20900,  18307,
-   15507,  12591,   9843,   7368,
-    4989,   2601,    404,  -1372,
-   -2831,  -4325,  -6067,  -7965,
-   -9843, -11698, -13619, -15566,
-  -17394, -19107, -20900, -22841,
-  -24676, -26145, -27373, -28677,
-  -30070, -31223, -31957, -32433,
-  -32767, -32764, -32227, -31262,
-  -30070, -28629, -26833, -24754,
-  -22518, -20085, -17394, -14625,
-  -12001,  -9469,  -6877,  -4376,
-   -2292,   -621,    943,   2468,
-    3640,   4299,   4719,   5166,
-    5528,   5654,   5798,   6373,
-    7416,   8622,   9843,  11219,
-   12810,  14400,  15776,  16990,
-   18203,  19397,  20361,  20941,
-   21170,  21153,  20900,  20308,
-   19282,  17835,  16046,  13987,
-   11731,   9404,   7146,   4991,
-    2831,  -7217,  -3713,   -521,
-    2043,   4322,   6810,   9479,
-   11633,  12528,  12139,  11274,
-   10876,  11246,  11980,  12556,
-   12878,  13297,  14302,  16146,
-   18515,  20478,  21122,  20506,
-   19683,  19452,  19273,  17941,
-   15264,  12528,  11151,  11274,
-   11888,  12015,  11558,  11274,
-   12119,  14323,  16874,  18198,
-   17648,  16118,  14925,  14351,
-   13606,  12015,   9786,   7684,
-    6339,   5861,   5745,   5119,
-    3467,   1245,   -533,  -1547,
-   -2747,  -5422,  -9765, -14625,
-  -18663, -21577, -24097, -26934,
-  -29903, -32091, -32767, -32063,
-  -30850, -30039, -29921, -30011,
-  -29535, -28244, -26803, -26165,
-  -26425, -26449, -24887, -21549,
-  -17573, -14140, -11212,  -7701,
-   -2851,   2783,   7805,  11274,
-   13410,  15092,  16901,  18711,
-   20008,  20478,  20385,  20506,
-   21556,  23555,  25772,  27429,
-   28401,  29196,  30343,  31789,
-   32767,  32274,  30006,  26916,
-   24457,  23042,  21636,  19223,
-   16295,  14323,  13955,  14351,
-   14274,  13297,  11883,  10761,
-   10327,  10220,   9414,   7171,
-    4043,   1501,    415,    247,
-     -99,  -1062,  -2202,  -2829,
-   -2598,  -1831,  -1456,  -2316,
-   -4306,  -6447,  -8043,  -9496,
-  -11759, -15166, -19003, -22062,
-  -23582, -23885, -24128, -25139,
-  -26472, -26962, -26229, -25139,
-  -24721, -25167, -26059, -26934,
-  -27338, -26962, -26149, -25652,
-  -25358, -23885, -20194, -15138,
-  -10578,  -7217,  -4165,   -521,
-    3512,   7143,   9800,  11274,
-   11754,  12015,  12913,  14351,
-   15272,  15092,  14633,  15120,
-   16597,  17913,  18133,  17428,
-   16583,  16118,  15972,  15633,
-   14417,  12015,   9073,   6914,
-    6262,   6374,   5906,   4607,
-    3593,   3809,   4750,   5119,
-    4320,   2783,   1141,   -265,
-   -1238,  -1831,  -2622,  -4111,
-   -5684,  -5934,  -4405,  -2316,
-   -1055,   -549,    205,   1529,
-    2763,   3296,   3053,   2042,
-     262,  -1831,  -3503,  -4624,
-   -5786,  -7217,  -8183,  -7958,
-   -7016,  -6704,  -7788,  -9753,
-  -11567, -12858, -14205, -16420,
-  -19648, -23116, -25727, -26934,
-  -27083, -26962, -27014, -26934,
-  -26003, -23885, -21166, -18985,
-  -17992, -17730, -17186, -15907,
-  -14396, -13371, -12847, -12061,
-  -10216,  -7217,  -1551,   3862,
-    8962,  13646,  17999,  22101,
-   25887,  28926,  30547,  30550,
-   29681,  29051,  29088,  29366,
-   29389,  29180,  29088,  29406,
-   30265,  31521,  32590,  32767,
-   32015,  31140,  30839,  30827,
-   30265,  28946,  27629,  27168,
-   27638,  28407,  28796,  28606,
-   28222,  28297,  29088,  29946,
-   29681,  27653,  24419,  21116,
-   18300,  15596,  12455,   9006,
-    6044,   4272,   3700,   3724,
-    3709,   3492,   3408,   3878,
-    4877,   5773,   5743,   4490,
-    2542,    728,   -676,  -2192,
-   -4460,  -7426, -10306, -12340,
-  -13507, -14516, -16142, -18528,
-  -21094, -23145, -24605, -26077,
-  -28097, -30379, -31900, -31799,
-  -30140, -27780, -25480, -23178,
-  -20218, -16301, -12057,  -8532,
-   -6211,  -4752,  -3594,  -2510,
-   -1542,   -786,   -384,   -382,
-    -375,    345,   1949,   3657,
-    4585,   4807,   5159,   6098,
-    7211,   7793,   7494,   6437,
-    5168,   4494,   4868,   5842,
-    6628,   7307,   8953,  12209,
-   16257,  19638,  21793,  23339,
-   25012,  26772,  27921,  27760,
-   26179,  23852,  21793,  20487,
-   19467,  17929,  15665,  13227,
-   11297,  10136,   9537,   9009,
-    8087,   6733,   5451,   4711,
-    4293,   3476,   1949,    277,
-    -667,   -552,    198,    882,
-    1083,    908,    782,    945,
-    1083,    500,  -1260,  -3956,
-   -6795,  -9055, -10598, -11800,
-  -12923, -13570, -12932, -10665,
-   -7379,  -4084,  -1260,   1379,
-    4293,   7536,  10704,  13233,
-   14798,  15650,  16540,  18016,
-   19759,  20918,  21209,  21336,
-   22094,  23330,  24127,  23855,
-   22677,  21109,  19458,  17775,
-   15966,  13774,  10996,   7995,
-    5752,   4957,   5159,   5258,
-    4877,   4785,   5743,   7385,
-    8670,   9141,   9245,   9539,
-   10129,  10872,  11579,  11857,
-   11297,  10130,   9245,   9148,
-    9254,   8636,   7202,   5626,
-    4293,   2900,   1074,  -1154,
-   -3585,  -6056,  -8263,  -9800,
-  -10589, -10928, -10889, -10064,
-   -8254,  -6129,  -4761,  -4620,
-   -5336,  -6381,  -7680,  -9553,
-  -12339, -16055, -20228, -24054,
-  -26930, -28899, -30441, -31824,
-  -32767, -32759, -31608, -29703,
-  -27806, -26466, -25480, -24050,
-  -21678, -18784, -16142, -13786,
-  -10880,  -6728,  -1551,  -1348,
-    3675,   9117,  14800,  20090,
-   24487,  27942,  30525,  32117,
-   32692,  32648,  32560,  32640,
-   32711,  32648,  32591,  32640,
-   32591,  32125,  31189,  30026,
-   28906,  27942,  27162,  26627,
-   26429,  26635,  27252,  28195,
-   29279,  30295,  31148,  31856,
-   32400,  32648,  32473,  31856,
-   30766,  28988,  26229,  22443,
-   17963,  13301,   8874,   4926,
-    1582,  -1078,  -2968,  -3963,
-   -3993,  -3170,  -1726,    220,
-    2718,   5718,   8870,  11724,
-   14069,  15915,  17203,  17737,
-   17432,  16438,  14954,  13031,
-   10642,   7810,   4587,   1004,
-   -2854,  -6830, -10839, -14944,
-  -19171, -23302, -26960, -29847,
-  -31796, -32715, -32658, -31938,
-  -30992, -30100, -29346, -28801,
-  -28591, -28793, -29400, -30370,
-  -31523, -32453, -32767, -32461,
-  -31854, -31146, -30335, -29585,
-  -29292, -29577, -30052, -30370,
-  -30713, -31407, -32258, -32723,
-  -32617, -32192, -31495, -30108,
-  -27637, -24086, -19596, -14159,
-   -7892,  -1340,   4793,  10155,
-   14745,  18530,  21308,  22966,
-   23681,  23759,  23367,  22443,
-   20841,  18530,  15670,  12508,
-    9226,   5980,   3035,    743,
-    -694,  -1340,  -1361,   -825,
-     256,   1797,   3642,   5710,
-    8036,  10686,  13676,  16953,
-   20382,  23759,  26862,  29503,
-   31501,  32648,  32767,  31856,
-   30188,  28204,  26266,  24535,
-   23103,  22190,  22057,  22705,
-   23812,  25066,  26426,  27934,
-   29414,  30557,  31240,  31594,
-   31779,  31864,  31896,  31856,
-   31562,  30818,  29693,  28457,
-   27179,  25589,  23404,  20613,
-   17337,  13562,   9168,   4142,
-   -1314,  -6830, -11991, -16512,
-  -20353, -23564, -26075, -27755,
-  -28662, -29054, -29108, -28801,
-  -28083, -26963, -25396, -23310,
-  -20797, -18073, -15232, -12329,
-   -9754,  -8138,  -7721,  -8146,
-   -9098, -10752, -13276, -16251,
-  -19080, -21733, -24566, -27494,
-  -29903, -31407, -32191, -32461,
-  -31978, -30361, -27561, -23833,
-  -19497, -14936, -10658,  -7100,
-   -4430,  -2647,  -1778,  -1871,
-   -2894,  -4739,  -7256, -10238,
-  -13456, -16766, -20050, -23049,
-  -25408, -26963, -27849, -28278,
-  -28330, -28008, -27313, -26186,
-  -24554, -22518, -20289, -17820,
-  -14723, -10752,  -6161,  -1348,
-   -2628,   3322,   8778,  13332,
-   16448,  17979,  18174,  17246,
-   15309,  12681,   9917,   7429,
-    5343,   3741,   2798,   2605,
-    3065,   4036,   5361,   6753,
-    7906,   8798,   9632,  10394,
-   10753,  10526,   9917,   9099,
-    7906,   6235,   4507,   3312,
-    2781,   2695,   3083,   4197,
-    5913,   7660,   9062,  10194,
-   11038,  11156,  10201,   8401,
-    6197,   3690,    805,  -2210,
-   -4906,  -7103,  -8874, -10126,
-  -10600, -10284,  -9444,  -8237,
-   -6614,  -4697,  -2895,  -1539,
-    -635,   -112,    -48,   -526,
-   -1489,  -2909,  -4888,  -7437,
-  -10316, -13272, -16277, -19348,
-  -22274, -24719, -26527, -27726,
-  -28254, -27890, -26527, -24402,
-  -21990, -19700, -17701, -16037,
-  -14871, -14509, -15138, -16609,
-  -18573, -20782, -23111, -25338,
-  -27115, -28235, -28805, -29058,
-  -29108, -28934, -28520, -27901,
-  -27115, -26180, -25104, -23885,
-  -22559, -21224, -19979, -18831,
-  -17719, -16595, -15423, -14120,
-  -12594, -10831,  -8874,  -6727,
-   -4336,  -1643,   1375,   4641,
-    7906,  10854,  13333,  15344,
-   16732,  17146,  16465,  15057,
-   13316,  11186,   8493,   5567,
-    3065,   1206,   -332,  -1716,
-   -2628,  -2788,  -2326,  -1390,
-     218,   2720,   5930,   9490,
-   13316,  17500,  21875,  25955,
-   29260,  31534,  32695,  32767,
-   31823,  29943,  27285,  24231,
-   21288,  18775,  16750,  15264,
-   14454,  14287,  14472,  14791,
-   15309,  16107,  17035,  17904,
-   18725,  19533,  20167,  20451,
-   20434,  20199,  19597,  18418,
-   16732,  14813,  12764,  10471,
-    7906,   5265,   2798,    637,
-   -1204,  -2759,  -4034,  -4963,
-   -5475,  -5659,  -5742,  -5871,
-   -6045,  -6321,  -6881,  -7796,
-   -8892, -10002, -11152, -12365,
-  -13448, -14179, -14569, -14771,
-  -14871, -14944, -15138, -15528,
-  -16010, -16511, -17131, -17899,
-  -18573, -18937, -19124, -19385,
-  -19712, -19974, -20263, -20773,
-  -21420, -21884, -21972, -21657,
-  -20851, -19470, -17701, -15861,
-  -14017, -12036, -10013,  -8319,
-   -7184,  -6540,  -6312,  -6544,
-   -7184,  -8055,  -9159, -10732,
-  -12878, -15381, -17986, -20653,
-  -23413, -26183, -28805, -31054,
-  -32524, -32767, -31652, -29368,
-  -25976, -21299, -15423,  -8968,
-   -2628,   2326,   8553,  13618,
-   17317,  19383,  19919,  19391,
-   18101,  15972,  13017,   9682,
-    6533,   3901,   2035,   1285,
-    1731,   2851,   3915,   4696,
-    5490,   6525,   7666,   8632,
-    9149,   8886,   7565,   5221,
-    2157,  -1347,  -4986,  -8162,
-  -10216, -11056, -11158, -10786,
-   -9624,  -7382,  -4365,  -1076,
-    2327,   5737,   8534,   9944,
-    9919,   9149,   8198,   7058,
-    5587,   3901,   2176,    497,
-    -907,  -1609,  -1410,   -551,
-     689,   2326,   4328,   6270,
-    7689,   8624,   9443,  10207,
-   10514,   9936,   8324,   5746,
-    2447,  -1084,  -4329,  -7112,
-   -9595, -11844, -13673, -14984,
-  -15939, -16567, -16469, -15247,
-  -13165, -11056,  -9556,  -8686,
-   -8226,  -8170,  -8622,  -9474,
-  -10520, -11844, -13758, -16296,
-  -18948, -21028, -22163, -22332,
-  -21637, -20241, -18438, -16559,
-  -14742, -12893, -10835,  -8424,
-   -5628,  -2659,    -18,   1809,
-    2749,   3113,   3205,   3121,
-    2943,   2851,   2896,   2859,
-    2575,   2326,   2676,   3909,
-    5781,   7837,   9794,  11519,
-   12797,  13348,  13103,  12306,
-   11195,   9674,   7483,   4696,
-    1843,   -560,  -2438,  -3963,
-   -5135,  -5808,  -6042,  -6062,
-   -5797,  -4758,  -2539,    760,
-    4746,   9149,  13801,  18342,
-   22283,  25419,  27957,  30151,
-   31891,  32767,  32490,  31200,
-   29375,  27518,  25963,  24902,
-   24420,  24369,  24322,  23852,
-   22944,  22007,  21478,  21491,
-   21918,  22532,  23028,  23065,
-   22492,  21483,  20329,  19129,
-   17738,  15972,  13733,  10994,
-    7812,   4425,   1291,  -1076,
-   -2370,  -2659,  -2294,  -1601,
-    -677,    489,   1809,   3121,
-    4359,   5475,   6223,   6270,
-    5618,   4688,   3863,   3121,
-    2257,   1276,    344,   -551,
-   -1621,  -2921,  -4135,  -4750,
-   -4457,  -3446,  -2325,  -1601,
-   -1187,   -560,    545,   1809,
-    2787,   3376,   3582,   3121,
-    1672,   -560,  -2929,  -5013,
-   -6874,  -8695, -10464, -12098,
-  -13509, -14468, -14689, -14197,
-  -13390, -12631, -12010, -11573,
-  -11449, -11581, -11650, -11573,
-  -11862, -13156, -15508, -18396,
-  -21329, -24177, -26926, -29417,
-  -31385, -32575, -32767, -31779,
-  -29434, -25489, -19784, -12623,
-   -4913,   2326,   1368,   4961,
-    7395,   9025,  10396,  12067,
-   14235,  16477,  18057,  18594,
-   18339,  17829,  17510,  17701,
-   18612,  20075,  21340,  21448,
-   19980,  17421,  14774,  12795,
-   11499,  10287,   8481,   5766,
-    2197,  -1975,  -6291,  -9989,
-  -12301, -13056, -12857, -12500,
-  -12301, -12065, -11489, -10401,
-   -8745,  -6678,  -4650,  -3129,
-   -2179,  -1450,   -546,    789,
-    2745,   5342,   8208,  10722,
-   12594,  14130,  15868,  18105,
-   20801,  23674,  26264,  28147,
-   29282,  30015,  30641,  31158,
-   31471,  31503,  30915,  29080,
-   25726,  21437,  17236,  13785,
-   11226,   9472,   8208,   6734,
-    4386,   1237,  -1914,  -4350,
-   -6009,  -7310,  -8753, -10741,
-  -13396, -16348, -18876, -20402,
-  -20783, -20218, -19150, -18238,
-  -18047, -18517, -18876, -18172,
-  -15858, -12020,  -7386,  -3088,
-       9,   1964,   3557,   5426,
-    7669,  10186,  12859,  15206,
-   16424,  16219,  15321,  14787,
-   15056,  15952,  17236,  18611,
-   19433,  19049,  17510,  15535,
-   13688,  11906,   9849,   7344,
-    4386,   1041,  -2461,  -5732,
-   -8471, -10676, -12584, -14513,
-  -16679, -18951, -20791, -21628,
-  -21330, -20243, -18876, -17729,
-  -17226, -17381, -17508, -16657,
-  -14490, -11517,  -8480,  -5833,
-   -3820,  -2497,  -1367,    556,
-    3839,   7935,  11764,  14803,
-   17244,  19317,  21066,  22813,
-   25178,  28267,  31189,  32767,
-   32565,  31002,  28726,  26304,
-   24358,  23400,  23255,  22968,
-   21622,  19186,  16415,  14053,
-   12320,  11031,   9849,   8336,
-    6028,   2759,  -1093,  -4787,
-   -7651,  -9389, -10121, -10274,
-  -10386, -10816, -11489, -11956,
-  -11754, -10777,  -9301,  -7722,
-   -6283,  -4969,  -3555,  -1702,
-     830,   3884,   6840,   9003,
-   10131,  10524,  10670,  11014,
-   12046,  14185,  17236,  20224,
-   22169,  23025,  23528,  24203,
-   24905,  25290,  25170,  24217,
-   21895,  18168,  13953,  10376,
-    7669,   5158,   2189,  -1379,
-   -5462,  -9910, -14225, -17615,
-  -19688, -20914, -22159, -23899,
-  -25981, -27925, -29272, -29819,
-  -29811, -29839, -30366, -31329,
-  -32273, -32767, -32555, -31481,
-  -29537, -27051, -24621, -22723,
-  -21330, -19863, -17508, -13739,
-   -8745,  -3382,   1368,  -5550,
-   -1281,   5350,  13282,  18638,
-   18322,  12960,   6407,   2331,
-    1186,    458,  -2104,  -5550,
-   -6140,   -900,   9112,  19182,
-   24822,  25463,  24271,  24346,
-   25311,  23832,  17333,   6951,
-   -3168,  -9326, -11095, -10986,
-  -11430, -12044, -10013,  -3376,
-    6162,  14047,  16714,  14561,
-   11074,   9155,   8435,   6136,
-     473,  -6880, -11798, -11258,
-   -5926,    730,   5763,   9126,
-   12946,  18668,  24904,  28151,
-   25897,  19212,  12011,   7495,
-    5428,   3176,   -824,  -5007,
-   -5990,  -1715,   6482,  14561,
-   18775,  18668,  17125,  17007,
-   17769,  15950,   9118,  -1202,
-  -10723, -16120, -17485, -17509,
-  -18450, -19654, -18138, -12073,
-   -3625,   2360,   2806,   -930,
-   -5012,  -7151,  -8360, -11258,
-  -17127, -24274, -28871, -27837,
-  -21472, -13131,  -5948,   -114,
-    6319,  14319,  22119,  26520,
-   25637,  20571,  14661,  10756,
-    8768,   6166,   1367,  -3648,
-   -4811,    -85,   8367,  16192,
-   20569,  21929,  22554,  23802,
-   24502,  21929,  14639,   4505,
-   -4315,  -8782,  -9387,  -9084,
-   -9843, -10413,  -7684,   -386,
-    8747,  14863,  15245,  11572,
-    7779,   5894,   4229,   -386,
-   -8858, -18295, -24102, -23760,
-  -18810, -13131,  -9148,  -5822,
-    -529,   7253,  14543,  17279,
-   14074,   7524,   1836,   -930,
-   -2329,  -5249, -10177, -13976,
-  -12643,  -5249,   4985,  13474,
-   17983,  19755,  21301,  23259,
-   23470,  19212,  10356,    156,
-   -7344, -10685, -11692, -12889,
-  -14413, -13674,  -8146,   1515,
-   11262,  16765,  16923,  14290,
-   12113,  11058,   8871,   3146,
-   -5615, -13674, -16942, -14519,
-   -9377,  -5249,  -2857,    428,
-    7073,  15950,  22764,  23802,
-   19148,  12417,   7452,   5049,
-    2699,  -2259,  -9123, -13704,
-  -12042,  -4162,   5966,  14018,
-   18705,  21929,  25977,  30597,
-   32767,  29540,  21289,  11843,
-    5122,   1817,   -348,  -3376,
-   -6500,  -6880,  -2482,   5592,
-   13361,  16765,  14890,  10484,
-    6915,   4535,    542,  -7453,
-  -18213, -27536, -31880, -31099,
-  -27874, -24818, -22101, -17781,
-  -10568,  -2259,   3037,   2602,
-   -2139,  -7151, -10162, -12889,
-  -18373, -26449, -32767, -32730,
-  -26050, -16936,  -9858,  -5550,
-  -32767, -32767, -32483, -32483,
-  -31915, -31915, -31632, -31632,
-  -31348, -31348, -30781, -30781,
-  -30497, -30497, -30213, -30213,
-  -29930, -29930, -29362, -29362,
-  -29078, -29078, -28795, -28795,
-  -28227, -28227, -27944, -27944,
-  -27660, -27660, -27093, -27093,
-  -26809, -26809, -26241, -26241,
-  -25958, -25958, -25674, -25674,
-  -25107, -25107, -24823, -24823,
-  -24256, -24256, -23972, -23972,
-  -23405, -23405, -23121, -23121,
-  -22553, -22553, -22270, -22270,
-  -21702, -21702, -21419, -21419,
-  -20851, -20851, -20568, -20568,
-  -20000, -20000, -19716, -19716,
-  -19149, -19149, -18865, -18865,
-  -18298, -18298, -18014, -18014,
-  -17447, -17447, -16879, -16879,
-  -16596, -16596, -16028, -16028,
-  -15745, -15745, -15177, -15177,
-  -14610, -14610, -14326, -14326,
-  -13759, -13759, -13191, -13191,
-  -12908, -12908, -12340, -12340,
-  -11773, -11773, -11489, -11489,
-  -10922, -10922, -10354, -10354,
-  -10071, -10071,  -9503,  -9503,
-   -8936,  -8936,  -8369,  -8369,
-   -8085,  -8085,  -7517,  -7517,
-   -6950,  -6950,  -6383,  -6383,
-   -5815,  -5815,  -5532,  -5532,
-   -4964,  -4964,  -4397,  -4397,
-   -3829,  -3829,  -3262,  -3262,
-   -2695,  -2695,  -2411,  -2411,
-   -1844,  -1844,  -1276,  -1276,
-    -709,   -709,   -141,   -141,
-     425,    425,    992,    992,
-    1560,   1560,   2127,   2127,
-    2695,   2695,   3262,   3262,
-    3829,   3829,   4113,   4113,
-    4681,   4681,   5248,   5248,
-    5815,   5815,   6383,   6383,
-    6950,   6950,   7801,   7801,
-    8369,   8369,   8936,   8936,
-    9503,   9503,  10071,  10071,
-   10638,  10638,  11206,  11206,
-   11773,  11773,  12340,  12340,
-   12908,  12908,  13475,  13475,
-   14043,  14043,  14894,  14894,
-   15461,  15461,  16028,  16028,
-   16596,  16596,  17163,  17163,
-   17731,  17731,  18582,  18582,
-   19149,  19149,  19716,  19716,
-   20284,  20284,  20851,  20851,
-   21702,  21702,  22270,  22270,
-   22837,  22837,  23405,  23405,
-   24256,  24256,  24823,  24823,
-   25390,  25390,  26241,  26241,
-   26809,  26809,  27376,  27376,
-   27944,  27944,  28795,  28795,
-   29362,  29362,  29930,  29930,
-   30781,  30781,  31348,  31348,
-   32199,  32199,  32767,  32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767,   -129,   -129,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767, -32767, -32767, -32767,
-  -31212, -31212, -29399, -29399,
-  -27845, -27845, -26291, -26291,
-  -24737, -24737, -22923, -22923,
-  -21369, -21369, -19815, -19815,
-  -18520, -18520, -16966, -16966,
-  -15412, -15412, -14117, -14117,
-  -12821, -12821, -11526, -11526,
-  -10231, -10231,  -8936,  -8936,
-   -7900,  -7900,  -6864,  -6864,
-   -5828,  -5828,  -4792,  -4792,
-   -4014,  -4014,  -3237,  -3237,
-   -2460,  -2460,  -1683,  -1683,
-   -1165,  -1165,   -647,   -647,
-    -129,   -129,    129,    129,
-     388,    388,    647,    647,
-     647,    647,    906,    906,
-     647,    647,    647,    647,
-     388,    388,    129,    129,
-    -129,   -129,   -647,   -647,
-   -1165,  -1165,  -1683,  -1683,
-   -2460,  -2460,  -3237,  -3237,
-   -4014,  -4014,  -4792,  -4792,
-   -5828,  -5828,  -6864,  -6864,
-   -7900,  -7900,  -8936,  -8936,
-  -10231, -10231, -11526, -11526,
-  -12821, -12821, -14117, -14117,
-  -15412, -15412, -16966, -16966,
-  -18520, -18520, -19815, -19815,
-  -21369, -21369, -22923, -22923,
-  -24737, -24737, -26291, -26291,
-  -27845, -27845, -29399, -29399,
-  -31212, -31212, -32767, -32767,
-   32767,  32767,  30953,  30953,
-   29399,  29399,  27845,  27845,
-   26291,  26291,  24478,  24478,
-   22923,  22923,  21369,  21369,
-   20074,  20074,  18520,  18520,
-   16966,  16966,  15671,  15671,
-   14376,  14376,  13080,  13080,
-   11785,  11785,  10490,  10490,
-    9454,   9454,   8418,   8418,
-    7382,   7382,   6346,   6346,
-    5569,   5569,   4792,   4792,
-    4014,   4014,   3237,   3237,
-    2719,   2719,   2201,   2201,
-    1683,   1683,   1424,   1424,
-    1165,   1165,    906,    906,
-     906,    906,    906,    906,
-     906,    906,    906,    906,
-    1165,   1165,   1424,   1424,
-    1683,   1683,   2201,   2201,
-    2719,   2719,   3237,   3237,
-    4014,   4014,   4792,   4792,
-    5569,   5569,   6346,   6346,
-    7382,   7382,   8418,   8418,
-    9454,   9454,  10490,  10490,
-   11785,  11785,  13080,  13080,
-   14376,  14376,  15671,  15671,
-   16966,  16966,  18520,  18520,
-   20074,  20074,  21369,  21369,
-   22923,  22923,  24478,  24478,
-   26291,  26291,  27845,  27845,
-   29399,  29399,  30953,  30953,
-   32767,  32767, -32767,    128,
-     128,    128,    128,    128,
-     128,    128,    128,    128,
-     128,    128,    128,    128,
-     128,    128,    128,  12464,
-   12464,  12464,  12464,  12464,
-   12464,  12464,  12464,  12464,
-   12464,  12464,  12464,  12464,
-   12464,  12464,  12464,  23258,
-   23258,  23258,  23258,  23258,
-   23258,  23258,  23258,  23258,
-   23258,  23258,  23258,  23258,
-   23258,  23258,  23258,  30197,
-   30197,  30197,  30197,  30197,
-   30197,  30197,  30197,  30197,
-   30197,  30197,  30197,  30197,
-   30197,  30197,  30197,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  30197,
-   30197,  30197,  30197,  30197,
-   30197,  30197,  30197,  30197,
-   30197,  30197,  30197,  30197,
-   30197,  30197,  30197,  23258,
-   23258,  23258,  23258,  23258,
-   23258,  23258,  23258,  23258,
-   23258,  23258,  23258,  23258,
-   23258,  23258,  23258,  12464,
-   12464,  12464,  12464,  12464,
-   12464,  12464,  12464,  12464,
-   12464,  12464,  12464,  12464,
-   12464,  12464,  12464,    128,
-     128,    128,    128,    128,
-     128,    128,    128,    128,
-     128,    128,    128,    128,
-     128,    128,    128, -12464,
-  -12464, -12464, -12464, -12464,
-  -12464, -12464, -12464, -12464,
-  -12464, -12464, -12464, -12464,
-  -12464, -12464, -12464, -23258,
-  -23258, -23258, -23258, -23258,
-  -23258, -23258, -23258, -23258,
-  -23258, -23258, -23258, -23258,
-  -23258, -23258, -23258, -30197,
-  -30197, -30197, -30197, -30197,
-  -30197, -30197, -30197, -30197,
-  -30197, -30197, -30197, -30197,
-  -30197, -30197, -30197, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -30197,
-  -30197, -30197, -30197, -30197,
-  -30197, -30197, -30197, -30197,
-  -30197, -30197, -30197, -30197,
-  -30197, -30197, -30197, -23258,
-  -23258, -23258, -23258, -23258,
-  -23258, -23258, -23258, -23258,
-  -23258, -23258, -23258, -23258,
-  -23258, -23258, -23258, -12464,
-  -12464, -12464, -12464, -12464,
-  -12464, -12464, -12464, -12464,
-  -12464, -12464, -12464, -12464,
-  -12464, -12464, -12464,    128,
-    -128,   -128,   1670,   1670,
-    3212,   3212,   4754,   4754,
-    6296,   6296,   7838,   7838,
-    9637,   9637,  10922,  10922,
-   12464,  12464,  14006,  14006,
-   15548,  15548,  16833,  16833,
-   18118,  18118,  19403,  19403,
-   20688,  20688,  21973,  21973,
-   23258,  23258,  24286,  24286,
-   25314,  25314,  26342,  26342,
-   27370,  27370,  28141,  28141,
-   28912,  28912,  29683,  29683,
-   30197,  30197,  30968,  30968,
-   31482,  31482,  31739,  31739,
-   32253,  32253,  32510,  32510,
-   32510,  32510,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32510,  32510,  32510,  32510,
-   32253,  32253,  31739,  31739,
-   31482,  31482,  30968,  30968,
-   30197,  30197,  29683,  29683,
-   28912,  28912,  28141,  28141,
-   27370,  27370,  26342,  26342,
-   25314,  25314,  24286,  24286,
-   23258,  23258,  21973,  21973,
-   20688,  20688,  19403,  19403,
-   18118,  18118,  16833,  16833,
-   15548,  15548,  14006,  14006,
-   12464,  12464,  10922,  10922,
-    9637,   9637,   7838,   7838,
-    6296,   6296,   4754,   4754,
-    3212,   3212,   1670,   1670,
-     128,    128,  -1670,  -1670,
-   -3212,  -3212,  -4754,  -4754,
-   -6296,  -6296,  -7838,  -7838,
-   -9637,  -9637, -10922, -10922,
-  -12464, -12464, -14006, -14006,
-  -15548, -15548, -16833, -16833,
-  -18118, -18118, -19403, -19403,
-  -20688, -20688, -21973, -21973,
-  -23258, -23258, -24286, -24286,
-  -25314, -25314, -26342, -26342,
-  -27370, -27370, -28141, -28141,
-  -28912, -28912, -29683, -29683,
-  -30197, -30197, -30968, -30968,
-  -31482, -31482, -31739, -31739,
-  -32253, -32253, -32510, -32510,
-  -32510, -32510, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32510, -32510, -32510, -32510,
-  -32253, -32253, -31739, -31739,
-  -31482, -31482, -30968, -30968,
-  -30197, -30197, -29683, -29683,
-  -28912, -28912, -28141, -28141,
-  -27370, -27370, -26342, -26342,
-  -25314, -25314, -24286, -24286,
-  -23258, -23258, -21973, -21973,
-  -20688, -20688, -19403, -19403,
-  -18118, -18118, -16833, -16833,
-  -15548, -15548, -14006, -14006,
-  -12464, -12464, -10922, -10922,
-   -9637,  -9637,  -7838,  -7838,
-   -6296,  -6296,  -4754,  -4754,
-   -3212,  -3212,  -1670,  -1670,
-    -128,    128,    128,    128,
-     128,    128,    128,    128,
-     128,    128,    128,    385,
-     385,    899,    899,   1156,
-    1156,   1927,   1927,   2441,
-    2441,   3469,   3469,   4497,
-    4497,   5525,   5525,   6810,
-    6810,   8352,   8352,   9894,
-    9894,  11693,  11693,  13235,
-   13235,  15034,  15034,  17090,
-   17090,  18889,  18889,  20688,
-   20688,  22487,  22487,  24286,
-   24286,  25828,  25828,  27370,
-   27370,  28655,  28655,  29940,
-   29940,  30968,  30968,  31739,
-   31739,  32253,  32253,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32253,  32253,  31739,
-   31739,  30968,  30968,  29940,
-   29940,  28655,  28655,  27370,
-   27370,  25828,  25828,  24286,
-   24286,  22487,  22487,  20688,
-   20688,  18889,  18889,  17090,
-   17090,  15034,  15034,  13235,
-   13235,  11693,  11693,   9894,
-    9894,   8352,   8352,   6810,
-    6810,   5525,   5525,   4497,
-    4497,   3469,   3469,   2441,
-    2441,   1927,   1927,   1156,
-    1156,    899,    899,    385,
-     385,    128,    128,    128,
-     128,    128,    128,    128,
-     128,    128,    128,   -128,
-    -128,   -128,   -128,   -128,
-    -128,   -128,   -128,   -385,
-    -385,   -899,   -899,  -1156,
-   -1156,  -1927,  -1927,  -2441,
-   -2441,  -3469,  -3469,  -4497,
-   -4497,  -5525,  -5525,  -6810,
-   -6810,  -8352,  -8352,  -9894,
-   -9894, -11693, -11693, -13235,
-  -13235, -15034, -15034, -17090,
-  -17090, -18889, -18889, -20688,
-  -20688, -22487, -22487, -24286,
-  -24286, -25828, -25828, -27370,
-  -27370, -28655, -28655, -29940,
-  -29940, -30968, -30968, -31739,
-  -31739, -32253, -32253, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32253, -32253, -31739,
-  -31739, -30968, -30968, -29940,
-  -29940, -28655, -28655, -27370,
-  -27370, -25828, -25828, -24286,
-  -24286, -22487, -22487, -20688,
-  -20688, -18889, -18889, -17090,
-  -17090, -15034, -15034, -13235,
-  -13235, -11693, -11693,  -9894,
-   -9894,  -8352,  -8352,  -6810,
-   -6810,  -5525,  -5525,  -4497,
-   -4497,  -3469,  -3469,  -2441,
-   -2441,  -1927,  -1927,  -1156,
-   -1156,   -899,   -899,   -385,
-    -385,   -128,   -128,   -128,
-    -128,   -128,   -128,   -128,
-    -128,    128,    128,    128,
-     128,    128,    128,    128,
-     128,    128,    128,    128,
-     128,    128,    128,    128,
-     128,    128,    385,    385,
-     385,    385,    642,    642,
-    1156,   1156,   1670,   1670,
-    2441,   2441,   3469,   3469,
-    4497,   4497,   5782,   5782,
-    7324,   7324,   9123,   9123,
-   10922,  10922,  12978,  12978,
-   15291,  15291,  17604,  17604,
-   19660,  19660,  21973,  21973,
-   24286,  24286,  26342,  26342,
-   28141,  28141,  29683,  29683,
-   30968,  30968,  31996,  31996,
-   32510,  32510,  32767,  32767,
-   32510,  32510,  31996,  31996,
-   30968,  30968,  29683,  29683,
-   28141,  28141,  26342,  26342,
-   24286,  24286,  21973,  21973,
-   19660,  19660,  17604,  17604,
-   15291,  15291,  12978,  12978,
-   10922,  10922,   9123,   9123,
-    7324,   7324,   5782,   5782,
-    4497,   4497,   3469,   3469,
-    2441,   2441,   1670,   1670,
-    1156,   1156,    642,    642,
-     385,    385,    385,    385,
-     128,    128,    128,    128,
-     128,    128,    128,    128,
-     128,    128,    128,    128,
-     128,    128,    128,    128,
-    -128,   -128,   -128,   -128,
-    -128,   -128,   -128,   -128,
-    -128,   -128,   -128,   -128,
-    -128,   -128,   -385,   -385,
-    -385,   -385,   -642,   -642,
-   -1156,  -1156,  -1670,  -1670,
-   -2441,  -2441,  -3469,  -3469,
-   -4497,  -4497,  -5782,  -5782,
-   -7324,  -7324,  -9123,  -9123,
-  -10922, -10922, -12978, -12978,
-  -15291, -15291, -17604, -17604,
-  -19660, -19660, -21973, -21973,
-  -24286, -24286, -26342, -26342,
-  -28141, -28141, -29683, -29683,
-  -30968, -30968, -31996, -31996,
-  -32510, -32510, -32767, -32767,
-  -32510, -32510, -31996, -31996,
-  -30968, -30968, -29683, -29683,
-  -28141, -28141, -26342, -26342,
-  -24286, -24286, -21973, -21973,
-  -19660, -19660, -17604, -17604,
-  -15291, -15291, -12978, -12978,
-  -10922, -10922,  -9123,  -9123,
-   -7324,  -7324,  -5782,  -5782,
-   -4497,  -4497,  -3469,  -3469,
-   -2441,  -2441,  -1670,  -1670,
-   -1156,  -1156,   -642,   -642,
-    -385,   -385,   -385,   -385,
-    -128,   -128,   -128,   -128,
-    -128,   -128,   -128,   -128,
-    -128,   -128,   -128,   -128,
-    -128,   -128,    128, -32767,
-  -32767, -31739, -31739, -30711,
-  -30711, -29683, -29683, -28655,
-  -28655, -27627, -27627, -26599,
-  -26599, -25571, -25571, -24543,
-  -24543, -23515, -23515, -22487,
-  -22487, -21202, -21202, -20174,
-  -20174, -19146, -19146, -18118,
-  -18118, -17090, -17090, -16062,
-  -16062, -15034, -15034, -14006,
-  -14006, -12978, -12978, -11950,
-  -11950, -10922, -10922,  -9894,
-   -9894,  -8866,  -8866,  -7838,
-   -7838,  -6810,  -6810,  -5782,
-   -5782,  -4754,  -4754,  -3726,
-   -3726,  -2698,  -2698,  -1670,
-   -1670,   -642,   -642,    642,
-     642,   1670,   1670,   2698,
-    2698,   3726,   3726,   4754,
-    4754,   5782,   5782,   6810,
-    6810,   7838,   7838,   8866,
-    8866,   9894,   9894,  10922,
-   10922,  11950,  11950,  12978,
-   12978,  14006,  14006,  15034,
-   15034,  16062,  16062,  17090,
-   17090,  18118,  18118,  19146,
-   19146,  20174,  20174,  21202,
-   21202,  22487,  22487,  23515,
-   23515,  24543,  24543,  25571,
-   25571,  26599,  26599,  27627,
-   27627,  28655,  28655,  29683,
-   29683,  30711,  30711,  31739,
-   31739,  32767,  32767,  32767,
-   32767,  31739,  31739,  30711,
-   30711,  29683,  29683,  28655,
-   28655,  27627,  27627,  26599,
-   26599,  25571,  25571,  24543,
-   24543,  23515,  23515,  22487,
-   22487,  21202,  21202,  20174,
-   20174,  19146,  19146,  18118,
-   18118,  17090,  17090,  16062,
-   16062,  15034,  15034,  14006,
-   14006,  12978,  12978,  11950,
-   11950,  10922,  10922,   9894,
-    9894,   8866,   8866,   7838,
-    7838,   6810,   6810,   5782,
-    5782,   4754,   4754,   3726,
-    3726,   2698,   2698,   1670,
-    1670,    642,    642,   -642,
-    -642,  -1670,  -1670,  -2698,
-   -2698,  -3726,  -3726,  -4754,
-   -4754,  -5782,  -5782,  -6810,
-   -6810,  -7838,  -7838,  -8866,
-   -8866,  -9894,  -9894, -10922,
-  -10922, -11950, -11950, -12978,
-  -12978, -14006, -14006, -15034,
-  -15034, -16062, -16062, -17090,
-  -17090, -18118, -18118, -19146,
-  -19146, -20174, -20174, -21202,
-  -21202, -22487, -22487, -23515,
-  -23515, -24543, -24543, -25571,
-  -25571, -26599, -26599, -27627,
-  -27627, -28655, -28655, -29683,
-  -29683, -30711, -30711, -31739,
-  -31739, -32767, -32767, -32767,
-  -32767, -32767, -32199, -32199,
-  -31348, -31348, -30497, -30497,
-  -29930, -29930, -29078, -29078,
-  -28227, -28227, -27660, -27660,
-  -26809, -26809, -25958, -25958,
-  -25107, -25107, -24256, -24256,
-  -23405, -23405, -22553, -22553,
-  -21702, -21702, -20851, -20851,
-  -20000, -20000, -19149, -19149,
-  -18298, -18298, -17447, -17447,
-  -16596, -16596, -15461, -15461,
-  -14610, -14610, -13759, -13759,
-  -12624, -12624, -11773, -11773,
-  -10638, -10638,  -9787,  -9787,
-   -8652,  -8652,  -7801,  -7801,
-   -6666,  -6666,  -5815,  -5815,
-   -4681,  -4681,  -3546,  -3546,
-   -2411,  -2411,  -1560,  -1560,
-    -425,   -425,    709,    709,
-    1844,   1844,   2978,   2978,
-    4113,   4113,   5248,   5248,
-    6383,   6383,   7517,   7517,
-    8652,   8652,   9787,   9787,
-   10922,  10922,  12057,  12057,
-   13475,  13475,  14610,  14610,
-   15745,  15745,  17163,  17163,
-   18298,  18298,  19716,  19716,
-   20851,  20851,  22270,  22270,
-   23405,  23405,  24823,  24823,
-   25958,  25958,  27376,  27376,
-   28795,  28795,  29930,  29930,
-   31348,  31348,  32767,  32767,
-  -32767, -32767, -32199, -32199,
-  -31348, -31348, -30497, -30497,
-  -29930, -29930, -29078, -29078,
-  -28227, -28227, -27660, -27660,
-  -26809, -26809, -25958, -25958,
-  -25107, -25107, -24256, -24256,
-  -23405, -23405, -22553, -22553,
-  -21702, -21702, -20851, -20851,
-  -20000, -20000, -19149, -19149,
-  -18298, -18298, -17447, -17447,
-  -16596, -16596, -15461, -15461,
-  -14610, -14610, -13759, -13759,
-  -12624, -12624, -11773, -11773,
-  -10638, -10638,  -9787,  -9787,
-   -8652,  -8652,  -7801,  -7801,
-   -6666,  -6666,  -5815,  -5815,
-   -4681,  -4681,  -3546,  -3546,
-   -2411,  -2411,  -1560,  -1560,
-    -425,   -425,    709,    709,
-    1844,   1844,   2978,   2978,
-    4113,   4113,   5248,   5248,
-    6383,   6383,   7517,   7517,
-    8652,   8652,   9787,   9787,
-   10922,  10922,  12057,  12057,
-   13475,  13475,  14610,  14610,
-   15745,  15745,  17163,  17163,
-   18298,  18298,  19716,  19716,
-   20851,  20851,  22270,  22270,
-   23405,  23405,  24823,  24823,
-   25958,  25958,  27376,  27376,
-   28795,  28795,  29930,  29930,
-   31348,  31348,  32767,  32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767,   -130,   -130,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767, -32767, -32767, -32767,
-  -32767,   -130,   -130,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767,  32767,  32767,  32767,
-   32767, -32767,
-};
-
-
-
-const int16_t* wavetable_table[] = {
-  wt_waves,
-};
-
-const int16_t ws_smooth_bipolar_fold[] IN_RAM = {
-  -32767, -32704, -32641, -32577,
-  -32512, -32447, -32381, -32314,
-  -32246, -32178, -32109, -32039,
-  -31969, -31898, -31826, -31753,
-  -31680, -31606, -31531, -31455,
-  -31378, -31301, -31223, -31145,
-  -31065, -30985, -30904, -30822,
-  -30739, -30656, -30572, -30487,
-  -30401, -30314, -30227, -30139,
-  -30050, -29960, -29870, -29778,
-  -29686, -29594, -29500, -29406,
-  -29310, -29214, -29118, -29020,
-  -28922, -28823, -28723, -28622,
-  -28521, -28419, -28316, -28212,
-  -28108, -28003, -27897, -27790,
-  -27683, -27575, -27466, -27356,
-  -27246, -27135, -27023, -26911,
-  -26798, -26684, -26570, -26455,
-  -26339, -26223, -26106, -25988,
-  -25870, -25751, -25632, -25511,
-  -25391, -25270, -25148, -25026,
-  -24903, -24779, -24655, -24531,
-  -24406, -24281, -24155, -24029,
-  -23902, -23775, -23647, -23519,
-  -23391, -23262, -23133, -23004,
-  -22874, -22744, -22614, -22483,
-  -22352, -22221, -22090, -21959,
-  -21827, -21695, -21563, -21431,
-  -21299, -21167, -21035, -20902,
-  -20770, -20637, -20505, -20373,
-  -20240, -20108, -19976, -19844,
-  -19712, -19581, -19449, -19318,
-  -19187, -19056, -18925, -18795,
-  -18665, -18536, -18407, -18278,
-  -18150, -18022, -17894, -17768,
-  -17641, -17515, -17390, -17266,
-  -17142, -17018, -16895, -16774,
-  -16652, -16532, -16412, -16293,
-  -16175, -16058, -15942, -15826,
-  -15712, -15598, -15486, -15375,
-  -15264, -15155, -15047, -14939,
-  -14833, -14729, -14625, -14523,
-  -14422, -14322, -14224, -14126,
-  -14031, -13936, -13843, -13752,
-  -13662, -13573, -13486, -13401,
-  -13317, -13234, -13154, -13075,
-  -12997, -12921, -12847, -12775,
-  -12705, -12636, -12569, -12504,
-  -12441, -12379, -12320, -12262,
-  -12206, -12153, -12101, -12051,
-  -12003, -11958, -11914, -11872,
-  -11833, -11795, -11760, -11727,
-  -11696, -11667, -11640, -11616,
-  -11594, -11574, -11556, -11540,
-  -11527, -11516, -11507, -11501,
-  -11496, -11495, -11495, -11498,
-  -11503, -11510, -11520, -11532,
-  -11547, -11564, -11583, -11604,
-  -11628, -11655, -11683, -11714,
-  -11748, -11784, -11822, -11862,
-  -11905, -11950, -11998, -12048,
-  -12100, -12155, -12212, -12271,
-  -12333, -12397, -12463, -12531,
-  -12602, -12675, -12750, -12828,
-  -12907, -12989, -13073, -13159,
-  -13248, -13338, -13431, -13525,
-  -13622, -13721, -13821, -13924,
-  -14029, -14136, -14244, -14355,
-  -14467, -14581, -14697, -14815,
-  -14934, -15056, -15179, -15303,
-  -15429, -15557, -15686, -15817,
-  -15950, -16083, -16219, -16355,
-  -16493, -16632, -16773, -16914,
-  -17057, -17201, -17346, -17492,
-  -17639, -17787, -17936, -18086,
-  -18236, -18388, -18540, -18692,
-  -18846, -19000, -19154, -19309,
-  -19464, -19620, -19776, -19932,
-  -20089, -20245, -20402, -20559,
-  -20716, -20873, -21029, -21186,
-  -21342, -21498, -21654, -21809,
-  -21964, -22118, -22272, -22425,
-  -22578, -22730, -22881, -23031,
-  -23180, -23328, -23476, -23622,
-  -23767, -23911, -24053, -24195,
-  -24335, -24473, -24610, -24746,
-  -24880, -25012, -25142, -25271,
-  -25398, -25523, -25646, -25767,
-  -25886, -26003, -26118, -26231,
-  -26341, -26449, -26554, -26657,
-  -26758, -26856, -26951, -27044,
-  -27134, -27221, -27306, -27387,
-  -27466, -27542, -27615, -27684,
-  -27751, -27814, -27874, -27931,
-  -27985, -28035, -28082, -28126,
-  -28166, -28202, -28235, -28265,
-  -28290, -28312, -28331, -28346,
-  -28356, -28363, -28367, -28366,
-  -28361, -28353, -28340, -28324,
-  -28304, -28279, -28250, -28218,
-  -28181, -28140, -28095, -28045,
-  -27992, -27934, -27872, -27805,
-  -27735, -27660, -27580, -27497,
-  -27409, -27317, -27220, -27119,
-  -27014, -26904, -26790, -26672,
-  -26549, -26422, -26290, -26154,
-  -26014, -25869, -25720, -25567,
-  -25409, -25247, -25080, -24910,
-  -24735, -24555, -24372, -24184,
-  -23992, -23796, -23595, -23390,
-  -23182, -22969, -22752, -22531,
-  -22305, -22076, -21843, -21606,
-  -21365, -21120, -20871, -20618,
-  -20362, -20102, -19838, -19570,
-  -19299, -19024, -18746, -18464,
-  -18179, -17890, -17598, -17303,
-  -17004, -16702, -16397, -16089,
-  -15778, -15464, -15146, -14826,
-  -14504, -14178, -13850, -13519,
-  -13185, -12849, -12510, -12169,
-  -11826, -11480, -11132, -10782,
-  -10430, -10075,  -9719,  -9361,
-   -9001,  -8639,  -8276,  -7911,
-   -7545,  -7177,  -6807,  -6436,
-   -6064,  -5691,  -5317,  -4941,
-   -4565,  -4188,  -3810,  -3431,
-   -3051,  -2671,  -2291,  -1910,
-   -1528,  -1146,   -764,   -382,
-       0,    382,    764,   1146,
-    1528,   1910,   2291,   2671,
-    3051,   3431,   3810,   4188,
-    4565,   4941,   5317,   5691,
-    6064,   6436,   6807,   7177,
-    7545,   7911,   8276,   8639,
-    9001,   9361,   9719,  10075,
-   10430,  10782,  11132,  11480,
-   11826,  12169,  12510,  12849,
-   13185,  13519,  13850,  14178,
-   14504,  14826,  15146,  15464,
-   15778,  16089,  16397,  16702,
-   17004,  17303,  17598,  17890,
-   18179,  18464,  18746,  19024,
-   19299,  19570,  19838,  20102,
-   20362,  20618,  20871,  21120,
-   21365,  21606,  21843,  22076,
-   22305,  22531,  22752,  22969,
-   23182,  23390,  23595,  23796,
-   23992,  24184,  24372,  24555,
-   24735,  24910,  25080,  25247,
-   25409,  25567,  25720,  25869,
-   26014,  26154,  26290,  26422,
-   26549,  26672,  26790,  26904,
-   27014,  27119,  27220,  27317,
-   27409,  27497,  27580,  27660,
-   27735,  27805,  27872,  27934,
-   27992,  28045,  28095,  28140,
-   28181,  28218,  28250,  28279,
-   28304,  28324,  28340,  28353,
-   28361,  28366,  28367,  28363,
-   28356,  28346,  28331,  28312,
-   28290,  28265,  28235,  28202,
-   28166,  28126,  28082,  28035,
-   27985,  27931,  27874,  27814,
-   27751,  27684,  27615,  27542,
-   27466,  27387,  27306,  27221,
-   27134,  27044,  26951,  26856,
-   26758,  26657,  26554,  26449,
-   26341,  26231,  26118,  26003,
-   25886,  25767,  25646,  25523,
-   25398,  25271,  25142,  25012,
-   24880,  24746,  24610,  24473,
-   24335,  24195,  24053,  23911,
-   23767,  23622,  23476,  23328,
-   23180,  23031,  22881,  22730,
-   22578,  22425,  22272,  22118,
-   21964,  21809,  21654,  21498,
-   21342,  21186,  21029,  20873,
-   20716,  20559,  20402,  20245,
-   20089,  19932,  19776,  19620,
-   19464,  19309,  19154,  19000,
-   18846,  18692,  18540,  18388,
-   18236,  18086,  17936,  17787,
-   17639,  17492,  17346,  17201,
-   17057,  16914,  16773,  16632,
-   16493,  16355,  16219,  16083,
-   15950,  15817,  15686,  15557,
-   15429,  15303,  15179,  15056,
-   14934,  14815,  14697,  14581,
-   14467,  14355,  14244,  14136,
-   14029,  13924,  13821,  13721,
-   13622,  13525,  13431,  13338,
-   13248,  13159,  13073,  12989,
-   12907,  12828,  12750,  12675,
-   12602,  12531,  12463,  12397,
-   12333,  12271,  12212,  12155,
-   12100,  12048,  11998,  11950,
-   11905,  11862,  11822,  11784,
-   11748,  11714,  11683,  11655,
-   11628,  11604,  11583,  11564,
-   11547,  11532,  11520,  11510,
-   11503,  11498,  11495,  11495,
-   11496,  11501,  11507,  11516,
-   11527,  11540,  11556,  11574,
-   11594,  11616,  11640,  11667,
-   11696,  11727,  11760,  11795,
-   11833,  11872,  11914,  11958,
-   12003,  12051,  12101,  12153,
-   12206,  12262,  12320,  12379,
-   12441,  12504,  12569,  12636,
-   12705,  12775,  12847,  12921,
-   12997,  13075,  13154,  13234,
-   13317,  13401,  13486,  13573,
-   13662,  13752,  13843,  13936,
-   14031,  14126,  14224,  14322,
-   14422,  14523,  14625,  14729,
-   14833,  14939,  15047,  15155,
-   15264,  15375,  15486,  15598,
-   15712,  15826,  15942,  16058,
-   16175,  16293,  16412,  16532,
-   16652,  16774,  16895,  17018,
-   17142,  17266,  17390,  17515,
-   17641,  17768,  17894,  18022,
-   18150,  18278,  18407,  18536,
-   18665,  18795,  18925,  19056,
-   19187,  19318,  19449,  19581,
-   19712,  19844,  19976,  20108,
-   20240,  20373,  20505,  20637,
-   20770,  20902,  21035,  21167,
-   21299,  21431,  21563,  21695,
-   21827,  21959,  22090,  22221,
-   22352,  22483,  22614,  22744,
-   22874,  23004,  23133,  23262,
-   23391,  23519,  23647,  23775,
-   23902,  24029,  24155,  24281,
-   24406,  24531,  24655,  24779,
-   24903,  25026,  25148,  25270,
-   25391,  25511,  25632,  25751,
-   25870,  25988,  26106,  26223,
-   26339,  26455,  26570,  26684,
-   26798,  26911,  27023,  27135,
-   27246,  27356,  27466,  27575,
-   27683,  27790,  27897,  28003,
-   28108,  28212,  28316,  28419,
-   28521,  28622,  28723,  28823,
-   28922,  29020,  29118,  29214,
-   29310,  29406,  29500,  29594,
-   29686,  29778,  29870,  29960,
-   30050,  30139,  30227,  30314,
-   30401,  30487,  30572,  30656,
-   30739,  30822,  30904,  30985,
-   31065,  31145,  31223,  31301,
-   31378,  31455,  31531,  31606,
-   31680,  31753,  31826,  31898,
-   31969,  32039,  32109,  32178,
-   32246,  32314,  32381,  32447,
-   32512,  32577,  32641,  32704,
-   32704,
-};
-
-
-
-const int16_t* waveshaper_table[] = {
-  ws_smooth_bipolar_fold,
-};
-
 
 }  // namespace tides
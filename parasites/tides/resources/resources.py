@@ -68,7 +68,6 @@ includes = """
 
 import lookup_tables
 import waveforms
-import wavetables
 
 types = ['uint8_t', 'uint16_t']
 create_specialized_manager = True
@@ -80,8 +79,7 @@ resources = [
    'lookup_table_32', 'LUT', 'uint32_t', int, False),
   (waveforms.waveforms,
    'waveform', 'WAV', 'int16_t', int, True),
-  (wavetables.wavetables,
-   'wavetable', 'WT', 'int16_t', int, True),
-  (wavetables.waveshapers,
-   'waveshaper', 'WS', 'int16_t', int, True)
 ]
+
+# The wavetables and waveshapers of the wavetable hack are generated into
+# tides/wavetable by wavetable_resources.py.
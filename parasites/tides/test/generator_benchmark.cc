@@ -0,0 +1,213 @@
+// Copyright 2026 Aepelzen's Parasites contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Throughput benchmark of Generator::FillBuffer, for every combination of
+// feature mode, generator mode, range and sync.
+//
+// Usage: generator_benchmark [output.json] [seconds of audio per case]
+//
+// Pitch, shape, slope and smoothness follow random walks updated once per
+// block, as the module does, and the clock/gate input is a pulse train. All
+// the random streams are seeded, so that two runs process the same data and
+// their JSON reports can be diffed.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "tides/generator.h"
+
+using namespace tides;
+using namespace std;
+
+const uint32_t kSampleRate = 48000;
+const uint32_t kClockPeriod = 480;
+const uint32_t kSeed = 0x21;
+
+const char* kFeatureModeNames[] = { "function", "harmonic", "random" };
+const char* kGeneratorModeNames[] = { "ad", "looping", "ar" };
+const char* kGeneratorRangeNames[] = { "high", "medium", "low" };
+
+// Bounded random walk, standing in for a CV.
+class RandomWalk {
+ public:
+  void Init(uint32_t seed, int32_t min, int32_t max, int32_t step) {
+    state_ = seed;
+    min_ = min;
+    max_ = max;
+    step_ = step;
+    value_ = (min + max) / 2;
+  }
+
+  int16_t Next() {
+    state_ = state_ * 1664525L + 1013904223L;
+    int32_t delta = static_cast<int32_t>(state_ >> 16) % (2 * step_ + 1);
+    value_ += delta - step_;
+    if (value_ < min_) {
+      value_ = 2 * min_ - value_;
+    } else if (value_ > max_) {
+      value_ = 2 * max_ - value_;
+    }
+    return value_;
+  }
+
+ private:
+  uint32_t state_;
+  int32_t min_;
+  int32_t max_;
+  int32_t step_;
+  int32_t value_;
+};
+
+struct Result {
+  Generator::FeatureMode feature_mode;
+  GeneratorMode mode;
+  GeneratorRange range;
+  bool sync;
+  double samples_per_second;
+};
+
+double Run(
+    Generator::FeatureMode feature_mode,
+    GeneratorMode mode,
+    GeneratorRange range,
+    bool sync,
+    uint32_t num_samples) {
+  Generator* generator = new Generator;
+  generator->Init();
+  generator->set_seed(kSeed);
+  generator->feature_mode_ = feature_mode;
+  generator->set_range(range);
+  generator->set_mode(mode);
+
+  RandomWalk pitch, shape, slope, smoothness;
+  pitch.Init(kSeed + 1, 36 << 7, 84 << 7, 64);
+  shape.Init(kSeed + 2, -32767, 32767, 2048);
+  slope.Init(kSeed + 3, -32767, 32767, 2048);
+  smoothness.Init(kSeed + 4, -32767, 32767, 2048);
+
+  uint32_t checksum = 0;
+  chrono::steady_clock::time_point start = chrono::steady_clock::now();
+  for (uint32_t i = 0; i < num_samples; ++i) {
+    if (generator->writable_block()) {
+      if (feature_mode == Generator::FEAT_MODE_HARMONIC) {
+        generator->set_pitch_high_range(pitch.Next() - (12 << 7), 0);
+      } else {
+        generator->set_pitch(pitch.Next(), 0);
+      }
+      generator->set_shape(shape.Next());
+      generator->set_slope(slope.Next());
+      generator->set_smoothness(smoothness.Next());
+      generator->set_sync(sync);
+      generator->FillBuffer();
+    }
+    uint32_t t = i % kClockPeriod;
+    uint8_t control = 0;
+    if (t < kClockPeriod / 4) {
+      control |= sync ? CONTROL_CLOCK : CONTROL_GATE;
+    }
+    if (t == 0) {
+      control |= sync ? CONTROL_CLOCK_RISING : CONTROL_GATE_RISING;
+    } else if (t == kClockPeriod / 4 && !sync) {
+      control |= CONTROL_GATE_FALLING;
+    }
+    GeneratorSample s = generator->Process(control);
+    checksum += s.unipolar + s.bipolar;
+  }
+  double seconds = chrono::duration<double>(
+      chrono::steady_clock::now() - start).count();
+  delete generator;
+
+  // Keeps the compiler from discarding the rendered samples.
+  if (checksum == 0xffffffff) {
+    fprintf(stderr, "!");
+  }
+  return num_samples / seconds;
+}
+
+void WriteJson(FILE* fp, const Result* results, size_t num_results) {
+  fprintf(fp, "{\n  \"sample_rate\": %u,\n  \"results\": [\n", kSampleRate);
+  for (size_t i = 0; i < num_results; ++i) {
+    const Result& r = results[i];
+    fprintf(fp,
+            "    { \"feature_mode\": \"%s\", \"mode\": \"%s\", "
+            "\"range\": \"%s\", \"sync\": %s, "
+            "\"samples_per_second\": %.0f }%s\n",
+            kFeatureModeNames[r.feature_mode],
+            kGeneratorModeNames[r.mode],
+            kGeneratorRangeNames[r.range],
+            r.sync ? "true" : "false",
+            r.samples_per_second,
+            i + 1 < num_results ? "," : "");
+  }
+  fprintf(fp, "  ]\n}\n");
+}
+
+int main(int argc, char** argv) {
+  const char* json_file_name = argc > 1 ? argv[1] : "generator_benchmark.json";
+  float duration = argc > 2 ? atof(argv[2]) : 2.0f;
+  uint32_t num_samples = duration * kSampleRate;
+
+  const size_t kNumResults = 3 * 3 * 3 * 2;
+  Result results[kNumResults];
+  size_t n = 0;
+
+  printf("%-9s %-8s %-7s %-5s %14s %9s\n",
+         "feature", "mode", "range", "sync", "samples/s", "realtime");
+  for (int32_t f = 0; f < 3; ++f) {
+    for (int32_t m = 0; m < 3; ++m) {
+      for (int32_t r = 0; r < 3; ++r) {
+        for (int32_t sync = 0; sync < 2; ++sync) {
+          Result& result = results[n++];
+          result.feature_mode = static_cast<Generator::FeatureMode>(f);
+          result.mode = static_cast<GeneratorMode>(m);
+          result.range = static_cast<GeneratorRange>(r);
+          result.sync = sync;
+          result.samples_per_second = Run(
+              result.feature_mode,
+              result.mode,
+              result.range,
+              result.sync,
+              num_samples);
+          printf("%-9s %-8s %-7s %-5s %14.0f %8.0fx\n",
+                 kFeatureModeNames[f],
+                 kGeneratorModeNames[m],
+                 kGeneratorRangeNames[r],
+                 sync ? "on" : "off",
+                 result.samples_per_second,
+                 result.samples_per_second / kSampleRate);
+        }
+      }
+    }
+  }
+
+  FILE* fp = fopen(json_file_name, "w");
+  if (!fp) {
+    fprintf(stderr, "Could not open %s\n", json_file_name);
+    return 1;
+  }
+  WriteJson(fp, results, n);
+  fclose(fp);
+  return 0;
+}
@@ -0,0 +1,58 @@
+// Copyright 2013 Olivier Gillet.
+//
+// Author: Olivier Gillet (ol.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Resources definitions.
+//
+// Automatically generated with:
+// python stmlib/tools/resources_compiler.py tides/resources/wavetable_resources.py
+
+
+#ifndef TIDES_WAVETABLE_RESOURCES_H_
+#define TIDES_WAVETABLE_RESOURCES_H_
+
+
+#include "stmlib/stmlib.h"
+
+
+
+namespace tides {
+
+typedef uint8_t ResourceId;
+
+extern const int16_t* wavetable_table[];
+
+extern const int16_t* waveshaper_table[];
+
+extern const int16_t wt_waves[];
+extern const int16_t ws_smooth_bipolar_fold[] IN_RAM;
+#define WT_WAVES 0
+#define WT_WAVES_SIZE 45746
+#define WS_SMOOTH_BIPOLAR_FOLD 0
+#define WS_SMOOTH_BIPOLAR_FOLD_SIZE 1025
+
+}  // namespace tides
+
+#endif  // TIDES_WAVETABLE_RESOURCES_H_
@@ -0,0 +1,115 @@
+// Copyright 2026 Aepelzen's Parasites contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Seeded random number generator, owned by each generator instead of the
+// process-wide stmlib::Random state.
+//
+// Four xorshift32 generators run side by side. They are advanced together,
+// which the compiler can vectorize, and their outputs are handed out in
+// order, so that single words and batches come from the same sequence.
+
+#ifndef TIDES_XORSHIFT_H_
+#define TIDES_XORSHIFT_H_
+
+#include "stmlib/stmlib.h"
+
+namespace tides {
+
+class Xorshift {
+ public:
+  Xorshift() { }
+  ~Xorshift() { }
+
+  void Init(uint32_t seed) {
+    // Spread the seed over the four lanes (splitmix32 finalizer), making
+    // sure that none of them is stuck at zero.
+    for (int32_t i = 0; i < kNumLanes; ++i) {
+      uint32_t z = seed + (i + 1) * 0x9e3779b9;
+      z = (z ^ (z >> 16)) * 0x85ebca6b;
+      z = (z ^ (z >> 13)) * 0xc2b2ae35;
+      z ^= z >> 16;
+      state_[i] = z ? z : 0x6d2b79f5;
+    }
+    index_ = kNumLanes;
+  }
+
+  inline uint32_t GetWord() {
+    if (index_ == kNumLanes) {
+      Advance();
+      index_ = 0;
+    }
+    return state_[index_++];
+  }
+
+  // Number of consecutive draws (at most 64) below p, where p is a 16-bit
+  // probability.
+  inline uint32_t GetGeometric(uint16_t p) {
+    uint32_t n = 0;
+    while ((GetWord() >> 16) < p && n < 64) {
+      ++n;
+    }
+    return n;
+  }
+
+  // Draws size words at once; same sequence as size calls to GetWord().
+  void Fill(uint32_t* words, size_t size) {
+    while (size && index_ != kNumLanes) {
+      *words++ = state_[index_++];
+      --size;
+    }
+    while (size >= kNumLanes) {
+      Advance();
+      for (int32_t i = 0; i < kNumLanes; ++i) {
+        words[i] = state_[i];
+      }
+      words += kNumLanes;
+      size -= kNumLanes;
+    }
+    while (size--) {
+      *words++ = GetWord();
+    }
+  }
+
+ private:
+  static const int32_t kNumLanes = 4;
+
+  inline void Advance() {
+    for (int32_t i = 0; i < kNumLanes; ++i) {
+      uint32_t x = state_[i];
+      x ^= x << 13;
+      x ^= x >> 17;
+      x ^= x << 5;
+      state_[i] = x;
+    }
+  }
+
+  uint32_t state_[kNumLanes];
+  int32_t index_;
+
+  DISALLOW_COPY_AND_ASSIGN(Xorshift);
+};
+
+}  // namespace tides
+
+#endif  // TIDES_XORSHIFT_H_
@@ -0,0 +1,230 @@
+// Copyright 2026 Aepelzen's Parasites contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Binaural Doppler effect of several sources.
+
+#include "warps/dsp/doppler_bank.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "stmlib/dsp/dsp.h"
+
+#include "warps/resources.h"
+
+namespace warps {
+
+using namespace std;
+using namespace stmlib;
+
+static inline Lanes Constrain(Lanes x, float min, float max) {
+  x = Select(x < min, Lanes() + min, x);
+  return Select(x > max, Lanes() + max, x);
+}
+
+static inline Lanes Sqrt(Lanes x) {
+  Lanes y = Lanes();
+  for (size_t j = 0; j < kDopplerBankLanes; ++j) {
+    y[j] = sqrtf(x[j]);
+  }
+  return y;
+}
+
+// The tables are read one lane at a time.
+static inline Lanes Interpolate(const float* table, Lanes index, float size) {
+  Lanes y = Lanes();
+  for (size_t j = 0; j < kDopplerBankLanes; ++j) {
+    y[j] = stmlib::Interpolate(table, index[j], size);
+  }
+  return y;
+}
+
+void DopplerBank::Init(float sample_rate, DopplerBankArena* arena) {
+  sample_rate_ = sample_rate;
+  arena_ = arena;
+  cursor_ = 0;
+  for (size_t i = 0; i < kNumGroups; ++i) {
+    x_[i] = Lanes();
+    y_[i] = Lanes();
+    lfo_phase_[i] = Lanes();
+    // Like the doppler mode of a Modulator, the sources start far away
+    // rather than gliding from the listener.
+    distance_[i] = Lanes() + 1.0f;
+    angle_[i] = Lanes() + 1.0f;
+  }
+  if (arena_) {
+    memset(arena_, 0, sizeof(*arena_));
+  }
+}
+
+void DopplerBank::Process(
+    const Parameters* parameters,
+    const ShortFrame* const* input,
+    ShortFrame* output,
+    size_t num_sources,
+    size_t size) {
+  const size_t kMask = kDopplerBankDelaySize - 1;
+
+  num_sources = min(num_sources, kMaxDopplerBankSources);
+  size_t num_groups = (num_sources + kDopplerBankLanes - 1) /
+      kDopplerBankLanes;
+
+  int32_t shape = parameters[0].carrier_shape;
+  float atten_factor =
+    shape == 0 ? 0.5f :
+    shape == 1 ? 4.0f :
+    shape == 2 ? 8.0f :
+    shape == 3 ? 15.0f : 0;
+  float room_size =
+    shape == 0 ? 100 :
+    shape == 1 ? (kDopplerBankDelaySize - 1) / 10.0f :
+    shape == 2 ? (kDopplerBankDelaySize - 1) / 5.0f :
+    shape == 3 ? (kDopplerBankDelaySize - 1) / 2.0f : 0;
+  float binaural_delay = sample_rate_ * 0.0015f;  // -1.5ms..1.5ms
+
+  // Transpose the parameters of the sources into lanes. The unused lanes are
+  // rendered too, with a gain of 0. The sources are mostly uncorrelated, so
+  // their gain keeps the power of the mix rather than its peak level.
+  float source_gain = num_sources ?
+      1.0f / sqrtf(static_cast<float>(num_sources)) : 0.0f;
+  float step = 1.0f / static_cast<float>(size);
+  Lanes x_increment[kNumGroups];
+  Lanes y_increment[kNumGroups];
+  Lanes lfo_increment[kNumGroups];
+  Lanes lfo_amplitude[kNumGroups];
+  Lanes gain[kNumGroups];
+  for (size_t g = 0; g < num_groups; ++g) {
+    for (size_t j = 0; j < kDopplerBankLanes; ++j) {
+      size_t s = g * kDopplerBankLanes + j;
+      if (s < num_sources) {
+        const Parameters& p = parameters[s];
+        float x_end = p.raw_algorithm * 2.0f - 1.0f;
+        float y_end = p.modulation_parameter * 2.0f;
+        x_increment[g][j] = (x_end - x_[g][j]) * step;
+        y_increment[g][j] = (y_end - y_[g][j]) * step;
+        lfo_increment[g][j] = p.channel_drive[0] * p.channel_drive[0] *
+            50.0f / sample_rate_;
+        lfo_amplitude[g][j] = p.channel_drive[1];
+        gain[g][j] = source_gain;
+      } else {
+        x_increment[g][j] = 0.0f;
+        y_increment[g][j] = 0.0f;
+        lfo_increment[g][j] = 0.0f;
+        lfo_amplitude[g][j] = 0.0f;
+        gain[g][j] = 0.0f;
+      }
+    }
+  }
+
+  for (size_t i = 0; i < size; ++i) {
+    ShortFrame* write = arena_->frames[cursor_];
+    for (size_t s = 0; s < num_sources; ++s) {
+      write[s] = input[s][i];
+    }
+
+    Lanes mix_l = Lanes();
+    Lanes mix_r = Lanes();
+    for (size_t g = 0; g < num_groups; ++g) {
+      Lanes sin = Interpolate(lut_sin, lfo_phase_[g], 1024.0f);
+      Lanes cos = Interpolate(lut_sin + 256, lfo_phase_[g], 1024.0f);
+
+      // The offset avoids the discontinuity at 0.
+      Lanes x = x_[g] + sin * lfo_amplitude[g] + 0.05f;
+      Lanes y = y_[g] + cos * lfo_amplitude[g];
+      x = Constrain(x, -1.0f, 1.0f);
+      y = Constrain(y, -1.0f, 2.0f);
+
+      // Angular coordinates.
+      Lanes distance = Sqrt(x * x + y * y);  // 0..sqrt(5)
+      Lanes angle = Interpolate(lut_arcsin, (x / distance + 1.0f) * 0.5f,
+                                256.0f);
+      distance *= 1.0f / 2.237f;
+      distance_[g] += 0.001f * (distance - distance_[g]);
+      angle_[g] += 0.001f * (angle - angle_[g]);
+      distance = distance_[g];
+      angle = angle_[g];
+
+      // Each ear hears both channels of the source, the far one later.
+      Lanes delay = distance * room_size;
+      Lanes delay_l = delay + Select(angle > 0.0f,
+                                     angle * binaural_delay, Lanes());
+      Lanes delay_r = delay - Select(angle < 0.0f,
+                                     angle * binaural_delay, Lanes());
+      LaneInt delay_l_integral = __builtin_convertvector(delay_l, LaneInt);
+      LaneInt delay_r_integral = __builtin_convertvector(delay_r, LaneInt);
+      Lanes delay_l_fractional = delay_l -
+          __builtin_convertvector(delay_l_integral, Lanes);
+      Lanes delay_r_fractional = delay_r -
+          __builtin_convertvector(delay_r_integral, Lanes);
+
+      // Gather the two frames around each delay.
+      Lanes a_l_l = Lanes(), a_l_r = Lanes(), b_l_l = Lanes(), b_l_r = Lanes();
+      Lanes a_r_l = Lanes(), a_r_r = Lanes(), b_r_l = Lanes(), b_r_r = Lanes();
+      for (size_t j = 0; j < kDopplerBankLanes; ++j) {
+        size_t s = g * kDopplerBankLanes + j;
+        size_t index_l = (cursor_ - delay_l_integral[j]) & kMask;
+        size_t index_r = (cursor_ - delay_r_integral[j]) & kMask;
+        const ShortFrame& a_l = arena_->frames[index_l][s];
+        const ShortFrame& b_l = arena_->frames[(index_l - 1) & kMask][s];
+        const ShortFrame& a_r = arena_->frames[index_r][s];
+        const ShortFrame& b_r = arena_->frames[(index_r - 1) & kMask][s];
+        a_l_l[j] = a_l.l;
+        a_l_r[j] = a_l.r;
+        b_l_l[j] = b_l.l;
+        b_l_r[j] = b_l.r;
+        a_r_l[j] = a_r.l;
+        a_r_r[j] = a_r.r;
+        b_r_l[j] = b_r.l;
+        b_r_r[j] = b_r.r;
+      }
+      Lanes s1_l = a_l_l + (b_l_l - a_l_l) * delay_l_fractional;
+      Lanes s2_l = a_l_r + (b_l_r - a_l_r) * delay_l_fractional;
+      Lanes s1_r = a_r_l + (b_r_l - a_r_l) * delay_r_fractional;
+      Lanes s2_r = a_r_r + (b_r_r - a_r_r) * delay_r_fractional;
+
+      // Distance attenuation.
+      Lanes atten = gain[g] / (1.0f + atten_factor * distance * distance);
+      Lanes fade_position = (angle + 1.0f) * 0.5f;
+      Lanes fade_in = Interpolate(lut_xfade_in, fade_position, 256.0f) * atten;
+      Lanes fade_out = Interpolate(lut_xfade_out, fade_position, 256.0f) *
+          atten;
+      mix_l += s2_l * fade_in + s1_l * fade_out;
+      mix_r += s1_r * fade_in + s2_r * fade_out;
+
+      x_[g] += x_increment[g];
+      y_[g] += y_increment[g];
+      lfo_phase_[g] += lfo_increment[g];
+      lfo_phase_[g] -= Select(lfo_phase_[g] > 1.0f, Lanes() + 1.0f, Lanes());
+    }
+
+    float l = mix_l[0] + mix_l[1] + mix_l[2] + mix_l[3];
+    float r = mix_r[0] + mix_r[1] + mix_r[2] + mix_r[3];
+    output[i].l = Clip16(static_cast<int32_t>(l));
+    output[i].r = Clip16(static_cast<int32_t>(r));
+    cursor_ = (cursor_ + 1) & kMask;
+  }
+}
+
+}  // namespace warps
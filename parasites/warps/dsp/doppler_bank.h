@@ -0,0 +1,98 @@
+// Copyright 2026 Aepelzen's Parasites contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Binaural Doppler effect of several sources, mixed into one stereo output.
+//
+// Each source behaves like the doppler mode of a Modulator, with its own
+// position and LFO. The sources share one delay arena, in which the frames
+// written by all the sources at a given time are interleaved, so that a
+// sample of all the sources is written to a single cache line. The positions
+// of the sources are computed by groups of kDopplerBankLanes in the lanes of
+// SIMD registers.
+
+#ifndef WARPS_DSP_DOPPLER_BANK_H_
+#define WARPS_DSP_DOPPLER_BANK_H_
+
+#include "stmlib/stmlib.h"
+
+#include "warps/dsp/lanes.h"
+#include "warps/dsp/modulator.h"
+#include "warps/dsp/parameters.h"
+
+namespace warps {
+
+const size_t kDopplerBankLanes = 4;
+const size_t kMaxDopplerBankSources = 16;
+// Must be a power of 2.
+const size_t kDopplerBankDelaySize = 16384;
+
+// Delay memory of the sources, 1 MB, which the caller allocates only when
+// the bank is used.
+struct DopplerBankArena {
+  ShortFrame frames[kDopplerBankDelaySize][kMaxDopplerBankSources];
+};
+
+class DopplerBank {
+ public:
+  DopplerBank() { }
+  ~DopplerBank() { }
+
+  // Clears the arena, which may be NULL as long as Process is not called.
+  void Init(float sample_rate, DopplerBankArena* arena);
+
+  // Mixes the first num_sources sources. Like in the doppler mode of a
+  // Modulator, source s is placed by parameters[s].raw_algorithm (x) and
+  // parameters[s].modulation_parameter (y), and moved by an LFO of rate
+  // parameters[s].channel_drive[0] and amplitude
+  // parameters[s].channel_drive[1]. The room is given by the carrier_shape of
+  // the first source. The sources are scaled by 1 / sqrt(num_sources).
+  void Process(
+      const Parameters* parameters,
+      const ShortFrame* const* input,
+      ShortFrame* output,
+      size_t num_sources,
+      size_t size);
+
+ private:
+  static const size_t kNumGroups =
+      kMaxDopplerBankSources / kDopplerBankLanes;
+
+  float sample_rate_;
+  size_t cursor_;
+
+  // Position at the end of the previous block.
+  Lanes x_[kNumGroups];
+  Lanes y_[kNumGroups];
+  Lanes lfo_phase_[kNumGroups];
+  Lanes distance_[kNumGroups];
+  Lanes angle_[kNumGroups];
+
+  DopplerBankArena* arena_;
+
+  DISALLOW_COPY_AND_ASSIGN(DopplerBank);
+};
+
+}  // namespace warps
+
+#endif  // WARPS_DSP_DOPPLER_BANK_H_
@@ -0,0 +1,71 @@
+// Copyright 2026 Aepelzen's Parasites contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Four floats in the lanes of a SIMD register, with the GCC vector extensions.
+
+#ifndef WARPS_DSP_LANES_H_
+#define WARPS_DSP_LANES_H_
+
+#include "stmlib/stmlib.h"
+
+namespace warps {
+
+typedef float Lanes __attribute__((vector_size(16)));
+typedef int32_t LaneInt __attribute__((vector_size(16)));
+typedef uint32_t LaneUint __attribute__((vector_size(16)));
+// All bits set in the lanes in which a comparison holds, 0 in the others.
+typedef LaneInt LaneMask;
+
+// a in the lanes in which mask is set, b in the others.
+inline LaneInt Select(LaneMask mask, LaneInt a, LaneInt b) {
+  return (mask & a) | (~mask & b);
+}
+
+inline Lanes Select(LaneMask mask, Lanes a, Lanes b) {
+  return reinterpret_cast<Lanes>(Select(
+      mask,
+      reinterpret_cast<LaneInt>(a),
+      reinterpret_cast<LaneInt>(b)));
+}
+
+// value in the lanes in which mask is set, 0.0f in the others.
+inline Lanes Select(LaneMask mask, Lanes value) {
+  return reinterpret_cast<Lanes>(mask & reinterpret_cast<LaneInt>(value));
+}
+
+inline Lanes Select(LaneMask mask, float value) {
+  return Select(mask, Lanes() + value);
+}
+
+inline Lanes ToFloat(LaneInt x) {
+  return __builtin_convertvector(x, Lanes);
+}
+
+inline LaneInt ToInt(Lanes x) {
+  return __builtin_convertvector(x, LaneInt);
+}
+
+}  // namespace warps
+
+#endif  // WARPS_DSP_LANES_H_
@@ -32,12 +32,17 @@
 #include "stmlib/stmlib.h"
 
 #include <algorithm>
+#include <cstring>
 
 #include "stmlib/dsp/dsp.h"
 #include "stmlib/dsp/filter.h"
 
+#include "warps/dsp/lanes.h"
+
 namespace warps {
 
+const size_t kMaxLimiterBlockSize = 96;
+
 class Limiter {
  public:
   Limiter() { }
@@ -65,6 +70,74 @@ class Limiter {
   DISALLOW_COPY_AND_ASSIGN(Limiter);
 };
 
+// Brickwall variant of the Limiter, with a look-ahead of one block: the
+// output is delayed by a block, so that the gain, ramped once per block,
+// is already down when a peak comes out. The block size must not change
+// between calls.
+class LookaheadLimiter {
+ public:
+  LookaheadLimiter() { }
+  ~LookaheadLimiter() { }
+
+  void Init() {
+    std::fill(&delay_[0], &delay_[kMaxLimiterBlockSize], 0.0f);
+    peak_ = 0.0f;
+    gain_ = 1.0f;
+  }
+
+  void Process(
+      float* in_out,
+      float pre_gain,
+      size_t size) {
+    // The ramp must end low enough for the block coming out next.
+    float peak = Peak(in_out, size) * pre_gain;
+    float target = 1.0f / std::max(1.0f, std::max(peak_, peak));
+    float gain = gain_;
+    if (target > gain) {
+      // Same release rate as the peak follower of the Limiter.
+      target = gain + (target - gain) * (0.00002f * size);
+    }
+    float increment = (target - gain) / static_cast<float>(size);
+    for (size_t i = 0; i < size; ++i) {
+      float s = delay_[i] * (gain + increment * static_cast<float>(i + 1));
+      delay_[i] = in_out[i] * pre_gain;
+      in_out[i] = stmlib::SoftLimit(s * 0.8f);
+    }
+    peak_ = peak;
+    gain_ = target;
+  }
+
+ private:
+  // Largest absolute value of the block.
+  static float Peak(const float* in, size_t size) {
+    const LaneMask abs_mask = LaneMask() + 0x7fffffff;
+    LaneMask peak = LaneMask();
+    size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+      Lanes x;
+      memcpy(&x, &in[i], sizeof(x));
+      // Positive floats compare like their bit patterns.
+      LaneMask a = reinterpret_cast<LaneMask>(x) & abs_mask;
+      LaneMask greater = a > peak;
+      peak = (a & greater) | (peak & ~greater);
+    }
+    Lanes lanes = reinterpret_cast<Lanes>(peak);
+    float result = std::max(
+        std::max(lanes[0], lanes[1]),
+        std::max(lanes[2], lanes[3]));
+    for (; i < size; ++i) {
+      result = std::max(result, fabsf(in[i]));
+    }
+    return result;
+  }
+
+  float delay_[kMaxLimiterBlockSize];
+  float peak_;
+  float gain_;
+
+  DISALLOW_COPY_AND_ASSIGN(LookaheadLimiter);
+};
+
 }  // namespace warps
 
 #endif  // WARPS_DSP_LIMITER_H_
@@ -29,11 +29,13 @@
 #include "warps/dsp/modulator.h"
 
 #include <algorithm>
+#include <cstring>
 
 #include "stmlib/dsp/units.h"
 #include "stmlib/utils/random.h"
 
 #include "warps/drivers/debug_pin.h"
+#include "warps/dsp/lanes.h"
 #include "warps/resources.h"
 
 namespace warps {
@@ -43,9 +45,99 @@ using namespace stmlib;
 
 const float kXmodCarrierGain = 0.5f;
 
+// Left and right channel.
+typedef float StereoLanes __attribute__((vector_size(8)));
+typedef int32_t StereoMask __attribute__((vector_size(8)));
+
+static inline StereoLanes Select(
+    StereoMask mask,
+    StereoLanes a,
+    StereoLanes b) {
+  StereoMask a_bits = reinterpret_cast<StereoMask>(a);
+  StereoMask b_bits = reinterpret_cast<StereoMask>(b);
+  return reinterpret_cast<StereoLanes>((mask & a_bits) | (~mask & b_bits));
+}
+
+static inline StereoLanes StereoSoftClip(StereoLanes x) {
+  StereoLanes one = StereoLanes() + 1.0f;
+  StereoLanes limited = x * (27.0f + x * x) / (27.0f + 9.0f * x * x);
+  limited = Select(x < -3.0f, -one, limited);
+  return Select(x > 3.0f, one, limited);
+}
+
+/* static */
+void SaturatingAmplifier::ProcessStereo(
+    SaturatingAmplifier* amplifier,
+    const float* drive,
+    float limit,
+    const ShortFrame* in,
+    float* out_l,
+    float* out_r,
+    float* out_raw,
+    size_t size) {
+  StereoLanes pre_gain;
+  StereoLanes post_gain;
+  for (size_t i = 0; i < 2; ++i) {
+    float drive_2 = drive[i] * drive[i];
+    float pre_gain_a = drive[i] * 0.5f;
+    float pre_gain_b = drive_2 * drive_2 * drive[i] * 24.0f;
+    pre_gain[i] = pre_gain_a + (pre_gain_b - pre_gain_a) * drive_2;
+    float drive_squished = drive[i] * (2.0f - drive[i]);
+    post_gain[i] = 1.0f / stmlib::SoftClip(
+        0.33f + drive_squished * (pre_gain[i] - 0.33f));
+  }
+
+  // Same ramps as the ParameterInterpolators of Process().
+  const StereoLanes target_drive = { drive[0], drive[1] };
+  StereoLanes level = { amplifier[0].level_, amplifier[1].level_ };
+  StereoLanes drive_value = { amplifier[0].drive_, amplifier[1].drive_ };
+  StereoLanes pre_gain_value = {
+    amplifier[0].pre_gain_, amplifier[1].pre_gain_
+  };
+  StereoLanes post_gain_value = {
+    amplifier[0].post_gain_, amplifier[1].post_gain_
+  };
+  const float n = static_cast<float>(size);
+  const StereoLanes drive_increment = (target_drive - drive_value) / n;
+  const StereoLanes pre_gain_increment = (pre_gain - pre_gain_value) / n;
+  const StereoLanes post_gain_increment = (post_gain - post_gain_value) / n;
+  const StereoLanes one = StereoLanes() + 1.0f;
+
+  for (size_t i = 0; i < size; ++i) {
+    // Noise gate and raw output.
+    StereoLanes s = {
+      static_cast<float>(in[i].l) / 32768.0f,
+      static_cast<float>(in[i].r) / 32768.0f
+    };
+    StereoLanes error = s * s - level;
+    level += error * Select(error > 0.0f, one * 0.1f, one * 0.0001f);
+    s *= Select(level <= 0.0001f, (1.0f / 0.0001f) * level, one);
+    drive_value += drive_increment;
+    StereoLanes raw = s * drive_value;
+    out_raw[i] = out_raw[i] + raw[0] + raw[1];
+
+    // Overdrive / gain.
+    pre_gain_value += pre_gain_increment;
+    post_gain_value += post_gain_increment;
+    StereoLanes pre = pre_gain_value * s;
+    StereoLanes post = StereoSoftClip(pre) * post_gain_value;
+    StereoLanes out = pre + (post - pre) * limit;
+    out_l[i] = out[0];
+    out_r[i] = out[1];
+  }
+
+  for (size_t i = 0; i < 2; ++i) {
+    amplifier[i].level_ = level[i];
+    amplifier[i].drive_ = drive_value[i];
+    amplifier[i].pre_gain_ = pre_gain_value[i];
+    amplifier[i].post_gain_ = post_gain_value[i];
+  }
+}
+
 void Modulator::Init(float sample_rate) {
   bypass_ = false;
-  feature_mode_ = FEATURE_MODE_META;
+  set_feature_mode(FEATURE_MODE_META);
+  external_carrier_ = NULL;
 
   for (int32_t i = 0; i < 2; ++i) {
     amplifier_[i].Init();
@@ -60,6 +152,7 @@ void Modulator::Init(float sample_rate) {
   vocoder_oscillator_.Init(sample_rate);
   quadrature_oscillator_.Init(sample_rate);
   vocoder_.Init(sample_rate);
+  lookahead_limiter_ = false;
 
   previous_parameters_.carrier_shape = 0;
   previous_parameters_.channel_drive[0] = 0.0f;
@@ -68,8 +161,38 @@ void Modulator::Init(float sample_rate) {
   previous_parameters_.modulation_parameter = 0.0f;
   previous_parameters_.note = 48.0f;
 
-  feedback_sample_ = 0.0f;
   delay_interpolation_ = INTERPOLATION_HERMITE;
+  delay_sync_time_ = 0.0f;
+  delay_previous_sync_time_ = 0.0f;
+  delay_sync_offset_ = 0;
+  num_delay_taps_ = 0;
+  chebyschev_envelope_ = 0.0f;
+  ClearDelay();
+
+  profiler_.Init();
+}
+
+void Modulator::ClearDelay() {
+  feedback_sample_ = 0.0f;
+  delay_feedback_.l = delay_feedback_.r = 0.0f;
+  delay_write_head_ = 0;
+  delay_write_position_ = 0.0f;
+  for (int32_t i = 0; i < 3; ++i) {
+    delay_history_[i].l = delay_history_[i].r = 0.0f;
+  }
+  delay_lp_time_ = 0.0f;
+  delay_lp_rate_ = 0.0f;
+  delay_next_time_ = 0.0f;
+  delay_head_fade_ = 0.0f;
+  delay_queued_time_ = 0.0f;
+  memset(delay_tap_output_, 0, sizeof(delay_tap_output_));
+
+  doppler_cursor_ = 0;
+  doppler_lfo_phase_ = 0.0f;
+  doppler_distance_ = 1.0f;
+  doppler_angle_ = 1.0f;
+  doppler_target_distance_ = 1.0f;
+  doppler_target_angle_ = 1.0f;
 
   ShortFrame e = {0, 0};
   fill(delay_buffer_, delay_buffer_+DELAY_SIZE, e);
@@ -195,7 +318,9 @@ void Modulator::ProcessFreqShifter(
     ++output;
     ++input;
   }
+  FlushDenormal(&feedback_sample);
   feedback_sample_ = feedback_sample;
+  quadrature_transform_[1].FlushDenormals();
   previous_parameters_ = parameters_;
 }
 
@@ -213,17 +338,7 @@ void Modulator::ProcessVocoder(
   }
 
   // Convert audio inputs to float and apply VCA/saturation (5.8% per channel)
-  short* input_samples = &input->l;
-  for (int32_t i = parameters_.carrier_shape ? 1 : 0; i < 2; ++i) {
-      amplifier_[i].Process(
-          parameters_.channel_drive[i],
-          1.0f,
-          input_samples + i,
-          buffer_[i],
-          aux_output,
-          2,
-          size);
-  }
+  Amplify(input, 1.0f, aux_output, size);
 
   // If necessary, render carrier. Otherwise, sum signals 1 and 2 for aux out.
   if (parameters_.carrier_shape) {
@@ -236,12 +351,7 @@ void Modulator::ProcessVocoder(
 
     // Outside of the transition zone between the cross-modulation and vocoding
     // algorithm, we need to render only one of the two oscillators.
-    float carrier_gain = vocoder_oscillator_.Render(
-          vocoder_shape,
-          parameters_.note,
-          internal_modulation_,
-          aux_output,
-          size);
+    float carrier_gain = RenderVocoderCarrier(vocoder_shape, aux_output, size);
     for (size_t i = 0; i < size; ++i) {
       carrier[i] = aux_output[i] * carrier_gain;
     }
@@ -250,8 +360,19 @@ void Modulator::ProcessVocoder(
   float release_time = parameters_.modulation_parameter;
   vocoder_.set_release_time(release_time * (2.0f - release_time));
   vocoder_.set_formant_shift(parameters_.modulation_algorithm);
+  if (lookahead_limiter_ && !vocoder_.lookahead_limiter()) {
+    fill(&lookahead_aux_output_[0], &lookahead_aux_output_[size], 0.0f);
+  }
+  vocoder_.set_lookahead_limiter(lookahead_limiter_);
   vocoder_.Process(modulator, carrier, main_output, size);
 
+  // Delay the aux output by the block of look-ahead of the main output.
+  if (lookahead_limiter_) {
+    for (size_t i = 0; i < size; ++i) {
+      swap(aux_output[i], lookahead_aux_output_[i]);
+    }
+  }
+
   // Convert back to integer and clip.
   while (size--) {
     output->l = Clip16(static_cast<int32_t>(*main_output * 32768.0f));
@@ -278,26 +399,15 @@ void Modulator::ProcessMeta(
   float* oversampled_output = src_buffer_[0];
 
   // 0.0: use cross-modulation algorithms. 1.0f: use vocoder.
-  float vocoder_amount = (
-      parameters_.modulation_algorithm - 0.7f) * 20.0f + 0.5f;
-  CONSTRAIN(vocoder_amount, 0.0f, 1.0f);
+  float vocoder_amount = VocoderAmount(parameters_.modulation_algorithm);
 
   if (!parameters_.carrier_shape) {
     fill(&aux_output[0], &aux_output[size], 0.0f);
   }
 
   // Convert audio inputs to float and apply VCA/saturation (5.8% per channel)
-  short* input_samples = &input->l;
-  for (int32_t i = parameters_.carrier_shape ? 1 : 0; i < 2; ++i) {
-      amplifier_[i].Process(
-          parameters_.channel_drive[i],
-          1.0f - vocoder_amount,
-          input_samples + i,
-          buffer_[i],
-          aux_output,
-          2,
-          size);
-  }
+  Amplify(input, 1.0f - vocoder_amount, aux_output, size);
+  profiler_.Mark(PROFILER_STAGE_AMPLIFIER);
 
   // If necessary, render carrier. Otherwise, sum signals 1 and 2 for aux out.
   if (parameters_.carrier_shape) {
@@ -315,20 +425,13 @@ void Modulator::ProcessMeta(
     // Outside of the transition zone between the cross-modulation and vocoding
     // algorithm, we need to render only one of the two oscillators.
     if (vocoder_amount == 0.0f) {
-      xmod_oscillator_.Render(
-          xmod_shape,
-          parameters_.note,
-          internal_modulation_,
-          aux_output,
-          size);
+      RenderXmodCarrier(xmod_shape, aux_output, size);
       for (size_t i = 0; i < size; ++i) {
         carrier[i] = aux_output[i] * kXmodCarrierGain;
       }
     } else if (vocoder_amount >= 0.5f) {
-      float carrier_gain = vocoder_oscillator_.Render(
+      float carrier_gain = RenderVocoderCarrier(
           vocoder_shape,
-          parameters_.note,
-          internal_modulation_,
           aux_output,
           size);
       for (size_t i = 0; i < size; ++i) {
@@ -336,16 +439,9 @@ void Modulator::ProcessMeta(
       }
     } else {
       float balance = vocoder_amount * 2.0f;
-      xmod_oscillator_.Render(
-          xmod_shape,
-          parameters_.note,
-          internal_modulation_,
-          carrier,
-          size);
-      float carrier_gain = vocoder_oscillator_.Render(
+      RenderXmodCarrier(xmod_shape, carrier, size);
+      float carrier_gain = RenderVocoderCarrier(
           vocoder_shape,
-          parameters_.note,
-          internal_modulation_,
           aux_output,
           size);
       for (size_t i = 0; i < size; ++i) {
@@ -357,11 +453,13 @@ void Modulator::ProcessMeta(
         carrier[i] = a + (b - a) * balance;
       }
     }
+    profiler_.Mark(PROFILER_STAGE_OSCILLATOR);
   }
 
   if (vocoder_amount < 0.5f) {
     src_up_[0].Process(carrier, oversampled_carrier, size);
     src_up_[1].Process(modulator, oversampled_modulator, size);
+    profiler_.Mark(PROFILER_STAGE_SRC_UP);
 
     float algorithm = min(parameters_.modulation_algorithm * 8.0f, 5.999f);
     float previous_algorithm = min(
@@ -383,15 +481,19 @@ void Modulator::ProcessMeta(
         oversampled_carrier,
         oversampled_output,
         size * kOversampling);
+    profiler_.Mark(PROFILER_STAGE_XMOD);
 
     src_down_.Process(oversampled_output, main_output, size * kOversampling);
+    profiler_.Mark(PROFILER_STAGE_SRC_DOWN);
   } else {
     float release_time = 4.0f * (parameters_.modulation_algorithm - 0.75f);
     CONSTRAIN(release_time, 0.0f, 1.0f);
 
     vocoder_.set_release_time(release_time * (2.0f - release_time));
     vocoder_.set_formant_shift(parameters_.modulation_parameter);
+    vocoder_.set_lookahead_limiter(false);
     vocoder_.Process(modulator, carrier, main_output, size);
+    profiler_.Mark(PROFILER_STAGE_VOCODER);
   }
 
   // Cross-fade to raw modulator for the transition between cross-modulation
@@ -432,17 +534,8 @@ void Modulator::Process1(ShortFrame* input, ShortFrame* output, size_t size) {
   }
 
   // Convert audio inputs to float and apply VCA/saturation (5.8% per channel)
-  short* input_samples = &input->l;
-  for (int32_t i = parameters_.carrier_shape ? 1 : 0; i < 2; ++i) {
-      amplifier_[i].Process(
-          parameters_.channel_drive[i],
-          1.0f,
-          input_samples + i,
-          buffer_[i],
-          aux_output,
-          2,
-          size);
-  }
+  Amplify(input, 1.0f, aux_output, size);
+  profiler_.Mark(PROFILER_STAGE_AMPLIFIER);
 
   // If necessary, render carrier. Otherwise, sum signals 1 and 2 for aux out.
   if (parameters_.carrier_shape) {
@@ -453,19 +546,16 @@ void Modulator::Process1(ShortFrame* input, ShortFrame* output, size_t size) {
 
     OscillatorShape xmod_shape = static_cast<OscillatorShape>(
         parameters_.carrier_shape - 1);
-    xmod_oscillator_.Render(
-          xmod_shape,
-          parameters_.note,
-          internal_modulation_,
-          aux_output,
-          size);
+    RenderXmodCarrier(xmod_shape, aux_output, size);
     for (size_t i = 0; i < size; ++i) {
       carrier[i] = aux_output[i] * kXmodCarrierGain;
     }
+    profiler_.Mark(PROFILER_STAGE_OSCILLATOR);
   }
 
   src_up2_[0].Process(carrier, oversampled_carrier, size);
   src_up2_[1].Process(modulator, oversampled_modulator, size);
+  profiler_.Mark(PROFILER_STAGE_SRC_UP);
 
   ProcessXmod<algorithm>(
         previous_parameters_.modulation_algorithm,
@@ -476,8 +566,10 @@ void Modulator::Process1(ShortFrame* input, ShortFrame* output, size_t size) {
         oversampled_carrier,
         oversampled_output,
         size * kLessOversampling);
+  profiler_.Mark(PROFILER_STAGE_XMOD);
 
   src_down2_[0].Process(oversampled_output, main_output, size * kLessOversampling);
+  profiler_.Mark(PROFILER_STAGE_SRC_DOWN);
 
   // Convert back to integer and clip.
   while (size--) {
@@ -501,17 +593,7 @@ void Modulator::ProcessBitcrusher(ShortFrame* input, ShortFrame* output, size_t
   }
 
   // Convert audio inputs to float and apply VCA/saturation (5.8% per channel)
-  short* input_samples = &input->l;
-  for (int32_t i = parameters_.carrier_shape ? 1 : 0; i < 2; ++i) {
-      amplifier_[i].Process(
-          parameters_.channel_drive[i],
-          1.0f,
-          input_samples + i,
-          buffer_[i],
-          aux_output,
-          2,
-          size);
-  }
+  Amplify(input, 1.0f, aux_output, size);
 
   // If necessary, render carrier. Otherwise, sum signals 1 and 2 for aux out.
   if (parameters_.carrier_shape) {
@@ -522,12 +604,7 @@ void Modulator::ProcessBitcrusher(ShortFrame* input, ShortFrame* output, size_t
 
     OscillatorShape xmod_shape = static_cast<OscillatorShape>(
         parameters_.carrier_shape - 1);
-    xmod_oscillator_.Render(
-          xmod_shape,
-          parameters_.note,
-          internal_modulation_,
-          aux_output,
-          size);
+    RenderXmodCarrier(xmod_shape, aux_output, size);
     for (size_t i = 0; i < size; ++i) {
       carrier[i] = aux_output[i] * kXmodCarrierGain;
     }
@@ -539,16 +616,16 @@ void Modulator::ProcessBitcrusher(ShortFrame* input, ShortFrame* output, size_t
   CONSTRAIN(mod_1, 0.0f, 1.0f);
   CONSTRAIN(mod_2, 0.0f, 1.0f);
 
-  ProcessXmod<ALGORITHM_BITCRUSHER>(
-        previous_parameters_.modulation_algorithm,
-        parameters_.modulation_algorithm,
-        mod_1,
-        mod_2,
-        carrier,
-  modulator,
-        main_output,
-  aux_output,
-        size);
+  ProcessBitcrusherXmod(
+      previous_parameters_.modulation_algorithm,
+      parameters_.modulation_algorithm,
+      mod_1,
+      mod_2,
+      carrier,
+      modulator,
+      main_output,
+      aux_output,
+      size);
 
   // Convert back to integer and clip.
   while (size--) {
@@ -562,17 +639,229 @@ void Modulator::ProcessBitcrusher(ShortFrame* input, ShortFrame* output, size_t
 
 }
 
-void Modulator::ProcessDelay(ShortFrame* input, ShortFrame* output, size_t size) {
+// Loads up to 4 samples, padded with zeros past size.
+static inline Lanes LoadLanes(const float* in, size_t size) {
+  Lanes x = Lanes();
+  if (size >= 4) {
+    memcpy(&x, in, sizeof(x));
+  } else {
+    for (size_t i = 0; i < size; ++i) {
+      x[i] = in[i];
+    }
+  }
+  return x;
+}
+
+static inline void StoreLanes(Lanes x, float* out, size_t size) {
+  if (size >= 4) {
+    memcpy(out, &x, sizeof(x));
+  } else {
+    for (size_t i = 0; i < size; ++i) {
+      out[i] = x[i];
+    }
+  }
+}
+
+// Number of steps of "while (n > 1.0f) n--;".
+static inline LaneInt ChebyshevSteps(Lanes n) {
+  LaneInt truncated = ToInt(n);
+  LaneInt steps = Select(ToFloat(truncated) == n, truncated - 1, truncated);
+  return Select(n > 1.0f, steps, LaneInt());
+}
+
+// Crossfade between the Chebyshev polynomials of x around order n, as the
+// loop of Xmod<ALGORITHM_CHEBYSCHEV> and Mod<ALGORITHM_CHEBYSCHEV> computes
+// it. Each lane stops the recurrence after its own number of steps, so that
+// a ramp of n gives the same result as the scalar code.
+static inline Lanes ChebyshevBlend(Lanes x, Lanes n) {
+  LaneInt steps = ChebyshevSteps(n);
+  int32_t max_steps = max(max(steps[0], steps[1]), max(steps[2], steps[3]));
+
+  Lanes x2 = 2.0f * x;
+  Lanes tn1 = x;
+  Lanes tn = x2 * x - 1.0f;
+  for (int32_t i = 0; i < max_steps; ++i) {
+    LaneInt active = (LaneInt() + i) < steps;
+    Lanes next = x2 * tn - tn1;
+    tn1 = Select(active, tn, tn1);
+    tn = Select(active, next, tn);
+  }
+  return tn1 + (tn - tn1) * (n - ToFloat(steps));
+}
+
+// ChebyshevBlend over a block, in place, with the order ramping as
+// p * scale. Most of the time the order does not move during the block: the
+// recurrence then runs without masks, on 16 samples at a time to hide its
+// latency.
+static void ChebyshevBlend(
+    float p,
+    float p_increment,
+    float scale,
+    float* x,
+    size_t size) {
+  const size_t kGroups = 4;
+  float n[kMaxBlockSize * kOversampling];
+  for (size_t i = 0; i < size; ++i) {
+    n[i] = p * scale;
+    p += p_increment;
+  }
+
+  LaneInt steps = ChebyshevSteps(Lanes() + n[0]);
+  bool uniform = true;
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    LaneInt same = ChebyshevSteps(LoadLanes(&n[i], 4)) == steps;
+    uniform = uniform && (same[0] & same[1] & same[2] & same[3]);
+  }
+  for (; i < size; ++i) {
+    uniform = uniform && ChebyshevSteps(Lanes() + n[i])[0] == steps[0];
+  }
 
+  i = 0;
+  if (uniform) {
+    const int32_t num_steps = steps[0];
+    const Lanes origin = ToFloat(steps);
+    for (; i + 4 * kGroups <= size; i += 4 * kGroups) {
+      Lanes x2[kGroups];
+      Lanes tn1[kGroups];
+      Lanes tn[kGroups];
+      Lanes fractional[kGroups];
+      for (size_t g = 0; g < kGroups; ++g) {
+        memcpy(&tn1[g], &x[i + 4 * g], sizeof(tn1[g]));
+        memcpy(&fractional[g], &n[i + 4 * g], sizeof(fractional[g]));
+        fractional[g] -= origin;
+        x2[g] = 2.0f * tn1[g];
+        tn[g] = x2[g] * tn1[g] - 1.0f;
+      }
+      for (int32_t j = 0; j < num_steps; ++j) {
+        for (size_t g = 0; g < kGroups; ++g) {
+          Lanes next = x2[g] * tn[g] - tn1[g];
+          tn1[g] = tn[g];
+          tn[g] = next;
+        }
+      }
+      for (size_t g = 0; g < kGroups; ++g) {
+        Lanes y = tn1[g] + (tn[g] - tn1[g]) * fractional[g];
+        memcpy(&x[i + 4 * g], &y, sizeof(y));
+      }
+    }
+  }
+  for (; i < size; i += 4) {
+    Lanes y = ChebyshevBlend(
+        LoadLanes(&x[i], size - i),
+        LoadLanes(&n[i], size - i));
+    StoreLanes(y, &x[i], size - i);
+  }
+}
+
+template<>
+void Modulator::ProcessXmod<ALGORITHM_CHEBYSCHEV>(
+    float p_1,
+    float p_1_end,
+    float p_2,
+    float p_2_end,
+    const float* in_1,
+    const float* in_2,
+    float* out,
+    size_t size) {
+  float gain[kMaxBlockSize * kOversampling];
+
+  // Same accumulation as the generic ProcessXmod.
+  float step = 1.0f / static_cast<float>(size);
+  float p_1_increment = (p_1_end - p_1) * step;
+  float p_2_increment = (p_2_end - p_2) * step;
+  for (size_t i = 0; i < size; ++i) {
+    float s = (in_1[i] + in_2[i]) * (p_2 * 2.0f);
+    CONSTRAIN(s, -1.0f, 1.0f);
+    out[i] = s;
+    gain[i] = p_2;
+    p_2 += p_2_increment;
+  }
+  ChebyshevBlend(p_1, p_1_increment, 16.0f, out, size);
+  for (size_t i = 0; i < size; ++i) {
+    out[i] = out[i] / gain[i] * 0.5f;
+  }
+}
+
+/* static */
+void Modulator::ProcessChebyschevMod(
+    float p,
+    float p_end,
+    const float* in,
+    float* out,
+    size_t size,
+    float* envelope) {
+  const float att = 0.01f;
+  const float rel = 0.000005f;
+  const float degree = 6.0f;
+
+  // The envelope follower runs sample by sample, the polynomials 4 samples
+  // at a time.
+  float amp[kMaxBlockSize * kOversampling];
+  float step = 1.0f / static_cast<float>(size);
+  float p_increment = (p_end - p) * step;
+  float e = *envelope;
+  for (size_t i = 0; i < size; ++i) {
+    SLOPE(e, fabs(in[i]), att, rel);
+    amp[i] = 0.9f / e;
+    out[i] = in[i] * amp[i];
+  }
+  *envelope = e;
+  ChebyshevBlend(p, p_increment, degree, out, size);
+  for (size_t i = 0; i < size; ++i) {
+    out[i] /= amp[i];
+  }
+}
+
+// Crossfade between the read heads of the delay, in about 10ms at 96kHz.
+const float kDelayHeadFadeIncrement = 1.0f / 1024.0f;
+
+FloatFrame Modulator::ReadDelay(float index) {
   ShortFrame *buffer = delay_buffer_;
 
-  static FloatFrame feedback_sample;
+  while (index < 0) {
+    index += DELAY_SIZE;
+  }
+  // Running backwards, the read head is ahead of the write head by the
+  // fractional write position times the rate, which is many frames after the
+  // rate rises from a low value, while the smoothed time can still be near 0.
+  while (index >= DELAY_SIZE) {
+    index -= DELAY_SIZE;
+  }
+
+  MAKE_INTEGRAL_FRACTIONAL(index);
 
-  static int32_t write_head = 0;
+  ShortFrame xm1 = buffer[index_integral];
+  ShortFrame x0 = buffer[(index_integral + 1) % DELAY_SIZE];
+  ShortFrame x1 = buffer[(index_integral + 2) % DELAY_SIZE];
+  ShortFrame x2 = buffer[(index_integral + 3) % DELAY_SIZE];
 
-  static float write_position = 0.0f;
+  FloatFrame wet;
 
-  static FloatFrame previous_samples[3] = {{0.0f, 0.0f}, {0.0f, 0.0f}, {0.0f, 0.0f}};
+  if (delay_interpolation_ == INTERPOLATION_ZOH) {
+    wet.l = xm1.l;
+    wet.r = xm1.r;
+  } else if (delay_interpolation_ == INTERPOLATION_LINEAR) {
+    wet.l = xm1.l + (x0.l - xm1.l) * index_fractional;
+    wet.r = xm1.r + (x0.r - xm1.r) * index_fractional;
+  } else {
+    FloatFrame c = { (x1.l - xm1.l) * 0.5f,
+                     (x1.r - xm1.r) * 0.5f };
+    FloatFrame v = { (float)(x0.l - x1.l), (float)(x0.r - x1.r)};
+    FloatFrame w = { c.l + v.l, c.r + v.r };
+    FloatFrame a = { w.l + v.l + (x2.l - x0.l) * 0.5f,
+                     w.r + v.r + (x2.r - x0.r) * 0.5f };
+    FloatFrame b_neg = { w.l + a.l, w.r + a.r };
+    float t = index_fractional;
+    wet.l = ((((a.l * t) - b_neg.l) * t + c.l) * t + x0.l);
+    wet.r = ((((a.r * t) - b_neg.r) * t + c.r) * t + x0.r);
+  }
+  return wet;
+}
+
+void Modulator::ProcessDelay(ShortFrame* input, ShortFrame* output, size_t size) {
+
+  ShortFrame *buffer = delay_buffer_;
 
   float time = previous_parameters_.modulation_parameter * (DELAY_SIZE-10) + 5;
   float time_end = parameters_.modulation_parameter * (DELAY_SIZE-10) + 5;
@@ -597,16 +886,41 @@ void Modulator::ProcessDelay(ShortFrame* input, ShortFrame* output, size_t size)
   filter_[0].set_f<stmlib::FREQUENCY_FAST>(0.0008f);
   filter_[1].set_f<stmlib::FREQUENCY_FAST>(0.0008f);
 
+  // The synced time applies from delay_sync_offset_.
+  size_t previous_sync_size = delay_sync_offset_;
+
+  // Position of the main read head without its time, and gain of its output,
+  // from which the extra read heads are rendered after the block is written.
+  float tap_head[kMaxBlockSize];
+  float tap_gain[kMaxBlockSize];
+  size_t tap_size = 0;
+
   while (size--) {
 
-    static float lp_time = 0.0f;
-    ONE_POLE(lp_time, time, 0.00002f);
+    float sync_time = previous_sync_size ?
+        delay_previous_sync_time_ : delay_sync_time_;
+    if (previous_sync_size) {
+      --previous_sync_size;
+    }
+    if (delay_head_fade_ == 0.0f) {
+      delay_queued_time_ = 0.0f;
+      if (sync_time == 0.0f) {
+        ONE_POLE(delay_lp_time_, time, 0.00002f);
+      } else if (sync_time != delay_lp_time_) {
+        // Jump to the new time through a second read head.
+        delay_next_time_ = sync_time;
+        delay_head_fade_ = kDelayHeadFadeIncrement;
+      }
+    } else {
+      // A synced time which changes during the crossfade is queued, and
+      // faded to as soon as the crossfade ends.
+      delay_queued_time_ = sync_time != delay_next_time_ ? sync_time : 0.0f;
+    }
 
-    static float lp_rate;
-    ONE_POLE(lp_rate, rate, 0.007f);
-    float sample_rate = fabsf(lp_rate);
+    ONE_POLE(delay_lp_rate_, rate, 0.007f);
+    float sample_rate = fabsf(delay_lp_rate_);
     CONSTRAIN(sample_rate, 0.001f, 1.0f);
-    int direction = lp_rate > 0.0f ? 1 : -1;
+    int direction = delay_lp_rate_ > 0.0f ? 1 : -1;
 
     FloatFrame in;
     in.l = static_cast<float>(input->l) / 32768.0f;
@@ -616,14 +930,14 @@ void Modulator::ProcessDelay(ShortFrame* input, ShortFrame* output, size_t size)
 
     if (parameters_.carrier_shape == 3) {
       // invert feedback channels (ping-pong)
-      fb.l = feedback_sample.r * feedback * 1.1f;
-      fb.r = feedback_sample.l * feedback * 1.1f;
+      fb.l = delay_feedback_.r * feedback * 1.1f;
+      fb.r = delay_feedback_.l * feedback * 1.1f;
     } else if (parameters_.carrier_shape == 2) {
       // simulate tape hiss with a bit of noise
       float noise1 = Random::GetFloat();
       float noise2 = Random::GetFloat();
-      fb.l = feedback_sample.l + noise1 * 0.002f;
-      fb.r = feedback_sample.r + noise2 * 0.002f;
+      fb.l = delay_feedback_.l + noise1 * 0.002f;
+      fb.r = delay_feedback_.r + noise2 * 0.002f;
       // apply filters: fixed high-pass and varying low-pass with attenuation
       filter_[2].set_f<stmlib::FREQUENCY_FAST>(feedback / 12.0f);
       filter_[3].set_f<stmlib::FREQUENCY_FAST>(feedback / 12.0f);
@@ -639,12 +953,12 @@ void Modulator::ProcessDelay(ShortFrame* input, ShortFrame* output, size_t size)
     } else if (parameters_.carrier_shape == 0) {
       // open feedback loop
       fb.l = feedback * 1.1f * in.r;
-      fb.r = feedback_sample.l;
+      fb.r = delay_feedback_.l;
       in.r = 0.0f;
     } else {
       // classic dual delay
-      fb.l = feedback_sample.l * feedback * 1.1f;
-      fb.r = feedback_sample.r * feedback * 1.1f;
+      fb.l = delay_feedback_.l * feedback * 1.1f;
+      fb.r = delay_feedback_.r * feedback * 1.1f;
     }
 
     // input + feedback
@@ -653,7 +967,7 @@ void Modulator::ProcessDelay(ShortFrame* input, ShortFrame* output, size_t size)
     mix.r = in.r + fb.r;
 
     // write to buffer
-    while (write_position < 1.0f) {
+    while (delay_write_position_ < 1.0f) {
 
       // read somewhere between the input and the previous input
       FloatFrame s = {0, 0};
@@ -662,12 +976,12 @@ void Modulator::ProcessDelay(ShortFrame* input, ShortFrame* output, size_t size)
         s.l = mix.l;
         s.r = mix.r;
       } else if (delay_interpolation_ == INTERPOLATION_LINEAR) {
-        s.l = previous_samples[0].l + (mix.l - previous_samples[0].l) * write_position;
-        s.r = previous_samples[0].r + (mix.r - previous_samples[0].r) * write_position;
+        s.l = delay_history_[0].l + (mix.l - delay_history_[0].l) * delay_write_position_;
+        s.r = delay_history_[0].r + (mix.r - delay_history_[0].r) * delay_write_position_;
       } else if (delay_interpolation_ == INTERPOLATION_HERMITE) {
-        FloatFrame xm1 = previous_samples[2];
-        FloatFrame x0 = previous_samples[1];
-        FloatFrame x1 = previous_samples[0];
+        FloatFrame xm1 = delay_history_[2];
+        FloatFrame x0 = delay_history_[1];
+        FloatFrame x1 = delay_history_[0];
         FloatFrame x2 = mix;
 
         FloatFrame c = { (x1.l - xm1.l) * 0.5f,
@@ -677,65 +991,48 @@ void Modulator::ProcessDelay(ShortFrame* input, ShortFrame* output, size_t size)
         FloatFrame a = { w.l + v.l + (x2.l - x0.l) * 0.5f,
                          w.r + v.r + (x2.r - x0.r) * 0.5f };
         FloatFrame b_neg = { w.l + a.l, w.r + a.r };
-        float t = write_position;
+        float t = delay_write_position_;
         s.l = ((((a.l * t) - b_neg.l) * t + c.l) * t + x0.l);
         s.r = ((((a.r * t) - b_neg.r) * t + c.r) * t + x0.r);
       }
 
       // write this to buffer
-      buffer[write_head].l = Clip16((s.l) * 32768.0f);
-      buffer[write_head].r = Clip16((s.r) * 32768.0f);
+      buffer[delay_write_head_].l = Clip16((s.l) * 32768.0f);
+      buffer[delay_write_head_].r = Clip16((s.r) * 32768.0f);
 
-      write_position += 1.0f / sample_rate;
+      delay_write_position_ += 1.0f / sample_rate;
 
-      write_head += direction;
+      delay_write_head_ += direction;
       // wraparound
-      if (write_head >= DELAY_SIZE)
-        write_head -= DELAY_SIZE;
-      else if (write_head < 0)
-        write_head += DELAY_SIZE;
+      if (delay_write_head_ >= DELAY_SIZE)
+        delay_write_head_ -= DELAY_SIZE;
+      else if (delay_write_head_ < 0)
+        delay_write_head_ += DELAY_SIZE;
     }
 
-    write_position--;
+    delay_write_position_--;
 
-    previous_samples[2] = previous_samples[1];
-    previous_samples[1] = previous_samples[0];
-    previous_samples[0] = mix;
+    delay_history_[2] = delay_history_[1];
+    delay_history_[1] = delay_history_[0];
+    delay_history_[0] = mix;
 
     // read from buffer
 
-    float index = write_head - write_position * sample_rate * direction - lp_time;
-
-    while (index < 0) {
-      index += DELAY_SIZE;
-    }
-
-    MAKE_INTEGRAL_FRACTIONAL(index);
-
-    ShortFrame xm1 = buffer[index_integral];
-    ShortFrame x0 = buffer[(index_integral + 1) % DELAY_SIZE];
-    ShortFrame x1 = buffer[(index_integral + 2) % DELAY_SIZE];
-    ShortFrame x2 = buffer[(index_integral + 3) % DELAY_SIZE];
-
-    FloatFrame wet;
-
-    if (delay_interpolation_ == INTERPOLATION_ZOH) {
-      wet.l = xm1.l;
-      wet.r = xm1.r;
-    } else if (delay_interpolation_ == INTERPOLATION_LINEAR) {
-      wet.l = xm1.l + (x0.l - xm1.l) * index_fractional;
-      wet.r = xm1.r + (x0.r - xm1.r) * index_fractional;
-    } else if (delay_interpolation_ == INTERPOLATION_HERMITE) {
-      FloatFrame c = { (x1.l - xm1.l) * 0.5f,
-                       (x1.r - xm1.r) * 0.5f };
-      FloatFrame v = { (float)(x0.l - x1.l), (float)(x0.r - x1.r)};
-      FloatFrame w = { c.l + v.l, c.r + v.r };
-      FloatFrame a = { w.l + v.l + (x2.l - x0.l) * 0.5f,
-                       w.r + v.r + (x2.r - x0.r) * 0.5f };
-      FloatFrame b_neg = { w.l + a.l, w.r + a.r };
-      float t = index_fractional;
-      wet.l = ((((a.l * t) - b_neg.l) * t + c.l) * t + x0.l);
-      wet.r = ((((a.r * t) - b_neg.r) * t + c.r) * t + x0.r);
+    float head = delay_write_head_ - delay_write_position_ * sample_rate * direction;
+    FloatFrame wet = ReadDelay(head - delay_lp_time_);
+    if (delay_head_fade_ > 0.0f) {
+      FloatFrame next = ReadDelay(head - delay_next_time_);
+      wet.l += (next.l - wet.l) * delay_head_fade_;
+      wet.r += (next.r - wet.r) * delay_head_fade_;
+      delay_head_fade_ += kDelayHeadFadeIncrement;
+      if (delay_head_fade_ >= 1.0f) {
+        delay_lp_time_ = delay_next_time_;
+        delay_head_fade_ = 0.0f;
+        if (delay_queued_time_ != 0.0f) {
+          delay_next_time_ = delay_queued_time_;
+          delay_head_fade_ = kDelayHeadFadeIncrement;
+        }
+      }
     }
 
     wet.l /= 32768.0f;
@@ -748,7 +1045,11 @@ void Modulator::ProcessDelay(ShortFrame* input, ShortFrame* output, size_t size)
     wet.l *= gain * gain;
     wet.r *= gain * gain;
 
-    feedback_sample = wet;
+    tap_head[tap_size] = head;
+    tap_gain[tap_size] = gain * gain;
+    ++tap_size;
+
+    delay_feedback_ = wet;
 
     float fade_in = Interpolate(lut_xfade_in, drywet, 256.0f);
     float fade_out = Interpolate(lut_xfade_out, drywet, 256.0f);
@@ -776,32 +1077,211 @@ void Modulator::ProcessDelay(ShortFrame* input, ShortFrame* output, size_t size)
     output++;
   }
 
+  if (num_delay_taps_) {
+    ProcessDelayTaps(tap_head, tap_gain, tap_size);
+  }
+
+  delay_previous_sync_time_ = delay_sync_time_;
+  delay_sync_offset_ = 0;
   previous_parameters_ = parameters_;
 }
 
-void Modulator::ProcessDoppler(ShortFrame* input, ShortFrame* output, size_t size) {
-  ShortFrame *buffer = delay_buffer_;
+void Modulator::set_delay_taps(const DelayTap* taps, size_t num_taps) {
+  // Further from the write head than the distance it travels in a block, so
+  // that the taps, read after the block is written, read what they would
+  // have read at each sample.
+  const float min_time = kMaxBlockSize + 4;
+  const float max_time = DELAY_SIZE - kMaxBlockSize - 4;
+
+  num_taps = min(num_taps, kMaxDelayTaps);
+  for (size_t t = 0; t < num_taps; ++t) {
+    DelayTap tap = taps[t];
+    while (tap.time > max_time) {
+      tap.time *= 0.5f;
+    }
+    CONSTRAIN(tap.time, min_time, max_time);
+    CONSTRAIN(tap.level, 0.0f, 1.0f);
+    CONSTRAIN(tap.pan, -1.0f, 1.0f);
+    delay_taps_[t] = tap;
+    if (t >= num_delay_taps_) {
+      previous_delay_taps_[t] = tap;
+    }
+  }
+  num_delay_taps_ = num_taps;
+}
 
-  static size_t cursor = 0;
-  static float lfo_phase = 0.0f;
-  static float distance = 1.0f;
-  static float angle = 1.0f;
+// Reads the four frames of the delay line from index, wrapped to the size
+// of the line, with the left channels in the lanes of l and the right
+// channels in the lanes of r. The Hermite interpolation between the second
+// and third frames is then the sum of the lanes of l * weights and
+// r * weights.
+static inline void LoadDelayTap(
+    const ShortFrame* buffer,
+    float index,
+    int32_t size,
+    Lanes* l,
+    Lanes* r,
+    Lanes* weights) {
+  while (index < 0) {
+    index += size;
+  }
+  while (index >= size) {
+    index -= size;
+  }
+  MAKE_INTEGRAL_FRACTIONAL(index);
 
-  float x = previous_parameters_.raw_algorithm * 2.0f - 1.0f;
-  float x_end = parameters_.raw_algorithm * 2.0f - 1.0f;
+  ShortFrame wrapped[4];
+  const ShortFrame* x = &buffer[index_integral];
+  if (index_integral + 3 >= size) {
+    for (int32_t k = 0; k < 4; ++k) {
+      wrapped[k] = buffer[(index_integral + k) % size];
+    }
+    x = wrapped;
+  }
+  LaneInt frames;
+  memcpy(&frames, x, sizeof(frames));
+  *l = ToFloat((frames << 16) >> 16);
+  *r = ToFloat(frames >> 16);
+
+  const Lanes a = { -0.5f, 1.5f, -1.5f, 0.5f };
+  const Lanes b = { 1.0f, -2.5f, 2.0f, -0.5f };
+  const Lanes c = { -0.5f, 0.0f, 0.5f, 0.0f };
+  const Lanes d = { 0.0f, 1.0f, 0.0f, 0.0f };
+  Lanes t = Lanes() + index_fractional;
+  *weights = ((a * t + b) * t + c) * t + d;
+}
 
-  float y = previous_parameters_.modulation_parameter * 2.0f;
-  float y_end = parameters_.modulation_parameter * 2.0f;
+// Gains of the left and right channels of a tap, with a constant power law.
+// A centered tap is as loud as the fully wet output of the main read head,
+// and a tap panned to one side is at unity gain on that side.
+static inline void DelayTapGains(const DelayTap& tap, float* l, float* r) {
+  float position = (tap.pan + 1.0f) * 0.5f;
+  float level = tap.level * 1.414213562f;
+  *l = level * Interpolate(lut_xfade_out, position, 256.0f);
+  *r = level * Interpolate(lut_xfade_in, position, 256.0f);
+}
+
+void Modulator::ProcessDelayTaps(
+    const float* head,
+    const float* gain,
+    size_t size) {
+  const ShortFrame* buffer = delay_buffer_;
+  const float step = 1.0f / static_cast<float>(size);
+  const bool soft_clip = parameters_.carrier_shape == 2;
+
+  // Two taps at a time, in the lanes l, r, l, r. With an odd number of taps,
+  // the last one fills both halves.
+  for (size_t t = 0; t < num_delay_taps_; t += 2) {
+    size_t taps[2] = { t, min(t + 1, num_delay_taps_ - 1) };
+    float time_1 = previous_delay_taps_[taps[0]].time;
+    float time_2 = previous_delay_taps_[taps[1]].time;
+    float target_time_1 = delay_taps_[taps[0]].time;
+    float target_time_2 = delay_taps_[taps[1]].time;
+    Lanes tap_gain = Lanes();
+    Lanes tap_gain_increment = Lanes();
+    for (size_t j = 0; j < 2; ++j) {
+      const DelayTap& from = previous_delay_taps_[taps[j]];
+      const DelayTap& to = delay_taps_[taps[j]];
+      float from_l, from_r, to_l, to_r;
+      DelayTapGains(from, &from_l, &from_r);
+      DelayTapGains(to, &to_l, &to_r);
+      tap_gain[2 * j] = from_l;
+      tap_gain[2 * j + 1] = from_r;
+      tap_gain_increment[2 * j] = (to_l - from_l) * step;
+      tap_gain_increment[2 * j + 1] = (to_r - from_r) * step;
+    }
+
+    ShortFrame* out_1 = delay_tap_output_[taps[0]];
+    ShortFrame* out_2 = delay_tap_output_[taps[1]];
+    for (size_t i = 0; i < size; ++i) {
+      Lanes l_1, r_1, weights_1;
+      Lanes l_2, r_2, weights_2;
+      LoadDelayTap(buffer, head[i] - time_1, DELAY_SIZE, &l_1, &r_1,
+                   &weights_1);
+      LoadDelayTap(buffer, head[i] - time_2, DELAY_SIZE, &l_2, &r_2,
+                   &weights_2);
+      // Like the time of the main head, so that a tap glides like tape.
+      ONE_POLE(time_1, target_time_1, 0.00002f);
+      ONE_POLE(time_2, target_time_2, 0.00002f);
+
+      // Sums the lanes of the four products into l_1, r_1, l_2, r_2.
+      Lanes p = l_1 * weights_1;
+      Lanes q = r_1 * weights_1;
+      Lanes u = l_2 * weights_2;
+      Lanes v = r_2 * weights_2;
+      Lanes pq = Lanes { p[0], q[0], p[1], q[1] } +
+          Lanes { p[2], q[2], p[3], q[3] };
+      Lanes uv = Lanes { u[0], v[0], u[1], v[1] } +
+          Lanes { u[2], v[2], u[3], v[3] };
+      Lanes wet = Lanes { pq[0], pq[1], uv[0], uv[1] } +
+          Lanes { pq[2], pq[3], uv[2], uv[3] };
+      wet *= tap_gain * (gain[i] / 32768.0f);
+      tap_gain += tap_gain_increment;
+
+      if (soft_clip) {
+        out_1[i].l = SoftConvert(wet[0] * 2.0f);
+        out_1[i].r = SoftConvert(wet[1] * 2.0f);
+        out_2[i].l = SoftConvert(wet[2] * 2.0f);
+        out_2[i].r = SoftConvert(wet[3] * 2.0f);
+      } else {
+        out_1[i].l = Clip16(wet[0] * 32768.0f);
+        out_1[i].r = Clip16(wet[1] * 32768.0f);
+        out_2[i].l = Clip16(wet[2] * 32768.0f);
+        out_2[i].r = Clip16(wet[3] * 32768.0f);
+      }
+    }
+    previous_delay_taps_[taps[0]].time = time_1;
+    previous_delay_taps_[taps[1]].time = time_2;
+  }
+
+  for (size_t t = 0; t < num_delay_taps_; ++t) {
+    previous_delay_taps_[t].level = delay_taps_[t].level;
+    previous_delay_taps_[t].pan = delay_taps_[t].pan;
+  }
+}
+
+// Number of frames past the end of the doppler delay line which repeat its
+// first frames, so that the 4 taps of a read are always contiguous.
+const size_t kDopplerGuard = 3;
+
+// Position of the source from the x and y coordinates, as a distance in
+// [0, 1] and an angle in [-1, 1].
+static inline void DopplerGeometry(
+    float x,
+    float y,
+    float* distance,
+    float* angle) {
+  CONSTRAIN(x, -1.0f, 1.0f);
+  CONSTRAIN(y, -1.0f, 2.0f);
+  float di = sqrtf(x * x + y * y);  // 0..sqrt(5)
+  *angle = Interpolate(lut_arcsin, (x / di + 1.0f) * 0.5f, 256.0f);
+  *distance = di / 2.237f;  // sqrt(5)
+}
+
+// Loads the 4 frames starting at the given frame of the delay line, the
+// frames of the left tap in the lower lanes and those of the right tap in
+// the upper lanes.
+static inline void LoadDopplerTaps(
+    const float* line,
+    size_t tap_l,
+    size_t tap_r,
+    Lanes* x) {
+  for (size_t i = 0; i < 4; ++i) {
+    memcpy(&x[i], &line[(tap_l + i) * 2], 2 * sizeof(float));
+    memcpy(reinterpret_cast<float*>(&x[i]) + 2, &line[(tap_r + i) * 2],
+           2 * sizeof(float));
+  }
+}
+
+void Modulator::ProcessDoppler(ShortFrame* input, ShortFrame* output, size_t size) {
+  // Float frames, in the memory of the short frames of the other modes.
+  float* line = reinterpret_cast<float*>(delay_buffer_);
 
   float lfo_freq = parameters_.channel_drive[0]
     * parameters_.channel_drive[0]
     * 50.0f;
   float lfo_amplitude = parameters_.channel_drive[1];
 
-  float step = 1.0f / static_cast<float>(size);
-  float x_increment = (x_end - x) * step;
-  float y_increment = (y_end - y) * step;
-
   int8_t shape = parameters_.carrier_shape;
 
   float atten_factor =
@@ -810,90 +1290,215 @@ void Modulator::ProcessDoppler(ShortFrame* input, ShortFrame* output, size_t siz
     shape == 2 ? 8.0f :
     shape == 3 ? 15.0f : 0;
 
+  // The largest room leaves space in the float frames for the binaural delay
+  // and for the interpolation taps.
   float room_size =
     shape == 0 ? 100 :
     shape == 1 ? (DELAY_SIZE - 1) / 10.0f :
     shape == 2 ? (DELAY_SIZE - 1) / 5.0f :
-    shape == 3 ? (DELAY_SIZE - 1) / 2.0f : 0;
+    shape == 3 ? DOPPLER_DELAY_SIZE - 160.0f : 0;
 
-  while (size--) {
+  // The position of the source is computed once per block, at the end of
+  // the block, and ramped from the position at the end of the previous
+  // block. The LFO moves by 3% of its cycle at most during a block.
+  doppler_lfo_phase_ += lfo_freq / 96000.0f * static_cast<float>(size);
+  if (doppler_lfo_phase_ > 1.0f) doppler_lfo_phase_--;
+  float sin = Interpolate(lut_sin, doppler_lfo_phase_, 1024.0f);
+  float cos = Interpolate(lut_sin + 256, doppler_lfo_phase_, 1024.0f);
 
-    // write input to buffer
-    buffer[cursor].l = input->l;
-    buffer[cursor].r = input->r;
+  float x_end = parameters_.raw_algorithm * 2.0f - 1.0f;
+  float y_end = parameters_.modulation_parameter * 2.0f;
+  float distance_end;
+  float angle_end;
+  DopplerGeometry(
+      x_end + sin * lfo_amplitude + 0.05f,  // offset avoids discontinuity at 0
+      y_end + cos * lfo_amplitude,
+      &distance_end,
+      &angle_end);
 
-    // LFOs
-    float sin = Interpolate(lut_sin, lfo_phase, 1024.0f);
-    float cos = Interpolate(lut_sin + 256, lfo_phase, 1024.0f);
+  float step = 1.0f / static_cast<float>(size);
+  float distance = doppler_target_distance_;
+  float angle = doppler_target_angle_;
+  float distance_increment = (distance_end - distance) * step;
+  float angle_increment = (angle_end - angle) * step;
 
-    float x_lfo = x + sin * lfo_amplitude + 0.05f; // offset avoids discontinuity at 0
-    float y_lfo = y + cos  * lfo_amplitude;
-    CONSTRAIN(x_lfo, -1.0f, 1.0f);
-    CONSTRAIN(y_lfo, -1.0f, 2.0f);
+  const float binaural_delay = 96000.0f * 0.0015f;  // -1.5ms..1.5ms
 
-    // compute angular coordinates
-    float di = sqrtf(x_lfo * x_lfo + y_lfo * y_lfo); // 0..sqrt(5)
-    float an = Interpolate(lut_arcsin, (x_lfo/di + 1.0f) * 0.5f, 256.0f);
-    di /= 2.237;		// sqrt(5)
+  while (size--) {
+    // write input to buffer, and to the guard frames
+    float frame[2] = {
+      static_cast<float>(input->l),
+      static_cast<float>(input->r)
+    };
+    memcpy(&line[doppler_cursor_ * 2], frame, sizeof(frame));
+    if (doppler_cursor_ < kDopplerGuard) {
+      memcpy(&line[(doppler_cursor_ + DOPPLER_DELAY_SIZE) * 2], frame,
+             sizeof(frame));
+    }
 
-    ONE_POLE(distance, di, 0.001f);
-    ONE_POLE(angle, an, 0.001f);
+    distance += distance_increment;
+    angle += angle_increment;
+    ONE_POLE(doppler_distance_, distance, 0.001f);
+    ONE_POLE(doppler_angle_, angle, 0.001f);
 
     // compute binaural delay
-    float binaural_delay = angle * (96000.0f * 0.0015f); // -1.5ms..1.5ms
-    float delay_l = distance * room_size + (angle > 0 ? binaural_delay : 0);
-    float delay_r = distance * room_size + (angle < 0 ? -binaural_delay : 0);
+    float delay_l = doppler_distance_ * room_size +
+      (doppler_angle_ > 0 ? doppler_angle_ * binaural_delay : 0);
+    float delay_r = doppler_distance_ * room_size +
+      (doppler_angle_ < 0 ? -doppler_angle_ * binaural_delay : 0);
 
-    // linear delay interpolation
+    // Hermite interpolation between the frames at delay + 1 and delay + 2,
+    // so that the newest tap is never ahead of the cursor.
     MAKE_INTEGRAL_FRACTIONAL(delay_l);
     MAKE_INTEGRAL_FRACTIONAL(delay_r);
+    size_t tap_l = doppler_cursor_ + DOPPLER_DELAY_SIZE - 3 - delay_l_integral;
+    size_t tap_r = doppler_cursor_ + DOPPLER_DELAY_SIZE - 3 - delay_r_integral;
+    if (tap_l >= DOPPLER_DELAY_SIZE) tap_l -= DOPPLER_DELAY_SIZE;
+    if (tap_r >= DOPPLER_DELAY_SIZE) tap_r -= DOPPLER_DELAY_SIZE;
+
+    Lanes x[4];
+    LoadDopplerTaps(line, tap_l, tap_r, x);
+    const Lanes t = {
+      1.0f - delay_l_fractional, 1.0f - delay_l_fractional,
+      1.0f - delay_r_fractional, 1.0f - delay_r_fractional
+    };
+    Lanes c = (x[2] - x[0]) * 0.5f;
+    Lanes v = x[1] - x[2];
+    Lanes w = c + v;
+    Lanes a = w + v + (x[3] - x[1]) * 0.5f;
+    Lanes b_neg = w + a;
+    // left and right channel of the source, heard by the left and right ear
+    Lanes s = (((a * t) - b_neg) * t + c) * t + x[1];
+
+    // distance attenuation and crossfade between the channels
+    float atten = 1.0f /
+      (1.0f + atten_factor * doppler_distance_ * doppler_distance_);
+    float fade_position = (doppler_angle_ + 1.0f) / 2.0f;
+    float fade_in = atten * Interpolate(lut_xfade_in, fade_position, 256.0f);
+    float fade_out = atten * Interpolate(lut_xfade_out, fade_position, 256.0f);
+    const Lanes gain = { fade_out, fade_in, fade_in, fade_out };
+    s *= gain;
+
+    output->l = Clip16(static_cast<int32_t>(s[0] + s[1]));
+    output->r = Clip16(static_cast<int32_t>(s[2] + s[3]));
 
-    int16_t index_l = cursor - delay_l_integral;
-    if (index_l < 0) index_l += DELAY_SIZE;
-    int16_t index_r = cursor - delay_r_integral;
-    if (index_r < 0) index_r += DELAY_SIZE;
-
-    ShortFrame a_l = buffer[index_l];
-    ShortFrame b_l = buffer[index_l == 0 ? DELAY_SIZE - 1 : index_l - 1];
-    ShortFrame a_r = buffer[index_r];
-    ShortFrame b_r = buffer[index_r == 0 ? DELAY_SIZE - 1 : index_r - 1];
-
-    short s1_l = a_l.l + (b_l.l - a_l.l) * delay_l_fractional;
-    short s2_l = a_l.r + (b_l.r - a_l.r) * delay_l_fractional;
-    short s1_r = a_r.l + (b_r.l - a_r.l) * delay_r_fractional;
-    short s2_r = a_r.r + (b_r.r - a_r.r) * delay_r_fractional;
-
-    // distance attenuation
-    float atten = 1.0f + atten_factor * distance * distance;
-    s1_l /= atten;
-    s2_l /= atten;
-    s1_r /= atten;
-    s2_r /= atten;
-
-    float fade_in = Interpolate(lut_xfade_in, (angle + 1.0f) / 2.0f, 256.0f);
-    float fade_out = Interpolate(lut_xfade_out, (angle + 1.0f) / 2.0f, 256.0f);
-
-    output->l = s2_l * fade_in + s1_l * fade_out;
-    output->r = s1_r * fade_in + s2_r * fade_out;
-
-    x += x_increment;
-    y += y_increment;
-    lfo_phase += lfo_freq / 96000.0f;
-    if (lfo_phase > 1.0f) lfo_phase--;
     input++;
     output++;
-    cursor = (cursor + 1) % DELAY_SIZE;
+    if (++doppler_cursor_ >= DOPPLER_DELAY_SIZE) {
+      doppler_cursor_ = 0;
+    }
   }
 
+  doppler_target_distance_ = distance_end;
+  doppler_target_angle_ = angle_end;
   previous_parameters_ = parameters_;
 }
 
+uint8_t Modulator::carrier_oscillators() const {
+  if (!parameters_.carrier_shape) {
+    return 0;
+  }
+  switch (feature_mode_) {
+    case FEATURE_MODE_FOLD:
+    case FEATURE_MODE_CHEBYSCHEV:
+    case FEATURE_MODE_BITCRUSHER:
+    case FEATURE_MODE_COMPARATOR:
+      return CARRIER_OSCILLATOR_XMOD;
+
+    case FEATURE_MODE_VOCODER:
+      return CARRIER_OSCILLATOR_VOCODER;
+
+    case FEATURE_MODE_META:
+      {
+        float vocoder_amount = VocoderAmount(parameters_.modulation_algorithm);
+        if (vocoder_amount == 0.0f) {
+          return CARRIER_OSCILLATOR_XMOD;
+        } else if (vocoder_amount >= 0.5f) {
+          return CARRIER_OSCILLATOR_VOCODER;
+        }
+        return CARRIER_OSCILLATOR_XMOD | CARRIER_OSCILLATOR_VOCODER;
+      }
+
+    default:
+      return 0;
+  }
+}
+
+// Converts the audio inputs to float and applies VCA/saturation. With an
+// internal carrier, only the modulator input is used.
+void Modulator::Amplify(
+    const ShortFrame* input,
+    float limit,
+    float* aux_output,
+    size_t size) {
+  if (parameters_.carrier_shape) {
+    amplifier_[1].Process(
+        parameters_.channel_drive[1],
+        limit,
+        &input->r,
+        buffer_[1],
+        aux_output,
+        2,
+        size);
+  } else {
+    SaturatingAmplifier::ProcessStereo(
+        amplifier_,
+        parameters_.channel_drive,
+        limit,
+        input,
+        buffer_[0],
+        buffer_[1],
+        aux_output,
+        size);
+  }
+}
+
+void Modulator::RenderXmodCarrier(
+    OscillatorShape shape,
+    float* out,
+    size_t size) {
+  if (external_carrier_) {
+    copy(&external_carrier_->xmod[0], &external_carrier_->xmod[size], out);
+  } else {
+    xmod_oscillator_.Render(
+        shape,
+        parameters_.note,
+        internal_modulation_,
+        out,
+        size);
+  }
+}
+
+float Modulator::RenderVocoderCarrier(
+    OscillatorShape shape,
+    float* out,
+    size_t size) {
+  if (external_carrier_) {
+    copy(
+        &external_carrier_->vocoder[0],
+        &external_carrier_->vocoder[size],
+        out);
+    return external_carrier_->vocoder_gain;
+  } else {
+    return vocoder_oscillator_.Render(
+        shape,
+        parameters_.note,
+        internal_modulation_,
+        out,
+        size);
+  }
+}
+
 void Modulator::Process(ShortFrame* input, ShortFrame* output, size_t size) {
   if (bypass_) {
     copy(&input[0], &input[size], &output[0]);
     return;
   }
 
+  // Covers the feedback paths which are not flushed explicitly, like the SVFs
+  // of the vocoder and of the delay, and the worker threads of the modules.
+  ScopedDenormalFlush flush;
+  profiler_.BeginBlock();
   switch (feature_mode_) {
 
   case FEATURE_MODE_DOPPLER:
@@ -934,6 +1539,7 @@ void Modulator::Process(ShortFrame* input, ShortFrame* output, size_t size) {
     ProcessMeta(input, output, size);
     break;
   }
+  profiler_.EndBlock(feature_mode_, size);
 }
 
 /* static */
@@ -959,16 +1565,13 @@ inline float Modulator::Xmod<ALGORITHM_XFADE>(
 
 template<>
 inline float Modulator::Mod<ALGORITHM_CHEBYSCHEV>(
-    float x, float p) {
+    float x, float p, float* envelope) {
 
   const float att = 0.01f;
   const float rel = 0.000005f;
 
-  static float envelope_;
-
-
-  SLOPE(envelope_, fabs(x), att, rel);
-  float amp = 0.9f / envelope_;
+  SLOPE(*envelope, fabs(x), att, rel);
+  float amp = 0.9f / *envelope;
 
   const float degree = 6.0f;
 
@@ -1083,6 +1686,129 @@ inline float Modulator::Xmod<ALGORITHM_BITCRUSHER>(
   return Interpolate(ops, p_2, 3.0f);
 }
 
+// Clip16(static_cast<int32_t>(x * 32768.0f)), in each lane.
+static inline LaneInt ToShort(Lanes x) {
+  LaneInt y = ToInt(x * 32768.0f);
+  y = Select(y < -32768, LaneInt() - 32768, y);
+  return Select(y > 32767, LaneInt() + 32767, y);
+}
+
+// Masks of the two bit depths surrounding p, and the balance between them.
+static inline void BitcrusherMasks(
+    Lanes p,
+    LaneInt* mask_1,
+    LaneInt* mask_2,
+    Lanes* balance) {
+  const float steps = 37.0f;
+  Lanes z = p * p * steps;
+  Lanes z_integral = ToFloat(ToInt(z));
+  *balance = z - z_integral;
+  *mask_1 = ToShort(z_integral / steps);
+  *mask_2 = ToShort((z_integral + 1.0f) / steps);
+}
+
+static inline LaneInt Crush(
+    LaneInt x,
+    LaneInt mask_1,
+    LaneInt mask_2,
+    Lanes balance) {
+  LaneInt x_mod_1 = x | mask_1;
+  LaneInt x_mod_2 = x | mask_2;
+  return ToInt(ToFloat(x_mod_1) + ToFloat(x_mod_2 - x_mod_1) * balance);
+}
+
+/* static */
+void Modulator::ProcessBitcrusherXmod(
+    float p_1,
+    float p_1_end,
+    float p_2,
+    float p_2_end,
+    const float* in_1,
+    const float* in_2,
+    float* out_1,
+    float* out_2,
+    size_t size) {
+  float step = 1.0f / static_cast<float>(size);
+  float p_1_increment = (p_1_end - p_1) * step;
+  float p_2_increment = (p_2_end - p_2) * step;
+
+  // Unless the algorithm knob moves, the bit depths are the same for the
+  // whole block.
+  LaneInt mask_1 = LaneInt();
+  LaneInt mask_2 = LaneInt();
+  Lanes balance = Lanes();
+  const bool fixed_depth = p_1_increment == 0.0f;
+  if (fixed_depth) {
+    BitcrusherMasks(Lanes() + p_1, &mask_1, &mask_2, &balance);
+  }
+
+  while (size >= 4) {
+    // Same accumulation as ProcessXmod.
+    float p_1_0 = p_1;
+    float p_1_1 = p_1_0 + p_1_increment;
+    float p_1_2 = p_1_1 + p_1_increment;
+    float p_1_3 = p_1_2 + p_1_increment;
+    p_1 = p_1_3 + p_1_increment;
+    float p_2_0 = p_2;
+    float p_2_1 = p_2_0 + p_2_increment;
+    float p_2_2 = p_2_1 + p_2_increment;
+    float p_2_3 = p_2_2 + p_2_increment;
+    p_2 = p_2_3 + p_2_increment;
+
+    if (!fixed_depth) {
+      Lanes p_1_lanes = { p_1_0, p_1_1, p_1_2, p_1_3 };
+      BitcrusherMasks(p_1_lanes, &mask_1, &mask_2, &balance);
+    }
+
+    Lanes x_1, x_2;
+    memcpy(&x_1, in_1, sizeof(x_1));
+    memcpy(&x_2, in_2, sizeof(x_2));
+    LaneInt x_1_mod = Crush(ToShort(x_1), mask_1, mask_2, balance);
+    LaneInt x_2_mod = Crush(ToShort(x_2), mask_1, mask_2, balance);
+
+    Lanes y_2 = ToFloat(x_1_mod) / 32768.0f;
+    memcpy(out_2, &y_2, sizeof(y_2));
+
+    // The shift count is masked like x86's shl does in the scalar code. SSE
+    // has no per-lane shift, so x_1_mod is multiplied by 2 ^ shift, made
+    // from a float exponent (2 ^ 31 converts to 0x80000000, as it should).
+    LaneInt shift = (x_2_mod >> 12) & 31;
+    Lanes power = reinterpret_cast<Lanes>((shift + 127) << 23);
+    LaneInt shifted = reinterpret_cast<LaneInt>(
+        reinterpret_cast<LaneUint>(x_1_mod) *
+        reinterpret_cast<LaneUint>(ToInt(power)));
+    Lanes sum = ToFloat(x_1_mod + x_2_mod) / 32768.0f;
+    Lanes bitwise_or = ToFloat(x_1_mod | x_2_mod) / 32768.0f;
+    Lanes bitwise_xor = ToFloat(x_1_mod ^ x_2_mod) / 32768.0f;
+    Lanes shift_left = ToFloat(shifted) / 32768.0f;
+
+    Lanes p_2_lanes = { p_2_0, p_2_1, p_2_2, p_2_3 };
+    Lanes index = p_2_lanes * 3.0f;
+    LaneInt index_integral = ToInt(index);
+    Lanes index_fractional = index - ToFloat(index_integral);
+    Lanes a = Select(index_integral == 0, sum,
+        Select(index_integral == 1, bitwise_or,
+            Select(index_integral == 2, bitwise_xor, shift_left)));
+    Lanes b = Select(index_integral == 0, bitwise_or,
+        Select(index_integral == 1, bitwise_xor, shift_left));
+    Lanes y_1 = a + (b - a) * index_fractional;
+    memcpy(out_1, &y_1, sizeof(y_1));
+
+    in_1 += 4;
+    in_2 += 4;
+    out_1 += 4;
+    out_2 += 4;
+    size -= 4;
+  }
+
+  while (size) {
+    *out_1++ = Xmod<ALGORITHM_BITCRUSHER>(*in_1++, *in_2++, p_1, p_2, out_2++);
+    p_1 += p_1_increment;
+    p_2 += p_2_increment;
+    size--;
+  }
+}
+
 /* static */
 template<>
 inline float Modulator::Xmod<ALGORITHM_COMPARATOR>(
@@ -1142,16 +1868,6 @@ inline float Modulator::Xmod<ALGORITHM_COMPARATOR8>(
   return y_1 + (y_2 - y_1) * x_fractional;
 }
 
-/* static */
-template<>
-inline float Modulator::Xmod<ALGORITHM_COMPARATOR_CHEBYSCHEV>(
-    float x_1, float x_2, float p_1, float p_2) {
-
-  float x = Xmod<ALGORITHM_COMPARATOR8>(x_1, x_2, p_1);
-  x = Mod<ALGORITHM_CHEBYSCHEV>(x, p_2);
-  return 0.8f * x;
-}
-
 /* static */
 template<>
 inline float Modulator::Xmod<ALGORITHM_CHEBYSCHEV>(
@@ -1191,6 +1907,252 @@ inline float Modulator::Xmod<ALGORITHM_NOP>(
   return modulator;
 }
 
+// Terms crossfaded by the comparator algorithms, computed without branches.
+enum ComparatorTerm {
+  COMPARATOR_SUM,
+  COMPARATOR_MIN,
+  COMPARATOR_RECTIFIED,
+  COMPARATOR_INVERTED,
+  COMPARATOR_WINDOW,
+  COMPARATOR_WINDOW_RECTIFIED,
+  COMPARATOR_THRESHOLD,
+  COMPARATOR_THRESHOLD_RECTIFIED
+};
+
+static inline float Select(bool mask, float a, float b) {
+  return mask ? a : b;
+}
+
+static inline float Abs(float x) {
+  return fabs(x);
+}
+
+static inline Lanes Abs(Lanes x) {
+  return reinterpret_cast<Lanes>(
+      reinterpret_cast<LaneInt>(x) & (LaneInt() + 0x7fffffff));
+}
+
+// T is float, or Lanes for 4 samples at a time.
+template<ComparatorTerm term, typename T>
+static inline T Comparator(T modulator, T carrier) {
+  switch (term) {
+    case COMPARATOR_SUM:
+      return modulator + carrier;
+    case COMPARATOR_MIN:
+      return Select(modulator < carrier, modulator, carrier);
+    case COMPARATOR_RECTIFIED:
+      return Select(modulator < carrier, Abs(carrier), Abs(modulator)) *
+          2.0f - 1.0f;
+    case COMPARATOR_INVERTED:
+      return Select(modulator < carrier, -carrier, modulator);
+    case COMPARATOR_WINDOW:
+      return Select(Abs(modulator) > Abs(carrier), modulator, carrier);
+    case COMPARATOR_WINDOW_RECTIFIED:
+      return Select(
+          Abs(modulator) > Abs(carrier), Abs(modulator), -Abs(carrier));
+    case COMPARATOR_THRESHOLD:
+      return Select(carrier > 0.05f, carrier, modulator);
+    default:
+      return Select(carrier > 0.05f, carrier, -Abs(modulator));
+  }
+}
+
+// Crossfade between two terms, over a run of samples in the same segment of
+// the sequence.
+template<ComparatorTerm term_1, ComparatorTerm term_2>
+static void ComparatorSegment(
+    const float* position,
+    float origin,
+    const float* modulator,
+    const float* carrier,
+    float* out,
+    size_t size) {
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    Lanes m, c, p;
+    memcpy(&m, &modulator[i], sizeof(m));
+    memcpy(&c, &carrier[i], sizeof(c));
+    memcpy(&p, &position[i], sizeof(p));
+    Lanes a = Comparator<term_1>(m, c);
+    Lanes b = Comparator<term_2>(m, c);
+    Lanes y = a + (b - a) * (p - origin);
+    memcpy(&out[i], &y, sizeof(y));
+  }
+  for (; i < size; ++i) {
+    float a = Comparator<term_1>(modulator[i], carrier[i]);
+    float b = Comparator<term_2>(modulator[i], carrier[i]);
+    out[i] = a + (b - a) * (position[i] - origin);
+  }
+}
+
+typedef void (*ComparatorSegmentFn)(
+    const float* position,
+    float origin,
+    const float* modulator,
+    const float* carrier,
+    float* out,
+    size_t size);
+
+// Sequence of Xmod<ALGORITHM_COMPARATOR>.
+static const ComparatorSegmentFn kComparatorSegments[] = {
+  &ComparatorSegment<COMPARATOR_MIN, COMPARATOR_THRESHOLD>,
+  &ComparatorSegment<COMPARATOR_THRESHOLD, COMPARATOR_WINDOW>,
+  &ComparatorSegment<COMPARATOR_WINDOW, COMPARATOR_WINDOW_RECTIFIED>,
+};
+
+// Sequence of Xmod<ALGORITHM_COMPARATOR8>.
+static const ComparatorSegmentFn kComparator8Segments[] = {
+  &ComparatorSegment<COMPARATOR_SUM, COMPARATOR_MIN>,
+  &ComparatorSegment<COMPARATOR_MIN, COMPARATOR_RECTIFIED>,
+  &ComparatorSegment<COMPARATOR_RECTIFIED, COMPARATOR_INVERTED>,
+  &ComparatorSegment<COMPARATOR_INVERTED, COMPARATOR_WINDOW>,
+  &ComparatorSegment<COMPARATOR_WINDOW, COMPARATOR_WINDOW_RECTIFIED>,
+  &ComparatorSegment<COMPARATOR_WINDOW_RECTIFIED, COMPARATOR_THRESHOLD>,
+  &ComparatorSegment<COMPARATOR_THRESHOLD, COMPARATOR_THRESHOLD_RECTIFIED>,
+};
+
+// The parameter only moves a little during a block: the block is split into
+// runs of samples in the same segment, each rendered by its own kernel.
+static void ProcessComparatorSegments(
+    const ComparatorSegmentFn* segments,
+    int32_t num_segments,
+    float scale,
+    float parameter,
+    float parameter_end,
+    const float* modulator,
+    const float* carrier,
+    float* out,
+    size_t size) {
+  // Same accumulation as ProcessXmod. Most of the time the knob is still,
+  // and the whole block is a single run.
+  float position[kMaxBlockSize * kOversampling];
+  float step = 1.0f / static_cast<float>(size);
+  float parameter_increment = (parameter_end - parameter) * step;
+  const bool still = parameter_increment == 0.0f;
+  if (still) {
+    fill(&position[0], &position[size], parameter * scale);
+  } else {
+    for (size_t i = 0; i < size; ++i) {
+      position[i] = parameter * scale;
+      parameter += parameter_increment;
+    }
+  }
+
+  size_t start = 0;
+  while (start < size) {
+    int32_t integral = static_cast<int32_t>(position[start]);
+    size_t end = still ? size : start + 1;
+    while (end < size && static_cast<int32_t>(position[end]) == integral) {
+      ++end;
+    }
+    // Out of range, like the last branch of Xmod<ALGORITHM_COMPARATOR8>.
+    int32_t segment = integral >= 0 && integral < num_segments
+        ? integral
+        : num_segments - 1;
+    segments[segment](
+        &position[start],
+        static_cast<float>(integral),
+        &modulator[start],
+        &carrier[start],
+        &out[start],
+        end - start);
+    start = end;
+  }
+}
+
+/* static */
+void Modulator::ProcessComparator(
+    float parameter,
+    float parameter_end,
+    const float* modulator,
+    const float* carrier,
+    float* out,
+    size_t size) {
+  ProcessComparatorSegments(
+      kComparatorSegments, 3, 2.995f,
+      parameter, parameter_end, modulator, carrier, out, size);
+}
+
+/* static */
+void Modulator::ProcessComparator8(
+    float parameter,
+    float parameter_end,
+    const float* modulator,
+    const float* carrier,
+    float* out,
+    size_t size) {
+  ProcessComparatorSegments(
+      kComparator8Segments, 7, 6.995f,
+      parameter, parameter_end, modulator, carrier, out, size);
+}
+
+template<>
+void Modulator::ProcessXmod<ALGORITHM_XOR, ALGORITHM_COMPARATOR>(
+    float balance,
+    float balance_end,
+    float parameter,
+    float parameter_end,
+    const float* in_1,
+    const float* in_2,
+    float* out,
+    size_t size) {
+  float comparator[kMaxBlockSize * kOversampling];
+  ProcessComparator(parameter, parameter_end, in_1, in_2, comparator, size);
+
+  float step = 1.0f / static_cast<float>(size);
+  float parameter_increment = (parameter_end - parameter) * step;
+  float balance_increment = (balance_end - balance) * step;
+  for (size_t i = 0; i < size; ++i) {
+    float a = Xmod<ALGORITHM_XOR>(in_1[i], in_2[i], parameter);
+    out[i] = a + (comparator[i] - a) * balance;
+    parameter += parameter_increment;
+    balance += balance_increment;
+  }
+}
+
+template<>
+void Modulator::ProcessXmod<ALGORITHM_COMPARATOR, ALGORITHM_NOP>(
+    float balance,
+    float balance_end,
+    float parameter,
+    float parameter_end,
+    const float* in_1,
+    const float* in_2,
+    float* out,
+    size_t size) {
+  float comparator[kMaxBlockSize * kOversampling];
+  ProcessComparator(parameter, parameter_end, in_1, in_2, comparator, size);
+
+  float step = 1.0f / static_cast<float>(size);
+  float balance_increment = (balance_end - balance) * step;
+  for (size_t i = 0; i < size; ++i) {
+    float a = comparator[i];
+    float b = Xmod<ALGORITHM_NOP>(in_1[i], in_2[i], parameter);
+    out[i] = a + (b - a) * balance;
+    balance += balance_increment;
+  }
+}
+
+template<>
+void Modulator::ProcessXmod<ALGORITHM_COMPARATOR_CHEBYSCHEV>(
+    float p_1,
+    float p_1_end,
+    float p_2,
+    float p_2_end,
+    const float* in_1,
+    const float* in_2,
+    float* out,
+    size_t size) {
+  float comparator[kMaxBlockSize * kOversampling];
+  ProcessComparator8(p_1, p_1_end, in_1, in_2, comparator, size);
+
+  ProcessChebyschevMod(
+      p_2, p_2_end, comparator, out, size, &chebyschev_envelope_);
+  for (size_t i = 0; i < size; ++i) {
+    out[i] *= 0.8f;
+  }
+}
+
 /* static */
 Modulator::XmodFn Modulator::xmod_table_[] = {
   &Modulator::ProcessXmod<ALGORITHM_XFADE, ALGORITHM_FOLD>,
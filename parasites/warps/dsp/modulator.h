@@ -34,8 +34,10 @@
 #include "stmlib/dsp/filter.h"
 #include "stmlib/dsp/parameter_interpolator.h"
 
+#include "warps/dsp/denormals.h"
 #include "warps/dsp/oscillator.h"
 #include "warps/dsp/parameters.h"
+#include "warps/dsp/profiler.h"
 #include "warps/dsp/quadrature_oscillator.h"
 #include "warps/dsp/quadrature_transform.h"
 #include "warps/dsp/sample_rate_converter.h"
@@ -48,10 +50,32 @@ const size_t kMaxBlockSize = 96;
 const size_t kOversampling = 6;
 const size_t kLessOversampling = 4;
 const size_t kNumOscillators = 1;
+const size_t kMaxDelayTaps = 7;
 
 typedef struct { short l; short r; } ShortFrame;
 typedef struct { float l; float r; } FloatFrame;
 
+// Read head of the delay mode, in addition to the main one: time in samples,
+// level, and pan from -1 (left) to 1 (right).
+struct DelayTap {
+  float time;
+  float level;
+  float pan;
+};
+
+// Internal carriers of a block, rendered outside of the modulator, for
+// instance by an OscillatorBank shared by the modulators of several voices.
+struct CarrierBlock {
+  float xmod[kMaxBlockSize];
+  float vocoder[kMaxBlockSize];
+  float vocoder_gain;
+};
+
+enum CarrierOscillator {
+  CARRIER_OSCILLATOR_XMOD = 1,
+  CARRIER_OSCILLATOR_VOCODER = 2
+};
+
 class SaturatingAmplifier {
  public:
   SaturatingAmplifier() { }
@@ -63,7 +87,7 @@ class SaturatingAmplifier {
   void Process(
       float drive,
       float limit,
-      short* in,
+      const short* in,
       float* out,
       float* out_raw,
       size_t in_stride,
@@ -106,6 +130,19 @@ class SaturatingAmplifier {
     }
   }
 
+  // Same as Process() on amplifier[0] and amplifier[1] with the left and
+  // right channels of in, but in a single pass over the block, with the two
+  // channels in the lanes of a vector.
+  static void ProcessStereo(
+      SaturatingAmplifier* amplifier,
+      const float* drive,
+      float limit,
+      const ShortFrame* in,
+      float* out_l,
+      float* out_r,
+      float* out_raw,
+      size_t size);
+
  private:
   float level_;
   float drive_;
@@ -144,10 +181,14 @@ class Modulator {
       float* out,
       size_t size);
 
-  Modulator() { }
+  // Defaulted, so that a value-initialised Modulator starts zeroed.
+  Modulator() = default;
   ~Modulator() { }
 
   void Init(float sample_rate);
+  // Clears the memory and the state of the delay and doppler modes, keeping
+  // their settings.
+  void ClearDelay();
   void Process(ShortFrame* input, ShortFrame* output, size_t size);
   template<XmodAlgorithm algorithm>
   void Process1(ShortFrame* input, ShortFrame* output, size_t size);
@@ -164,7 +205,67 @@ class Modulator {
   inline void set_bypass(bool bypass) { bypass_ = bypass; }
 
   inline FeatureMode feature_mode() const { return feature_mode_; }
-  inline void set_feature_mode(FeatureMode feature_mode) { feature_mode_ = feature_mode; }
+  inline void set_feature_mode(FeatureMode feature_mode) {
+    // Unsigned, so that negative modes fall back to the meta mode too.
+    if (static_cast<uint32_t>(feature_mode) > FEATURE_MODE_META) {
+      feature_mode = FEATURE_MODE_META;
+    }
+    feature_mode_ = feature_mode;
+  }
+
+  // Per-stage timings, only recorded when built with WARPS_PROFILE.
+  inline Profiler* mutable_profiler() { return &profiler_; }
+
+  // Internal oscillators used by the next block with the current mode and
+  // parameters, as a combination of CarrierOscillator flags.
+  uint8_t carrier_oscillators() const;
+
+  // When set, the internal carriers are read from carrier instead of being
+  // rendered by the oscillators of the modulator. It must hold the carriers
+  // given by carrier_oscillators() whenever Process is called.
+  inline void set_external_carrier(const CarrierBlock* carrier) {
+    external_carrier_ = carrier;
+  }
+
+  // Selects the look-ahead limiter in the vocoder mode. It delays the main
+  // output by one block, so the aux output is delayed along with it. The
+  // vocoder of the meta mode keeps the original limiter: it does not run in
+  // every block and is crossfaded with undelayed signals.
+  inline void set_lookahead_limiter(bool lookahead_limiter) {
+    lookahead_limiter_ = lookahead_limiter;
+  }
+
+  // In the delay mode, replaces the time given by the modulation parameter
+  // with a time in samples, for instance a division of a clock period. The
+  // time is halved until it fits in the buffer. It applies from the sample
+  // offset of the next block, and a change of time crossfades to a second
+  // read head instead of sliding the read head. A time of 0 returns to the
+  // modulation parameter.
+  inline void set_delay_time(float time, size_t offset) {
+    while (time > DELAY_SIZE - 5) {
+      time *= 0.5f;
+    }
+    delay_sync_time_ = time;
+    delay_sync_offset_ = offset;
+  }
+
+  // Time in samples of the delay mode for a modulation parameter.
+  static inline float delay_time(float modulation_parameter) {
+    return modulation_parameter * (DELAY_SIZE - 10) + 5;
+  }
+
+  // Extra read heads of the delay mode, which share the write pass of the
+  // main one and are read together, two taps to a vector. They do not feed
+  // back, and their wet output is left in delay_tap_output(tap) after each
+  // block. Their times are halved until they fit in the buffer, are kept
+  // more than kMaxBlockSize samples away from the write head on both sides,
+  // and glide through the same one-pole filter as the time of the main head.
+  // Their levels and pans slide linearly over a block.
+  void set_delay_taps(const DelayTap* taps, size_t num_taps);
+
+  inline const ShortFrame* delay_tap_output(size_t tap) const {
+    return delay_tap_output_[tap];
+  }
 
  private:
   template<XmodAlgorithm algorithm_1, XmodAlgorithm algorithm_2>
@@ -270,6 +371,46 @@ class Modulator {
   template<XmodAlgorithm algorithm>
   static float Xmod(float x_1, float x_2, float p_1, float p_2, float *out_2);
 
+  // Xmod<ALGORITHM_COMPARATOR> and Xmod<ALGORITHM_COMPARATOR8> over a block,
+  // with one branch-free kernel per segment of their sequences.
+  static void ProcessComparator(
+      float parameter,
+      float parameter_end,
+      const float* modulator,
+      const float* carrier,
+      float* out,
+      size_t size);
+  static void ProcessComparator8(
+      float parameter,
+      float parameter_end,
+      const float* modulator,
+      const float* carrier,
+      float* out,
+      size_t size);
+
+  // Mod<ALGORITHM_CHEBYSCHEV> over a block, with the polynomials evaluated 4
+  // samples at a time. ProcessXmod<ALGORITHM_CHEBYSCHEV> is specialized to
+  // do the same.
+  static void ProcessChebyschevMod(
+      float p,
+      float p_end,
+      const float* in,
+      float* out,
+      size_t size,
+      float* envelope);
+
+  // ProcessXmod<ALGORITHM_BITCRUSHER>, 4 samples at a time in integer lanes.
+  static void ProcessBitcrusherXmod(
+      float p_1,
+      float p_1_end,
+      float p_2,
+      float p_2_end,
+      const float* in_1,
+      const float* in_2,
+      float* out_1,
+      float* out_2,
+      size_t size);
+
   template<XmodAlgorithm algorithm>
   void ProcessMod(
       float p,
@@ -290,7 +431,37 @@ class Modulator {
   template<XmodAlgorithm algorithm>
   static float Mod(float x, float p);
 
+  // For the algorithms with an envelope follower, whose state is kept by the
+  // caller.
+  template<XmodAlgorithm algorithm>
+  static float Mod(float x, float p, float* envelope);
+
   static float Diode(float x);
+
+  // Balance between the cross-modulation (0.0) and the vocoder (1.0) in the
+  // meta mode.
+  static inline float VocoderAmount(float modulation_algorithm) {
+    float vocoder_amount = (modulation_algorithm - 0.7f) * 20.0f + 0.5f;
+    CONSTRAIN(vocoder_amount, 0.0f, 1.0f);
+    return vocoder_amount;
+  }
+
+  void Amplify(
+      const ShortFrame* input,
+      float limit,
+      float* aux_output,
+      size_t size);
+
+  // Interpolated frame of the delay buffer at index, which can be outside of
+  // the buffer.
+  FloatFrame ReadDelay(float index);
+
+  // Renders the extra read heads from the positions of the main read head
+  // without its time, and the gain applied to its output.
+  void ProcessDelayTaps(const float* head, const float* gain, size_t size);
+
+  void RenderXmodCarrier(OscillatorShape shape, float* out, size_t size);
+  float RenderVocoderCarrier(OscillatorShape shape, float* out, size_t size);
   
   bool bypass_;
 
@@ -309,10 +480,43 @@ class Modulator {
   SampleRateConverter<SRC_UP, kLessOversampling, 48> src_up2_[2];
   SampleRateConverter<SRC_DOWN, kLessOversampling, 48> src_down2_[2];
   Vocoder vocoder_;
+  bool lookahead_limiter_;
+  float lookahead_aux_output_[kMaxBlockSize];
   QuadratureTransform quadrature_transform_[2];  
 
   stmlib::OnePole filter_[4];
 
+  // Envelope follower of the comparator mode.
+  float chebyschev_envelope_;
+
+  // State of the delay and doppler modes.
+  FloatFrame delay_feedback_;
+  int32_t delay_write_head_;
+  float delay_write_position_;
+  FloatFrame delay_history_[3];
+  float delay_lp_time_;
+  float delay_lp_rate_;
+  // Synced time requested for the next block, from delay_sync_offset_, and
+  // for the previous one. 0 when the time follows the modulation parameter.
+  float delay_sync_time_;
+  float delay_previous_sync_time_;
+  size_t delay_sync_offset_;
+  // Time of the read head faded in, and position of the crossfade, 0 when no
+  // crossfade is in progress.
+  float delay_next_time_;
+  float delay_head_fade_;
+  // Synced time to fade to once the crossfade ends, 0 when none.
+  float delay_queued_time_;
+
+  size_t doppler_cursor_;
+  float doppler_lfo_phase_;
+  float doppler_distance_;
+  float doppler_angle_;
+  // Distance and angle of the source, without smoothing, at the end of the
+  // previous block.
+  float doppler_target_distance_;
+  float doppler_target_angle_;
+
   /* everything that follows will be used as delay buffer */
   ShortFrame delay_buffer_[8192+4096];  
   float internal_modulation_[kMaxBlockSize];
@@ -328,6 +532,12 @@ class Modulator {
                   + sizeof(feedback_sample_)) / sizeof(ShortFrame) - 4
   };
 
+  enum DopplerDelaySize {
+    // The doppler mode stores float frames in the same memory, followed by
+    // kDopplerGuard frames which repeat the first ones.
+    DOPPLER_DELAY_SIZE = DELAY_SIZE / 2 - 4
+  };
+
   enum DelayInterpolation {
     INTERPOLATION_ZOH,
     INTERPOLATION_LINEAR,
@@ -336,6 +546,17 @@ class Modulator {
 
   DelayInterpolation delay_interpolation_;
 
+  // Extra read heads of the delay mode, as requested and as rendered at the
+  // end of the previous block.
+  size_t num_delay_taps_;
+  DelayTap delay_taps_[kMaxDelayTaps];
+  DelayTap previous_delay_taps_[kMaxDelayTaps];
+  ShortFrame delay_tap_output_[kMaxDelayTaps][kMaxBlockSize];
+
+  Profiler profiler_;
+
+  const CarrierBlock* external_carrier_;
+
   static XmodFn xmod_table_[];
 
   DISALLOW_COPY_AND_ASSIGN(Modulator);
@@ -54,7 +54,7 @@ class Oscillator {
       float* out,
       size_t size);
 
-  inline float midi_to_increment(float midi_pitch) const {
+  static inline float midi_to_increment(float midi_pitch) {
     int32_t pitch = static_cast<int32_t>(midi_pitch * 256.0f);
     pitch = 32768 + stmlib::Clip16(pitch - 20480);
     float increment = lut_midi_to_f_high[pitch >> 8] * \
@@ -0,0 +1,256 @@
+// Copyright 2026 Aepelzen's Parasites contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Internal oscillators of several modulators, rendered together.
+
+#include "warps/dsp/oscillator_bank.h"
+
+#include <algorithm>
+
+namespace warps {
+
+using namespace std;
+
+void OscillatorBank::Init(float sample_rate) {
+  for (size_t i = 0; i < kNumGroups; ++i) {
+    for (size_t j = 0; j < kOscillatorBankLanes; ++j) {
+      phase_[i][j] = 0.0f;
+      phase_increment_[i][j] = 100.0f * (1.0f / sample_rate);
+      next_sample_[i][j] = 0.0f;
+      high_[i][j] = 0.0f;
+      lp_state_[i][j] = 0.0f;
+      hp_state_[i][j] = 0.0f;
+    }
+  }
+  for (size_t i = 0; i < kMaxOscillatorBankVoices; ++i) {
+    noise_[i].Init(sample_rate);
+  }
+}
+
+void OscillatorBank::Render(
+    OscillatorShape shape,
+    const float* note,
+    float* const* modulation,
+    float* const* out,
+    float* gain,
+    size_t num_voices,
+    size_t size) {
+  if (shape == OSCILLATOR_SHAPE_NOISE_LP) {
+    for (size_t i = 0; i < num_voices; ++i) {
+      gain[i] = noise_[i].Render(shape, note[i], modulation[i], out[i], size);
+    }
+    return;
+  }
+
+  Lanes lane_modulation[kMaxOscillatorBankBlockSize];
+  Lanes lane_out[kMaxOscillatorBankBlockSize];
+  float discarded[kMaxOscillatorBankBlockSize];
+  static const float silence[kMaxOscillatorBankBlockSize] = { 0.0f };
+
+  for (size_t voice = 0; voice < num_voices; voice += kOscillatorBankLanes) {
+    size_t group = voice / kOscillatorBankLanes;
+    size_t num_lanes = min(kOscillatorBankLanes, num_voices - voice);
+
+    // Transpose the modulation of the voices of the group into lanes. The
+    // unused lanes are rendered too, with a constant pitch, and discarded.
+    const float* lane_modulation_source[kOscillatorBankLanes];
+    float* lane_destination[kOscillatorBankLanes];
+    for (size_t j = 0; j < kOscillatorBankLanes; ++j) {
+      if (j < num_lanes) {
+        target_increment_[group][j] = Oscillator::midi_to_increment(
+            note[voice + j]);
+        lane_modulation_source[j] = modulation[voice + j];
+        lane_destination[j] = out[voice + j];
+      } else {
+        target_increment_[group][j] = phase_increment_[group][j];
+        lane_modulation_source[j] = silence;
+        lane_destination[j] = discarded;
+      }
+    }
+    for (size_t i = 0; i < size; ++i) {
+      Lanes m = {
+        lane_modulation_source[0][i],
+        lane_modulation_source[1][i],
+        lane_modulation_source[2][i],
+        lane_modulation_source[3][i]
+      };
+      lane_modulation[i] = m;
+    }
+
+    // Like Oscillator::Render, the gain of the pulse is computed from the
+    // increment at the beginning of the block.
+    Lanes previous_increment = phase_increment_[group];
+
+    switch (shape) {
+      case OSCILLATOR_SHAPE_SINE:
+        RenderSine(group, lane_modulation, lane_out, size);
+        break;
+      case OSCILLATOR_SHAPE_TRIANGLE:
+        RenderPolyblep<OSCILLATOR_SHAPE_TRIANGLE>(
+            group, lane_modulation, lane_out, size);
+        break;
+      case OSCILLATOR_SHAPE_SAW:
+        RenderPolyblep<OSCILLATOR_SHAPE_SAW>(
+            group, lane_modulation, lane_out, size);
+        break;
+      default:
+        RenderPolyblep<OSCILLATOR_SHAPE_PULSE>(
+            group, lane_modulation, lane_out, size);
+        break;
+    }
+
+    for (size_t i = 0; i < size; ++i) {
+      Lanes y = lane_out[i];
+      lane_destination[0][i] = y[0];
+      lane_destination[1][i] = y[1];
+      lane_destination[2][i] = y[2];
+      lane_destination[3][i] = y[3];
+    }
+    for (size_t j = 0; j < num_lanes; ++j) {
+      gain[voice + j] = shape == OSCILLATOR_SHAPE_PULSE
+          ? 0.025f / (0.0002f + previous_increment[j])
+          : 1.0f;
+    }
+  }
+}
+
+void OscillatorBank::RenderSine(
+    size_t group,
+    const Lanes* modulation,
+    Lanes* out,
+    size_t size) {
+  const float k2Pi = 6.283185307179586f;
+
+  Lanes phase = phase_[group];
+  Lanes phase_increment = phase_increment_[group];
+  Lanes phase_increment_step = (target_increment_[group] - phase_increment) /
+      static_cast<float>(size);
+  for (size_t i = 0; i < size; ++i) {
+    phase_increment += phase_increment_step;
+    phase += phase_increment;
+    phase -= Select(phase >= 1.0f, 1.0f);
+
+    // Phase modulation, wrapped into [-0.5, 0.5).
+    Lanes x = phase + modulation[i] * 4.0f - 0.5f;
+    Lanes x_integral = __builtin_convertvector(
+        __builtin_convertvector(x, LaneInt), Lanes);
+    x -= x_integral - Select(x_integral > x, 1.0f);
+    x -= Select(x >= 0.5f, 1.0f);
+
+    // sin(2 pi (x + 0.5)) = -sin(2 pi x). Fold x into [-0.25, 0.25], where
+    // the Taylor series converges quickly.
+    x += Select(x > 0.25f, 0.5f - 2.0f * x);
+    x += Select(x < -0.25f, -0.5f - 2.0f * x);
+    Lanes w = x * k2Pi;
+    Lanes w2 = w * w;
+    Lanes s = w2 * (-1.0f / 39916800.0f) + 1.0f / 362880.0f;
+    s = s * w2 - 1.0f / 5040.0f;
+    s = s * w2 + 1.0f / 120.0f;
+    s = s * w2 - 1.0f / 6.0f;
+    s = s * w2 + 1.0f;
+    out[i] = -w * s;
+  }
+  phase_[group] = phase;
+  phase_increment_[group] = phase_increment;
+}
+
+template<OscillatorShape shape>
+void OscillatorBank::RenderPolyblep(
+    size_t group,
+    const Lanes* modulation,
+    Lanes* out,
+    size_t size) {
+  Lanes phase = phase_[group];
+  Lanes phase_increment = phase_increment_[group];
+  Lanes phase_increment_step = (target_increment_[group] - phase_increment) /
+      static_cast<float>(size);
+  Lanes next_sample = next_sample_[group];
+  Lanes high = high_[group];
+  Lanes lp_state = lp_state_[group];
+  Lanes hp_state = hp_state_[group];
+
+  for (size_t i = 0; i < size; ++i) {
+    Lanes this_sample = next_sample;
+    next_sample = Lanes();
+
+    phase_increment += phase_increment_step;
+    Lanes modulated_increment = phase_increment * (1.0f + modulation[i]);
+    LaneMask stalled = modulated_increment <= 0.0f;
+    modulated_increment = Select(~stalled, modulated_increment) +
+        Select(stalled, 1.0e-7f);
+    phase += modulated_increment;
+
+    // The blep corrections are computed in all the lanes, and only added in
+    // the lanes in which a discontinuity occurred.
+    if (shape == OSCILLATOR_SHAPE_TRIANGLE) {
+      Lanes rise = Select((high == 0.0f) & (phase >= 0.5f), 1.0f);
+      Lanes t = (phase - 0.5f) / modulated_increment;
+      Lanes u = 1.0f - t;
+      this_sample += rise * (0.5f * t * t);
+      next_sample += rise * (-0.5f * u * u);
+      high += rise;
+
+      Lanes fall = Select(phase >= 1.0f, 1.0f);
+      phase -= fall;
+      t = phase / modulated_increment;
+      u = 1.0f - t;
+      this_sample -= fall * (0.5f * t * t);
+      next_sample -= fall * (-0.5f * u * u);
+      high *= 1.0f - fall;
+
+      const Lanes integrator_coefficient = modulated_increment * 0.0625f;
+      next_sample += Select(phase >= 0.5f, 1.0f);
+      this_sample = 128.0f * (this_sample - 0.5f);
+      lp_state += integrator_coefficient * (this_sample - lp_state);
+      out[i] = lp_state;
+    } else {
+      Lanes wrap = Select(phase >= 1.0f, 1.0f);
+      phase -= wrap;
+      Lanes t = phase / modulated_increment;
+      Lanes u = 1.0f - t;
+      this_sample -= wrap * (0.5f * t * t);
+      next_sample -= wrap * (-0.5f * u * u);
+      next_sample += phase;
+
+      if (shape == OSCILLATOR_SHAPE_SAW) {
+        this_sample = this_sample * 2.0f - 1.0f;
+        lp_state += 0.3f * (this_sample - lp_state);
+        out[i] = lp_state;
+      } else {
+        lp_state += 0.25f * ((hp_state - this_sample) - lp_state);
+        out[i] = 4.0f * lp_state;
+        hp_state = this_sample;
+      }
+    }
+  }
+
+  phase_[group] = phase;
+  phase_increment_[group] = phase_increment;
+  next_sample_[group] = next_sample;
+  high_[group] = high;
+  lp_state_[group] = lp_state;
+  hp_state_[group] = hp_state;
+}
+
+}  // namespace warps
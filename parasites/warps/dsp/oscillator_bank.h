@@ -0,0 +1,93 @@
+// Copyright 2026 Aepelzen's Parasites contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Internal oscillators of several modulators, rendered together.
+//
+// Each voice behaves like an Oscillator, but the voices are rendered by
+// groups of kOscillatorBankLanes in the lanes of SIMD registers. The polyBLEP
+// corrections are applied with masks rather than branches, so that all the
+// lanes follow the same path, and the sine is computed with a polynomial
+// rather than interpolated from lut_sin. The noise shape has no SIMD version,
+// and is rendered one voice at a time.
+
+#ifndef WARPS_DSP_OSCILLATOR_BANK_H_
+#define WARPS_DSP_OSCILLATOR_BANK_H_
+
+#include "stmlib/stmlib.h"
+
+#include "warps/dsp/lanes.h"
+#include "warps/dsp/oscillator.h"
+#include "warps/dsp/parameters.h"
+
+namespace warps {
+
+const size_t kOscillatorBankLanes = 4;
+const size_t kMaxOscillatorBankVoices = 16;
+const size_t kMaxOscillatorBankBlockSize = 96;
+
+class OscillatorBank {
+ public:
+  OscillatorBank() { }
+  ~OscillatorBank() { }
+
+  void Init(float sample_rate);
+
+  // Renders the first num_voices voices. Writes to gain the gain by which
+  // the output of each voice is to be multiplied, as returned by
+  // Oscillator::Render.
+  void Render(
+      OscillatorShape shape,
+      const float* note,
+      float* const* modulation,
+      float* const* out,
+      float* gain,
+      size_t num_voices,
+      size_t size);
+
+ private:
+  static const size_t kNumGroups =
+      kMaxOscillatorBankVoices / kOscillatorBankLanes;
+
+  void RenderSine(size_t group, const Lanes* modulation, Lanes* out,
+                  size_t size);
+  template<OscillatorShape shape>
+  void RenderPolyblep(size_t group, const Lanes* modulation, Lanes* out,
+                      size_t size);
+
+  Lanes phase_[kNumGroups];
+  Lanes phase_increment_[kNumGroups];
+  Lanes target_increment_[kNumGroups];
+  Lanes next_sample_[kNumGroups];
+  Lanes high_[kNumGroups];
+  Lanes lp_state_[kNumGroups];
+  Lanes hp_state_[kNumGroups];
+
+  Oscillator noise_[kMaxOscillatorBankVoices];
+
+  DISALLOW_COPY_AND_ASSIGN(OscillatorBank);
+};
+
+}  // namespace warps
+
+#endif  // WARPS_DSP_OSCILLATOR_BANK_H_
@@ -0,0 +1,228 @@
+// Copyright 2026 Aepelzen's Parasites contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Per-stage timing of the modulator.
+//
+// Only compiled in when WARPS_PROFILE is defined. Otherwise, all the methods
+// of Profiler are empty and the calls to them vanish.
+//
+// The audio thread times the stages of each block with Mark(), which charges
+// the time elapsed since the previous mark to a stage, then pushes the block
+// into a single-producer, single-consumer ring. Another thread pops the
+// blocks and accumulates them with ProfilerStatistics. Blocks are dropped
+// when the ring is full.
+
+#ifndef WARPS_DSP_PROFILER_H_
+#define WARPS_DSP_PROFILER_H_
+
+#include "stmlib/stmlib.h"
+
+#ifdef WARPS_PROFILE
+#include <atomic>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+#endif  // WARPS_PROFILE
+
+#include "warps/dsp/parameters.h"
+
+namespace warps {
+
+enum ProfilerStage {
+  PROFILER_STAGE_AMPLIFIER,
+  PROFILER_STAGE_OSCILLATOR,
+  PROFILER_STAGE_SRC_UP,
+  PROFILER_STAGE_XMOD,
+  PROFILER_STAGE_SRC_DOWN,
+  PROFILER_STAGE_VOCODER,
+  // Conversions, cross-fades, and the modes which are not broken down.
+  PROFILER_STAGE_OTHER,
+  PROFILER_STAGE_LAST
+};
+
+struct ProfilerBlock {
+  uint8_t feature_mode;
+  uint8_t size;
+  uint32_t ticks[PROFILER_STAGE_LAST];
+};
+
+const size_t kProfilerRingSize = 1024;
+const size_t kNumFeatureModes = FEATURE_MODE_META + 1;
+
+#ifdef WARPS_PROFILE
+
+class Profiler {
+ public:
+  Profiler() { }
+  ~Profiler() { }
+
+  void Init() {
+    read_ptr_.store(0, std::memory_order_relaxed);
+    write_ptr_.store(0, std::memory_order_relaxed);
+  }
+
+  // Ticks are cycles of the time-stamp counter on x86, nanoseconds elsewhere.
+  static inline uint64_t Now() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+  }
+
+  static inline const char* tick_unit() {
+#if defined(__x86_64__) || defined(__i386__)
+    return "cycles";
+#else
+    return "ns";
+#endif
+  }
+
+  inline void BeginBlock() {
+    for (size_t i = 0; i < PROFILER_STAGE_LAST; ++i) {
+      block_.ticks[i] = 0;
+    }
+    last_mark_ = Now();
+  }
+
+  inline void Mark(ProfilerStage stage) {
+    uint64_t now = Now();
+    block_.ticks[stage] += static_cast<uint32_t>(now - last_mark_);
+    last_mark_ = now;
+  }
+
+  inline void EndBlock(FeatureMode feature_mode, size_t size) {
+    Mark(PROFILER_STAGE_OTHER);
+    block_.feature_mode = feature_mode;
+    block_.size = size;
+    size_t w = write_ptr_.load(std::memory_order_relaxed);
+    size_t next = (w + 1) % kProfilerRingSize;
+    if (next != read_ptr_.load(std::memory_order_acquire)) {
+      ring_[w] = block_;
+      write_ptr_.store(next, std::memory_order_release);
+    }
+  }
+
+  // Called from the consumer thread.
+  inline bool Pop(ProfilerBlock* block) {
+    size_t r = read_ptr_.load(std::memory_order_relaxed);
+    if (r == write_ptr_.load(std::memory_order_acquire)) {
+      return false;
+    }
+    *block = ring_[r];
+    read_ptr_.store((r + 1) % kProfilerRingSize, std::memory_order_release);
+    return true;
+  }
+
+ private:
+  ProfilerBlock block_;
+  uint64_t last_mark_;
+
+  ProfilerBlock ring_[kProfilerRingSize];
+  std::atomic<size_t> read_ptr_;
+  std::atomic<size_t> write_ptr_;
+
+  DISALLOW_COPY_AND_ASSIGN(Profiler);
+};
+
+#else
+
+class Profiler {
+ public:
+  Profiler() { }
+  ~Profiler() { }
+
+  inline void Init() { }
+  inline void BeginBlock() { }
+  inline void Mark(ProfilerStage stage) { }
+  inline void EndBlock(FeatureMode feature_mode, size_t size) { }
+  inline bool Pop(ProfilerBlock* block) { return false; }
+
+ private:
+  DISALLOW_COPY_AND_ASSIGN(Profiler);
+};
+
+#endif  // WARPS_PROFILE
+
+// Smoothed ticks per sample, for each stage of each feature mode.
+class ProfilerStatistics {
+ public:
+  ProfilerStatistics() { }
+  ~ProfilerStatistics() { }
+
+  void Init() {
+    for (size_t i = 0; i < kNumFeatureModes; ++i) {
+      for (size_t j = 0; j < PROFILER_STAGE_LAST; ++j) {
+        ticks_per_sample_[i][j] = 0.0f;
+      }
+      num_blocks_[i] = 0;
+    }
+  }
+
+  void Accumulate(const ProfilerBlock& block) {
+    if (block.feature_mode >= kNumFeatureModes || !block.size) {
+      return;
+    }
+    float* t = ticks_per_sample_[block.feature_mode];
+    // The first blocks are averaged, then the statistics follow the patch
+    // with a time constant of about 1000 blocks.
+    uint32_t n = ++num_blocks_[block.feature_mode];
+    float coefficient = n < 1000 ? 1.0f / n : 0.001f;
+    for (size_t i = 0; i < PROFILER_STAGE_LAST; ++i) {
+      float ticks = static_cast<float>(block.ticks[i]) / block.size;
+      t[i] += coefficient * (ticks - t[i]);
+    }
+  }
+
+  inline float ticks_per_sample(
+      FeatureMode feature_mode,
+      ProfilerStage stage) const {
+    return ticks_per_sample_[feature_mode][stage];
+  }
+
+  inline float total_ticks_per_sample(FeatureMode feature_mode) const {
+    float total = 0.0f;
+    for (size_t i = 0; i < PROFILER_STAGE_LAST; ++i) {
+      total += ticks_per_sample_[feature_mode][i];
+    }
+    return total;
+  }
+
+  inline uint32_t num_blocks(FeatureMode feature_mode) const {
+    return num_blocks_[feature_mode];
+  }
+
+ private:
+  float ticks_per_sample_[kNumFeatureModes][PROFILER_STAGE_LAST];
+  uint32_t num_blocks_[kNumFeatureModes];
+
+  DISALLOW_COPY_AND_ASSIGN(ProfilerStatistics);
+};
+
+}  // namespace warps
+
+#endif  // WARPS_DSP_PROFILER_H_
@@ -34,6 +34,8 @@
 #include "stmlib/dsp/dsp.h"
 #include "stmlib/dsp/filter.h"
 
+#include "warps/dsp/denormals.h"
+
 namespace warps {
 
 const int32_t kMaxNumFilters = 24;
@@ -65,6 +67,13 @@ class QuadratureTransform {
       filter_[i].Process(source, destination, size);
     }
   }
+
+  // To be called once per block by the users of the per-sample Process.
+  void FlushDenormals() {
+    for (int32_t i = 0; i < num_filters_; ++i) {
+      filter_[i].FlushDenormals();
+    }
+  }
   
  private:
   class AllPassFilter {
@@ -96,10 +105,17 @@ class QuadratureTransform {
         xp = x;
         yp = y;
       }
+      FlushDenormal(&xp);
+      FlushDenormal(&yp);
       x_ = xp;
       y_ = yp;
     }
 
+    inline void FlushDenormals() {
+      FlushDenormal(&x_);
+      FlushDenormal(&y_);
+    }
+
    private:
     float x_;
     float y_;
@@ -42,9 +42,11 @@ void Vocoder::Init(float sample_rate) {
   modulator_filter_bank_.Init(sample_rate);
   carrier_filter_bank_.Init(sample_rate);
   limiter_.Init();
+  lookahead_limiter_.Init();
 
   release_time_ = 0.5f;
   formant_shift_ = 0.5f;
+  use_lookahead_limiter_ = false;
   
   BandGain zero;
   zero.carrier = 0.0f;
@@ -124,7 +126,11 @@ void Vocoder::Process(
   }
 
   carrier_filter_bank_.Synthesize(out, size);
-  limiter_.Process(out, 1.6f, size);
+  if (use_lookahead_limiter_) {
+    lookahead_limiter_.Process(out, 1.6f, size);
+  } else {
+    limiter_.Process(out, 1.6f, size);
+  }
 }
 
 }  // namespace warps
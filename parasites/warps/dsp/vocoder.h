@@ -31,6 +31,7 @@
 
 #include "stmlib/stmlib.h"
 
+#include "warps/dsp/denormals.h"
 #include "warps/dsp/filter_bank.h"
 #include "warps/dsp/limiter.h"
 
@@ -75,9 +76,11 @@ class EnvelopeFollower {
       }
       *out++ = envelope;
     }
+    FlushDenormal(&envelope);
     envelope_ = envelope;
     float error = peak - peak_;
     peak_ += (error > 0.0f ? 0.5f : 0.1f) * error;
+    FlushDenormal(&peak_);
   }
   
   inline float peak() const { return peak_; }
@@ -117,9 +120,20 @@ class Vocoder {
     formant_shift_ = formant_shift;
   }
 
+  // Selects the brickwall, look-ahead limiter, which delays the output by
+  // one block.
+  void set_lookahead_limiter(bool lookahead_limiter) {
+    if (lookahead_limiter && !use_lookahead_limiter_) {
+      lookahead_limiter_.Init();
+    }
+    use_lookahead_limiter_ = lookahead_limiter;
+  }
+  bool lookahead_limiter() const { return use_lookahead_limiter_; }
+
  private:
   float release_time_;
   float formant_shift_;
+  bool use_lookahead_limiter_;
   
   BandGain previous_gain_[kNumBands];
   BandGain gain_[kNumBands];
@@ -129,6 +143,7 @@ class Vocoder {
   FilterBank modulator_filter_bank_;
   FilterBank carrier_filter_bank_;
   Limiter limiter_;
+  LookaheadLimiter lookahead_limiter_;
   EnvelopeFollower follower_[kNumBands];
   
   DISALLOW_COPY_AND_ASSIGN(Vocoder);
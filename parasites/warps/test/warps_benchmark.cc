@@ -0,0 +1,306 @@
+// Copyright 2026 Aepelzen's Parasites contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Micro-benchmark of Modulator::Process, for every feature mode, every zone of
+// the meta mode and every carrier shape, at several block sizes.
+//
+// Usage: warps_benchmark [seconds of audio per case]
+//
+// Reports ns/sample, and cycles/sample and instructions/sample from the
+// hardware performance counters when the kernel allows access to them (see
+// /proc/sys/kernel/perf_event_paranoid). Otherwise, cycles are read from the
+// time-stamp counter and instructions are not reported.
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <xmmintrin.h>
+#include <x86intrin.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif  // __linux__
+
+#include "warps/dsp/modulator.h"
+
+using namespace warps;
+using namespace std;
+
+const float kSampleRate = 96000.0f;
+const size_t kBlockSizes[] = { 16, 60, 96 };
+const size_t kNumBlockSizes = sizeof(kBlockSizes) / sizeof(kBlockSizes[0]);
+const int32_t kNumCarrierShapes = 4;
+
+const char* kFeatureModeNames[] = {
+  "doppler",
+  "fold",
+  "chebyschev",
+  "frequency_shifter",
+  "bitcrusher",
+  "comparator",
+  "vocoder",
+  "delay",
+  "meta",
+};
+
+// Values of modulation_algorithm in the middle of each zone of the meta mode:
+// the six cross-modulation algorithms of xmod_table_, then the vocoder.
+struct MetaZone {
+  const char* name;
+  float algorithm;
+};
+
+const MetaZone kMetaZones[] = {
+  { "xfade_fold", 0.0625f },
+  { "fold_analog_rm", 0.1875f },
+  { "analog_rm_digital_rm", 0.3125f },
+  { "digital_rm_xor", 0.4375f },
+  { "xor_comparator", 0.5625f },
+  { "comparator_nop", 0.64f },
+  { "vocoder", 0.9f },
+};
+
+const size_t kNumMetaZones = sizeof(kMetaZones) / sizeof(kMetaZones[0]);
+
+class PerfCounters {
+ public:
+  PerfCounters() : cycles_fd_(-1), instructions_fd_(-1) { }
+  ~PerfCounters() {
+#ifdef __linux__
+    if (instructions_fd_ != -1) {
+      close(instructions_fd_);
+    }
+    if (cycles_fd_ != -1) {
+      close(cycles_fd_);
+    }
+#endif  // __linux__
+  }
+
+  void Init() {
+#ifdef __linux__
+    cycles_fd_ = Open(PERF_COUNT_HW_CPU_CYCLES, -1);
+    if (cycles_fd_ != -1) {
+      instructions_fd_ = Open(PERF_COUNT_HW_INSTRUCTIONS, cycles_fd_);
+    }
+#endif  // __linux__
+  }
+
+  inline bool available() const { return cycles_fd_ != -1; }
+  inline bool has_instructions() const { return instructions_fd_ != -1; }
+
+  void Start() {
+#ifdef __linux__
+    if (available()) {
+      ioctl(cycles_fd_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+      ioctl(cycles_fd_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+      return;
+    }
+#endif  // __linux__
+    tsc_start_ = __rdtsc();
+  }
+
+  void Stop(uint64_t* cycles, uint64_t* instructions) {
+    *instructions = 0;
+#ifdef __linux__
+    if (available()) {
+      ioctl(cycles_fd_, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+      *cycles = Read(cycles_fd_);
+      if (has_instructions()) {
+        *instructions = Read(instructions_fd_);
+      }
+      return;
+    }
+#endif  // __linux__
+    *cycles = __rdtsc() - tsc_start_;
+  }
+
+ private:
+#ifdef __linux__
+  static int Open(uint64_t config, int group_fd) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = config;
+    attr.disabled = group_fd == -1 ? 1 : 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return static_cast<int>(
+        syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0));
+  }
+
+  static uint64_t Read(int fd) {
+    uint64_t value = 0;
+    if (read(fd, &value, sizeof(value)) != sizeof(value)) {
+      return 0;
+    }
+    return value;
+  }
+#endif  // __linux__
+
+  int cycles_fd_;
+  int instructions_fd_;
+  uint64_t tsc_start_;
+};
+
+// Deterministic stereo test signal: a chord on the modulator input, a slowly
+// swept tone on the carrier input, with a bit of noise to keep the
+// comparators and the bitcrusher busy.
+void RenderInput(ShortFrame* input, size_t size) {
+  uint32_t noise = 0x21;
+  for (size_t i = 0; i < size; ++i) {
+    float t = static_cast<float>(i) / kSampleRate;
+    noise = noise * 1664525L + 1013904223L;
+    float n = static_cast<float>(static_cast<int32_t>(noise) >> 16) / 32768.0f;
+    float l = 0.3f * sinf(2.0f * M_PI * 110.0f * t) +
+        0.2f * sinf(2.0f * M_PI * 164.8f * t) +
+        0.01f * n;
+    float r = 0.5f * sinf(2.0f * M_PI * (220.0f + 50.0f * sinf(t)) * t);
+    input[i].l = static_cast<short>(l * 32767.0f);
+    input[i].r = static_cast<short>(r * 32767.0f);
+  }
+}
+
+class Benchmark {
+ public:
+  Benchmark(float seconds) : num_frames_(seconds * kSampleRate) {
+    input_ = new ShortFrame[num_frames_];
+    RenderInput(input_, num_frames_);
+    counters_.Init();
+  }
+
+  ~Benchmark() {
+    delete[] input_;
+  }
+
+  void PrintHeader() const {
+    printf("%-18s %-21s %5s %5s %10s %12s %12s\n",
+           "mode", "zone", "shape", "block",
+           "ns/sample", counters_.available() ? "cycles/smp" : "tsc/smp",
+           "instr/smp");
+  }
+
+  void Run(
+      FeatureMode mode,
+      const char* zone,
+      float algorithm,
+      int32_t carrier_shape,
+      size_t block_size) {
+    Modulator* modulator = new Modulator;
+    modulator->Init(kSampleRate);
+    modulator->set_feature_mode(mode);
+    ShortFrame output[kMaxBlockSize];
+
+    // One untimed pass to settle the state of the delay lines and filters,
+    // and to bring the code and the lookup tables into the caches.
+    Render(modulator, algorithm, carrier_shape, block_size, output);
+
+    uint64_t cycles, instructions;
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    counters_.Start();
+    Render(modulator, algorithm, carrier_shape, block_size, output);
+    counters_.Stop(&cycles, &instructions);
+    double ns = chrono::duration<double, nano>(
+        chrono::steady_clock::now() - start).count();
+    delete modulator;
+
+    size_t num_samples = num_frames_ / block_size * block_size;
+    printf("%-18s %-21s %5d %5d %10.2f %12.1f ",
+           kFeatureModeNames[mode], zone, carrier_shape,
+           static_cast<int>(block_size),
+           ns / num_samples,
+           static_cast<double>(cycles) / num_samples);
+    if (counters_.has_instructions()) {
+      printf("%12.1f\n", static_cast<double>(instructions) / num_samples);
+    } else {
+      printf("%12s\n", "-");
+    }
+  }
+
+ private:
+  void Render(
+      Modulator* modulator,
+      float algorithm,
+      int32_t carrier_shape,
+      size_t block_size,
+      ShortFrame* output) {
+    for (size_t i = 0; i + block_size <= num_frames_; i += block_size) {
+      // Some modes rescale their parameters in place, so they are set again
+      // for every block, as the module does.
+      Parameters* p = modulator->mutable_parameters();
+      p->channel_drive[0] = 0.6f;
+      p->channel_drive[1] = 0.6f;
+      p->modulation_algorithm = algorithm;
+      p->modulation_parameter = 0.5f;
+      p->raw_level[0] = 0.6f;
+      p->raw_level[1] = 0.6f;
+      p->raw_algorithm_pot = algorithm;
+      p->raw_algorithm_cv = 0.0f;
+      p->raw_algorithm = algorithm;
+      p->note = 48.0f;
+      p->carrier_shape = carrier_shape;
+      modulator->Process(&input_[i], output, block_size);
+    }
+  }
+
+  size_t num_frames_;
+  ShortFrame* input_;
+  PerfCounters counters_;
+};
+
+int main(int argc, char** argv) {
+  _MM_SET_FLUSH_ZERO_MODE(_MM_FLUSH_ZERO_ON);
+
+  float seconds = argc > 1 ? atof(argv[1]) : 1.0f;
+  Benchmark benchmark(seconds);
+  benchmark.PrintHeader();
+
+  for (int32_t mode = FEATURE_MODE_DOPPLER; mode < FEATURE_MODE_META; ++mode) {
+    for (int32_t shape = 0; shape < kNumCarrierShapes; ++shape) {
+      for (size_t i = 0; i < kNumBlockSizes; ++i) {
+        benchmark.Run(
+            static_cast<FeatureMode>(mode), "-", 0.5f, shape, kBlockSizes[i]);
+      }
+    }
+  }
+
+  for (size_t zone = 0; zone < kNumMetaZones; ++zone) {
+    for (int32_t shape = 0; shape < kNumCarrierShapes; ++shape) {
+      for (size_t i = 0; i < kNumBlockSizes; ++i) {
+        benchmark.Run(
+            FEATURE_MODE_META,
+            kMetaZones[zone].name,
+            kMetaZones[zone].algorithm,
+            shape,
+            kBlockSizes[i]);
+      }
+    }
+  }
+  return 0;
+}
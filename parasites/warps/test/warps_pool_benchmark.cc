@@ -0,0 +1,198 @@
+// Copyright 2026 Aepelzen's Parasites contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Benchmark of the worker pool of the polyphonic Wasp (src/WorkerPool.hpp):
+// renders 16 channels of a few feature modes, one Modulator per channel, in a
+// loop on one thread, then with the pool and 0 to 4 worker threads.
+//
+// Usage: warps_pool_benchmark [seconds of audio per case]
+//
+// Reports ns/block for the 16 channels and the speedup over the serial loop.
+// Each block is dispatched and waited for at once, the calling thread
+// rendering the jobs no worker has claimed, so this measures the throughput
+// of the pool and its overhead, not the pipelining of the module. With 0
+// workers, the difference with the serial loop is the cost of the pool
+// itself. The speedup is bounded by the number of cores.
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <xmmintrin.h>
+
+#include "WorkerPool.hpp"
+#include "warps/dsp/modulator.h"
+
+using namespace warps;
+using namespace std;
+
+const float kSampleRate = 96000.0f;
+const size_t kBlockSize = 60;
+const int kNumChannels = 16;
+const int kMaxWorkers = 4;
+
+struct PoolCase {
+  const char* name;
+  FeatureMode mode;
+  float algorithm;
+  int32_t carrier_shape;
+};
+
+const PoolCase kCases[] = {
+  { "fold", FEATURE_MODE_FOLD, 0.5f, 1 },
+  { "vocoder", FEATURE_MODE_VOCODER, 0.5f, 0 },
+  { "delay", FEATURE_MODE_DELAY, 0.5f, 1 },
+  { "meta_xmod", FEATURE_MODE_META, 0.3125f, 1 },
+  { "meta_vocoder", FEATURE_MODE_META, 0.9f, 1 },
+};
+
+const size_t kNumCases = sizeof(kCases) / sizeof(kCases[0]);
+
+// A different tone on each channel, so that the channels do not share their
+// branches.
+void RenderInput(ShortFrame* input, size_t size, int channel) {
+  for (size_t i = 0; i < size; ++i) {
+    float t = static_cast<float>(i) / kSampleRate;
+    float f = 110.0f * (1.0f + 0.125f * channel);
+    float l = 0.3f * sinf(2.0f * M_PI * f * t);
+    float r = 0.5f * sinf(2.0f * M_PI * (220.0f + 50.0f * sinf(t)) * t);
+    input[i].l = static_cast<short>(l * 32767.0f);
+    input[i].r = static_cast<short>(r * 32767.0f);
+  }
+}
+
+class Benchmark {
+ public:
+  Benchmark(float seconds)
+      : num_blocks_(seconds * kSampleRate / kBlockSize),
+        block_(0),
+        modulators_(NULL),
+        pool_([this](int c) { RenderChannel(c); }) {
+    size_t num_frames = num_blocks_ * kBlockSize;
+    for (int c = 0; c < kNumChannels; ++c) {
+      input_[c] = new ShortFrame[num_frames];
+      RenderInput(input_[c], num_frames, c);
+    }
+  }
+
+  ~Benchmark() {
+    for (int c = 0; c < kNumChannels; ++c) {
+      delete[] input_[c];
+    }
+  }
+
+  void PrintHeader() const {
+    printf("%-14s %-8s %12s %8s\n", "mode", "workers", "ns/block", "speedup");
+  }
+
+  void Run(const PoolCase& c) {
+    double serial = Time(c, -1);
+    printf("%-14s %-8s %12.0f %8.2f\n", c.name, "serial", serial, 1.0);
+    for (int workers = 0; workers <= kMaxWorkers; ++workers) {
+      double pool = Time(c, workers);
+      printf("%-14s %-8d %12.0f %8.2f\n", c.name, workers, pool,
+             serial / pool);
+    }
+  }
+
+ private:
+  // Returns ns/block, rendering in a loop when num_workers is negative.
+  double Time(const PoolCase& c, int num_workers) {
+    modulators_ = new Modulator[kNumChannels]();
+    for (int i = 0; i < kNumChannels; ++i) {
+      modulators_[i].Init(kSampleRate);
+      modulators_[i].set_feature_mode(c.mode);
+    }
+    if (num_workers > 0) {
+      pool_.start(num_workers);
+    }
+
+    // One untimed pass to settle the state of the delay lines and filters,
+    // and to bring the code and the lookup tables into the caches.
+    Render(c, num_workers);
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    Render(c, num_workers);
+    double ns = chrono::duration<double, nano>(
+        chrono::steady_clock::now() - start).count();
+
+    pool_.stop();
+    delete[] modulators_;
+    modulators_ = NULL;
+    return ns / num_blocks_;
+  }
+
+  void Render(const PoolCase& c, int num_workers) {
+    for (block_ = 0; block_ < num_blocks_; ++block_) {
+      for (int i = 0; i < kNumChannels; ++i) {
+        Parameters* p = modulators_[i].mutable_parameters();
+        p->channel_drive[0] = 0.6f;
+        p->channel_drive[1] = 0.6f;
+        p->modulation_algorithm = c.algorithm;
+        p->modulation_parameter = 0.5f;
+        p->raw_level[0] = 0.6f;
+        p->raw_level[1] = 0.6f;
+        p->raw_algorithm_pot = c.algorithm;
+        p->raw_algorithm_cv = 0.0f;
+        p->raw_algorithm = c.algorithm;
+        p->note = 48.0f;
+        p->carrier_shape = c.carrier_shape;
+      }
+      if (num_workers < 0) {
+        for (int i = 0; i < kNumChannels; ++i) {
+          RenderChannel(i);
+        }
+      } else {
+        pool_.dispatch(kNumChannels);
+        pool_.wait();
+      }
+    }
+  }
+
+  void RenderChannel(int c) {
+    size_t offset = block_ * kBlockSize;
+    modulators_[c].Process(
+        &input_[c][offset], &output_[c][0], kBlockSize);
+  }
+
+  size_t num_blocks_;
+  size_t block_;
+  Modulator* modulators_;
+  ShortFrame* input_[kNumChannels];
+  ShortFrame output_[kNumChannels][kBlockSize];
+  WorkerPool pool_;
+};
+
+int main(int argc, char** argv) {
+  _MM_SET_FLUSH_ZERO_MODE(_MM_FLUSH_ZERO_ON);
+
+  float seconds = argc > 1 ? atof(argv[1]) : 1.0f;
+  printf("%u hardware threads\n", thread::hardware_concurrency());
+  Benchmark benchmark(seconds);
+  benchmark.PrintHeader();
+  for (size_t i = 0; i < kNumCases; ++i) {
+    benchmark.Run(kCases[i]);
+  }
+  return 0;
+}
@@ -0,0 +1,161 @@
+// Copyright 2026 Aepelzen's Parasites contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Stress benchmark of the silent tails: each feature mode is fed one second
+// of signal with the feedback and the levels turned up, then a long silence,
+// during which the state of the filters and feedback loops decays towards the
+// range of denormal numbers.
+//
+// Usage: warps_tail_benchmark [seconds of silence]
+//
+// Reports ns/sample for the signal, and for each successive second of
+// silence. On a denormal-safe build, the cost of the tail stays flat: a case
+// is flagged when a second of silence costs more than twice the cheapest one.
+//
+// Unlike warps_benchmark, this does not set the flush-to-zero mode of the
+// process, which is the job of Modulator::Process.
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "warps/dsp/modulator.h"
+
+using namespace warps;
+using namespace std;
+
+const float kSampleRate = 96000.0f;
+const size_t kBlockSize = 60;
+const size_t kFramesPerSecond = 96000;
+const float kFlatnessThreshold = 2.0f;
+
+struct TailCase {
+  const char* name;
+  FeatureMode mode;
+  float algorithm;
+  int32_t carrier_shape;
+};
+
+const TailCase kCases[] = {
+  { "doppler", FEATURE_MODE_DOPPLER, 0.5f, 0 },
+  { "fold", FEATURE_MODE_FOLD, 0.5f, 1 },
+  { "chebyschev", FEATURE_MODE_CHEBYSCHEV, 0.5f, 1 },
+  { "frequency_shifter", FEATURE_MODE_FREQUENCY_SHIFTER, 0.5f, 1 },
+  { "bitcrusher", FEATURE_MODE_BITCRUSHER, 0.5f, 1 },
+  { "comparator", FEATURE_MODE_COMPARATOR, 0.5f, 1 },
+  { "vocoder", FEATURE_MODE_VOCODER, 0.5f, 0 },
+  { "delay_dual", FEATURE_MODE_DELAY, 0.7f, 1 },
+  { "delay_tape", FEATURE_MODE_DELAY, 0.7f, 2 },
+  { "meta_xmod", FEATURE_MODE_META, 0.3125f, 1 },
+  { "meta_vocoder", FEATURE_MODE_META, 0.9f, 1 },
+};
+
+const size_t kNumCases = sizeof(kCases) / sizeof(kCases[0]);
+
+void RenderInput(ShortFrame* input, size_t size) {
+  for (size_t i = 0; i < size; ++i) {
+    float t = static_cast<float>(i) / kSampleRate;
+    float l = 0.5f * sinf(2.0f * M_PI * 110.0f * t);
+    float r = 0.5f * sinf(2.0f * M_PI * 330.0f * t);
+    input[i].l = static_cast<short>(l * 32767.0f);
+    input[i].r = static_cast<short>(r * 32767.0f);
+  }
+}
+
+// Returns ns/sample.
+double Render(
+    Modulator* modulator,
+    const TailCase& c,
+    const ShortFrame* input,
+    size_t size) {
+  ShortFrame output[kBlockSize];
+  chrono::steady_clock::time_point start = chrono::steady_clock::now();
+  for (size_t i = 0; i + kBlockSize <= size; i += kBlockSize) {
+    Parameters* p = modulator->mutable_parameters();
+    p->channel_drive[0] = 0.8f;
+    p->channel_drive[1] = 0.8f;
+    p->modulation_algorithm = c.algorithm;
+    p->modulation_parameter = 0.5f;
+    p->raw_level[0] = 0.9f;
+    p->raw_level[1] = 0.9f;
+    p->raw_algorithm_pot = c.algorithm;
+    p->raw_algorithm_cv = 0.0f;
+    p->raw_algorithm = c.algorithm;
+    p->note = 48.0f;
+    p->carrier_shape = c.carrier_shape;
+    modulator->Process(
+        const_cast<ShortFrame*>(&input[i]), output, kBlockSize);
+  }
+  double ns = chrono::duration<double, nano>(
+      chrono::steady_clock::now() - start).count();
+  return ns / (size / kBlockSize * kBlockSize);
+}
+
+int main(int argc, char** argv) {
+  int seconds = argc > 1 ? atoi(argv[1]) : 20;
+  if (seconds < 1) {
+    seconds = 1;
+  }
+
+  vector<ShortFrame> signal(kFramesPerSecond);
+  vector<ShortFrame> silence(kFramesPerSecond);
+  RenderInput(&signal[0], signal.size());
+  for (size_t i = 0; i < silence.size(); ++i) {
+    silence[i].l = silence[i].r = 0;
+  }
+
+  printf("%-18s %10s %10s %10s %10s\n",
+         "case", "signal", "tail min", "tail max", "tail last");
+  int num_flagged = 0;
+  for (size_t i = 0; i < kNumCases; ++i) {
+    Modulator* modulator = new Modulator;
+    modulator->Init(kSampleRate);
+    modulator->set_feature_mode(kCases[i].mode);
+
+    double signal_ns = Render(
+        modulator, kCases[i], &signal[0], signal.size());
+    double min_ns = 0.0;
+    double max_ns = 0.0;
+    double last_ns = 0.0;
+    for (int s = 0; s < seconds; ++s) {
+      last_ns = Render(modulator, kCases[i], &silence[0], silence.size());
+      if (s == 0 || last_ns < min_ns) {
+        min_ns = last_ns;
+      }
+      if (s == 0 || last_ns > max_ns) {
+        max_ns = last_ns;
+      }
+    }
+    delete modulator;
+
+    bool flagged = max_ns > kFlatnessThreshold * min_ns;
+    num_flagged += flagged ? 1 : 0;
+    printf("%-18s %10.2f %10.2f %10.2f %10.2f%s\n",
+           kCases[i].name, signal_ns, min_ns, max_ns, last_ns,
+           flagged ? "  NOT FLAT" : "");
+  }
+  return num_flagged ? 1 : 0;
+}
@@ -48,10 +48,17 @@ struct Tides : Module {
 	};
 
 	bool sheep;
+	bool audioRateModulation = false;
+	bool pllSync = false;
+	// Each instance, including a duplicate or a preset, draws its own random sequence unless the
+	// seed is saved with the patch.
+	bool reproducibleRandom = false;
 	tides::Generator generator;
 	uint8_t quantize = 0;
 	int frame = 0;
 	uint8_t lastGate;
+	float lastClock = 0.f;
+	float lastTrig = 0.f;
 	dsp::SchmittTrigger modeTrigger;
 	dsp::SchmittTrigger rangeTrigger;
 	
@@ -96,6 +103,8 @@ struct Tides : Module {
 	void onReset() override {
 		generator.set_range(tides::GENERATOR_RANGE_MEDIUM);
 		generator.set_mode(tides::GENERATOR_MODE_LOOPING);
+		generator.set_seed(random::u32());
+		reproducibleRandom = false;
 		sheep = false;
 	}
 
@@ -111,6 +120,12 @@ struct Tides : Module {
 		json_object_set_new(rootJ, "sheep", json_boolean(sheep));
 		json_object_set_new(rootJ, "featureMode", json_integer(static_cast<int>(generator.feature_mode_)));
 		json_object_set_new(rootJ, "QuantizerMode", json_integer(quantize));
+		json_object_set_new(rootJ, "audioRateModulation", json_boolean(audioRateModulation));
+		json_object_set_new(rootJ, "pllSync", json_boolean(pllSync));
+		json_object_set_new(rootJ, "reproducibleRandom", json_boolean(reproducibleRandom));
+		if (reproducibleRandom) {
+			json_object_set_new(rootJ, "seed", json_integer(generator.seed()));
+		}
 		return rootJ;
 	}
 
@@ -130,9 +145,31 @@ struct Tides : Module {
 		if (json_t* quantizerJ = json_object_get(rootJ, "QuantizerMode")) {
 			quantize = json_integer_value(quantizerJ);
 		}
+		if (json_t* audioRateModulationJ = json_object_get(rootJ, "audioRateModulation")) {
+			audioRateModulation = json_boolean_value(audioRateModulationJ);
+		}
+		if (json_t* pllSyncJ = json_object_get(rootJ, "pllSync")) {
+			pllSync = json_boolean_value(pllSyncJ);
+		}
+		if (json_t* reproducibleRandomJ = json_object_get(rootJ, "reproducibleRandom")) {
+			reproducibleRandom = json_boolean_value(reproducibleRandomJ);
+		}
+		json_t* seedJ = json_object_get(rootJ, "seed");
+		if (reproducibleRandom && seedJ) {
+			generator.set_seed(json_integer_value(seedJ));
+		}
 	}
 };
 
+// Time elapsed since the input crossed the 0.7V threshold between the previous
+// and the current sample, in 1/256th of a sample.
+static uint8_t crossingDelay(float previous, float current) {
+	if (current == previous)
+		return 0;
+	float elapsed = (current - 0.7f) / (current - previous);
+	return clamp(elapsed * 256.f, 0.f, 255.f);
+}
+
 void Tides::process(const ProcessArgs& args) {
 	tides::GeneratorMode mode = generator.mode();
 	if (modeTrigger.process(params[MODE_PARAM].getValue())) {
@@ -150,11 +187,14 @@ void Tides::process(const ProcessArgs& args) {
 	lights[RANGE_GREEN_LIGHT].setBrightness((range == 1 || range == 2) ? 1.0 : 0.0);
 	lights[RANGE_RED_LIGHT].setBrightness((range == 0 || range == 1) ? 1.0 : 0.0);
 
+	// FM, shape and slope CVs are applied per sample instead of once per block
+	bool perSampleModulation = audioRateModulation && generator.feature_mode_ == tides::Generator::FEAT_MODE_FUNCTION;
+
 	//Buffer loop
 	if (generator.writable_block()) {
 		// Pitch
 		float pitchParam = clamp(params[FREQUENCY_PARAM].getValue() + inputs[PITCH_INPUT].getVoltage() * 12.0f, -60.0f, 60.0f);
-		float fm = clamp(inputs[FM_INPUT].getVoltage() / 5.0f * params[FM_PARAM].getValue() / 12.0f, -1.0f, 1.0f) * 0x600;
+		float fm = perSampleModulation ? 0.0f : clamp(inputs[FM_INPUT].getVoltage() / 5.0f * params[FM_PARAM].getValue() / 12.0f, -1.0f, 1.0f) * 0x600;
 
 		pitchParam += 60.0;
 		// this is probably not original but seems useful to keep the same frequency as in normal mode
@@ -196,8 +236,10 @@ void Tides::process(const ProcessArgs& args) {
 		}
 
 		// Slope, smoothness, pitch
-		int16_t shape = clamp(params[SHAPE_PARAM].getValue() + inputs[SHAPE_INPUT].getVoltage() / 5.0f, -1.0f, 1.0f) * 0x7fff;
-		int16_t slope = clamp(params[SLOPE_PARAM].getValue() + inputs[SLOPE_INPUT].getVoltage() / 5.0f, -1.0f, 1.0f) * 0x7fff;
+		float shapeCV = perSampleModulation ? 0.0f : inputs[SHAPE_INPUT].getVoltage() / 5.0f;
+		float slopeCV = perSampleModulation ? 0.0f : inputs[SLOPE_INPUT].getVoltage() / 5.0f;
+		int16_t shape = clamp(params[SHAPE_PARAM].getValue() + shapeCV, -1.0f, 1.0f) * 0x7fff;
+		int16_t slope = clamp(params[SLOPE_PARAM].getValue() + slopeCV, -1.0f, 1.0f) * 0x7fff;
 		int16_t smoothness = clamp(params[SMOOTHNESS_PARAM].getValue() + inputs[SMOOTHNESS_INPUT].getVoltage() / 5.0f, -1.0f, 1.0f) * 0x7fff;
 		generator.set_shape(shape);
 		generator.set_slope(slope);
@@ -208,6 +250,8 @@ void Tides::process(const ProcessArgs& args) {
 		// Instead of toggling sync by holding the range button, just enable it if the clock port is plugged in.
 		// TODO make auto PLL (as it is now) an option? 
 		generator.set_sync(inputs[CLOCK_INPUT].isConnected());
+		generator.set_pll(pllSync);
+		generator.set_audio_rate_modulation(perSampleModulation);
 		generator.FillBuffer();
 #ifdef WAVETABLE_HACK
 		generator.Process(sheep);
@@ -222,19 +266,45 @@ void Tides::process(const ProcessArgs& args) {
 	uint8_t gate = 0;
 	if (inputs[FREEZE_INPUT].getVoltage() >= 0.7)
 		gate |= tides::CONTROL_FREEZE;
-	if (inputs[TRIG_INPUT].getVoltage() >= 0.7)
+	float trig = inputs[TRIG_INPUT].getVoltage();
+	if (trig >= 0.7)
 		gate |= tides::CONTROL_GATE;
-	if (inputs[CLOCK_INPUT].getVoltage() >= 0.7)
+	float clock = inputs[CLOCK_INPUT].getVoltage();
+	if (clock >= 0.7)
 		gate |= tides::CONTROL_CLOCK;
-	if (!(lastGate & tides::CONTROL_CLOCK) && (gate & tides::CONTROL_CLOCK))
-		gate |= tides::CONTROL_GATE_RISING;
-	if (!(lastGate & tides::CONTROL_GATE) && (gate & tides::CONTROL_GATE))
+
+	// Edges are timed within the sample by interpolating the threshold crossing
+	tides::GeneratorEdgeDelay edgeDelay = {0, 0};
+	if (!(lastGate & tides::CONTROL_CLOCK) && (gate & tides::CONTROL_CLOCK)) {
+		if (pllSync) {
+			gate |= tides::CONTROL_CLOCK_RISING;
+			edgeDelay.clock = crossingDelay(lastClock, clock);
+		}
+		else {
+			gate |= tides::CONTROL_GATE_RISING;
+			edgeDelay.gate = crossingDelay(lastClock, clock);
+		}
+	}
+	if (!(lastGate & tides::CONTROL_GATE) && (gate & tides::CONTROL_GATE)) {
 		gate |= tides::CONTROL_GATE_RISING;
-	if ((lastGate & tides::CONTROL_GATE) && !(gate & tides::CONTROL_GATE))
+		edgeDelay.gate = crossingDelay(lastTrig, trig);
+	}
+	if ((lastGate & tides::CONTROL_GATE) && !(gate & tides::CONTROL_GATE)) {
 		gate |= tides::CONTROL_GATE_FALLING;
+		edgeDelay.gate = crossingDelay(lastTrig, trig);
+	}
 	lastGate = gate;
+	lastClock = clock;
+	lastTrig = trig;
+
+	tides::GeneratorModulation modulation = {0, 0, 0};
+	if (perSampleModulation) {
+		modulation.fm = clamp(inputs[FM_INPUT].getVoltage() / 5.0f * params[FM_PARAM].getValue() / 12.0f, -1.0f, 1.0f) * 0x600;
+		modulation.shape = clamp(inputs[SHAPE_INPUT].getVoltage() / 5.0f, -1.0f, 1.0f) * 0x7fff;
+		modulation.slope = clamp(inputs[SLOPE_INPUT].getVoltage() / 5.0f, -1.0f, 1.0f) * 0x7fff;
+	}
 
-	const tides::GeneratorSample& sample = generator.Process(gate);
+	const tides::GeneratorSample& sample = generator.Process(gate, modulation, edgeDelay);
 
 	uint32_t uni = sample.unipolar;
 	int32_t bi = sample.bipolar;
@@ -327,6 +397,14 @@ struct TidesWidget : ModuleWidget {
 				[=]() {module->generator.feature_mode_ = modeLabel.fmode;}
 			));
 		}
+
+		menu->addChild(new MenuSeparator);
+		menu->addChild(createBoolPtrMenuItem("Audio-rate FM, shape and slope", "", &module->audioRateModulation));
+		menu->addChild(createBoolPtrMenuItem("PLL clock sync", "", &module->pllSync));
+		menu->addChild(createBoolPtrMenuItem("Save the random sequence with the patch", "", &module->reproducibleRandom));
+		if (module->pllSync && module->generator.sync()) {
+			menu->addChild(createMenuLabel(string::f("Clock lock quality: %d%%", module->generator.clock_lock_quality() * 100 / 65535)));
+		}
 	}
 };
 
@@ -1,7 +1,8 @@
 #include "AepelzensParasites.hpp"
+#include "WorkerPool.hpp"
+#include "warps/dsp/doppler_bank.h"
 #include "warps/dsp/modulator.h"
-
-#pragma GCC diagnostic ignored "-Wclass-memaccess"
+#include "warps/dsp/oscillator_bank.h"
 
 struct Warps : Module {
 	enum ParamIds {
@@ -32,12 +33,87 @@ struct Warps : Module {
 		NUM_LIGHTS = ALGORITHM_LIGHT + 3
 	};
 
+	// Blocks of 60 frames over which the modes are crossfaded, about 20 ms at 48 kHz.
+	static const int MODE_FADE_BLOCKS = 16;
+
 	int frame = 0;
-	warps::Modulator modulator;
-	warps::ShortFrame inputFrames[60] {};
-	warps::ShortFrame outputFrames[60] {};
+	int channels = 1;
+	// One modulator per channel. The modes share most of the state of the modulators, so the
+	// new mode cannot start from the state left by the old one: when the mode changes, the UI
+	// thread allocates a fresh set of modulators for the new mode, which the audio thread renders
+	// alongside the old set and crossfades in. The old set is then handed back to the UI thread to
+	// be deleted, so that the two sets only coexist during the transition.
+	// Owned by the audio thread, like the carrier shapes in their parameters, which are copied from
+	// shape at each block.
+	warps::Modulator* modulators;
+	// The modulators, for the profiler readout of the UI thread. They are published before the
+	// previous ones are retired, and the UI thread deletes retired modulators only after it is done
+	// with the published ones, so they stay alive while they are read.
+	std::atomic<warps::Modulator*> publishedModulators {nullptr};
+	std::atomic<int> shape {0};
+	warps::FeatureMode mode = warps::FEATURE_MODE_META;
+	// From the UI thread to the audio thread.
+	std::atomic<warps::Modulator*> pendingModulators {nullptr};
+	// Owned by the audio thread.
+	warps::Modulator* incomingModulators = nullptr;
+	int fadeBlock = 0;
+	// From the audio thread back to the UI thread. No new transition starts until it is collected.
+	std::atomic<warps::Modulator*> retiredModulators {nullptr};
+	warps::ShortFrame inputFrames[PORT_MAX_CHANNELS][60] {};
+	warps::ShortFrame outputFrames[PORT_MAX_CHANNELS][60] {};
 	dsp::SchmittTrigger stateTrigger;
 
+	// With several channels, the internal oscillators of the modulators are rendered together, a
+	// few channels at a time in SIMD lanes, and the modulators read their carriers from carrierBlocks.
+	warps::OscillatorBank xmodOscillators;
+	warps::OscillatorBank vocoderOscillators;
+	warps::CarrierBlock carrierBlocks[PORT_MAX_CHANNELS];
+	float carrierModulation[PORT_MAX_CHANNELS][60] {};
+
+	// With multithreading and several channels, the channels of block N are rendered by the worker
+	// pool from workInputFrames to workOutputFrames while block N + 1 is recorded, at the cost of
+	// one more block of latency. The Doppler mix of block N is held back along with them, in
+	// workDopplerMixFrames, so that it stays aligned with the channels it is crossfaded with.
+	// pipelined is set by the audio thread while a block is in the pool, and read by the UI thread
+	// to stop the workers once the option is turned off. workPending is set while the output of a
+	// block is held back, whether or not its channels are in the pool.
+	std::atomic<bool> multithreaded {false};
+	std::atomic<bool> pipelined {false};
+	bool workPending = false;
+	int workChannels = 0;
+	warps::ShortFrame workInputFrames[PORT_MAX_CHANNELS][60] {};
+	warps::ShortFrame workOutputFrames[PORT_MAX_CHANNELS][60] {};
+	warps::ShortFrame workDopplerMixFrames[60] {};
+	int workDopplerMixFrom = 0;
+	int workDopplerMixTo = 0;
+	// Channels of the block in outputFrames.
+	int outputChannels = 1;
+	WorkerPool workerPool {[this](int c) {
+		renderChannel(c, workInputFrames[c], workOutputFrames[c]);
+	}};
+
+	// Brickwall limiter with one block of look-ahead on the output of the vocoder mode, instead of the
+	// original peak-following limiter, which overshoots on transients. Both outputs are delayed by a
+	// block. The vocoder of the meta mode keeps the original limiter.
+	bool lookaheadLimiter = false;
+
+	// In the Doppler mode, places each channel as a source around the listener and mixes them into
+	// one stereo output, instead of rendering a Doppler effect per channel. The sources share the
+	// delay memory of dopplerBank. Mode transitions are crossfaded with the per-channel Doppler
+	// effect, and the mix takes over once they are done: it is crossfaded with the channels over
+	// MODE_FADE_BLOCKS blocks, as are the channels when it stops.
+	std::atomic<bool> dopplerMix {false};
+	warps::DopplerBank dopplerBank;
+	// Allocated by the UI thread when the mix is first enabled, before dopplerMix is set, and kept
+	// until the module is deleted.
+	std::atomic<warps::DopplerBankArena*> dopplerArena {nullptr};
+	warps::Parameters dopplerParameters[PORT_MAX_CHANNELS];
+	warps::ShortFrame dopplerMixFrames[60] {};
+	// Position of the crossfade at the start and at the end of the current block, from 0 (the
+	// channels) to MODE_FADE_BLOCKS (the mix).
+	int dopplerMixFrom = 0;
+	int dopplerMixTo = 0;
+
 	// Taken from eurorack\warps\ui.cc
 	const uint8_t algorithm_palette[10][3] = {
 		{ 0, 192, 64 },
@@ -75,75 +151,340 @@ struct Warps : Module {
 
 		configBypass(MODULATOR_INPUT, MODULATOR_OUTPUT);
 
-		memset(&modulator, 0, sizeof(modulator));
-		modulator.Init(96000.0f);
+		modulators = createModulators(mode, 0);
+		publishedModulators.store(modulators);
+		xmodOscillators.Init(96000.0f);
+		vocoderOscillators.Init(96000.0f);
+		dopplerBank.Init(96000.0f, nullptr);
+	}
+
+	~Warps() {
+		// The workers may still be rendering a block.
+		workerPool.stop();
+		delete[] modulators;
+		delete[] incomingModulators;
+		delete[] pendingModulators.exchange(nullptr);
+		collectModulators();
+		delete dopplerArena.load();
+	}
+
+	/** Always PORT_MAX_CHANNELS modulators (about 2 MB), not just the channels in use: the channel
+	count follows the inputs on the audio thread, which cannot allocate, and a channel appearing must
+	find its modulator initialised and in the current mode. Only the channels in use are rendered, so
+	the others cost memory but no time or cache. */
+	static warps::Modulator* createModulators(warps::FeatureMode mode, int shape) {
+		warps::Modulator* modulators = new warps::Modulator[PORT_MAX_CHANNELS]();
+		for (int c = 0; c < PORT_MAX_CHANNELS; c++) {
+			modulators[c].Init(96000.0f);
+			modulators[c].set_feature_mode(mode);
+			modulators[c].mutable_parameters()->carrier_shape = shape;
+		}
+		return modulators;
+	}
+
+	/** Called from the UI thread. Deletes the modulators faded out by the audio thread. */
+	void collectModulators() {
+		delete[] retiredModulators.exchange(nullptr);
+	}
+
+	/** Called from the UI thread. */
+	void setMultithreaded(bool multithreaded) {
+		if (multithreaded && !workerPool.isStarted()) {
+			int numThreads = std::max(1, std::min(4, static_cast<int>(std::thread::hardware_concurrency()) / 2));
+			workerPool.start(numThreads);
+		}
+		this->multithreaded = multithreaded;
+		collectWorkers();
+	}
+
+	/** Called from the UI thread. Stops the workers once the option is off and their last block has
+	been collected. Stopping them earlier would also be safe, as wait() renders the jobs left. */
+	void collectWorkers() {
+		if (!multithreaded && !pipelined && workerPool.isStarted()) {
+			workerPool.stop();
+		}
+	}
+
+	warps::FeatureMode featureMode() {
+		return mode;
+	}
+
+	/** Called from the UI thread. The audio thread crossfades to the new mode. */
+	void setFeatureMode(warps::FeatureMode mode) {
+		collectModulators();
+		if (mode == this->mode)
+			return;
+		this->mode = mode;
+		// Replaces the previous request if the audio thread has not picked it up yet.
+		delete[] pendingModulators.exchange(createModulators(mode, carrierShape()));
+	}
+
+	/** Called from the UI thread. */
+	void setDopplerMix(bool dopplerMix) {
+		if (dopplerMix && !dopplerArena)
+			dopplerArena = new warps::DopplerBankArena;
+		this->dopplerMix = dopplerMix;
 	}
-	
+
+	/** Called from the audio thread. Whether the channels are mixed by dopplerBank for the next block. */
+	bool mixesDoppler() {
+		return dopplerMix && !incomingModulators && modulators[0].feature_mode() == warps::FEATURE_MODE_DOPPLER;
+	}
+
+	/** Called from the audio thread between blocks, when the workers are idle. */
+	void stepDopplerMix() {
+		dopplerMixFrom = dopplerMixTo;
+		if (mixesDoppler()) {
+			// The mix starts from silence, not from where it stopped the last time.
+			if (dopplerMixTo == 0)
+				dopplerBank.Init(96000.0f, dopplerArena);
+			dopplerMixTo = std::min(dopplerMixTo + 1, MODE_FADE_BLOCKS);
+		} else {
+			// The modulators are not rendered under the mix, so their delay memory is stale.
+			if (dopplerMixTo == MODE_FADE_BLOCKS) {
+				for (int c = 0; c < PORT_MAX_CHANNELS; c++) {
+					modulators[c].ClearDelay();
+				}
+			}
+			dopplerMixTo = std::max(dopplerMixTo - 1, 0);
+		}
+	}
+
+	/** Called from the audio thread. */
+	void renderDopplerMix() {
+		const warps::ShortFrame* sources[PORT_MAX_CHANNELS];
+		for (int c = 0; c < channels; c++) {
+			dopplerParameters[c] = modulators[c].parameters();
+			sources[c] = inputFrames[c];
+		}
+		dopplerBank.Process(dopplerParameters, sources, dopplerMixFrames, channels, 60);
+	}
+
+	/** Called from the audio thread. Crossfades the first numChannels channels of outputFrames with
+	the Doppler mix, which is added to the first channel, and returns the number of output channels. */
+	int fadeDopplerMix(int numChannels, const warps::ShortFrame* mix, int from, int to) {
+		if (from == MODE_FADE_BLOCKS && to == MODE_FADE_BLOCKS) {
+			std::copy(mix, mix + 60, outputFrames[0]);
+			return 1;
+		}
+		if (from == 0 && to == 0)
+			return numChannels;
+
+		float position = static_cast<float>(from) / MODE_FADE_BLOCKS;
+		float increment = static_cast<float>(to - from) / (MODE_FADE_BLOCKS * 60);
+		for (int i = 0; i < 60; i++) {
+			float fadeIn = stmlib::Interpolate(warps::lut_xfade_in, position, 256.0f);
+			float fadeOut = stmlib::Interpolate(warps::lut_xfade_out, position, 256.0f);
+			outputFrames[0][i].l = stmlib::Clip16(static_cast<int32_t>(outputFrames[0][i].l * fadeOut + mix[i].l * fadeIn));
+			outputFrames[0][i].r = stmlib::Clip16(static_cast<int32_t>(outputFrames[0][i].r * fadeOut + mix[i].r * fadeIn));
+			for (int c = 1; c < numChannels; c++) {
+				outputFrames[c][i].l = static_cast<int16_t>(outputFrames[c][i].l * fadeOut);
+				outputFrames[c][i].r = static_cast<int16_t>(outputFrames[c][i].r * fadeOut);
+			}
+			position += increment;
+		}
+		return numChannels;
+	}
+
+	int carrierShape() {
+		return shape;
+	}
+
+	/** Called from any thread. The audio thread applies the shape from the next block. */
+	void setCarrierShape(int shape) {
+		this->shape = shape;
+	}
+
+	/** Called from the audio thread, or from the workers. */
+	void renderChannel(int c, warps::ShortFrame* input, warps::ShortFrame* output) {
+		modulators[c].Process(input, output, 60);
+		if (!incomingModulators)
+			return;
+
+		warps::ShortFrame incoming[60];
+		incomingModulators[c].Process(input, incoming, 60);
+		float position = static_cast<float>(fadeBlock) / MODE_FADE_BLOCKS;
+		float increment = 1.0f / (MODE_FADE_BLOCKS * 60);
+		for (int i = 0; i < 60; i++) {
+			float fadeIn = stmlib::Interpolate(warps::lut_xfade_in, position, 256.0f);
+			float fadeOut = stmlib::Interpolate(warps::lut_xfade_out, position, 256.0f);
+			output[i].l = stmlib::Clip16(static_cast<int32_t>(output[i].l * fadeOut + incoming[i].l * fadeIn));
+			output[i].r = stmlib::Clip16(static_cast<int32_t>(output[i].r * fadeOut + incoming[i].r * fadeIn));
+			position += increment;
+		}
+	}
+
+	/** Called from the audio thread between blocks, when the workers are idle. */
+	void renderCarriers() {
+		int shape = modulators[0].parameters().carrier_shape;
+		bool external = channels > 1 && shape != 0;
+		uint8_t oscillators = 0;
+		for (int c = 0; c < channels; c++) {
+			modulators[c].set_external_carrier(external ? &carrierBlocks[c] : NULL);
+			oscillators |= modulators[c].carrier_oscillators();
+			if (incomingModulators) {
+				incomingModulators[c].set_external_carrier(external ? &carrierBlocks[c] : NULL);
+				oscillators |= incomingModulators[c].carrier_oscillators();
+			}
+		}
+		if (!external)
+			return;
+
+		float notes[PORT_MAX_CHANNELS];
+		float* modulation[PORT_MAX_CHANNELS];
+		float* xmod[PORT_MAX_CHANNELS];
+		float* vocoder[PORT_MAX_CHANNELS];
+		float xmodGains[PORT_MAX_CHANNELS];
+		float vocoderGains[PORT_MAX_CHANNELS];
+		for (int c = 0; c < channels; c++) {
+			notes[c] = modulators[c].parameters().note;
+			// Phase modulation by the carrier input, as scaled by the modulators.
+			for (int i = 0; i < 60; i++) {
+				carrierModulation[c][i] = static_cast<float>(inputFrames[c][i].l) / 32768.0f;
+			}
+			modulation[c] = carrierModulation[c];
+			xmod[c] = carrierBlocks[c].xmod;
+			vocoder[c] = carrierBlocks[c].vocoder;
+		}
+		if (oscillators & warps::CARRIER_OSCILLATOR_XMOD) {
+			xmodOscillators.Render(static_cast<warps::OscillatorShape>(shape - 1), notes, modulation, xmod, xmodGains, channels, 60);
+		}
+		if (oscillators & warps::CARRIER_OSCILLATOR_VOCODER) {
+			vocoderOscillators.Render(static_cast<warps::OscillatorShape>(shape + 1), notes, modulation, vocoder, vocoderGains, channels, 60);
+			for (int c = 0; c < channels; c++) {
+				carrierBlocks[c].vocoder_gain = vocoderGains[c];
+			}
+		}
+	}
+
+	/** Called from the audio thread between blocks, when the workers are idle. */
+	void stepModeTransition() {
+		if (incomingModulators && ++fadeBlock >= MODE_FADE_BLOCKS) {
+			publishedModulators.store(incomingModulators);
+			retiredModulators.store(modulators);
+			modulators = incomingModulators;
+			incomingModulators = nullptr;
+		}
+		if (!incomingModulators && !retiredModulators.load()) {
+			incomingModulators = pendingModulators.exchange(nullptr);
+			fadeBlock = 0;
+		}
+	}
+
 	void process(const ProcessArgs& args) override;
 
 	json_t* dataToJson() override {
 		json_t* rootJ = json_object();
-		warps::Parameters* p = modulator.mutable_parameters();
-		json_object_set_new(rootJ, "shape", json_integer(p->carrier_shape));
-		json_object_set_new(rootJ, "mode", json_integer(modulator.feature_mode()));
+		json_object_set_new(rootJ, "shape", json_integer(carrierShape()));
+		json_object_set_new(rootJ, "mode", json_integer(featureMode()));
+		json_object_set_new(rootJ, "multithreaded", json_boolean(multithreaded));
+		json_object_set_new(rootJ, "lookaheadLimiter", json_boolean(lookaheadLimiter));
+		json_object_set_new(rootJ, "dopplerMix", json_boolean(dopplerMix));
 		return rootJ;
 	}
 
 	void dataFromJson(json_t* rootJ) override {
-		warps::Parameters* p = modulator.mutable_parameters();
 		if (json_t* shapeJ = json_object_get(rootJ, "shape")) {
-			p->carrier_shape = json_integer_value(shapeJ);
+			setCarrierShape(json_integer_value(shapeJ));
 		}
 		if (json_t* modeJ = json_object_get(rootJ, "mode")) {
-		  	modulator.set_feature_mode(static_cast<warps::FeatureMode>(json_integer_value(modeJ)));
+			int mode = clamp((int) json_integer_value(modeJ), 0, (int) warps::FEATURE_MODE_META);
+			setFeatureMode(static_cast<warps::FeatureMode>(mode));
+		}
+		if (json_t* multithreadedJ = json_object_get(rootJ, "multithreaded")) {
+			setMultithreaded(json_boolean_value(multithreadedJ));
+		}
+		if (json_t* lookaheadLimiterJ = json_object_get(rootJ, "lookaheadLimiter")) {
+			lookaheadLimiter = json_boolean_value(lookaheadLimiterJ);
+		}
+		if (json_t* dopplerMixJ = json_object_get(rootJ, "dopplerMix")) {
+			setDopplerMix(json_boolean_value(dopplerMixJ));
 		}
 	}
 
 	void onReset() override {
-		warps::Parameters* p = modulator.mutable_parameters();
-		p->carrier_shape = 0;
-		modulator.set_feature_mode(warps::FEATURE_MODE_META);
+		setCarrierShape(0);
+		setDopplerMix(false);
+		setFeatureMode(warps::FEATURE_MODE_META);
 	}
 
 	void onRandomize() override {
-		warps::Parameters* p = modulator.mutable_parameters();
-		p->carrier_shape = random::u32() % 4;
+		setCarrierShape(random::u32() % 4);
 	}
 };
 
 void Warps::process(const ProcessArgs& args) {
 	// State trigger
-	warps::Parameters* p = modulator.mutable_parameters();
 	if (stateTrigger.process(params[STATE_PARAM].getValue())) {
-		p->carrier_shape = (p->carrier_shape + 1) % 4;
+		setCarrierShape((carrierShape() + 1) % 4);
 	}
-	lights[CARRIER_GREEN_LIGHT].setBrightness((p->carrier_shape == 1 || p->carrier_shape == 2) ? 1.0 : 0.0);
-	lights[CARRIER_RED_LIGHT].setBrightness((p->carrier_shape == 2 || p->carrier_shape == 3) ? 1.0 : 0.0);
+	int shape = carrierShape();
+	lights[CARRIER_GREEN_LIGHT].setBrightness((shape == 1 || shape == 2) ? 1.0 : 0.0);
+	lights[CARRIER_RED_LIGHT].setBrightness((shape == 2 || shape == 3) ? 1.0 : 0.0);
 
 	// Buffer loop
 	if (++frame >= 60) {
 		frame = 0;
 
-		// Normal Warps' level inputs to 5v and make pots attenuate to match hardware and manual
-		// https://github.com/VCVRack/AudibleInstruments/pull/107
-		p->channel_drive[0] = clamp(params[LEVEL1_PARAM].getValue() * inputs[LEVEL1_INPUT].getNormalVoltage(5.0f) / 5.0f, 0.0f, 1.0f);
-		p->channel_drive[1] = clamp(params[LEVEL2_PARAM].getValue() * inputs[LEVEL2_INPUT].getNormalVoltage(5.0f) / 5.0f, 0.0f, 1.0f);
+		// The workers must be done with the modulators before their parameters change.
+		if (pipelined) {
+			workerPool.wait();
+			pipelined = false;
+		}
+		if (workPending) {
+			for (int c = 0; c < workChannels; c++) {
+				std::copy(workOutputFrames[c], workOutputFrames[c] + 60, outputFrames[c]);
+			}
+			outputChannels = fadeDopplerMix(workChannels, workDopplerMixFrames, workDopplerMixFrom, workDopplerMixTo);
+			workPending = false;
+		}
+
+		stepModeTransition();
+		stepDopplerMix();
+
+		for (int c = 0; c < channels; c++) {
+			warps::Parameters* p = modulators[c].mutable_parameters();
+			p->carrier_shape = shape;
+
+			// Normal Warps' level inputs to 5v and make pots attenuate to match hardware and manual
+			// https://github.com/VCVRack/AudibleInstruments/pull/107
+			p->channel_drive[0] = clamp(params[LEVEL1_PARAM].getValue() * inputs[LEVEL1_INPUT].getNormalPolyVoltage(5.0f, c) / 5.0f, 0.0f, 1.0f);
+			p->channel_drive[1] = clamp(params[LEVEL2_PARAM].getValue() * inputs[LEVEL2_INPUT].getNormalPolyVoltage(5.0f, c) / 5.0f, 0.0f, 1.0f);
+
+			p->modulation_algorithm = clamp(params[ALGORITHM_PARAM].getValue() / 8.0 + inputs[ALGORITHM_INPUT].getPolyVoltage(c) / 5.0f, 0.0f, 1.0f);
+			p->raw_level[0] = clamp(params[LEVEL1_PARAM].getValue(), 0.0f, 1.0f);
+			p->raw_level[1] = clamp(params[LEVEL2_PARAM].getValue(), 0.0f, 1.0f);
 
-		p->modulation_algorithm = clamp(params[ALGORITHM_PARAM].getValue() / 8.0 + inputs[ALGORITHM_INPUT].getVoltage() / 5.0f, 0.0f, 1.0f);
-		p->raw_level[0] = clamp(params[LEVEL1_PARAM].getValue(), 0.0f, 1.0f);
-		p->raw_level[1] = clamp(params[LEVEL2_PARAM].getValue(), 0.0f, 1.0f);
+			//p->raw_algorithm_pot = clampf(params[ALGORITHM_PARAM].getValue() /8.0, 0.0, 1.0);
+			float val = clamp(params[ALGORITHM_PARAM].getValue() / 8.0f, 0.0f, 1.0f);
+			val = stmlib::Interpolate(warps::lut_pot_curve, val, 512.0f);
+			p->raw_algorithm_pot = val;
 
-		//p->raw_algorithm_pot = clampf(params[ALGORITHM_PARAM].getValue() /8.0, 0.0, 1.0);
-		float val = clamp(params[ALGORITHM_PARAM].getValue() / 8.0f, 0.0f, 1.0f);
-		val = stmlib::Interpolate(warps::lut_pot_curve, val, 512.0f);
-		p->raw_algorithm_pot = val;
+			p->raw_algorithm_cv = clamp(inputs[ALGORITHM_INPUT].getPolyVoltage(c) / 5.0f, -1.0f, 1.0f);
+			//According to the cv-scaler this does not seem to use the plot curve
+			p->raw_algorithm = clamp(params[ALGORITHM_PARAM].getValue() / 8.0f + inputs[ALGORITHM_INPUT].getPolyVoltage(c) /5.0f, 0.0f, 1.0f);
+
+			p->modulation_parameter = clamp(params[TIMBRE_PARAM].getValue() + inputs[TIMBRE_INPUT].getPolyVoltage(c) / 5.0f, 0.0f, 1.0f);
+
+			// p->frequency_shift_pot = params[ALGORITHM_PARAM].getValue() / 8.0;
+			// p->frequency_shift_cv = clampf(inputs[ALGORITHM_INPUT].getVoltage() / 5.0, -1.0, 1.0);
+			// p->phase_shift = p->modulation_algorithm;
+
+			// level 1 pot still operates additively with level 1 cv for controlling the frequency of the internal oscillator
+			p->note = 60.0 * params[LEVEL1_PARAM].getValue() + 12.0 * inputs[LEVEL1_INPUT].getNormalPolyVoltage(2.0, c) + 12.0;
+			p->note += log2f(96000.0 / args.sampleRate) * 12.0;
+
+			modulators[c].set_lookahead_limiter(lookaheadLimiter);
+
+			if (incomingModulators) {
+				*incomingModulators[c].mutable_parameters() = *p;
+				incomingModulators[c].set_lookahead_limiter(lookaheadLimiter);
+			}
+		}
 
-		p->raw_algorithm_cv = clamp(inputs[ALGORITHM_INPUT].getVoltage() / 5.0f, -1.0f, 1.0f);
-		//According to the cv-scaler this does not seem to use the plot curve
-		p->raw_algorithm = clamp(params[ALGORITHM_PARAM].getValue() / 8.0f + inputs[ALGORITHM_INPUT].getVoltage() /5.0f, 0.0f, 1.0f);
 		{
 			// Taken from eurorack\warps\ui.cc
-			float zone = 8.0f * p->modulation_algorithm;
+			float zone = 8.0f * modulators[0].parameters().modulation_algorithm;
             MAKE_INTEGRAL_FRACTIONAL(zone);
             int zone_fractional_i = static_cast<int>(zone_fractional * 256.0f);
             for (int i = 0; i < 3; i++) {
@@ -153,27 +494,54 @@ void Warps::process(const ProcessArgs& args) {
             }
 		}
 
-		p->modulation_parameter = clamp(params[TIMBRE_PARAM].getValue() + inputs[TIMBRE_INPUT].getVoltage() / 5.0f, 0.0f, 1.0f);
-
-		// p->frequency_shift_pot = params[ALGORITHM_PARAM].getValue() / 8.0;
-		// p->frequency_shift_cv = clampf(inputs[ALGORITHM_INPUT].getVoltage() / 5.0, -1.0, 1.0);
-		// p->phase_shift = p->modulation_algorithm;
+		renderCarriers();
 
-		// level 1 pot still operates additively with level 1 cv for controlling the frequency of the internal oscillator
-		p->note = 60.0 * params[LEVEL1_PARAM].getValue() + 12.0 * inputs[LEVEL1_INPUT].getNormalVoltage(2.0) + 12.0;
-		p->note += log2f(96000.0 / args.sampleRate) * 12.0;
+		// Under the mix, the channels are only rendered while they are crossfaded with it.
+		if (dopplerMixFrom > 0 || dopplerMixTo > 0) {
+			renderDopplerMix();
+		}
+		int renderChannels = (dopplerMixFrom < MODE_FADE_BLOCKS || dopplerMixTo < MODE_FADE_BLOCKS) ? channels : 0;
+		if (multithreaded && channels > 1) {
+			for (int c = 0; c < renderChannels; c++) {
+				std::copy(inputFrames[c], inputFrames[c] + 60, workInputFrames[c]);
+			}
+			std::copy(dopplerMixFrames, dopplerMixFrames + 60, workDopplerMixFrames);
+			workDopplerMixFrom = dopplerMixFrom;
+			workDopplerMixTo = dopplerMixTo;
+			workChannels = renderChannels;
+			if (renderChannels > 0) {
+				workerPool.dispatch(renderChannels);
+				pipelined = true;
+			}
+			workPending = true;
+		} else {
+			for (int c = 0; c < renderChannels; c++) {
+				renderChannel(c, inputFrames[c], outputFrames[c]);
+			}
+			outputChannels = fadeDopplerMix(renderChannels, dopplerMixFrames, dopplerMixFrom, dopplerMixTo);
+		}
 
-		modulator.Process(inputFrames, outputFrames, 60);
+		channels = std::max(1, std::max(inputs[CARRIER_INPUT].getChannels(), inputs[MODULATOR_INPUT].getChannels()));
+		outputs[MODULATOR_OUTPUT].setChannels(outputChannels);
+		outputs[AUX_OUTPUT].setChannels(outputChannels);
 	}
 
-	inputFrames[frame].l = clamp(static_cast<int>((inputs[CARRIER_INPUT].getVoltage() / 16.0 * 0x8000)), -0x8000, 0x7fff);
-	inputFrames[frame].r = clamp(static_cast<int>((inputs[MODULATOR_INPUT].getVoltage() / 16.0 * 0x8000)), -0x8000, 0x7fff);
-	outputs[MODULATOR_OUTPUT].setVoltage(static_cast<float>(outputFrames[frame].l) / 0x8000 * 5.0);
-	outputs[AUX_OUTPUT].setVoltage(static_cast<float>(outputFrames[frame].r) / 0x8000 * 5.0);
+	for (int c = 0; c < channels; c++) {
+		inputFrames[c][frame].l = clamp(static_cast<int>((inputs[CARRIER_INPUT].getPolyVoltage(c) / 16.0 * 0x8000)), -0x8000, 0x7fff);
+		inputFrames[c][frame].r = clamp(static_cast<int>((inputs[MODULATOR_INPUT].getPolyVoltage(c) / 16.0 * 0x8000)), -0x8000, 0x7fff);
+	}
+	for (int c = 0; c < outputChannels; c++) {
+		outputs[MODULATOR_OUTPUT].setVoltage(static_cast<float>(outputFrames[c][frame].l) / 0x8000 * 5.0, c);
+		outputs[AUX_OUTPUT].setVoltage(static_cast<float>(outputFrames[c][frame].r) / 0x8000 * 5.0, c);
+	}
 }
 
 
 struct WarpsWidget : ModuleWidget {
+#ifdef WARPS_PROFILE
+	warps::ProfilerStatistics profilerStatistics;
+#endif
+
 	WarpsWidget(Warps* module) {
 		setModule(module);
 		setPanel(createPanel(asset::plugin(pluginInstance, "res/Wasp.svg")));
@@ -201,8 +569,49 @@ struct WarpsWidget : ModuleWidget {
 
 		addChild(createLight<SmallLight<GreenRedLight>>(Vec(21, 169), module, Warps::CARRIER_GREEN_LIGHT));
 		addChild(createLightCentered<Rogan6PSLight<RedGreenBlueLight>>(Vec(73.556641, 96.560532), module, Warps::ALGORITHM_LIGHT));
+
+#ifdef WARPS_PROFILE
+		profilerStatistics.Init();
+#endif
 	}
 
+	void step() override {
+		Warps* module = dynamic_cast<Warps*>(this->module);
+		if (module) {
+#ifdef WARPS_PROFILE
+			warps::ProfilerBlock block;
+			warps::Modulator* modulators = module->publishedModulators.load();
+			while (modulators[0].mutable_profiler()->Pop(&block)) {
+				profilerStatistics.Accumulate(block);
+			}
+#endif
+			module->collectModulators();
+			module->collectWorkers();
+		}
+		ModuleWidget::step();
+	}
+
+#ifdef WARPS_PROFILE
+	void appendProfilerMenu(Menu* menu, warps::FeatureMode mode) {
+		static const char* stageNames[warps::PROFILER_STAGE_LAST] = {
+			"Amplifier", "Oscillator", "Upsampler", "Cross-modulation", "Downsampler", "Vocoder", "Other"
+		};
+		float total = profilerStatistics.total_ticks_per_sample(mode);
+
+		menu->addChild(new MenuSeparator);
+		menu->addChild(createMenuLabel(string::f("CPU: %.1f %s/sample", total, warps::Profiler::tick_unit())));
+		if (!profilerStatistics.num_blocks(mode)) {
+			return;
+		}
+		for (int i = 0; i < warps::PROFILER_STAGE_LAST; i++) {
+			float ticks = profilerStatistics.ticks_per_sample(mode, static_cast<warps::ProfilerStage>(i));
+			if (ticks > 0.0f) {
+				menu->addChild(createMenuLabel(string::f("%s: %.1f (%.0f%%)", stageNames[i], ticks, 100.0f * ticks / total)));
+			}
+		}
+	}
+#endif
+
 	void appendContextMenu(Menu* menu) override {
 		Warps* module = dynamic_cast<Warps*>(this->module);
 		assert(module);
@@ -214,23 +623,42 @@ struct WarpsWidget : ModuleWidget {
 		struct ModeNameAndId {
 			std::string name;
 			warps::FeatureMode fmode;
+			bool dopplerMix;
 		};
 		static const std::vector<ModeNameAndId> modeLabels = {
-			{"Binaural Doppler [1 instance]", 	warps::FEATURE_MODE_DOPPLER},
-			{"Wavefolder", 						warps::FEATURE_MODE_FOLD},
-			{"Chebyschev (waveshaper)", 		warps::FEATURE_MODE_CHEBYSCHEV},
-			{"Frequency Shifter (easter egg)", 	warps::FEATURE_MODE_FREQUENCY_SHIFTER},
-			{"Dual Bitcrusher", 				warps::FEATURE_MODE_BITCRUSHER},
-			{"Comparator + Chebyschev", 		warps::FEATURE_MODE_COMPARATOR},
-			{"Vocoder", 						warps::FEATURE_MODE_VOCODER},
-			{"Meta (main function)", 			warps::FEATURE_MODE_META}
+			{"Binaural Doppler", 				warps::FEATURE_MODE_DOPPLER, false},
+			{"Binaural Doppler [mix of sources]", warps::FEATURE_MODE_DOPPLER, true},
+			{"Wavefolder", 						warps::FEATURE_MODE_FOLD, false},
+			{"Chebyschev (waveshaper)", 		warps::FEATURE_MODE_CHEBYSCHEV, false},
+			{"Frequency Shifter (easter egg)", 	warps::FEATURE_MODE_FREQUENCY_SHIFTER, false},
+			{"Dual Bitcrusher", 				warps::FEATURE_MODE_BITCRUSHER, false},
+			{"Comparator + Chebyschev", 		warps::FEATURE_MODE_COMPARATOR, false},
+			{"Vocoder", 						warps::FEATURE_MODE_VOCODER, false},
+			{"Meta (main function)", 			warps::FEATURE_MODE_META, false}
 		};
 		for (const auto &modeLabel : modeLabels) {
 			menu->addChild(createCheckMenuItem(modeLabel.name, "",
-				[=]() {return module->modulator.feature_mode() == modeLabel.fmode;},
-				[=]() {module->modulator.set_feature_mode(modeLabel.fmode);}
+				[=]() {
+					return module->featureMode() == modeLabel.fmode &&
+						(modeLabel.fmode != warps::FEATURE_MODE_DOPPLER || module->dopplerMix == modeLabel.dopplerMix);
+				},
+				[=]() {
+					module->setDopplerMix(modeLabel.dopplerMix);
+					module->setFeatureMode(modeLabel.fmode);
+				}
 			));
 		}
+
+		menu->addChild(new MenuSeparator);
+		menu->addChild(createBoolMenuItem("Render channels on worker threads", "",
+			[=]() {return module->multithreaded.load();},
+			[=](bool multithreaded) {module->setMultithreaded(multithreaded);}
+		));
+		menu->addChild(createBoolPtrMenuItem("Look-ahead limiter in vocoder mode", "", &module->lookaheadLimiter));
+
+#ifdef WARPS_PROFILE
+		appendProfilerMenu(menu, module->featureMode());
+#endif
 	}
 };
 
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/** Runs the jobs of a block (typically one per polyphony channel) on worker threads.
+
+The audio thread publishes a block with dispatch(), and collects it with wait() before publishing
+the next one, so that the workers have a whole block period to process it. Jobs are claimed by
+compare-and-swap on a single ticket holding the block generation, the number of jobs of the block
+and the next job index, so that a claim can only succeed against the block it was read from. The
+mutex only guards the sleeping and waking of threads and is never held while a job runs. wait()
+also claims the jobs that no worker has claimed yet, which lets the pool work without any thread
+at all. It then sleeps until the jobs claimed by workers are done, so a worker preempted in the
+middle of a job delays it.
+*/
+struct WorkerPool {
+	/** `job` is called with the index of the job, from the worker threads and from wait(). */
+	WorkerPool(std::function<void(int)> job) : job(job) {}
+
+	~WorkerPool() {
+		stop();
+	}
+
+	/** Called from the UI thread. */
+	void start(int numThreads) {
+		stop();
+		running = true;
+		for (int i = 0; i < numThreads; i++) {
+			threads.push_back(std::thread([this]() {
+				run();
+			}));
+		}
+	}
+
+	void stop() {
+		if (threads.empty())
+			return;
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			running = false;
+		}
+		cv.notify_all();
+		for (std::thread& thread : threads) {
+			thread.join();
+		}
+		threads.clear();
+	}
+
+	bool isStarted() const {
+		return !threads.empty();
+	}
+
+	/** Called from the audio thread, once the data of the jobs is ready. At most 255 jobs. */
+	void dispatch(int numJobs) {
+		remaining.store(numJobs, std::memory_order_relaxed);
+		uint32_t generation = (ticket.load(std::memory_order_relaxed) >> 16) + 1;
+		// Published under the lock, so that a worker between its check of the ticket and its wait
+		// cannot miss the notification.
+		std::lock_guard<std::mutex> lock(mutex);
+		ticket.store(generation << 16 | static_cast<uint32_t>(numJobs) << 8, std::memory_order_release);
+		cv.notify_all();
+	}
+
+	/** Called from the audio thread. Returns when all the jobs of the last dispatch are done. */
+	void wait() {
+		uint32_t generation = ticket.load(std::memory_order_acquire) >> 16;
+		work(generation);
+		if (remaining.load(std::memory_order_acquire) == 0)
+			return;
+		std::unique_lock<std::mutex> lock(mutex);
+		doneCv.wait(lock, [this]() {
+			return remaining.load(std::memory_order_acquire) == 0;
+		});
+	}
+
+private:
+	void run() {
+		uint32_t done = ticket.load(std::memory_order_acquire) >> 16;
+		while (true) {
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				cv.wait(lock, [&]() {
+					return !running || (ticket.load(std::memory_order_acquire) >> 16) != done;
+				});
+				if (!running)
+					break;
+			}
+			done = ticket.load(std::memory_order_acquire) >> 16;
+			work(done);
+		}
+	}
+
+	void work(uint32_t generation) {
+		uint32_t t = ticket.load(std::memory_order_acquire);
+		// The count is read from the same word as the index, so a ticket read before a dispatch
+		// fails its compare-and-swap instead of claiming a job of the next block.
+		while ((t >> 16) == generation && (t & 0xff) < ((t >> 8) & 0xff)) {
+			if (ticket.compare_exchange_weak(t, t + 1, std::memory_order_acq_rel)) {
+				job(t & 0xff);
+				if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+					// Under the lock, so that wait() cannot check remaining and then miss this.
+					std::lock_guard<std::mutex> lock(mutex);
+					doneCv.notify_one();
+				}
+				t = ticket.load(std::memory_order_acquire);
+			}
+		}
+	}
+
+	std::function<void(int)> job;
+	std::vector<std::thread> threads;
+	std::mutex mutex;
+	// Wakes the workers when a block is dispatched or the pool stops.
+	std::condition_variable cv;
+	// Wakes wait() when the last job of the block is done.
+	std::condition_variable doneCv;
+	bool running = false;
+
+	// Block generation in the upper 16 bits, number of jobs of the block in the next 8, and index
+	// of the next job to claim in the lower 8. The generation wraps around, which is harmless: a
+	// claim only succeeds against the current ticket, so the job it gets is one of the current block.
+	std::atomic<uint32_t> ticket{0};
+	std::atomic<int> remaining{0};
+};